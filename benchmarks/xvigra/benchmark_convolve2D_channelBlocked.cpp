@@ -0,0 +1,130 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <iostream>
+
+#include "xtensor/xtensor.hpp"
+#include "xtensor/xrandom.hpp"
+
+#include "xvigra/convolution_util.hpp"
+#include "xvigra/explicit_convolution.hpp"
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ define - begin                                                                                                   ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+#define INPUT_SIZE 128
+#define KERNEL_SIZE 3
+#define CHANNELS_MIN 8
+#define CHANNELS_MAX 64
+#define CHANNELS_STEP 8
+
+
+#define BENCHMARK_SINGLE_VERSION(name)                                        \
+    BENCHMARK_TEMPLATE(name, float)                                           \
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {   \
+        return *(std::min_element(std::begin(v), std::end(v)));               \
+      })                                                                      \
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {   \
+        return *(std::max_element(std::begin(v), std::end(v)));               \
+      })                                                                      \
+    ->DenseRange(CHANNELS_MIN, CHANNELS_MAX, CHANNELS_STEP)                   \
+    ->Unit(benchmark::kMillisecond)
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ define - end                                                                                                     ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ benchmark channel layout - begin                                                                                 ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+// the direct convolution of the plain layouts is compared with the channel blocked kernel, all with C in and C out
+template <typename ElementType>
+void runPlainLayout(benchmark::State& state, xvigra::ChannelPosition channelPosition) {
+	int channels = static_cast<int>(state.range(0));
+	bool isChannelFirst = channelPosition == xvigra::ChannelPosition::FIRST;
+
+	std::array<int, 3> inputShape = isChannelFirst
+		? std::array<int, 3>{channels, INPUT_SIZE, INPUT_SIZE}
+		: std::array<int, 3>{INPUT_SIZE, INPUT_SIZE, channels};
+	std::array<int, 4> kernelShape{channels, channels, KERNEL_SIZE, KERNEL_SIZE};
+
+	xvigra::KernelOptions2D options2D;
+	options2D.setPadding(KERNEL_SIZE / 2);
+	options2D.setChannelPosition(channelPosition);
+	options2D.setAlgorithm(xvigra::Algorithm::DIRECT);
+
+	xt::xtensor<ElementType, 3> input = xt::random::rand<ElementType>(inputShape);
+	xt::xtensor<ElementType, 4> kernel = xt::random::rand<ElementType>(kernelShape);
+
+	for (auto _ : state) {
+		 auto result = xvigra::convolve2D(
+		 	input, 
+		 	kernel, 
+		 	options2D
+		 );
+		 benchmark::DoNotOptimize(result.data());
+	}
+}
+
+
+template <typename ElementType>
+void benchmark_convolve2D_channelBlocked_channelFirst(benchmark::State& state) {
+	runPlainLayout<ElementType>(state, xvigra::ChannelPosition::FIRST);
+}
+
+
+template <typename ElementType>
+void benchmark_convolve2D_channelBlocked_channelLast(benchmark::State& state) {
+	runPlainLayout<ElementType>(state, xvigra::ChannelPosition::LAST);
+}
+
+
+template <typename ElementType>
+void benchmark_convolve2D_channelBlocked_blocked(benchmark::State& state) {
+	int channels = static_cast<int>(state.range(0));
+
+	std::array<int, 3> inputShape{channels, INPUT_SIZE, INPUT_SIZE};
+	std::array<int, 4> kernelShape{channels, channels, KERNEL_SIZE, KERNEL_SIZE};
+
+	xvigra::KernelOptions2D options2D;
+	options2D.setPadding(KERNEL_SIZE / 2);
+	options2D.setChannelPosition(xvigra::ChannelPosition::BLOCKED);
+
+	xt::xtensor<ElementType, 3> plainInput = xt::random::rand<ElementType>(inputShape);
+	xt::xtensor<ElementType, 4> input = xvigra::toChannelBlocked(plainInput, xvigra::ChannelPosition::FIRST);
+	xt::xtensor<ElementType, 4> kernel = xt::random::rand<ElementType>(kernelShape);
+
+	for (auto _ : state) {
+		 auto result = xvigra::convolve2DBlocked(
+		 	input, 
+		 	kernel, 
+		 	options2D
+		 );
+		 benchmark::DoNotOptimize(result.data());
+	}
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ benchmark channel layout - end                                                                                   ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ run benchmarks - begin                                                                                           ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+BENCHMARK_SINGLE_VERSION(benchmark_convolve2D_channelBlocked_channelFirst);
+BENCHMARK_SINGLE_VERSION(benchmark_convolve2D_channelBlocked_channelLast);
+BENCHMARK_SINGLE_VERSION(benchmark_convolve2D_channelBlocked_blocked);
+
+
+BENCHMARK_MAIN();
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ run benchmarks - end                                                                                             ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
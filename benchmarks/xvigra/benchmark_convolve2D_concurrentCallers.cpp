@@ -0,0 +1,116 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <iostream>
+
+#include "xtensor/xtensor.hpp"
+#include "xtensor/xrandom.hpp"
+
+#include "xvigra/explicit_convolution.hpp"
+#include "xvigra/thread_util.hpp"
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ define - begin                                                                                                   ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+#define INPUT_SIZE 256
+#define INPUT_CHANNELS 16
+#define OUTPUT_CHANNELS 32
+#define KERNEL_SIZE 3
+
+
+// every benchmark thread is a caller which runs its own convolutions with a budget of all hardware threads; the
+// throughput is reported as convolutions per second of wall clock time
+#define BENCHMARK_SINGLE_VERSION(name)                                        \
+    BENCHMARK_TEMPLATE(name, float)                                           \
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {   \
+        return *(std::min_element(std::begin(v), std::end(v)));               \
+      })                                                                      \
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {   \
+        return *(std::max_element(std::begin(v), std::end(v)));               \
+      })                                                                      \
+    ->Threads(1)                                                              \
+    ->Threads(4)                                                              \
+    ->Threads(16)                                                             \
+    ->UseRealTime()                                                           \
+    ->Unit(benchmark::kMillisecond)
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ define - end                                                                                                     ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ benchmark concurrent callers - begin                                                                             ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+template <typename ElementType>
+void runConcurrentCaller(benchmark::State& state, xvigra::ThreadingMode threadingMode) {
+	std::array<int, 3> inputShape{INPUT_CHANNELS, INPUT_SIZE, INPUT_SIZE};
+	std::array<int, 4> kernelShape{OUTPUT_CHANNELS, INPUT_CHANNELS, KERNEL_SIZE, KERNEL_SIZE};
+
+	xvigra::KernelOptions2D options2D;
+	options2D.setPadding(KERNEL_SIZE / 2);
+	options2D.setChannelPosition(xvigra::ChannelPosition::FIRST);
+	options2D.setAlgorithm(xvigra::Algorithm::GEMM);
+	options2D.setThreadCount(0);
+
+	xt::xtensor<ElementType, 3> input = xt::random::rand<ElementType>(inputShape);
+	xt::xtensor<ElementType, 4> kernel = xt::random::rand<ElementType>(kernelShape);
+
+	xvigra::setThreadingMode(threadingMode);
+
+	// the callers mark themselves as parallel regions, which only SINGLE_IN_PARALLEL takes into account
+	xvigra::ParallelRegion region;
+
+	for (auto _ : state) {
+		 auto result = xvigra::convolve2D(
+		 	input, 
+		 	kernel, 
+		 	options2D
+		 );
+		 benchmark::DoNotOptimize(result.data());
+	}
+
+	state.SetItemsProcessed(state.iterations());
+}
+
+
+template <typename ElementType>
+void benchmark_convolve2D_concurrentCallers_unmanaged(benchmark::State& state) {
+	runConcurrentCaller<ElementType>(state, xvigra::ThreadingMode::UNMANAGED);
+}
+
+
+template <typename ElementType>
+void benchmark_convolve2D_concurrentCallers_budget(benchmark::State& state) {
+	runConcurrentCaller<ElementType>(state, xvigra::ThreadingMode::BUDGET);
+}
+
+
+template <typename ElementType>
+void benchmark_convolve2D_concurrentCallers_singleInParallel(benchmark::State& state) {
+	runConcurrentCaller<ElementType>(state, xvigra::ThreadingMode::SINGLE_IN_PARALLEL);
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ benchmark concurrent callers - end                                                                               ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ run benchmarks - begin                                                                                           ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+BENCHMARK_SINGLE_VERSION(benchmark_convolve2D_concurrentCallers_unmanaged);
+BENCHMARK_SINGLE_VERSION(benchmark_convolve2D_concurrentCallers_budget);
+BENCHMARK_SINGLE_VERSION(benchmark_convolve2D_concurrentCallers_singleInParallel);
+
+
+BENCHMARK_MAIN();
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ run benchmarks - end                                                                                             ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
@@ -6,6 +6,7 @@
 #include "xtensor/xtensor.hpp"
 #include "xtensor/xrandom.hpp"
 
+#include "xvigra/explicit_convolution.hpp"
 #include "xvigra_legacy/explicit_convolution.hpp"
 
 // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
@@ -257,6 +258,103 @@ void benchmark_convolve2D_v5_inputSize_channelLast(benchmark::State& state) {
 // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
 
 
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ benchmark xvigra algorithms - begin                                                                              ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+template <typename ElementType>
+void benchmark_convolve2D_gemm_inputSize_channelLast(benchmark::State& state) {
+	int inputHeight = static_cast<int>(state.range(0) + 1);
+	int inputWidth = static_cast<int>(state.range(0) - 1);
+	int inputChannels = 3;
+	int kernelHeight = 8;
+	int kernelWidth = 7;
+	
+	std::array<int, 3> inputShape{inputHeight, inputWidth, inputChannels};
+	std::array<int, 4> kernelShape{inputChannels, inputChannels, kernelHeight, kernelWidth};
+
+	int padding = 3;
+	int stride = 4;
+	int dilation = 2;
+
+	xvigra::KernelOptions2D options2D;
+	options2D.setPadding(padding - 1, padding + 1);
+	options2D.setStride(stride + 1, stride - 1);
+	options2D.setDilation(dilation - 1, dilation + 1);
+	options2D.setChannelPosition(xvigra::ChannelPosition::LAST);   
+	options2D.setAlgorithm(xvigra::Algorithm::GEMM);
+
+	xt::xtensor<ElementType, 3> input;
+	xt::xtensor<ElementType, 4> kernel;
+	
+	if constexpr (std::is_floating_point<ElementType>::value) {
+		input = xt::random::rand<ElementType>(inputShape);
+		kernel = xt::random::rand<ElementType>(kernelShape);
+	} else {
+		input = xt::random::randint<ElementType>(inputShape);
+		kernel = xt::random::randint<ElementType>(kernelShape);
+	}
+	
+	for (auto _ : state) {
+		 auto result = xvigra::convolve2D(
+		 	input, 
+		 	kernel, 
+		 	options2D
+		 );
+		 benchmark::DoNotOptimize(result.data());
+	}
+}
+
+
+template <typename ElementType>
+void benchmark_convolve2D_direct_inputSize_channelLast(benchmark::State& state) {
+	int inputHeight = static_cast<int>(state.range(0) + 1);
+	int inputWidth = static_cast<int>(state.range(0) - 1);
+	int inputChannels = 3;
+	int kernelHeight = 8;
+	int kernelWidth = 7;
+	
+	std::array<int, 3> inputShape{inputHeight, inputWidth, inputChannels};
+	std::array<int, 4> kernelShape{inputChannels, inputChannels, kernelHeight, kernelWidth};
+
+	int padding = 3;
+	int stride = 4;
+	int dilation = 2;
+
+	xvigra::KernelOptions2D options2D;
+	options2D.setPadding(padding - 1, padding + 1);
+	options2D.setStride(stride + 1, stride - 1);
+	options2D.setDilation(dilation - 1, dilation + 1);
+	options2D.setChannelPosition(xvigra::ChannelPosition::LAST);   
+	options2D.setAlgorithm(xvigra::Algorithm::DIRECT);
+
+	xt::xtensor<ElementType, 3> input;
+	xt::xtensor<ElementType, 4> kernel;
+	
+	if constexpr (std::is_floating_point<ElementType>::value) {
+		input = xt::random::rand<ElementType>(inputShape);
+		kernel = xt::random::rand<ElementType>(kernelShape);
+	} else {
+		input = xt::random::randint<ElementType>(inputShape);
+		kernel = xt::random::randint<ElementType>(kernelShape);
+	}
+	
+	for (auto _ : state) {
+		 auto result = xvigra::convolve2D(
+		 	input, 
+		 	kernel, 
+		 	options2D
+		 );
+		 benchmark::DoNotOptimize(result.data());
+	}
+}
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ benchmark xvigra algorithms - end                                                                                ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
 // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
 // ║ run benchmarks - begin                                                                                           ║
 // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
@@ -266,6 +364,8 @@ BENCHMARK_SINGLE_VERSION(benchmark_convolve2D_v2_inputSize_channelLast);
 BENCHMARK_SINGLE_VERSION(benchmark_convolve2D_v3_inputSize_channelLast);
 BENCHMARK_SINGLE_VERSION(benchmark_convolve2D_v4_inputSize_channelLast);
 BENCHMARK_SINGLE_VERSION(benchmark_convolve2D_v5_inputSize_channelLast);
+BENCHMARK_SINGLE_VERSION(benchmark_convolve2D_gemm_inputSize_channelLast);
+BENCHMARK_SINGLE_VERSION(benchmark_convolve2D_direct_inputSize_channelLast);
 
 
 BENCHMARK_MAIN();
@@ -0,0 +1,115 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <iostream>
+
+#include "xtensor/xtensor.hpp"
+#include "xtensor/xrandom.hpp"
+
+#include "xvigra/convolution_util.hpp"
+#include "xvigra/explicit_convolution.hpp"
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ define - begin                                                                                                   ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+#define INPUT_SIZE 256
+#define CHANNELS_MIN 8
+#define CHANNELS_MAX 64
+#define CHANNELS_STEP 8
+
+
+#define BENCHMARK_SINGLE_VERSION(name)                                        \
+    BENCHMARK_TEMPLATE(name, float)                                           \
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {   \
+        return *(std::min_element(std::begin(v), std::end(v)));               \
+      })                                                                      \
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {   \
+        return *(std::max_element(std::begin(v), std::end(v)));               \
+      })                                                                      \
+    ->DenseRange(CHANNELS_MIN, CHANNELS_MAX, CHANNELS_STEP)                   \
+    ->Unit(benchmark::kMillisecond)
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ define - end                                                                                                     ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ benchmark pointwise kernel - begin                                                                               ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+// 1x1 channel mixing with C in and C out; GEMM multiplies the input in place, DIRECT accumulates every channel pair
+template <typename ElementType>
+void runPointwiseKernel(benchmark::State& state, xvigra::ChannelPosition channelPosition, xvigra::Algorithm algorithm) {
+	int channels = static_cast<int>(state.range(0));
+	bool isChannelFirst = channelPosition == xvigra::ChannelPosition::FIRST;
+
+	std::array<int, 3> inputShape = isChannelFirst
+		? std::array<int, 3>{channels, INPUT_SIZE, INPUT_SIZE}
+		: std::array<int, 3>{INPUT_SIZE, INPUT_SIZE, channels};
+	std::array<int, 4> kernelShape{channels, channels, 1, 1};
+
+	xvigra::KernelOptions2D options2D;
+	options2D.setChannelPosition(channelPosition);
+	options2D.setAlgorithm(algorithm);
+
+	xt::xtensor<ElementType, 3> input = xt::random::rand<ElementType>(inputShape);
+	xt::xtensor<ElementType, 4> kernel = xt::random::rand<ElementType>(kernelShape);
+
+	for (auto _ : state) {
+		 auto result = xvigra::convolve2D(
+		 	input, 
+		 	kernel, 
+		 	options2D
+		 );
+		 benchmark::DoNotOptimize(result.data());
+	}
+}
+
+
+template <typename ElementType>
+void benchmark_convolve2D_pointwise_gemmChannelFirst(benchmark::State& state) {
+	runPointwiseKernel<ElementType>(state, xvigra::ChannelPosition::FIRST, xvigra::Algorithm::GEMM);
+}
+
+
+template <typename ElementType>
+void benchmark_convolve2D_pointwise_gemmChannelLast(benchmark::State& state) {
+	runPointwiseKernel<ElementType>(state, xvigra::ChannelPosition::LAST, xvigra::Algorithm::GEMM);
+}
+
+
+template <typename ElementType>
+void benchmark_convolve2D_pointwise_directChannelFirst(benchmark::State& state) {
+	runPointwiseKernel<ElementType>(state, xvigra::ChannelPosition::FIRST, xvigra::Algorithm::DIRECT);
+}
+
+
+template <typename ElementType>
+void benchmark_convolve2D_pointwise_directChannelLast(benchmark::State& state) {
+	runPointwiseKernel<ElementType>(state, xvigra::ChannelPosition::LAST, xvigra::Algorithm::DIRECT);
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ benchmark pointwise kernel - end                                                                                 ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ run benchmarks - begin                                                                                           ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+BENCHMARK_SINGLE_VERSION(benchmark_convolve2D_pointwise_gemmChannelFirst);
+BENCHMARK_SINGLE_VERSION(benchmark_convolve2D_pointwise_gemmChannelLast);
+BENCHMARK_SINGLE_VERSION(benchmark_convolve2D_pointwise_directChannelFirst);
+BENCHMARK_SINGLE_VERSION(benchmark_convolve2D_pointwise_directChannelLast);
+
+
+BENCHMARK_MAIN();
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ run benchmarks - end                                                                                             ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
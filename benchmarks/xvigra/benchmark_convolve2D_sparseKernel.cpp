@@ -0,0 +1,130 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <iostream>
+
+#include "xtensor/xtensor.hpp"
+#include "xtensor/xrandom.hpp"
+
+#include "xvigra/convolution_util.hpp"
+#include "xvigra/explicit_convolution.hpp"
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ define - begin                                                                                                   ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+#define INPUT_SIZE 256
+#define INPUT_CHANNELS 3
+#define OUTPUT_CHANNELS 8
+#define KERNEL_SIZE_MIN 5
+#define KERNEL_SIZE_MAX 21
+#define KERNEL_SIZE_STEP 4
+
+
+#define BENCHMARK_SINGLE_VERSION(name)                                        \
+    BENCHMARK_TEMPLATE(name, float)                                           \
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {   \
+        return *(std::min_element(std::begin(v), std::end(v)));               \
+      })                                                                      \
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {   \
+        return *(std::max_element(std::begin(v), std::end(v)));               \
+      })                                                                      \
+    ->DenseRange(KERNEL_SIZE_MIN, KERNEL_SIZE_MAX, KERNEL_SIZE_STEP)          \
+    ->Unit(benchmark::kMillisecond)
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ define - end                                                                                                     ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ benchmark sparse kernel - begin                                                                                  ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+// ring kernel with 4 non-zero taps per channel pair; the dense variant fills the remaining taps with a small value,
+// so that every tap is multiplied; only Algorithm::AUTO hands the sparse ring to the sparse backend
+template <typename ElementType>
+void runRingKernel(benchmark::State& state, xvigra::Algorithm algorithm, bool isDense) {
+	int kernelSize = static_cast<int>(state.range(0));
+	int center = kernelSize / 2;
+
+	std::array<int, 3> inputShape{INPUT_CHANNELS, INPUT_SIZE, INPUT_SIZE};
+	std::array<int, 4> kernelShape{OUTPUT_CHANNELS, INPUT_CHANNELS, kernelSize, kernelSize};
+
+	xvigra::KernelOptions2D options2D;
+	options2D.setPadding(center);
+	options2D.setChannelPosition(xvigra::ChannelPosition::FIRST);
+	options2D.setAlgorithm(algorithm);
+
+	xt::xtensor<ElementType, 3> input = xt::random::rand<ElementType>(inputShape);
+	xt::xtensor<ElementType, 4> kernel = xt::zeros<ElementType>(kernelShape);
+
+	if (isDense) {
+		kernel.fill(static_cast<ElementType>(1e-3));
+	}
+
+	for (int outputChannel = 0; outputChannel < OUTPUT_CHANNELS; ++outputChannel) {
+		for (int inputChannel = 0; inputChannel < INPUT_CHANNELS; ++inputChannel) {
+			kernel(outputChannel, inputChannel, 0, center) = 1;
+			kernel(outputChannel, inputChannel, kernelSize - 1, center) = 1;
+			kernel(outputChannel, inputChannel, center, 0) = -1;
+			kernel(outputChannel, inputChannel, center, kernelSize - 1) = -1;
+		}
+	}
+
+	for (auto _ : state) {
+		 auto result = xvigra::convolve2D(
+		 	input, 
+		 	kernel, 
+		 	options2D
+		 );
+		 benchmark::DoNotOptimize(result.data());
+	}
+}
+
+
+template <typename ElementType>
+void benchmark_convolve2D_sparseKernel_gemmDense(benchmark::State& state) {
+	runRingKernel<ElementType>(state, xvigra::Algorithm::GEMM, true);
+}
+
+
+template <typename ElementType>
+void benchmark_convolve2D_sparseKernel_gemmSparse(benchmark::State& state) {
+	runRingKernel<ElementType>(state, xvigra::Algorithm::GEMM, false);
+}
+
+
+template <typename ElementType>
+void benchmark_convolve2D_sparseKernel_auto(benchmark::State& state) {
+	runRingKernel<ElementType>(state, xvigra::Algorithm::AUTO, false);
+}
+
+
+template <typename ElementType>
+void benchmark_convolve2D_sparseKernel_direct(benchmark::State& state) {
+	runRingKernel<ElementType>(state, xvigra::Algorithm::DIRECT, false);
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ benchmark sparse kernel - end                                                                                    ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ run benchmarks - begin                                                                                           ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+BENCHMARK_SINGLE_VERSION(benchmark_convolve2D_sparseKernel_gemmDense);
+BENCHMARK_SINGLE_VERSION(benchmark_convolve2D_sparseKernel_gemmSparse);
+BENCHMARK_SINGLE_VERSION(benchmark_convolve2D_sparseKernel_auto);
+BENCHMARK_SINGLE_VERSION(benchmark_convolve2D_sparseKernel_direct);
+
+
+BENCHMARK_MAIN();
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ run benchmarks - end                                                                                             ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
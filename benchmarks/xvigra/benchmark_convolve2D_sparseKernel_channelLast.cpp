@@ -0,0 +1,136 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <iostream>
+
+#include "xtensor/xtensor.hpp"
+#include "xtensor/xrandom.hpp"
+
+#include "xvigra/convolution_util.hpp"
+#include "xvigra/explicit_convolution.hpp"
+#include "xvigra/sparse_convolution.hpp"
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ define - begin                                                                                                   ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+#define INPUT_SIZE 64
+#define CHANNELS 64
+#define KERNEL_SIZE 3
+#define DENSITY_MIN 1
+#define DENSITY_MAX 10
+#define DENSITY_STEP 1
+
+
+#define BENCHMARK_SINGLE_VERSION(name)                                        \
+    BENCHMARK_TEMPLATE(name, float)                                           \
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {   \
+        return *(std::min_element(std::begin(v), std::end(v)));               \
+      })                                                                      \
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {   \
+        return *(std::max_element(std::begin(v), std::end(v)));               \
+      })                                                                      \
+    ->DenseRange(DENSITY_MIN, DENSITY_MAX, DENSITY_STEP)                      \
+    ->Unit(benchmark::kMillisecond)
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ define - end                                                                                                     ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ benchmark sparse kernel channel last - begin                                                                     ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+// many channels in the last position, where GEMM runs on contiguous channel vectors and the sparse backend gathers
+// every tap separately; the range of densities brackets xvigra::SPARSE_TAP_DENSITY_CHANNEL_LAST
+template <typename ElementType>
+xt::xtensor<ElementType, 4> createKernel(int densityPercent) {
+	std::array<int, 4> kernelShape{CHANNELS, CHANNELS, KERNEL_SIZE, KERNEL_SIZE};
+	xt::xtensor<ElementType, 4> kernel = xt::zeros<ElementType>(kernelShape);
+
+	// spreads the non-zero taps evenly over channel pairs and positions
+	for (std::size_t index = 0; index < kernel.size(); ++index) {
+		if (static_cast<int>((index * 37) % 100) < densityPercent) {
+			kernel.data()[index] = static_cast<ElementType>(index % 7) - static_cast<ElementType>(3.5);
+		}
+	}
+
+	return kernel;
+}
+
+
+xvigra::KernelOptions2D createOptions(xvigra::Algorithm algorithm) {
+	xvigra::KernelOptions2D options2D;
+	options2D.setPadding(KERNEL_SIZE / 2);
+	options2D.setChannelPosition(xvigra::ChannelPosition::LAST);
+	options2D.setAlgorithm(algorithm);
+	return options2D;
+}
+
+
+template <typename ElementType>
+void benchmark_convolve2D_sparseKernel_channelLast_gemm(benchmark::State& state) {
+	std::array<int, 3> inputShape{INPUT_SIZE, INPUT_SIZE, CHANNELS};
+
+	xvigra::KernelOptions2D options2D = createOptions(xvigra::Algorithm::GEMM);
+	xt::xtensor<ElementType, 3> input = xt::random::rand<ElementType>(inputShape);
+	xt::xtensor<ElementType, 4> kernel = createKernel<ElementType>(static_cast<int>(state.range(0)));
+
+	for (auto _ : state) {
+		 auto result = xvigra::convolve2D(
+		 	input, 
+		 	kernel, 
+		 	options2D
+		 );
+		 benchmark::DoNotOptimize(result.data());
+	}
+}
+
+
+template <typename ElementType>
+void benchmark_convolve2D_sparseKernel_channelLast_sparse(benchmark::State& state) {
+	std::array<int, 3> inputShape{INPUT_SIZE, INPUT_SIZE, CHANNELS};
+
+	xvigra::KernelOptions2D options2D = createOptions(xvigra::Algorithm::DIRECT);
+	xt::xtensor<ElementType, 3> input = xt::random::rand<ElementType>(inputShape);
+	xt::xtensor<ElementType, 4> kernel = createKernel<ElementType>(static_cast<int>(state.range(0)));
+	xvigra::SparseKernel2D<ElementType> sparseKernel = xvigra::collectNonZeroTaps<ElementType>(kernel);
+
+	state.counters["density"] = sparseKernel.density();
+
+	xt::xtensor<ElementType, 3> result = xt::zeros<ElementType>({INPUT_SIZE, INPUT_SIZE, CHANNELS});
+
+	for (auto _ : state) {
+		 xvigra::sparseConvolve2D<ElementType, ElementType>(
+		 	input, 
+		 	sparseKernel, 
+		 	options2D.optionsY,
+		 	options2D.optionsX,
+		 	xvigra::Epilogue(),
+		 	result
+		 );
+		 benchmark::DoNotOptimize(result.data());
+	}
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ benchmark sparse kernel channel last - end                                                                       ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ run benchmarks - begin                                                                                           ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+BENCHMARK_SINGLE_VERSION(benchmark_convolve2D_sparseKernel_channelLast_gemm);
+BENCHMARK_SINGLE_VERSION(benchmark_convolve2D_sparseKernel_channelLast_sparse);
+
+
+BENCHMARK_MAIN();
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ run benchmarks - end                                                                                             ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
@@ -0,0 +1,152 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <iostream>
+
+#include "xtensor/xtensor.hpp"
+#include "xtensor/xrandom.hpp"
+
+#include "xvigra/explicit_convolution.hpp"
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ define - begin                                                                                                   ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+#define INPUT_SIZE 1000
+#define THREAD_COUNT_MIN 1
+#define THREAD_COUNT_MAX 16
+#define THREAD_COUNT_STEP 1
+
+
+// the patch is built by several threads, so the wall clock time is measured instead of the CPU time of the main thread
+#define BENCHMARK_SINGLE_VERSION(name)                                        \
+    BENCHMARK_TEMPLATE(name, float)                                           \
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {   \
+        return *(std::min_element(std::begin(v), std::end(v)));               \
+      })                                                                      \
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {   \
+        return *(std::max_element(std::begin(v), std::end(v)));               \
+      })                                                                      \
+    ->DenseRange(THREAD_COUNT_MIN, THREAD_COUNT_MAX, THREAD_COUNT_STEP)       \
+    ->UseRealTime()                                                           \
+    ->Unit(benchmark::kMillisecond)
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ define - end                                                                                                     ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ benchmark thread count - begin                                                                                   ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+template <typename ElementType>
+void benchmark_convolve2D_threadCount_channelFirst(benchmark::State& state) {
+	int threadCount = static_cast<int>(state.range(0));
+	int inputHeight = INPUT_SIZE + 1;
+	int inputWidth = INPUT_SIZE - 1;
+	int inputChannels = 3;
+	int kernelHeight = 8;
+	int kernelWidth = 7;
+	
+	std::array<int, 3> inputShape{inputChannels, inputHeight, inputWidth};
+	std::array<int, 4> kernelShape{inputChannels, inputChannels, kernelHeight, kernelWidth};
+
+	int padding = 3;
+	int stride = 4;
+	int dilation = 2;
+
+	xvigra::KernelOptions2D options2D;
+	options2D.setPadding(padding - 1, padding + 1);
+	options2D.setStride(stride + 1, stride - 1);
+	options2D.setDilation(dilation - 1, dilation + 1);
+	options2D.setChannelPosition(xvigra::ChannelPosition::FIRST);
+	options2D.setAlgorithm(xvigra::Algorithm::GEMM);
+	options2D.setThreadCount(threadCount);
+
+	xt::xtensor<ElementType, 3> input;
+	xt::xtensor<ElementType, 4> kernel;
+	
+	if constexpr (std::is_floating_point<ElementType>::value) {
+		input = xt::random::rand<ElementType>(inputShape);
+		kernel = xt::random::rand<ElementType>(kernelShape);
+	} else {
+		input = xt::random::randint<ElementType>(inputShape);
+		kernel = xt::random::randint<ElementType>(kernelShape);
+	}
+	
+	for (auto _ : state) {
+		 auto result = xvigra::convolve2D(
+		 	input, 
+		 	kernel, 
+		 	options2D
+		 );
+		 benchmark::DoNotOptimize(result.data());
+	}
+}
+
+
+template <typename ElementType>
+void benchmark_convolve2D_threadCount_channelLast(benchmark::State& state) {
+	int threadCount = static_cast<int>(state.range(0));
+	int inputHeight = INPUT_SIZE + 1;
+	int inputWidth = INPUT_SIZE - 1;
+	int inputChannels = 3;
+	int kernelHeight = 8;
+	int kernelWidth = 7;
+	
+	std::array<int, 3> inputShape{inputHeight, inputWidth, inputChannels};
+	std::array<int, 4> kernelShape{inputChannels, inputChannels, kernelHeight, kernelWidth};
+
+	int padding = 3;
+	int stride = 4;
+	int dilation = 2;
+
+	xvigra::KernelOptions2D options2D;
+	options2D.setPadding(padding - 1, padding + 1);
+	options2D.setStride(stride + 1, stride - 1);
+	options2D.setDilation(dilation - 1, dilation + 1);
+	options2D.setChannelPosition(xvigra::ChannelPosition::LAST);
+	options2D.setAlgorithm(xvigra::Algorithm::GEMM);
+	options2D.setThreadCount(threadCount);
+
+	xt::xtensor<ElementType, 3> input;
+	xt::xtensor<ElementType, 4> kernel;
+	
+	if constexpr (std::is_floating_point<ElementType>::value) {
+		input = xt::random::rand<ElementType>(inputShape);
+		kernel = xt::random::rand<ElementType>(kernelShape);
+	} else {
+		input = xt::random::randint<ElementType>(inputShape);
+		kernel = xt::random::randint<ElementType>(kernelShape);
+	}
+	
+	for (auto _ : state) {
+		 auto result = xvigra::convolve2D(
+		 	input, 
+		 	kernel, 
+		 	options2D
+		 );
+		 benchmark::DoNotOptimize(result.data());
+	}
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ benchmark thread count - end                                                                                     ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ run benchmarks - begin                                                                                           ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+BENCHMARK_SINGLE_VERSION(benchmark_convolve2D_threadCount_channelFirst);
+BENCHMARK_SINGLE_VERSION(benchmark_convolve2D_threadCount_channelLast);
+
+
+BENCHMARK_MAIN();
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ run benchmarks - end                                                                                             ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
@@ -0,0 +1,122 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <iostream>
+
+#include "xtensor/xtensor.hpp"
+#include "xtensor/xrandom.hpp"
+
+#include "xvigra/convolution_util.hpp"
+#include "xvigra/explicit_convolution.hpp"
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ define - begin                                                                                                   ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+#define INPUT_SIZE_MIN 32
+#define INPUT_SIZE_MAX 512
+#define INPUT_SIZE_STEP 32
+#define CHANNELS 16
+#define KERNEL_SIZE 3
+
+
+#define BENCHMARK_SINGLE_VERSION(name)                                        \
+    BENCHMARK_TEMPLATE(name, float)                                           \
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {   \
+        return *(std::min_element(std::begin(v), std::end(v)));               \
+      })                                                                      \
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {   \
+        return *(std::max_element(std::begin(v), std::end(v)));               \
+      })                                                                      \
+    ->DenseRange(INPUT_SIZE_MIN, INPUT_SIZE_MAX, INPUT_SIZE_STEP)             \
+    ->Unit(benchmark::kMillisecond)
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ define - end                                                                                                     ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ benchmark convolveND versus convolve2D - begin                                                                   ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+// the same GEMM convolution of a square input with 16 channels in and out, once through the generic N-dimensional
+// gather of convolveND<2> and once through the specialized patch of convolve2D
+template <typename ElementType>
+void runConvolution(benchmark::State& state, xvigra::ChannelPosition channelPosition, bool isGeneric) {
+	int inputSize = static_cast<int>(state.range(0));
+	bool isChannelFirst = channelPosition == xvigra::ChannelPosition::FIRST;
+
+	std::array<int, 3> inputShape = isChannelFirst
+		? std::array<int, 3>{CHANNELS, inputSize, inputSize}
+		: std::array<int, 3>{inputSize, inputSize, CHANNELS};
+	std::array<int, 4> kernelShape{CHANNELS, CHANNELS, KERNEL_SIZE, KERNEL_SIZE};
+
+	xvigra::KernelOptions options(KERNEL_SIZE / 2);
+	options.setChannelPosition(channelPosition);
+	options.setAlgorithm(xvigra::Algorithm::GEMM);
+	options.setBorderTreatment(xvigra::BorderTreatment::symmetricReflect());
+
+	std::array<xvigra::KernelOptions, 2> kernelOptions{options, options};
+	xvigra::KernelOptions2D options2D(options, options);
+
+	xt::xtensor<ElementType, 3> input = xt::random::rand<ElementType>(inputShape);
+	xt::xtensor<ElementType, 4> kernel = xt::random::rand<ElementType>(kernelShape);
+	xt::xtensor<ElementType, 3> result;
+
+	for (auto _ : state) {
+		if (isGeneric) {
+			xvigra::convolveND<2>(input, kernel, kernelOptions, result);
+		} else {
+			xvigra::convolve2D(input, kernel, options2D, result);
+		}
+		benchmark::DoNotOptimize(result.data());
+	}
+}
+
+
+template <typename ElementType>
+void benchmark_convolveND_versus2D_convolveNDChannelFirst(benchmark::State& state) {
+	runConvolution<ElementType>(state, xvigra::ChannelPosition::FIRST, true);
+}
+
+
+template <typename ElementType>
+void benchmark_convolveND_versus2D_convolve2DChannelFirst(benchmark::State& state) {
+	runConvolution<ElementType>(state, xvigra::ChannelPosition::FIRST, false);
+}
+
+
+template <typename ElementType>
+void benchmark_convolveND_versus2D_convolveNDChannelLast(benchmark::State& state) {
+	runConvolution<ElementType>(state, xvigra::ChannelPosition::LAST, true);
+}
+
+
+template <typename ElementType>
+void benchmark_convolveND_versus2D_convolve2DChannelLast(benchmark::State& state) {
+	runConvolution<ElementType>(state, xvigra::ChannelPosition::LAST, false);
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ benchmark convolveND versus convolve2D - end                                                                     ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ run benchmarks - begin                                                                                           ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+BENCHMARK_SINGLE_VERSION(benchmark_convolveND_versus2D_convolveNDChannelFirst);
+BENCHMARK_SINGLE_VERSION(benchmark_convolveND_versus2D_convolve2DChannelFirst);
+BENCHMARK_SINGLE_VERSION(benchmark_convolveND_versus2D_convolveNDChannelLast);
+BENCHMARK_SINGLE_VERSION(benchmark_convolveND_versus2D_convolve2DChannelLast);
+
+
+BENCHMARK_MAIN();
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ run benchmarks - end                                                                                             ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
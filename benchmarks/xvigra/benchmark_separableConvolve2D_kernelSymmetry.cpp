@@ -0,0 +1,125 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <iostream>
+
+#include "xtensor/xtensor.hpp"
+#include "xtensor/xrandom.hpp"
+
+#include "xvigra/convolution_util.hpp"
+#include "xvigra/kernel_init.hpp"
+#include "xvigra/separable_convolution.hpp"
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ define - begin                                                                                                   ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+#define INPUT_SIZE 512
+#define INPUT_CHANNELS 3
+#define SCALE_MIN 1
+#define SCALE_MAX 5
+
+
+#define BENCHMARK_SINGLE_VERSION(name)                                        \
+    BENCHMARK_TEMPLATE(name, float)                                           \
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {   \
+        return *(std::min_element(std::begin(v), std::end(v)));               \
+      })                                                                      \
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {   \
+        return *(std::max_element(std::begin(v), std::end(v)));               \
+      })                                                                      \
+    ->DenseRange(SCALE_MIN, SCALE_MAX, 1)                                     \
+    ->Unit(benchmark::kMillisecond)
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ define - end                                                                                                     ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ benchmark kernel symmetry - begin                                                                                ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+// smoothing along y and the first Gaussian derivative along x, as for one component of the gradient; the scale is the
+// standard deviation, so the kernels grow from 7 to 35 taps
+template <typename ElementType>
+void runGaussianPasses(benchmark::State& state, xvigra::ChannelPosition channelPosition, bool isFolded) {
+	double scale = static_cast<double>(state.range(0));
+	xt::xtensor<ElementType, 1> smoothing = xvigra::initGaussian<ElementType>(scale);
+	xt::xtensor<ElementType, 1> derivative = xvigra::initGaussianDerivative<ElementType>(scale, 1);
+
+	std::array<int, 3> inputShape = channelPosition == xvigra::ChannelPosition::FIRST
+		? std::array<int, 3>{INPUT_CHANNELS, INPUT_SIZE, INPUT_SIZE}
+		: std::array<int, 3>{INPUT_SIZE, INPUT_SIZE, INPUT_CHANNELS};
+
+	xvigra::KernelOptions2D options2D;
+	options2D.setPadding(static_cast<int>(smoothing.size() / 2), static_cast<int>(derivative.size() / 2));
+	options2D.setBorderTreatment(xvigra::BorderTreatment::asymmetricReflect());
+	options2D.setChannelPosition(channelPosition);
+
+	// the unfolded passes run the default GEMM algorithm; only the DIRECT and AUTO algorithms fold
+	if (isFolded) {
+		options2D.setAlgorithm(xvigra::Algorithm::DIRECT);
+		options2D.setKernelSymmetry(xvigra::KernelSymmetry::SYMMETRIC, xvigra::KernelSymmetry::ANTISYMMETRIC);
+	} else {
+		options2D.setKernelSymmetry(xvigra::KernelSymmetry::NONE);
+	}
+
+	xt::xtensor<ElementType, 3> input = xt::random::rand<ElementType>(inputShape);
+
+	for (auto _ : state) {
+		 auto result = xvigra::separableConvolve2D(
+		 	input, 
+		 	std::array{smoothing, derivative}, 
+		 	options2D
+		 );
+		 benchmark::DoNotOptimize(result.data());
+	}
+}
+
+
+template <typename ElementType>
+void benchmark_separableConvolve2D_kernelSymmetry_channelFirstUnfolded(benchmark::State& state) {
+	runGaussianPasses<ElementType>(state, xvigra::ChannelPosition::FIRST, false);
+}
+
+
+template <typename ElementType>
+void benchmark_separableConvolve2D_kernelSymmetry_channelFirstFolded(benchmark::State& state) {
+	runGaussianPasses<ElementType>(state, xvigra::ChannelPosition::FIRST, true);
+}
+
+
+template <typename ElementType>
+void benchmark_separableConvolve2D_kernelSymmetry_channelLastUnfolded(benchmark::State& state) {
+	runGaussianPasses<ElementType>(state, xvigra::ChannelPosition::LAST, false);
+}
+
+
+template <typename ElementType>
+void benchmark_separableConvolve2D_kernelSymmetry_channelLastFolded(benchmark::State& state) {
+	runGaussianPasses<ElementType>(state, xvigra::ChannelPosition::LAST, true);
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ benchmark kernel symmetry - end                                                                                  ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ run benchmarks - begin                                                                                           ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+BENCHMARK_SINGLE_VERSION(benchmark_separableConvolve2D_kernelSymmetry_channelFirstUnfolded);
+BENCHMARK_SINGLE_VERSION(benchmark_separableConvolve2D_kernelSymmetry_channelFirstFolded);
+BENCHMARK_SINGLE_VERSION(benchmark_separableConvolve2D_kernelSymmetry_channelLastUnfolded);
+BENCHMARK_SINGLE_VERSION(benchmark_separableConvolve2D_kernelSymmetry_channelLastFolded);
+
+
+BENCHMARK_MAIN();
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ run benchmarks - end                                                                                             ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
@@ -0,0 +1,107 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <iostream>
+
+#include "xtensor/xtensor.hpp"
+#include "xtensor/xrandom.hpp"
+
+#include "xtensor-blas/xlinalg.hpp"
+
+#include "xvigra/gemm_util.hpp"
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ define - begin                                                                                                   ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+// the product of a single GEMM tile of convolve1D: OC x (IC * K) kernel times (IC * K) x W patch
+#define INPUT_SIZE 4096
+#define INPUT_CHANNELS 3
+#define KERNEL_SIZE 7
+#define OUTPUT_CHANNELS_MIN 1
+#define OUTPUT_CHANNELS_MAX 32
+#define OUTPUT_CHANNELS_STEP 1
+
+
+#define BENCHMARK_SINGLE_VERSION(name)                                        \
+    BENCHMARK_TEMPLATE(name, float)                                           \
+    ->ComputeStatistics("min", [](const std::vector<double>& v) -> double {   \
+        return *(std::min_element(std::begin(v), std::end(v)));               \
+      })                                                                      \
+    ->ComputeStatistics("max", [](const std::vector<double>& v) -> double {   \
+        return *(std::max_element(std::begin(v), std::end(v)));               \
+      })                                                                      \
+    ->DenseRange(OUTPUT_CHANNELS_MIN, OUTPUT_CHANNELS_MAX, OUTPUT_CHANNELS_STEP) \
+    ->Unit(benchmark::kMicrosecond)
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ define - end                                                                                                     ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ benchmark output channels - begin                                                                                ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+template <typename ElementType>
+void benchmark_smallGemm_outputChannels_blas(benchmark::State& state) {
+	int outputChannels = static_cast<int>(state.range(0));
+	int depth = INPUT_CHANNELS * KERNEL_SIZE;
+
+	std::array<int, 2> kernelShape{outputChannels, depth};
+	std::array<int, 2> patchShape{depth, INPUT_SIZE};
+
+	xt::xtensor<ElementType, 2> kernel = xt::random::rand<ElementType>(kernelShape);
+	xt::xtensor<ElementType, 2> patch = xt::random::rand<ElementType>(patchShape);
+
+	for (auto _ : state) {
+		xt::xtensor<ElementType, 2> result = xt::linalg::dot(kernel, patch);
+		benchmark::DoNotOptimize(result.data());
+	}
+}
+
+
+template <typename ElementType>
+void benchmark_smallGemm_outputChannels_microKernel(benchmark::State& state) {
+	int outputChannels = static_cast<int>(state.range(0));
+	int depth = INPUT_CHANNELS * KERNEL_SIZE;
+
+	std::array<int, 2> kernelShape{outputChannels, depth};
+	std::array<int, 2> patchShape{depth, INPUT_SIZE};
+
+	xt::xtensor<ElementType, 2> kernel = xt::random::rand<ElementType>(kernelShape);
+	xt::xtensor<ElementType, 2> patch = xt::random::rand<ElementType>(patchShape);
+
+	// the micro-kernel is called directly, so it is also measured beyond xvigra::SMALL_GEMM_LIMIT
+	for (auto _ : state) {
+		xt::xtensor<ElementType, 2> result(std::array<std::size_t, 2>{static_cast<std::size_t>(outputChannels), INPUT_SIZE});
+		xvigra::smallGemm(
+			outputChannels, INPUT_SIZE, depth,
+			kernel.data(), depth, 1,
+			patch.data(), INPUT_SIZE, 1,
+			result.data(), INPUT_SIZE
+		);
+		benchmark::DoNotOptimize(result.data());
+	}
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ benchmark output channels - end                                                                                  ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ run benchmarks - begin                                                                                           ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+BENCHMARK_SINGLE_VERSION(benchmark_smallGemm_outputChannels_blas);
+BENCHMARK_SINGLE_VERSION(benchmark_smallGemm_outputChannels_microKernel);
+
+
+BENCHMARK_MAIN();
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ run benchmarks - end                                                                                             ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
@@ -44,6 +44,12 @@ printf '────────────────────────
 ./build-linux/tests/test_convolution_util
 printf '\n'
 
+printf '────────────────────────────────────────────────────────────────────────────────\n'
+printf '                                    Test FFT\n'
+printf '────────────────────────────────────────────────────────────────────────────────\n'
+./build-linux/tests/test_fft
+printf '\n'
+
 printf '────────────────────────────────────────────────────────────────────────────────\n'
 printf '                                Test Image IO\n'
 printf '────────────────────────────────────────────────────────────────────────────────\n'
@@ -56,12 +62,60 @@ printf '────────────────────────
 ./build-linux/tests/test_explicit_convolution
 printf '\n'
 
+printf '────────────────────────────────────────────────────────────────────────────────\n'
+printf '                             Test Convolution Plan\n'
+printf '────────────────────────────────────────────────────────────────────────────────\n'
+./build-linux/tests/test_convolution_plan
+printf '\n'
+
+printf '────────────────────────────────────────────────────────────────────────────────\n'
+printf '                            Test Convolution Tuning\n'
+printf '────────────────────────────────────────────────────────────────────────────────\n'
+./build-linux/tests/test_convolution_tuning
+printf '\n'
+
 printf '────────────────────────────────────────────────────────────────────────────────\n'
 printf '                         Test Separable Convolution\n'
 printf '────────────────────────────────────────────────────────────────────────────────\n'
 ./build-linux/tests/test_separable_convolution
 printf '\n'
 
+printf '────────────────────────────────────────────────────────────────────────────────\n'
+printf '                                Test Workspace\n'
+printf '────────────────────────────────────────────────────────────────────────────────\n'
+./build-linux/tests/test_workspace
+printf '\n'
+
+printf '────────────────────────────────────────────────────────────────────────────────\n'
+printf '                                Test Half Precision\n'
+printf '────────────────────────────────────────────────────────────────────────────────\n'
+./build-linux/tests/test_half_precision
+printf '\n'
+
+printf '────────────────────────────────────────────────────────────────────────────────\n'
+printf '                                Test SIMD Util\n'
+printf '────────────────────────────────────────────────────────────────────────────────\n'
+./build-linux/tests/test_simd_util
+printf '\n'
+
+printf '────────────────────────────────────────────────────────────────────────────────\n'
+printf '                                Test Epilogue\n'
+printf '────────────────────────────────────────────────────────────────────────────────\n'
+./build-linux/tests/test_epilogue
+printf '\n'
+
+printf '────────────────────────────────────────────────────────────────────────────────\n'
+printf '                                Test Gemm Util\n'
+printf '────────────────────────────────────────────────────────────────────────────────\n'
+./build-linux/tests/test_gemm_util
+printf '\n'
+
+printf '────────────────────────────────────────────────────────────────────────────────\n'
+printf '                                Test Thread Util\n'
+printf '────────────────────────────────────────────────────────────────────────────────\n'
+./build-linux/tests/test_thread_util
+printf '\n'
+
 end_time=$(date +%s%3N)
 runtime=$((end_time-start_time))
 printf 'Test-Time: %s ms\n\n\n' "$runtime"
@@ -42,6 +42,12 @@ $start_time = [Math]::Round((Get-Date).ToFileTime()/10000);
 .\build-windows\tests\Release\test_convolution_util.exe;
 "`n"
 
+"--------------------------------------------------------------------------------"
+"                                     Test FFT"
+"--------------------------------------------------------------------------------"
+.\build-windows\tests\Release\test_fft.exe;
+"`n"
+
 "--------------------------------------------------------------------------------"
 "                                  Test Image IO"
 "--------------------------------------------------------------------------------"
@@ -54,12 +60,60 @@ $start_time = [Math]::Round((Get-Date).ToFileTime()/10000);
 .\build-windows\tests\Release\test_explicit_convolution.exe;
 "`n"
 
+"--------------------------------------------------------------------------------"
+"                              Test Convolution Plan"
+"--------------------------------------------------------------------------------"
+.\build-windows\tests\Release\test_convolution_plan.exe;
+"`n"
+
+"--------------------------------------------------------------------------------"
+"                            Test Convolution Tuning"
+"--------------------------------------------------------------------------------"
+.\build-windows\tests\Release\test_convolution_tuning.exe;
+"`n"
+
 "--------------------------------------------------------------------------------"
 "                         Test Separable Convolution"
 "--------------------------------------------------------------------------------"
 .\build-windows\tests\Release\test_separable_convolution.exe;
 "`n"
 
+"--------------------------------------------------------------------------------"
+"                                Test Workspace"
+"--------------------------------------------------------------------------------"
+.\build-windows\tests\Release\test_workspace.exe;
+"`n"
+
+"--------------------------------------------------------------------------------"
+"                                Test Half Precision"
+"--------------------------------------------------------------------------------"
+.\build-windows\tests\Release\test_half_precision.exe;
+"`n"
+
+"--------------------------------------------------------------------------------"
+"                                Test SIMD Util"
+"--------------------------------------------------------------------------------"
+.\build-windows\tests\Release\test_simd_util.exe;
+"`n"
+
+"--------------------------------------------------------------------------------"
+"                                Test Epilogue"
+"--------------------------------------------------------------------------------"
+.\build-windows\tests\Release\test_epilogue.exe;
+"`n"
+
+"--------------------------------------------------------------------------------"
+"                                Test Gemm Util"
+"--------------------------------------------------------------------------------"
+.\build-windows\tests\Release\test_gemm_util.exe;
+"`n"
+
+"--------------------------------------------------------------------------------"
+"                                Test Thread Util"
+"--------------------------------------------------------------------------------"
+.\build-windows\tests\Release\test_thread_util.exe;
+"`n"
+
 $end_time = [Math]::Round((Get-Date).ToFileTime()/10000);
 $runtime = $end_time - $start_time;
 "Test-Time: {0} ms`n`n" -f $runtime;
@@ -40,6 +40,7 @@ namespace xvigra {
             xvigra::KernelOptions option;
             option.setBorderTreatment(xvigra::BorderTreatment::asymmetricReflect());
             option.setPadding(gaussianKernels[i].shape()[0] / 2);
+            option.setKernelSymmetry(xvigra::KernelSymmetry::SYMMETRIC);
             options[i] = option;
         }
 
@@ -99,6 +100,7 @@ namespace xvigra {
             xvigra::KernelOptions option;
             option.setBorderTreatment(xvigra::BorderTreatment::asymmetricReflect());
             option.setPadding(kernels[i].shape()[0] / 2);
+            option.setKernelSymmetry(xvigra::KernelSymmetry::SYMMETRIC);
             options[i] = option;
         }
 
@@ -112,6 +114,8 @@ namespace xvigra {
 
             specializedKernels[i] = grad;
             specializedOptions[i].setPadding(specializedKernels[i].shape()[0] / 2);
+            // the first derivative of the Gaussian is sampled at mirrored positions, so its taps are antisymmetric
+            specializedOptions[i].setKernelSymmetry(xvigra::KernelSymmetry::ANTISYMMETRIC);
 
             result[i] = xvigra::separableConvolve(source, specializedKernels, specializedOptions);
         }
@@ -0,0 +1,662 @@
+#ifndef XVIGRA_CONVOLUTION_PLAN_HPP
+#define XVIGRA_CONVOLUTION_PLAN_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#ifdef VOID
+#undef VOID
+#endif
+
+#include "xtensor/xadapt.hpp"
+#include "xtensor/xexpression.hpp"
+#include "xtensor/xtensor.hpp"
+
+#include "xvigra/convolution_util.hpp"
+#include "xvigra/epilogue.hpp"
+#include "xvigra/gemm_util.hpp"
+#include "xvigra/half_precision.hpp"
+#include "xvigra/kernel_util.hpp"
+#include "xvigra/sparse_convolution.hpp"
+#include "xvigra/thread_util.hpp"
+
+namespace xvigra {
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ class ConvolutionPlan2D - begin                                                                              ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    /*
+     * <p>
+     * Precomputed explicit 2-dimensional convolution for a fixed input shape, kernel and options.
+     * The constructor promotes and packs the kernel into its GEMM matrix, resolves the border treatments into gather
+     * index tables and allocates the tiled patch workspace. ConvolutionPlan2D#execute only gathers the patch and runs
+     * the matrix multiplication with xvigra::matrixProduct; it does not allocate.
+     * Only Algorithm::GEMM and Algorithm::AUTO can be planned. Groups are not planned either, except for a kernel
+     * without channel axes, whose promoted diagonal filter already is the depthwise convolution of IC groups.
+     * The epilogue of the plan is applied to every tile of the output right after it is computed.
+     * With Algorithm::AUTO in the options and a sparse kernel (see xvigra::SparseKernel2D#isSparse), the
+     * constructor collects the non-zero taps instead and ConvolutionPlan2D#execute only gathers and accumulates those,
+     * see xvigra::accumulateSparseRows2D; every other algorithm is planned with the kernel matrix.
+     * ConvolutionPlan2D#executeBatch convolves a batch of N images of the planned shape with the same setup.
+     * The result is equal to xvigra::convolve2D with Algorithm::GEMM and, as there, 16-bit floats are accumulated and
+     * returned in float (see xvigra::AccumulationType). A plan owns its workspace, so a single plan must not be
+     * executed concurrently.
+     * </p>
+     *
+     * @tparam InputType value type of the input
+     * @tparam KernelType value type of the kernel
+     */
+    template <typename InputType, typename KernelType>
+    class ConvolutionPlan2D {
+    public:
+        using ResultType = AccumulationType<std::common_type_t<InputType, AccumulationType<KernelType>>>;
+        using ShapeType = std::array<std::size_t, 3>;
+        using BatchShapeType = std::array<std::size_t, 4>;
+
+    private:
+        bool isChannelFirst;
+
+        ShapeType inputShape;
+        ShapeType outputShape;
+
+        std::size_t inputChannels;
+        std::size_t inputHeight;
+        std::size_t inputWidth;
+        std::size_t outputChannels;
+        std::size_t outputHeight;
+        std::size_t outputWidth;
+        std::size_t kernelHeight;
+        std::size_t kernelWidth;
+        std::size_t workspaceLimit;
+        int threadCount;
+        Epilogue epilogue;
+
+        bool isSparse;
+        SparseKernel2D<ResultType> sparseKernel;
+        SparseGather2D<ResultType> sparseGather;
+
+        xt::xtensor<ResultType, 2> kernelMatrix;
+        std::vector<int> indicesY;
+        std::vector<int> indicesX;
+
+        ResultType constantBeginY;
+        ResultType constantEndY;
+        ResultType constantBeginX;
+        ResultType constantEndX;
+
+        std::vector<ResultType> patchBuffer;
+        std::vector<ResultType> productBuffer;
+
+        void reserveWorkspace(std::size_t);
+        void run(const InputType*, ResultType*, std::size_t);
+
+        void buildPatchChannelFirst(const InputType*, ResultType*, std::size_t, std::size_t, std::size_t) const;
+        void buildPatchChannelLast(const InputType*, ResultType*, std::size_t, std::size_t) const;
+        void applyEpilogueRows(ResultType*, std::size_t, std::size_t) const;
+
+    public:
+        template <typename T>
+        ConvolutionPlan2D(const ShapeType&, const xt::xexpression<T>&, const KernelOptions2D&, const Epilogue& = Epilogue());
+
+        const ShapeType& getInputShape() const;
+        const ShapeType& getOutputShape() const;
+        BatchShapeType getBatchInputShape(std::size_t) const;
+        BatchShapeType getBatchOutputShape(std::size_t) const;
+
+        void execute(const xt::xtensor<InputType, 3>&, xt::xtensor<ResultType, 3>&);
+        void executeBatch(const xt::xtensor<InputType, 4>&, xt::xtensor<ResultType, 4>&);
+    }; // ConvolutionPlan2D
+
+    /*
+     * <p>
+     * Creates the plan for inputs of the given shape.
+     * </p>
+     *
+     * @tparam T derived type of the kernel xexpression
+     * @param shape input shape H x W x C or C x H x W depending on the channel position of the options
+     * @param kernelExpression xexpression containing the kernel data
+     * @param options2D object containing information about padding, stride, dilation, channel position, border
+                        treatment, algorithm, groups, thread count and workspace limit
+     * @param epilogue bias, scale, clipping and rounding which are applied to the result
+     * @throws std::invalid_argument * if the channel positions, algorithms or groups of optionsY and optionsX differ
+                                     * if IMPLICIT channel position is requested
+                                     * if another algorithm than GEMM or AUTO is requested
+                                     * if groups are requested for a kernel with channel axes
+                                     * if the input channels in the input shape and kernel do not align
+                                     * if the padded input is smaller than the dilated kernel
+                                     * if the bias of the epilogue does not match the output channels
+     */
+    template <typename InputType, typename KernelType>
+    template <typename T>
+    ConvolutionPlan2D<InputType, KernelType>::ConvolutionPlan2D(
+        const ShapeType& shape,
+        const xt::xexpression<T>& kernelExpression,
+        const KernelOptions2D& options2D,
+        const Epilogue& epilogue
+    ) : inputShape(shape), epilogue(epilogue) {
+        const KernelOptions& optionsY = options2D.optionsY;
+        const KernelOptions& optionsX = options2D.optionsX;
+
+        if (optionsY.channelPosition != optionsX.channelPosition) {
+            throw std::invalid_argument(
+                "ConvolutionPlan2D(): Channel can't be on different positions for optionsY and optionsX!"
+            );
+        }
+
+        if (optionsY.algorithm != optionsX.algorithm) {
+            throw std::invalid_argument(
+                "ConvolutionPlan2D(): Algorithm can't be different for optionsY and optionsX!"
+            );
+        }
+
+        if (optionsY.groups != optionsX.groups) {
+            throw std::invalid_argument(
+                "ConvolutionPlan2D(): Groups can't be different for optionsY and optionsX!"
+            );
+        }
+
+        if (optionsY.algorithm != Algorithm::GEMM && optionsY.algorithm != Algorithm::AUTO) {
+            throw std::invalid_argument("ConvolutionPlan2D(): Only the GEMM and AUTO algorithms can be planned!");
+        }
+
+        if (optionsY.channelPosition == ChannelPosition::IMPLICIT) {
+            throw std::invalid_argument(
+                "ConvolutionPlan2D(): Implicit channel option is not supported for explicit channels in input!"
+            );
+        }
+
+        if (optionsY.channelPosition == ChannelPosition::BLOCKED) {
+            throw std::invalid_argument(
+                "ConvolutionPlan2D(): Blocked channel option is only supported by convolve2DBlocked!"
+            );
+        }
+
+        this->isChannelFirst = optionsY.channelPosition == ChannelPosition::FIRST;
+        this->inputChannels = shape[this->isChannelFirst ? 0 : 2];
+        this->inputHeight = shape[this->isChannelFirst ? 1 : 0];
+        this->inputWidth = shape[this->isChannelFirst ? 2 : 1];
+
+        // a kernel without channel axes is promoted to the diagonal filter of its depthwise convolution, every other
+        // grouped kernel would need a block diagonal kernel matrix
+        bool isDepthwiseKernel = kernelExpression.derived_cast().dimension() <= 2 && optionsY.groups == static_cast<int>(this->inputChannels);
+        if (optionsY.groups != 1 && !isDepthwiseKernel) {
+            throw std::invalid_argument("ConvolutionPlan2D(): Groups are only supported for kernels without channel axes!");
+        }
+
+        xt::xtensor<KernelType, 4> kernel = promoteKernelToFull2D(kernelExpression.derived_cast(), this->inputChannels);
+
+        this->outputChannels = kernel.shape()[0];
+        this->kernelHeight = kernel.shape()[2];
+        this->kernelWidth = kernel.shape()[3];
+
+        if (this->inputChannels != kernel.shape()[1]) {
+            throw std::invalid_argument("ConvolutionPlan2D(): Input channels of input and kernel do not align!");
+        }
+
+        if (static_cast<int>(this->inputHeight) + optionsY.paddingTotal() < (static_cast<int>(this->kernelHeight) - 1) * optionsY.dilation + 1) {
+            throw std::invalid_argument("ConvolutionPlan2D(): Kernel height is greater than padded input height!");
+        }
+
+        if (static_cast<int>(this->inputWidth) + optionsX.paddingTotal() < (static_cast<int>(this->kernelWidth) - 1) * optionsX.dilation + 1) {
+            throw std::invalid_argument("ConvolutionPlan2D(): Kernel width is greater than padded input width!");
+        }
+
+        checkEpilogue(epilogue, this->outputChannels, "ConvolutionPlan2D()");
+
+        this->indicesY = calculateGatherIndices(static_cast<int>(this->inputHeight), static_cast<int>(this->kernelHeight), optionsY);
+        this->indicesX = calculateGatherIndices(static_cast<int>(this->inputWidth), static_cast<int>(this->kernelWidth), optionsX);
+        this->outputHeight = this->indicesY.size() / this->kernelHeight;
+        this->outputWidth = this->indicesX.size() / this->kernelWidth;
+
+        this->constantBeginY = gatherConstant<InputType, ResultType>(optionsY, CONSTANT_BEGIN_INDEX);
+        this->constantEndY = gatherConstant<InputType, ResultType>(optionsY, CONSTANT_END_INDEX);
+        this->constantBeginX = gatherConstant<InputType, ResultType>(optionsX, CONSTANT_BEGIN_INDEX);
+        this->constantEndX = gatherConstant<InputType, ResultType>(optionsX, CONSTANT_END_INDEX);
+
+        this->workspaceLimit = optionsY.workspaceLimit;
+        this->threadCount = optionsY.threadCount;
+
+        // with Algorithm::AUTO sparse kernels skip the kernel matrix and the patch workspace
+        this->isSparse = false;
+        if (optionsY.algorithm == Algorithm::AUTO) {
+            this->sparseKernel = collectNonZeroTaps<ResultType>(kernel);
+            this->isSparse = this->sparseKernel.isSparse(optionsY.channelPosition);
+        }
+
+        if (this->isSparse) {
+            this->sparseGather = calculateSparseGather2D<ResultType, InputType>(this->inputHeight, this->inputWidth, this->kernelHeight, this->kernelWidth, optionsY, optionsX);
+
+            if (this->isChannelFirst) {
+                this->outputShape = {this->outputChannels, this->outputHeight, this->outputWidth};
+            } else {
+                this->outputShape = {this->outputHeight, this->outputWidth, this->outputChannels};
+            }
+            return;
+        }
+
+        std::size_t depth = this->inputChannels * this->kernelHeight * this->kernelWidth;
+
+        if (this->isChannelFirst) {
+            this->outputShape = {this->outputChannels, this->outputHeight, this->outputWidth};
+
+            // OC x (IC, KH, KW), multiplied from the left with the patch
+            typename xt::xtensor<ResultType, 2>::shape_type kernelShape{this->outputChannels, depth};
+            this->kernelMatrix = xt::xtensor<ResultType, 2>(kernelShape);
+            for (std::size_t outputChannel = 0; outputChannel < this->outputChannels; ++outputChannel) {
+                for (std::size_t inputChannel = 0; inputChannel < this->inputChannels; ++inputChannel) {
+                    for (std::size_t kernelY = 0; kernelY < this->kernelHeight; ++kernelY) {
+                        for (std::size_t kernelX = 0; kernelX < this->kernelWidth; ++kernelX) {
+                            this->kernelMatrix(outputChannel, (inputChannel * this->kernelHeight + kernelY) * this->kernelWidth + kernelX) =
+                                static_cast<ResultType>(kernel(outputChannel, inputChannel, kernelY, kernelX));
+                        }
+                    }
+                }
+            }
+        } else {
+            this->outputShape = {this->outputHeight, this->outputWidth, this->outputChannels};
+
+            // (KH, KW, IC) x OC, so that every kernel tap gathers the contiguous channels of one pixel
+            typename xt::xtensor<ResultType, 2>::shape_type kernelShape{depth, this->outputChannels};
+            this->kernelMatrix = xt::xtensor<ResultType, 2>(kernelShape);
+            for (std::size_t outputChannel = 0; outputChannel < this->outputChannels; ++outputChannel) {
+                for (std::size_t inputChannel = 0; inputChannel < this->inputChannels; ++inputChannel) {
+                    for (std::size_t kernelY = 0; kernelY < this->kernelHeight; ++kernelY) {
+                        for (std::size_t kernelX = 0; kernelX < this->kernelWidth; ++kernelX) {
+                            this->kernelMatrix((kernelY * this->kernelWidth + kernelX) * this->inputChannels + inputChannel, outputChannel) =
+                                static_cast<ResultType>(kernel(outputChannel, inputChannel, kernelY, kernelX));
+                        }
+                    }
+                }
+            }
+        }
+
+        reserveWorkspace(1);
+    }
+
+    template <typename InputType, typename KernelType>
+    const typename ConvolutionPlan2D<InputType, KernelType>::ShapeType& ConvolutionPlan2D<InputType, KernelType>::getInputShape() const {
+        return this->inputShape;
+    }
+
+    template <typename InputType, typename KernelType>
+    const typename ConvolutionPlan2D<InputType, KernelType>::ShapeType& ConvolutionPlan2D<InputType, KernelType>::getOutputShape() const {
+        return this->outputShape;
+    }
+
+    template <typename InputType, typename KernelType>
+    typename ConvolutionPlan2D<InputType, KernelType>::BatchShapeType ConvolutionPlan2D<InputType, KernelType>::getBatchInputShape(std::size_t batchSize) const {
+        return {batchSize, this->inputShape[0], this->inputShape[1], this->inputShape[2]};
+    }
+
+    template <typename InputType, typename KernelType>
+    typename ConvolutionPlan2D<InputType, KernelType>::BatchShapeType ConvolutionPlan2D<InputType, KernelType>::getBatchOutputShape(std::size_t batchSize) const {
+        return {batchSize, this->outputShape[0], this->outputShape[1], this->outputShape[2]};
+    }
+
+    /*
+     * <p>
+     * Convolves the input with the planned kernel and writes the result into the given output.
+     * </p>
+     *
+     * @param input input of the planned shape
+     * @param output output of the shape returned by ConvolutionPlan2D#getOutputShape
+     * @throws std::invalid_argument * if the shape of input does not match the planned input shape
+                                     * if the shape of output does not match the planned output shape
+     */
+    template <typename InputType, typename KernelType>
+    void ConvolutionPlan2D<InputType, KernelType>::execute(
+        const xt::xtensor<InputType, 3>& input,
+        xt::xtensor<ResultType, 3>& output
+    ) {
+        if (!std::equal(input.shape().begin(), input.shape().end(), this->inputShape.begin())) {
+            throw std::invalid_argument("ConvolutionPlan2D#execute(): Input shape does not match the planned input shape!");
+        }
+
+        if (!std::equal(output.shape().begin(), output.shape().end(), this->outputShape.begin())) {
+            throw std::invalid_argument("ConvolutionPlan2D#execute(): Output shape does not match the planned output shape!");
+        }
+
+        run(input.data(), output.data(), 1);
+    }
+
+    /*
+     * <p>
+     * Convolves every image of the batch with the planned kernel and writes the results into the given output.
+     * The output rows of all images are folded into the rows of the GEMM, so the batch is multiplied in tiles which
+     * may span several images instead of one small multiplication per image. Kernel matrix, index tables and
+     * workspace are shared by all images; the workspace only grows if a larger batch allows larger tiles within the
+     * workspace limit.
+     * </p>
+     *
+     * @param input batch of shape N x H x W x C or N x C x H x W, see ConvolutionPlan2D#getBatchInputShape
+     * @param output batch of the shape returned by ConvolutionPlan2D#getBatchOutputShape for the same N
+     * @throws std::invalid_argument * if the image shape of input does not match the planned input shape
+                                     * if the shape of output does not match the planned batch output shape
+     */
+    template <typename InputType, typename KernelType>
+    void ConvolutionPlan2D<InputType, KernelType>::executeBatch(
+        const xt::xtensor<InputType, 4>& input,
+        xt::xtensor<ResultType, 4>& output
+    ) {
+        std::size_t batchSize = input.shape()[0];
+
+        if (!std::equal(input.shape().begin() + 1, input.shape().end(), this->inputShape.begin())) {
+            throw std::invalid_argument("ConvolutionPlan2D#executeBatch(): Input shape does not match the planned input shape!");
+        }
+
+        BatchShapeType batchOutputShape = getBatchOutputShape(batchSize);
+        if (!std::equal(output.shape().begin(), output.shape().end(), batchOutputShape.begin())) {
+            throw std::invalid_argument("ConvolutionPlan2D#executeBatch(): Output shape does not match the planned output shape!");
+        }
+
+        reserveWorkspace(batchSize);
+        run(input.data(), output.data(), batchSize);
+    }
+
+    /*
+     * <p>
+     * Grows the patch and product buffers to the largest tile the workspace limit allows for the given batch size.
+     * </p>
+     */
+    template <typename InputType, typename KernelType>
+    void ConvolutionPlan2D<InputType, KernelType>::reserveWorkspace(std::size_t batchSize) {
+        if (this->isSparse) {
+            return;
+        }
+
+        std::size_t depth = this->inputChannels * this->kernelHeight * this->kernelWidth;
+        std::size_t tileRows = static_cast<std::size_t>(calculateTileSize(
+            this->workspaceLimit,
+            depth * this->outputWidth * sizeof(ResultType),
+            static_cast<int>(batchSize * this->outputHeight)
+        ));
+
+        if (this->patchBuffer.size() < depth * tileRows * this->outputWidth) {
+            this->patchBuffer.resize(depth * tileRows * this->outputWidth);
+        }
+
+        if (this->isChannelFirst && this->productBuffer.size() < this->outputChannels * tileRows * this->outputWidth) {
+            this->productBuffer.resize(this->outputChannels * tileRows * this->outputWidth);
+        }
+    }
+
+    /*
+     * <p>
+     * Convolves batchSize consecutive images. The batch is processed in tiles of output rows; row r of the tile
+     * belongs to image r / H_out, so the patch of a tile is gathered in segments of rows from the same image.
+     * Sparse plans accumulate the non-zero taps of every image instead, with the output rows split over the threads.
+     * </p>
+     */
+    template <typename InputType, typename KernelType>
+    void ConvolutionPlan2D<InputType, KernelType>::run(
+        const InputType* input,
+        ResultType* output,
+        std::size_t batchSize
+    ) {
+        std::size_t depth = this->inputChannels * this->kernelHeight * this->kernelWidth;
+        std::size_t inputImageSize = this->inputChannels * this->inputHeight * this->inputWidth;
+        std::size_t outputImageSize = this->outputChannels * this->outputHeight * this->outputWidth;
+
+        if (this->isSparse) {
+            for (std::size_t image = 0; image < batchSize; ++image) {
+                const InputType* imageInput = input + image * inputImageSize;
+                ResultType* imageOutput = output + image * outputImageSize;
+                std::fill(imageOutput, imageOutput + outputImageSize, static_cast<ResultType>(0));
+
+                parallelFor(0, static_cast<int>(this->outputHeight), this->threadCount, [&](int rowBegin, int rowEnd) {
+                    accumulateSparseRows2D(
+                        this->sparseKernel,
+                        this->sparseGather,
+                        imageInput,
+                        this->isChannelFirst,
+                        this->inputHeight,
+                        this->inputWidth,
+                        imageOutput,
+                        0,
+                        this->outputHeight,
+                        static_cast<std::size_t>(rowBegin),
+                        static_cast<std::size_t>(rowEnd)
+                    );
+                    this->applyEpilogueRows(imageOutput, static_cast<std::size_t>(rowBegin), static_cast<std::size_t>(rowEnd));
+                });
+            }
+            return;
+        }
+
+        std::size_t totalRows = batchSize * this->outputHeight;
+        std::size_t tileRows = this->patchBuffer.size() / (depth * this->outputWidth);
+
+        for (std::size_t tileBegin = 0; tileBegin < totalRows; tileBegin += tileRows) {
+            std::size_t tileEnd = std::min(tileBegin + tileRows, totalRows);
+            std::size_t columns = (tileEnd - tileBegin) * this->outputWidth;
+
+            for (std::size_t row = tileBegin; row < tileEnd;) {
+                std::size_t image = row / this->outputHeight;
+                std::size_t rowBegin = row % this->outputHeight;
+                std::size_t rowEnd = std::min(this->outputHeight, rowBegin + tileEnd - row);
+                const InputType* imageInput = input + image * inputImageSize;
+
+                if (this->isChannelFirst) {
+                    ResultType* patch = this->patchBuffer.data() + (row - tileBegin) * this->outputWidth;
+                    this->buildPatchChannelFirst(imageInput, patch, rowBegin, rowEnd, columns);
+                } else {
+                    ResultType* patch = this->patchBuffer.data() + (row - tileBegin) * this->outputWidth * depth;
+                    this->buildPatchChannelLast(imageInput, patch, rowBegin, rowEnd);
+                }
+
+                row += rowEnd - rowBegin;
+            }
+
+            if (this->isChannelFirst) {
+                auto patch = xt::adapt(this->patchBuffer.data(), depth * columns, xt::no_ownership(), std::array<std::size_t, 2>{depth, columns});
+                auto product = xt::adapt(this->productBuffer.data(), this->outputChannels * columns, xt::no_ownership(), std::array<std::size_t, 2>{this->outputChannels, columns});
+                matrixProduct(this->kernelMatrix, patch, product, this->threadCount);
+
+                // the product holds OC x (rows, W_out), which is scattered back into the C x H x W images
+                for (std::size_t row = tileBegin; row < tileEnd;) {
+                    std::size_t image = row / this->outputHeight;
+                    std::size_t rowBegin = row % this->outputHeight;
+                    std::size_t rowEnd = std::min(this->outputHeight, rowBegin + tileEnd - row);
+                    std::size_t segmentSize = (rowEnd - rowBegin) * this->outputWidth;
+
+                    for (std::size_t outputChannel = 0; outputChannel < this->outputChannels; ++outputChannel) {
+                        const ResultType* source = this->productBuffer.data() + outputChannel * columns + (row - tileBegin) * this->outputWidth;
+                        ResultType* target = output + image * outputImageSize + (outputChannel * this->outputHeight + rowBegin) * this->outputWidth;
+                        std::copy(source, source + segmentSize, target);
+                    }
+
+                    this->applyEpilogueRows(output + image * outputImageSize, rowBegin, rowEnd);
+                    row += rowEnd - rowBegin;
+                }
+            } else {
+                // the rows of the tile are contiguous in the output, so the product is written in place
+                auto patch = xt::adapt(this->patchBuffer.data(), columns * depth, xt::no_ownership(), std::array<std::size_t, 2>{columns, depth});
+                auto product = xt::adapt(output + tileBegin * this->outputWidth * this->outputChannels, columns * this->outputChannels, xt::no_ownership(), std::array<std::size_t, 2>{columns, this->outputChannels});
+                matrixProduct(patch, this->kernelMatrix, product, this->threadCount);
+
+                for (std::size_t row = tileBegin; row < tileEnd;) {
+                    std::size_t image = row / this->outputHeight;
+                    std::size_t rowBegin = row % this->outputHeight;
+                    std::size_t rowEnd = std::min(this->outputHeight, rowBegin + tileEnd - row);
+                    this->applyEpilogueRows(output + image * outputImageSize, rowBegin, rowEnd);
+                    row += rowEnd - rowBegin;
+                }
+            }
+        }
+    }
+
+    template <typename InputType, typename KernelType>
+    void ConvolutionPlan2D<InputType, KernelType>::buildPatchChannelFirst(
+        const InputType* input,
+        ResultType* patch,
+        std::size_t tileBegin,
+        std::size_t tileEnd,
+        std::size_t columns
+    ) const {
+        for (std::size_t inputChannel = 0; inputChannel < this->inputChannels; ++inputChannel) {
+            for (std::size_t kernelY = 0; kernelY < this->kernelHeight; ++kernelY) {
+                for (std::size_t kernelX = 0; kernelX < this->kernelWidth; ++kernelX) {
+                    ResultType* patchRow = patch + ((inputChannel * this->kernelHeight + kernelY) * this->kernelWidth + kernelX) * columns;
+                    const int* indexRowX = this->indicesX.data() + kernelX * this->outputWidth;
+
+                    for (std::size_t outIndexY = tileBegin; outIndexY < tileEnd; ++outIndexY) {
+                        int inputY = this->indicesY[kernelY * this->outputHeight + outIndexY];
+                        ResultType* target = patchRow + (outIndexY - tileBegin) * this->outputWidth;
+
+                        if (inputY < 0) {
+                            std::fill(target, target + this->outputWidth, inputY == CONSTANT_BEGIN_INDEX ? this->constantBeginY : this->constantEndY);
+                            continue;
+                        }
+
+                        const InputType* inputRow = input + (inputChannel * this->inputHeight + static_cast<std::size_t>(inputY)) * this->inputWidth;
+
+                        for (std::size_t outIndexX = 0; outIndexX < this->outputWidth; ++outIndexX) {
+                            int inputX = indexRowX[outIndexX];
+                            target[outIndexX] = 0 <= inputX
+                                ? static_cast<ResultType>(inputRow[inputX])
+                                : (inputX == CONSTANT_BEGIN_INDEX ? this->constantBeginX : this->constantEndX);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    template <typename InputType, typename KernelType>
+    void ConvolutionPlan2D<InputType, KernelType>::buildPatchChannelLast(
+        const InputType* input,
+        ResultType* patch,
+        std::size_t tileBegin,
+        std::size_t tileEnd
+    ) const {
+        std::size_t depth = this->inputChannels * this->kernelHeight * this->kernelWidth;
+
+        for (std::size_t outIndexY = tileBegin; outIndexY < tileEnd; ++outIndexY) {
+            for (std::size_t outIndexX = 0; outIndexX < this->outputWidth; ++outIndexX) {
+                ResultType* patchRow = patch + ((outIndexY - tileBegin) * this->outputWidth + outIndexX) * depth;
+
+                for (std::size_t kernelY = 0; kernelY < this->kernelHeight; ++kernelY) {
+                    int inputY = this->indicesY[kernelY * this->outputHeight + outIndexY];
+
+                    for (std::size_t kernelX = 0; kernelX < this->kernelWidth; ++kernelX) {
+                        int inputX = this->indicesX[kernelX * this->outputWidth + outIndexX];
+                        ResultType* target = patchRow + (kernelY * this->kernelWidth + kernelX) * this->inputChannels;
+
+                        if (inputY < 0) {
+                            std::fill(target, target + this->inputChannels, inputY == CONSTANT_BEGIN_INDEX ? this->constantBeginY : this->constantEndY);
+                        } else if (inputX < 0) {
+                            std::fill(target, target + this->inputChannels, inputX == CONSTANT_BEGIN_INDEX ? this->constantBeginX : this->constantEndX);
+                        } else {
+                            const InputType* pixel = input + (static_cast<std::size_t>(inputY) * this->inputWidth + static_cast<std::size_t>(inputX)) * this->inputChannels;
+
+                            for (std::size_t inputChannel = 0; inputChannel < this->inputChannels; ++inputChannel) {
+                                target[inputChannel] = static_cast<ResultType>(pixel[inputChannel]);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    /*
+     * <p>
+     * Applies the epilogue of the plan in place to the output rows [rowBegin, rowEnd) of a single image.
+     * </p>
+     */
+    template <typename InputType, typename KernelType>
+    void ConvolutionPlan2D<InputType, KernelType>::applyEpilogueRows(
+        ResultType* image,
+        std::size_t rowBegin,
+        std::size_t rowEnd
+    ) const {
+        if (this->epilogue.isIdentity()) {
+            return;
+        }
+
+        std::size_t rowSize = (rowEnd - rowBegin) * this->outputWidth;
+
+        if (this->isChannelFirst) {
+            for (std::size_t outputChannel = 0; outputChannel < this->outputChannels; ++outputChannel) {
+                ResultType* channelRows = image + (outputChannel * this->outputHeight + rowBegin) * this->outputWidth;
+
+                for (std::size_t index = 0; index < rowSize; ++index) {
+                    channelRows[index] = this->epilogue.template apply<ResultType>(channelRows[index], outputChannel);
+                }
+            }
+        } else {
+            ResultType* pixels = image + rowBegin * this->outputWidth * this->outputChannels;
+
+            for (std::size_t pixel = 0; pixel < rowSize; ++pixel) {
+                for (std::size_t outputChannel = 0; outputChannel < this->outputChannels; ++outputChannel) {
+                    ResultType& value = pixels[pixel * this->outputChannels + outputChannel];
+                    value = this->epilogue.template apply<ResultType>(value, outputChannel);
+                }
+            }
+        }
+    }
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ class ConvolutionPlan2D - end                                                                                ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ convolve2DBatch - begin                                                                                      ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    /*
+     * <p>
+     * Calculates the explicit 2-dimensional convolution of every image of a batch with the same kernel.
+     * The batch is convolved by a single xvigra::ConvolutionPlan2D with ConvolutionPlan2D#executeBatch, so kernel
+     * promotion, gather indices and workspace are set up once and the output rows of all images are multiplied
+     * together. The result of every image is equal to xvigra::convolve2D with the same options and epilogue; only
+     * Algorithm::GEMM and Algorithm::AUTO are supported.
+     * </p>
+     *
+     * @tparam T derived type of the input xexpression
+     * @tparam O derived type of the kernel xexpression
+     * @param inputExpression xexpression containing the batch of shape N x H x W x C or N x C x H x W
+     * @param kernelExpression xexpression containing the kernel data
+     * @param options2D object containing information about padding, stride, dilation, channel position, border
+                        treatment, algorithm, groups, thread count and workspace limit
+     * @param epilogue bias, scale, clipping and rounding which are applied to the results
+     * @return the results of shape N x H' x W' x C' or N x C' x H' x W' as xt::xtensor
+     * @throws std::invalid_argument * if input is not 4 dimensional
+                                     * for every invalid configuration rejected by xvigra::ConvolutionPlan2D
+     */
+    template <typename T, typename O>
+    auto convolve2DBatch(
+        const xt::xexpression<T>& inputExpression,
+        const xt::xexpression<O>& kernelExpression,
+        const KernelOptions2D& options2D,
+        const Epilogue& epilogue = Epilogue()
+    ) {
+        using InputType = typename xt::xexpression<T>::derived_type::value_type;
+        using KernelType = typename xt::xexpression<O>::derived_type::value_type;
+        using ResultType = typename ConvolutionPlan2D<InputType, KernelType>::ResultType;
+
+        if (inputExpression.derived_cast().dimension() != 4) {
+            throw std::invalid_argument("convolve2DBatch(): Need 4 dimensional (N x H x W x C or N x C x H x W) input!");
+        }
+
+        xt::xtensor<InputType, 4> input = inputExpression.derived_cast();
+        std::array<std::size_t, 3> imageShape{input.shape()[1], input.shape()[2], input.shape()[3]};
+
+        ConvolutionPlan2D<InputType, KernelType> plan(imageShape, kernelExpression, options2D, epilogue);
+        xt::xtensor<ResultType, 4> result(plan.getBatchOutputShape(input.shape()[0]));
+
+        plan.executeBatch(input, result);
+        return result;
+    }
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ convolve2DBatch - end                                                                                        ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+} // xvigra
+
+#endif // XVIGRA_CONVOLUTION_PLAN_HPP
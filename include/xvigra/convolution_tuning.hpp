@@ -0,0 +1,636 @@
+#ifndef XVIGRA_CONVOLUTION_TUNING_HPP
+#define XVIGRA_CONVOLUTION_TUNING_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+#ifdef VOID
+#undef VOID
+#endif
+
+#include "xtensor/xexpression.hpp"
+#include "xtensor/xtensor.hpp"
+
+#include "xvigra/convolution_util.hpp"
+#include "xvigra/explicit_convolution.hpp"
+#include "xvigra/half_precision.hpp"
+#include "xvigra/kernel_util.hpp"
+#include "xvigra/sparse_convolution.hpp"
+#include "xvigra/thread_util.hpp"
+
+namespace xvigra {
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ forward declaration - begin                                                                                  ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    struct TuningResult;
+
+    class ConvolutionTuner;
+
+    template <typename T>
+    std::string tuningTypeName();
+
+    inline std::string algorithmName(Algorithm);
+
+    inline Algorithm parseAlgorithmName(const std::string&);
+
+    template <typename InputType, typename KernelType>
+    std::string createTuningKey2D(int, int, int, int, int, int, double, const KernelOptions2D&);
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ forward declaration - end                                                                                    ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ tuning key - begin                                                                                           ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    /*
+     * <p>
+     * Returns a short name of the value type which is stable across compilers, e.g. "f4" for float or "i2" for short.
+     * The 16-bit floating point types are "h2" for xvigra::Float16 and "b2" for xvigra::BFloat16.
+     * </p>
+     */
+    template <typename T>
+    std::string tuningTypeName() {
+        static_assert(isHalfPrecision<T> || std::is_arithmetic_v<T>, "tuningTypeName(): Only arithmetic types are supported!");
+
+        if constexpr (std::is_same_v<T, Float16>) {
+            return "h2";
+        } else if constexpr (std::is_same_v<T, BFloat16>) {
+            return "b2";
+        } else {
+            std::string prefix = std::is_floating_point_v<T> ? "f" : (std::is_signed_v<T> ? "i" : "u");
+            return prefix + std::to_string(sizeof(T));
+        }
+    }
+
+
+    /*
+     * <p>
+     * Returns the name of the algorithm as it is stored in the cache file of xvigra::ConvolutionTuner.
+     * </p>
+     */
+    inline std::string algorithmName(Algorithm algorithm) {
+        switch (algorithm) {
+            case Algorithm::GEMM:
+                return "GEMM";
+            case Algorithm::DIRECT:
+                return "DIRECT";
+            case Algorithm::WINOGRAD_2X2:
+                return "WINOGRAD_2X2";
+            case Algorithm::WINOGRAD_4X4:
+                return "WINOGRAD_4X4";
+            case Algorithm::FFT:
+                return "FFT";
+            case Algorithm::AUTO:
+                return "AUTO";
+            default:
+                throw std::invalid_argument("algorithmName(): Unknown algorithm!");
+        }
+    }
+
+    /*
+     * <p>
+     * Inverse of xvigra::algorithmName.
+     * </p>
+     *
+     * @throws std::invalid_argument if the name does not belong to an algorithm
+     */
+    inline Algorithm parseAlgorithmName(const std::string& name) {
+        for (Algorithm algorithm : {Algorithm::GEMM, Algorithm::DIRECT, Algorithm::WINOGRAD_2X2, Algorithm::WINOGRAD_4X4, Algorithm::FFT, Algorithm::AUTO}) {
+            if (algorithmName(algorithm) == name) {
+                return algorithm;
+            }
+        }
+
+        throw std::invalid_argument("parseAlgorithmName(): Unknown algorithm name '" + name + "'!");
+    }
+
+    /*
+     * <p>
+     * Creates the key under which xvigra::ConvolutionTuner stores the tuning result of an explicit 2-dimensional
+     * convolution. The key contains everything the backends' run time depends on: the input and full kernel shape,
+     * the fraction of non-zero kernel taps in per mille together with whether Algorithm::AUTO takes the sparse backend
+     * for it (see xvigra::SparseKernel2D#isSparse), the channel position, padding, stride, dilation, groups, the
+     * resolved thread count, the border treatment types and the value types. The values of constant borders and the
+     * algorithm and workspace limit of the options are not part of the key.
+     * The key contains no whitespace.
+     * </p>
+     *
+     * @tparam InputType value type of the input as it is stored, see xvigra::tuningTypeName
+     * @tparam KernelType value type of the kernel as it is stored, see xvigra::tuningTypeName
+     * @param inputChannels number of input channels
+     * @param inputHeight number of input elements along the height
+     * @param inputWidth number of input elements along the width
+     * @param outputChannels number of output channels
+     * @param kernelHeight number of kernel taps along the height
+     * @param kernelWidth number of kernel taps along the width
+     * @param kernelDensity fraction of non-zero kernel taps, see xvigra::SparseKernel2D#density
+     * @param options2D object containing information about padding, stride, dilation, channel position and border
+                        treatment
+     * @return the key of the configuration
+     */
+    template <typename InputType, typename KernelType>
+    std::string createTuningKey2D(
+        int inputChannels,
+        int inputHeight,
+        int inputWidth,
+        int outputChannels,
+        int kernelHeight,
+        int kernelWidth,
+        double kernelDensity,
+        const KernelOptions2D& options2D
+    ) {
+        const KernelOptions& optionsY = options2D.optionsY;
+        const KernelOptions& optionsX = options2D.optionsX;
+
+        std::ostringstream key;
+        key << "conv2d"
+            << ";in=" << inputChannels << "x" << inputHeight << "x" << inputWidth
+            << ";kernel=" << outputChannels << "x" << inputChannels << "x" << kernelHeight << "x" << kernelWidth
+            << ";density=" << std::lround(kernelDensity * 1000.0)
+            << ";sparse=" << (kernelDensity <= (optionsY.channelPosition == ChannelPosition::LAST ? SPARSE_TAP_DENSITY_CHANNEL_LAST : SPARSE_TAP_DENSITY))
+            << ";channel=" << (optionsY.channelPosition == ChannelPosition::FIRST ? "first" : "last")
+            << ";padding=" << optionsY.getPadding() << "," << optionsX.getPadding()
+            << ";stride=" << optionsY.stride << "," << optionsX.stride
+            << ";dilation=" << optionsY.dilation << "," << optionsX.dilation
+            << ";groups=" << optionsY.groups
+            << ";threads=" << resolveThreadCount(optionsY.threadCount)
+            << ";border=" << static_cast<int>(optionsY.borderTreatmentBegin.getType())
+            << "," << static_cast<int>(optionsY.borderTreatmentEnd.getType())
+            << "," << static_cast<int>(optionsX.borderTreatmentBegin.getType())
+            << "," << static_cast<int>(optionsX.borderTreatmentEnd.getType())
+            << ";type=" << tuningTypeName<InputType>() << "," << tuningTypeName<KernelType>();
+
+        return key.str();
+    }
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ tuning key - end                                                                                             ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ class ConvolutionTuner - begin                                                                               ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    // first line of every cache file; files with another header are ignored so that a format change can't mix entries
+    constexpr const char* TUNING_CACHE_HEADER = "# xvigra convolution tuning cache v1";
+
+    // workspace limits which are timed for Algorithm::GEMM; 0 means a single untiled patch
+    constexpr std::size_t TUNING_WORKSPACE_LIMITS[] = {
+        64 * 1024,
+        256 * 1024,
+        1024 * 1024,
+        DEFAULT_WORKSPACE_LIMIT,
+        16 * 1024 * 1024,
+        0
+    };
+
+    struct TuningResult {
+        Algorithm algorithm;
+        std::size_t workspaceLimit;
+        double seconds;
+    }; // TuningResult
+
+    /*
+     * <p>
+     * Opt-in autotuner for the explicit 2-dimensional convolution.
+     * The first time a configuration is seen, ConvolutionTuner#tune2D times every backend which can process it, and
+     * Algorithm::GEMM with every workspace limit of xvigra::TUNING_WORKSPACE_LIMITS which leads to a different tile
+     * height. For a sparse kernel Algorithm::AUTO, which then runs xvigra::sparseConvolve2D, is timed as well.
+     * The fastest choice is remembered under the key of xvigra::createTuningKey2D and returned for every later call
+     * with the same configuration.
+     * </p>
+     * <p>
+     * If the tuner has a cache file, the file is loaded by the constructor and every new result is written back
+     * immediately. Writing merges the entries other processes stored in the meantime and replaces the file
+     * atomically, so several processes can share a cache file. A tuner itself must not be used concurrently.
+     * The cache only holds measurements of the machine it was written on; it should not be copied between machines
+     * with different hardware.
+     * </p>
+     */
+    class ConvolutionTuner {
+    private:
+        std::string path;
+        int repetitions;
+        std::map<std::string, TuningResult> entries;
+
+        static std::map<std::string, TuningResult> readEntries(const std::string&);
+        static std::string createTemporaryPath(const std::string&);
+
+        template <typename T, typename O>
+        double measure(const xt::xexpression<T>&, const xt::xexpression<O>&, const KernelOptions2D&) const;
+
+    public:
+        explicit ConvolutionTuner(const std::string& path="", int repetitions=3);
+
+        const std::string& getPath() const;
+        int getRepetitions() const;
+        std::size_t size() const;
+
+        bool contains(const std::string&) const;
+        const TuningResult& get(const std::string&) const;
+        void put(const std::string&, const TuningResult&);
+
+        void load();
+        void save() const;
+
+        template <typename T, typename O>
+        KernelOptions2D tune2D(const xt::xexpression<T>&, const xt::xexpression<O>&, const KernelOptions2D&);
+    }; // ConvolutionTuner
+
+    /*
+     * <p>
+     * Creates a tuner and loads the cache file if it exists.
+     * </p>
+     *
+     * @param path cache file; an empty path keeps the results in memory only
+     * @param repetitions number of timed runs per candidate, of which the fastest counts
+     * @throws std::invalid_argument if repetitions is smaller than 1
+     * @throws std::runtime_error if the cache file exists but is malformed
+     */
+    ConvolutionTuner::ConvolutionTuner(const std::string& path, int repetitions)
+    : path(path), repetitions(repetitions), entries() {
+        if (repetitions < 1) {
+            throw std::invalid_argument("ConvolutionTuner(): Need at least one repetition!");
+        }
+
+        load();
+    }
+
+    const std::string& ConvolutionTuner::getPath() const {
+        return this->path;
+    }
+
+    int ConvolutionTuner::getRepetitions() const {
+        return this->repetitions;
+    }
+
+    std::size_t ConvolutionTuner::size() const {
+        return this->entries.size();
+    }
+
+    bool ConvolutionTuner::contains(const std::string& key) const {
+        return this->entries.find(key) != this->entries.end();
+    }
+
+    /*
+     * @throws std::out_of_range if there is no result for the key
+     */
+    const TuningResult& ConvolutionTuner::get(const std::string& key) const {
+        auto iter = this->entries.find(key);
+        if (iter == this->entries.end()) {
+            throw std::out_of_range("ConvolutionTuner#get(): No tuning result for key '" + key + "'!");
+        }
+
+        return iter->second;
+    }
+
+    void ConvolutionTuner::put(const std::string& key, const TuningResult& result) {
+        this->entries[key] = result;
+    }
+
+    /*
+     * <p>
+     * Reads all entries of a cache file. Missing files and files with another header yield no entries.
+     * Every entry is a line "key algorithm workspaceLimit seconds".
+     * </p>
+     *
+     * @throws std::runtime_error if an entry is malformed
+     */
+    std::map<std::string, TuningResult> ConvolutionTuner::readEntries(const std::string& path) {
+        std::map<std::string, TuningResult> result;
+        std::ifstream file(path);
+        std::string line;
+
+        if (!file || !std::getline(file, line) || line != TUNING_CACHE_HEADER) {
+            return result;
+        }
+
+        for (int lineNumber = 2; std::getline(file, line); ++lineNumber) {
+            if (line.empty() || line[0] == '#') {
+                continue;
+            }
+
+            std::istringstream stream(line);
+            std::string key;
+            std::string name;
+            TuningResult entry;
+
+            if (!(stream >> key >> name >> entry.workspaceLimit >> entry.seconds)) {
+                throw std::runtime_error(
+                    "ConvolutionTuner#load(): Malformed entry in line " + std::to_string(lineNumber) + " of '" + path + "'!"
+                );
+            }
+
+            try {
+                entry.algorithm = parseAlgorithmName(name);
+            } catch (const std::invalid_argument&) {
+                throw std::runtime_error(
+                    "ConvolutionTuner#load(): Unknown algorithm in line " + std::to_string(lineNumber) + " of '" + path + "'!"
+                );
+            }
+
+            result[key] = entry;
+        }
+
+        return result;
+    }
+
+    /*
+     * <p>
+     * Returns a name for a temporary file in the directory of the cache file which no other process uses, made of the
+     * cache file name, the process id and a random suffix. Renaming within a directory is atomic, which a temporary
+     * file in another directory would not guarantee.
+     * </p>
+     */
+    std::string ConvolutionTuner::createTemporaryPath(const std::string& path) {
+#ifdef _WIN32
+        long processId = static_cast<long>(_getpid());
+#else
+        long processId = static_cast<long>(getpid());
+#endif
+        std::random_device device;
+        std::mt19937_64 generator((static_cast<std::uint64_t>(device()) << 32) ^ device());
+
+        std::ostringstream name;
+        name << path << "." << processId << "." << std::hex << generator() << ".tmp";
+        return name.str();
+    }
+
+    /*
+     * <p>
+     * Adds all entries of the cache file which are not known yet. Does nothing without a cache file.
+     * </p>
+     *
+     * @throws std::runtime_error if the cache file is malformed
+     */
+    void ConvolutionTuner::load() {
+        if (this->path.empty()) {
+            return;
+        }
+
+        for (const auto& [key, entry] : readEntries(this->path)) {
+            this->entries.emplace(key, entry);
+        }
+    }
+
+    /*
+     * <p>
+     * Writes all entries to the cache file. Entries another process added to the file since it was read are kept;
+     * for keys known to both, the entry of this tuner wins. The file is written to a temporary file next to it first
+     * and then renamed, so readers never see a partially written cache. Every call uses its own temporary file, so
+     * concurrent writers can't corrupt each other's file; the last rename wins. Does nothing without a cache file.
+     * </p>
+     *
+     * @throws std::runtime_error if the cache file is malformed or can't be written
+     */
+    void ConvolutionTuner::save() const {
+        if (this->path.empty()) {
+            return;
+        }
+
+        std::map<std::string, TuningResult> merged = readEntries(this->path);
+        for (const auto& [key, entry] : this->entries) {
+            merged[key] = entry;
+        }
+
+        std::string temporaryPath = createTemporaryPath(this->path);
+        {
+            std::ofstream file(temporaryPath, std::ios::trunc);
+            file.precision(std::numeric_limits<double>::max_digits10);
+            file << TUNING_CACHE_HEADER << "\n";
+
+            for (const auto& [key, entry] : merged) {
+                file << key << " " << algorithmName(entry.algorithm) << " " << entry.workspaceLimit << " " << entry.seconds << "\n";
+            }
+
+            file.close();
+            if (!file) {
+                std::error_code ignored;
+                std::filesystem::remove(temporaryPath, ignored);
+                throw std::runtime_error("ConvolutionTuner#save(): Could not write '" + temporaryPath + "'!");
+            }
+        }
+
+        std::error_code error;
+        std::filesystem::rename(temporaryPath, this->path, error);
+        if (error) {
+            std::error_code ignored;
+            std::filesystem::remove(temporaryPath, ignored);
+            throw std::runtime_error("ConvolutionTuner#save(): Could not replace '" + this->path + "': " + error.message() + "!");
+        }
+    }
+
+    /*
+     * <p>
+     * Returns the fastest of ConvolutionTuner#getRepetitions() runs of xvigra::convolve2D in seconds.
+     * </p>
+     */
+    template <typename T, typename O>
+    double ConvolutionTuner::measure(
+        const xt::xexpression<T>& inputExpression,
+        const xt::xexpression<O>& kernelExpression,
+        const KernelOptions2D& options2D
+    ) const {
+        double fastest = std::numeric_limits<double>::infinity();
+
+        for (int repetition = 0; repetition < this->repetitions; ++repetition) {
+            auto start = std::chrono::steady_clock::now();
+            convolve2D(inputExpression, kernelExpression, options2D);
+            auto end = std::chrono::steady_clock::now();
+
+            fastest = std::min(fastest, std::chrono::duration<double>(end - start).count());
+        }
+
+        return fastest;
+    }
+
+    /*
+     * <p>
+     * Returns the options with the fastest algorithm and workspace limit for the convolution of the input with the
+     * kernel. Unknown configurations are timed on the given data and stored, which writes the cache file. The
+     * algorithm and workspace limit of the given options are ignored; everything else is kept.
+     * </p>
+     *
+     * @tparam T derived type of the input xexpression
+     * @tparam O derived type of the kernel xexpression
+     * @param inputExpression xexpression containing the input data
+     * @param kernelExpression xexpression containing the kernel data
+     * @param options2D object containing information about padding, stride, dilation, channel position and border
+                        treatment
+     * @return copy of the options with the tuned algorithm and workspace limit
+     * @throws std::invalid_argument * if input does not match the required shape
+                                     * if IMPLICIT channel position is requested
+                                     * for every other invalid configuration rejected by xvigra::convolve2D
+     * @throws std::runtime_error if the cache file can't be written
+     */
+    template <typename T, typename O>
+    KernelOptions2D ConvolutionTuner::tune2D(
+        const xt::xexpression<T>& inputExpression,
+        const xt::xexpression<O>& kernelExpression,
+        const KernelOptions2D& options2D
+    ) {
+        using InputType = typename xt::xexpression<T>::derived_type::value_type;
+        using RawKernelType = typename xt::xexpression<O>::derived_type::value_type;
+        // the candidates run with the result type of xvigra::convolve2D, which accumulates 16-bit floats in float
+        using KernelType = xvigra::AccumulationType<RawKernelType>;
+        using ResultType = xvigra::AccumulationType<std::common_type_t<InputType, KernelType>>;
+
+        const auto& input = inputExpression.derived_cast();
+        const KernelOptions& optionsY = options2D.optionsY;
+        const KernelOptions& optionsX = options2D.optionsX;
+
+        if (optionsY.channelPosition == ChannelPosition::IMPLICIT) {
+            throw std::invalid_argument(
+                "ConvolutionTuner#tune2D(): Implicit channel option is not supported for explicit channels in input!"
+            );
+        }
+
+        if (optionsY.channelPosition == ChannelPosition::BLOCKED) {
+            throw std::invalid_argument(
+                "ConvolutionTuner#tune2D(): Blocked channel option is only supported by convolve2DBlocked!"
+            );
+        }
+
+        if (input.dimension() != 3) {
+            throw std::invalid_argument("ConvolutionTuner#tune2D(): Need 3 dimensional (H x W x C or C x H x W) input!");
+        }
+
+        bool isChannelFirst = optionsY.channelPosition == ChannelPosition::FIRST;
+        int inputChannels = static_cast<int>(input.shape()[isChannelFirst ? 0 : 2]);
+        int inputHeight = static_cast<int>(input.shape()[isChannelFirst ? 1 : 0]);
+        int inputWidth = static_cast<int>(input.shape()[isChannelFirst ? 2 : 1]);
+
+        // every group is convolved on its own, see xvigra::convolve2D
+        const auto& kernel = kernelExpression.derived_cast();
+        std::size_t kernelDimension = kernel.dimension();
+        int groups = std::max(kernelDimension <= 2 ? inputChannels : optionsY.groups, 1);
+        int groupInputChannels = inputChannels / groups;
+        int groupOutputChannels = kernelDimension == 4 ? static_cast<int>(kernel.shape()[0]) / groups : groupInputChannels;
+        int kernelHeight = static_cast<int>(kernel.shape()[kernelDimension == 1 ? 0 : kernelDimension - 2]);
+        int kernelWidth = static_cast<int>(kernel.shape()[kernelDimension - 1]);
+
+        KernelOptions2D keyOptions = options2D;
+        keyOptions.setGroups(groups);
+
+        // the density of the non-zero taps decides whether Algorithm::AUTO takes the sparse backend
+        SparseKernel2D<ResultType> sparseKernel = collectNonZeroTaps<ResultType>(promoteKernelToFull2D(kernel, static_cast<std::size_t>(groupInputChannels)));
+
+        // the key names the stored types, so that a 16-bit kernel never shares the entry of a float kernel
+        std::string key = createTuningKey2D<InputType, RawKernelType>(
+            inputChannels,
+            inputHeight,
+            inputWidth,
+            groups * groupOutputChannels,
+            kernelHeight,
+            kernelWidth,
+            sparseKernel.density(),
+            keyOptions
+        );
+
+        KernelOptions2D result = options2D;
+
+        auto iter = this->entries.find(key);
+        if (iter != this->entries.end()) {
+            result.setAlgorithm(iter->second.algorithm);
+            result.setWorkspaceLimit(iter->second.workspaceLimit);
+            return result;
+        }
+
+        TuningResult best{Algorithm::GEMM, optionsY.workspaceLimit, std::numeric_limits<double>::infinity()};
+        KernelOptions2D candidate = options2D;
+
+        // tiles of equal height run the same code, so only workspace limits with a new tile height are timed
+        int outputHeight = calculateOutputSize(inputHeight, kernelHeight, optionsY);
+        int outputWidth = calculateOutputSize(inputWidth, kernelWidth, optionsX);
+        std::size_t patchRowBytes = static_cast<std::size_t>(groupInputChannels) * kernelHeight * kernelWidth * outputWidth * sizeof(ResultType);
+        std::vector<int> timedTileHeights;
+
+        candidate.setAlgorithm(Algorithm::GEMM);
+        for (std::size_t workspaceLimit : TUNING_WORKSPACE_LIMITS) {
+            int tileHeight = calculateTileSize(workspaceLimit, patchRowBytes, outputHeight);
+            if (std::find(timedTileHeights.begin(), timedTileHeights.end(), tileHeight) != timedTileHeights.end()) {
+                continue;
+            }
+            timedTileHeights.push_back(tileHeight);
+
+            candidate.setWorkspaceLimit(workspaceLimit);
+            double seconds = measure(input, kernel, candidate);
+            if (seconds < best.seconds) {
+                best = TuningResult{Algorithm::GEMM, workspaceLimit, seconds};
+            }
+        }
+
+        // the other backends don't build a patch, so their workspace limit is irrelevant
+        candidate.setWorkspaceLimit(optionsY.workspaceLimit);
+        for (Algorithm algorithm : {Algorithm::DIRECT, Algorithm::WINOGRAD_2X2, Algorithm::WINOGRAD_4X4, Algorithm::FFT}) {
+            double estimatedCost = estimateAlgorithmCost2D(
+                algorithm,
+                groupInputChannels,
+                inputHeight,
+                inputWidth,
+                groupOutputChannels,
+                kernelHeight,
+                kernelWidth,
+                optionsY,
+                optionsX,
+                std::is_floating_point_v<ResultType>
+            );
+
+            if (std::isinf(estimatedCost)) {
+                continue;
+            }
+
+            candidate.setAlgorithm(algorithm);
+            double seconds = measure(input, kernel, candidate);
+            if (seconds < best.seconds) {
+                best = TuningResult{algorithm, optionsY.workspaceLimit, seconds};
+            }
+        }
+
+        // Algorithm::AUTO is only timed when it runs the sparse backend, see xvigra::convolve2D
+        if (sparseKernel.isSparse(optionsY.channelPosition) && !isPointwise2D(kernelHeight, kernelWidth, optionsY, optionsX)) {
+            candidate.setAlgorithm(Algorithm::AUTO);
+            double seconds = measure(input, kernel, candidate);
+            if (seconds < best.seconds) {
+                best = TuningResult{Algorithm::AUTO, optionsY.workspaceLimit, seconds};
+            }
+        }
+
+        this->entries[key] = best;
+        save();
+
+        result.setAlgorithm(best.algorithm);
+        result.setWorkspaceLimit(best.workspaceLimit);
+        return result;
+    }
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ class ConvolutionTuner - end                                                                                 ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+} // xvigra
+
+#endif // XVIGRA_CONVOLUTION_TUNING_HPP
@@ -1,19 +1,29 @@
 #ifndef XVIGRA_CONVOLUTION_UTIL_HPP
 #define XVIGRA_CONVOLUTION_UTIL_HPP
 
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <complex>
+#include <cstddef>
+#include <limits>
 #include <ostream>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 #ifdef VOID
 #undef VOID
 #endif
 
+#include <xtensor/xbuilder.hpp>
 #include <xtensor/xexpression.hpp>
 #include <xtensor/xtensor.hpp>
 #include <xtensor/xview.hpp>
 
+#include <xvigra/fft.hpp>
 #include <xvigra/math.hpp>
+#include <xvigra/workspace.hpp>
 
 namespace xvigra {
     // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
@@ -22,6 +32,10 @@ namespace xvigra {
 
     enum class ChannelPosition;
 
+    enum class Algorithm;
+
+    enum class KernelSymmetry;
+
     enum class BorderTreatmentType;
 
     class BorderTreatment;
@@ -37,6 +51,38 @@ namespace xvigra {
 
     inline int calculateOutputSize(int, int, const KernelOptions&);
 
+    inline std::pair<int, int> calculateInteriorRange(int, int, const KernelOptions&);
+
+    inline int calculateTileSize(std::size_t, std::size_t, int);
+
+    inline std::size_t calculateFFTHeight(std::size_t, std::size_t, std::size_t, std::size_t, std::size_t);
+
+    inline std::vector<int> calculateGatherIndices(int, int, const KernelOptions&);
+
+    inline std::vector<int> calculatePaddedSourceIndices(int, int, const KernelOptions&);
+
+    inline bool isPointwise2D(int, int, const KernelOptions&, const KernelOptions&);
+
+    inline double estimateAlgorithmCost1D(Algorithm, int, int, int, int, const KernelOptions&);
+
+    inline Algorithm selectAlgorithm1D(int, int, int, int, const KernelOptions&);
+
+    inline double estimateAlgorithmCost2D(Algorithm, int, int, int, int, int, int, const KernelOptions&, const KernelOptions&, bool);
+
+    inline Algorithm selectAlgorithm2D(int, int, int, int, int, int, const KernelOptions&, const KernelOptions&, bool);
+
+    template <typename T>
+    auto toChannelBlocked(const xt::xexpression<T>&, const ChannelPosition&);
+
+    template <typename T>
+    auto fromChannelBlocked(const xt::xexpression<T>&, std::size_t, const ChannelPosition&);
+
+    template <typename T>
+    KernelSymmetry detectKernelSymmetry(const xt::xexpression<T>&);
+
+    template <typename T>
+    KernelSymmetry resolveKernelSymmetry(const xt::xexpression<T>&, const KernelOptions&);
+
     // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
     // ║ forward declaration - end                                                                                    ║
     // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
@@ -46,10 +92,12 @@ namespace xvigra {
     // ║ enum class ChannelPosition - begin                                                                           ║
     // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
 
+    // BLOCKED is the channel blocked layout C/8 x H x W x 8 (NCHWc), see xvigra::toChannelBlocked
     enum class ChannelPosition {
         FIRST,
         LAST,
-        IMPLICIT
+        IMPLICIT,
+        BLOCKED
     }; // ChannelPosition
 
     std::ostream& operator<<(std::ostream& out, const ChannelPosition& type) {
@@ -60,6 +108,8 @@ namespace xvigra {
                 return out << "ChannelPosition::LAST";
             case ChannelPosition::IMPLICIT:
                 return out << "ChannelPosition::IMPLICIT";
+            case ChannelPosition::BLOCKED:
+                return out << "ChannelPosition::BLOCKED";
             default:
                 return out << "Unknown ChannelPosition";
         }
@@ -71,6 +121,97 @@ namespace xvigra {
     // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
 
 
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ enum class Algorithm - begin                                                                                 ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    /*
+     * <p>
+     * Selects the backend which is used by the explicit convolution.
+     * GEMM builds the im2col patch and multiplies it with the kernel matrix, DIRECT reads the input in place and
+     * accumulates every kernel tap straight into the output.
+     * WINOGRAD_2X2 and WINOGRAD_4X4 use the minimal filtering algorithms F(2x2, 3x3) and F(4x4, 3x3) of Lavin A. and
+     * Gray S. and are only available for 3x3 kernels with stride 1 and dilation 1.
+     * FFT multiplies the spectra of the padded input and the kernel, which is the fastest choice for large kernels.
+     * AUTO estimates the cost of every applicable backend with xvigra::estimateAlgorithmCost1D and
+     * xvigra::estimateAlgorithmCost2D and uses the cheapest one.
+     * </p>
+     */
+    enum class Algorithm {
+        GEMM,
+        DIRECT,
+        WINOGRAD_2X2,
+        WINOGRAD_4X4,
+        FFT,
+        AUTO
+    }; // Algorithm
+
+    std::ostream& operator<<(std::ostream& out, const Algorithm& algorithm) {
+        switch (algorithm) {
+            case Algorithm::GEMM:
+                return out << "Algorithm::GEMM";
+            case Algorithm::DIRECT:
+                return out << "Algorithm::DIRECT";
+            case Algorithm::WINOGRAD_2X2:
+                return out << "Algorithm::WINOGRAD_2X2";
+            case Algorithm::WINOGRAD_4X4:
+                return out << "Algorithm::WINOGRAD_4X4";
+            case Algorithm::FFT:
+                return out << "Algorithm::FFT";
+            case Algorithm::AUTO:
+                return out << "Algorithm::AUTO";
+            default:
+                return out << "Unknown Algorithm";
+        }
+    }
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ enum class Algorithm - end                                                                                   ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ enum class KernelSymmetry - begin                                                                            ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    /*
+     * <p>
+     * Symmetry of a 1-dimensional kernel k of size K. SYMMETRIC kernels satisfy k[i] = k[K - 1 - i], e.g. the
+     * kernels of xvigra::initGaussian, and ANTISYMMETRIC kernels satisfy k[i] = -k[K - 1 - i], e.g. the first
+     * derivative of xvigra::initGaussianDerivative. The explicit convolution of such a depthwise 1-dimensional kernel
+     * adds or subtracts the mirrored input samples before multiplying, which halves the multiplications.
+     * The folding only applies to Algorithm::DIRECT and Algorithm::AUTO, so an explicitly requested GEMM always runs
+     * as requested. AUTO detects the symmetry from the kernel values and NONE disables the folding. A declared
+     * symmetry skips the detection, but is still checked against the taps, see xvigra::resolveKernelSymmetry.
+     * </p>
+     */
+    enum class KernelSymmetry {
+        AUTO,
+        NONE,
+        SYMMETRIC,
+        ANTISYMMETRIC
+    }; // KernelSymmetry
+
+    std::ostream& operator<<(std::ostream& out, const KernelSymmetry& symmetry) {
+        switch (symmetry) {
+            case KernelSymmetry::AUTO:
+                return out << "KernelSymmetry::AUTO";
+            case KernelSymmetry::NONE:
+                return out << "KernelSymmetry::NONE";
+            case KernelSymmetry::SYMMETRIC:
+                return out << "KernelSymmetry::SYMMETRIC";
+            case KernelSymmetry::ANTISYMMETRIC:
+                return out << "KernelSymmetry::ANTISYMMETRIC";
+            default:
+                return out << "Unknown KernelSymmetry";
+        }
+    }
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ enum class KernelSymmetry - end                                                                              ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
     // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
     // ║ enum class BorderTreatmentType - begin                                                                       ║
     // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
@@ -182,6 +323,9 @@ namespace xvigra {
     // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
     // ║ class KernelOptions - begin                                                                                  ║
     // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+    // upper bound in bytes for the im2col patch of a single GEMM call; 0 means unbounded
+    constexpr std::size_t DEFAULT_WORKSPACE_LIMIT = 4 * 1024 * 1024;
+
     class KernelOptions {
     private:
         int padding;
@@ -192,6 +336,12 @@ namespace xvigra {
         ChannelPosition channelPosition;
         BorderTreatment borderTreatmentBegin;
         BorderTreatment borderTreatmentEnd;
+        Algorithm algorithm;
+        std::size_t workspaceLimit;
+        int threadCount;
+        int groups;
+        KernelSymmetry kernelSymmetry;
+        Workspace* workspace;
 
         KernelOptions(
             int padding=0, 
@@ -204,7 +354,13 @@ namespace xvigra {
           dilation(dilation), 
           channelPosition(channelPosition),
           borderTreatmentBegin(BorderTreatment::constant(0)),
-          borderTreatmentEnd(BorderTreatment::constant(0))
+          borderTreatmentEnd(BorderTreatment::constant(0)),
+          algorithm(Algorithm::GEMM),
+          workspaceLimit(DEFAULT_WORKSPACE_LIMIT),
+          threadCount(1),
+          groups(1),
+          kernelSymmetry(KernelSymmetry::AUTO),
+          workspace(nullptr)
         {}
 
         int getPadding() const;
@@ -222,6 +378,13 @@ namespace xvigra {
         void setBorderTreatment(const BorderTreatment&, const BorderTreatment&);
         void setBorderTreatmentBegin(const BorderTreatment&);
         void setBorderTreatmentEnd(const BorderTreatment&);
+
+        void setAlgorithm(const Algorithm&);
+        void setWorkspaceLimit(std::size_t);
+        void setThreadCount(int);
+        void setGroups(int);
+        void setKernelSymmetry(const KernelSymmetry&);
+        void setWorkspace(Workspace*);
     }; // KernelOptions
 
     std::ostream& operator<<(std::ostream& out, const KernelOptions& options) {
@@ -233,6 +396,11 @@ namespace xvigra {
                    << ", channelPosition=" << options.channelPosition
                    << ", borderTreatmentBegin=" << options.borderTreatmentBegin
                    << ", borderTreatmentEnd=" << options.borderTreatmentEnd
+                   << ", algorithm=" << options.algorithm
+                   << ", workspaceLimit=" << options.workspaceLimit
+                   << ", threadCount=" << options.threadCount
+                   << ", groups=" << options.groups
+                   << ", kernelSymmetry=" << options.kernelSymmetry
                    <<  "}";
     }
 
@@ -293,6 +461,34 @@ namespace xvigra {
         this->borderTreatmentEnd = endTreatment;
     }
 
+    void KernelOptions::setAlgorithm(const Algorithm& algorithm) {
+        this->algorithm = algorithm;
+    }
+
+    void KernelOptions::setWorkspaceLimit(std::size_t workspaceLimit) {
+        this->workspaceLimit = workspaceLimit;
+    }
+
+    // number of threads which build the im2col patch; 0 uses one thread per hardware thread
+    void KernelOptions::setThreadCount(int threadCount) {
+        this->threadCount = threadCount;
+    }
+
+    // number of channel groups which are convolved independently; the input channels must be a multiple of it
+    void KernelOptions::setGroups(int groups) {
+        this->groups = groups;
+    }
+
+    // symmetry of a 1-dimensional kernel, see xvigra::KernelSymmetry; only the DIRECT and AUTO algorithms fold it
+    void KernelOptions::setKernelSymmetry(const KernelSymmetry& kernelSymmetry) {
+        this->kernelSymmetry = kernelSymmetry;
+    }
+
+    // arena for the scratch memory of the convolution, which is not owned; nullptr uses xvigra::threadLocalWorkspace
+    void KernelOptions::setWorkspace(Workspace* workspace) {
+        this->workspace = workspace;
+    }
+
     // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
     // ║ class KernelOptions - end                                                                                    ║
     // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
@@ -324,6 +520,13 @@ namespace xvigra {
         void setBorderTreatmentBegin(const BorderTreatment&, const BorderTreatment&);
         void setBorderTreatmentEnd(const BorderTreatment&);
         void setBorderTreatmentEnd(const BorderTreatment&, const BorderTreatment&);
+        void setAlgorithm(const Algorithm&);
+        void setWorkspaceLimit(std::size_t);
+        void setThreadCount(int);
+        void setGroups(int);
+        void setKernelSymmetry(const KernelSymmetry&);
+        void setKernelSymmetry(const KernelSymmetry&, const KernelSymmetry&);
+        void setWorkspace(Workspace*);
     }; // KernelOptions2D
 
     void KernelOptions2D::setPadding(int padding) {
@@ -387,11 +590,120 @@ namespace xvigra {
         this->optionsX.borderTreatmentEnd = treatmentX;
     }
 
+    void KernelOptions2D::setAlgorithm(const Algorithm& algorithm) {
+        this->optionsY.algorithm = algorithm;
+        this->optionsX.algorithm = algorithm;
+    }
+
+    void KernelOptions2D::setWorkspaceLimit(std::size_t workspaceLimit) {
+        this->optionsY.workspaceLimit = workspaceLimit;
+        this->optionsX.workspaceLimit = workspaceLimit;
+    }
+
+    void KernelOptions2D::setThreadCount(int threadCount) {
+        this->optionsY.threadCount = threadCount;
+        this->optionsX.threadCount = threadCount;
+    }
+
+    void KernelOptions2D::setGroups(int groups) {
+        this->optionsY.groups = groups;
+        this->optionsX.groups = groups;
+    }
+
+    void KernelOptions2D::setKernelSymmetry(const KernelSymmetry& kernelSymmetry) {
+        setKernelSymmetry(kernelSymmetry, kernelSymmetry);
+    }
+
+    void KernelOptions2D::setKernelSymmetry(const KernelSymmetry& kernelSymmetryY, const KernelSymmetry& kernelSymmetryX) {
+        this->optionsY.kernelSymmetry = kernelSymmetryY;
+        this->optionsX.kernelSymmetry = kernelSymmetryX;
+    }
+
+    void KernelOptions2D::setWorkspace(Workspace* workspace) {
+        this->optionsY.workspace = workspace;
+        this->optionsX.workspace = workspace;
+    }
+
     // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
     // ║ class KernelOptions2D - end                                                                                  ║
     // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
     
 
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ border index - begin                                                                                         ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    #define XVIGRA_GET_BEGIN_BORDER_INDEX(value, treatment, index, size) {                      \
+        switch((treatment).getType()) {                                                         \
+            case xvigra::BorderTreatmentType::ASYMMETRIC_REFLECT: {                             \
+                (value) = std::abs((index));                                                    \
+                break;                                                                          \
+            }                                                                                   \
+            case xvigra::BorderTreatmentType::AVOID: {                                          \
+                throw std::domain_error(                                                        \
+                    "getBorderIndex(): Border treatment AVOID should not be used here!"         \
+                );                                                                              \
+            }                                                                                   \
+            case xvigra::BorderTreatmentType::CONSTANT: {                                       \
+                (value) = -1;                                                                   \
+                break;                                                                          \
+            }                                                                                   \
+            case xvigra::BorderTreatmentType::REPEAT: {                                         \
+                (value) = 0;                                                                    \
+                break;                                                                          \
+            }                                                                                   \
+            case xvigra::BorderTreatmentType::SYMMETRIC_REFLECT: {                              \
+                (value) = std::abs((index) + 1);                                                \
+                break;                                                                          \
+            }                                                                                   \
+            case xvigra::BorderTreatmentType::WRAP: {                                           \
+                (value) = (index) + (size);                                                     \
+                break;                                                                          \
+            }                                                                                   \
+            default: {                                                                          \
+                throw std::domain_error("getBorderIndex(): Unknown begin border treatment!");   \
+            }                                                                                   \
+        }                                                                                       \
+    }
+
+    #define XVIGRA_GET_END_BORDER_INDEX(value, treatment, index, size) {                      \
+        switch((treatment).getType()) {                                                       \
+            case xvigra::BorderTreatmentType::ASYMMETRIC_REFLECT: {                           \
+                (value) = 2 * (size) - (index) - 2;                                           \
+                break;                                                                        \
+            }                                                                                 \
+            case xvigra::BorderTreatmentType::AVOID: {                                        \
+                throw std::domain_error(                                                      \
+                    "getBorderIndex(): Border treatment AVOID should not be used here!"       \
+                );                                                                            \
+            }                                                                                 \
+            case xvigra::BorderTreatmentType::CONSTANT: {                                     \
+                (value) = -1;                                                                 \
+                break;                                                                        \
+            }                                                                                 \
+            case xvigra::BorderTreatmentType::REPEAT: {                                       \
+                (value) = (size) - 1;                                                         \
+                break;                                                                        \
+            }                                                                                 \
+            case xvigra::BorderTreatmentType::SYMMETRIC_REFLECT: {                            \
+                (value) = 2 * (size) - (index) - 1;                                           \
+                break;                                                                        \
+            }                                                                                 \
+            case xvigra::BorderTreatmentType::WRAP: {                                         \
+                (value) = (index) - (size);                                                   \
+                break;                                                                        \
+            }                                                                                 \
+            default: {                                                                        \
+                throw std::domain_error("getBorderIndex(): Unknown end border treatment!");   \
+            }                                                                                 \
+        }                                                                                     \
+    }
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ border index - end                                                                                           ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
     // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
     // ║ general utility - begin                                                                                      ║
     // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
@@ -418,9 +730,702 @@ namespace xvigra {
         return static_cast<int>(std::floor((static_cast<double>(inputSize + options.paddingTotal() - options.dilation * (kernelSize - 1) - 1) / options.stride) + 1));
     }
 
+    /*
+     * <p>
+     * Calculates the range of output indices along one axis for which every kernel tap reads inside of the input.
+     * Only the output indices outside of this range need any border treatment.
+     * </p>
+     *
+     * @param inputSize number of input elements along the axis
+     * @param kernelSize number of kernel taps along the axis
+     * @param options object containing information about padding, stride, dilation and border treatment
+     * @return pair (begin, end) of output indices; the range is empty if begin == end
+     */
+    inline std::pair<int, int> calculateInteriorRange(
+        int inputSize,
+        int kernelSize,
+        const KernelOptions& options
+    ) {
+        int outputSize = calculateOutputSize(inputSize, kernelSize, options);
+        int paddingBegin = options.paddingBegin();
+
+        int lastFreeIndex = inputSize - 1 + paddingBegin - options.dilation * (kernelSize - 1);
+        int begin = std::min((paddingBegin + options.stride - 1) / options.stride, outputSize);
+        int end = lastFreeIndex < 0 ? 0 : lastFreeIndex / options.stride + 1;
+
+        return std::make_pair(begin, std::min(std::max(end, begin), outputSize));
+    }
+
+    /*
+     * <p>
+     * Calculates how many output rows (or columns) fit into one tile of the im2col patch without exceeding the
+     * workspace limit. At least one unit is always returned so that the convolution can progress.
+     * </p>
+     *
+     * @param workspaceLimit upper bound in bytes for the patch; 0 means unbounded
+     * @param bytesPerUnit number of patch bytes needed for a single output row (or column)
+     * @param totalUnits number of output rows (or columns) which have to be processed
+     * @return number of output rows (or columns) per tile
+     */
+    inline int calculateTileSize(
+        std::size_t workspaceLimit,
+        std::size_t bytesPerUnit,
+        int totalUnits
+    ) {
+        if (workspaceLimit == 0 || bytesPerUnit == 0) {
+            return totalUnits;
+        }
+
+        std::size_t units = workspaceLimit / bytesPerUnit;
+        return static_cast<int>(std::max<std::size_t>(1, std::min<std::size_t>(units, static_cast<std::size_t>(totalUnits))));
+    }
+
+    /*
+     * <p>
+     * Calculates the height of the transforms of xvigra::fftConvolve2D, which processes the output in bands of rows.
+     * Starting with a transform which covers the whole padded input, the height is halved while the spectra of one
+     * band exceed the workspace limit and the halved transform still holds the dilated kernel. A transform of height
+     * T covers (T - kernelExtent) / stride + 1 output rows.
+     * </p>
+     *
+     * @param workspaceLimit upper bound in bytes for the spectra of one band; 0 means unbounded
+     * @param inputChannels number of input channels, whose spectra are kept for the whole band
+     * @param paddedHeight number of rows of the padded input
+     * @param fftWidth number of columns of the transforms; a power of two
+     * @param kernelExtent number of padded rows which are spanned by the dilated kernel
+     * @return height of the transforms; a power of two
+     */
+    inline std::size_t calculateFFTHeight(
+        std::size_t workspaceLimit,
+        std::size_t inputChannels,
+        std::size_t paddedHeight,
+        std::size_t fftWidth,
+        std::size_t kernelExtent
+    ) {
+        std::size_t result = nextPowerOfTwo(paddedHeight);
+
+        if (workspaceLimit == 0) {
+            return result;
+        }
+
+        // the input spectra of the band, the kernel spectrum, the accumulator and the buffer of the transform
+        // besides the real image
+        auto bandBytes = [&](std::size_t height) {
+            return (inputChannels + 3) * height * (fftWidth / 2 + 1) * sizeof(std::complex<double>)
+                 + height * fftWidth * sizeof(double);
+        };
+
+        std::size_t minimalHeight = nextPowerOfTwo(kernelExtent);
+        while (minimalHeight < result && workspaceLimit < bandBytes(result)) {
+            result /= 2;
+        }
+
+        return result;
+    }
+
+    constexpr int CONSTANT_BEGIN_INDEX = -1;
+    constexpr int CONSTANT_END_INDEX = -2;
+
+    /*
+     * <p>
+     * Calculates for every kernel tap and every output position along one axis the input index which is read by the
+     * explicit convolution. Positions outside of the input are resolved with the border treatments of the options;
+     * positions covered by a constant border are marked with xvigra::CONSTANT_BEGIN_INDEX or
+     * xvigra::CONSTANT_END_INDEX.
+     * </p>
+     *
+     * @param inputSize number of input elements along the axis
+     * @param kernelSize number of kernel taps along the axis
+     * @param options object containing information about padding, stride, dilation and border treatment
+     * @return vector of size kernelSize * outputSize, entry [kernelIndex * outputSize + outIndex] holds the input index
+     */
+    inline std::vector<int> calculateGatherIndices(
+        int inputSize,
+        int kernelSize,
+        const KernelOptions& options
+    ) {
+        int outputSize = calculateOutputSize(inputSize, kernelSize, options);
+        int kernelMinimum = kernelSize % 2 == 0 ? 0 : -(kernelSize / 2);
+        int indexMinimum = -options.paddingBegin() + options.dilation * std::abs(kernelMinimum);
+
+        std::vector<int> result(static_cast<std::size_t>(kernelSize) * static_cast<std::size_t>(outputSize));
+
+        for (int kernelIndex = 0; kernelIndex < kernelSize; ++kernelIndex) {
+            int kernelOffset = (kernelIndex + kernelMinimum) * options.dilation;
+
+            for (int outIndex = 0; outIndex < outputSize; ++outIndex) {
+                int index = indexMinimum + outIndex * options.stride + kernelOffset;
+
+                if (index < 0) {
+                    if (options.borderTreatmentBegin.getType() == BorderTreatmentType::CONSTANT) {
+                        index = CONSTANT_BEGIN_INDEX;
+                    } else {
+                        XVIGRA_GET_BEGIN_BORDER_INDEX(index, options.borderTreatmentBegin, index, inputSize)
+                    }
+                } else if (inputSize <= index) {
+                    if (options.borderTreatmentEnd.getType() == BorderTreatmentType::CONSTANT) {
+                        index = CONSTANT_END_INDEX;
+                    } else {
+                        XVIGRA_GET_END_BORDER_INDEX(index, options.borderTreatmentEnd, index, inputSize)
+                    }
+                }
+
+                result[kernelIndex * outputSize + outIndex] = index;
+            }
+        }
+
+        return result;
+    }
+
+    /*
+     * <p>
+     * Calculates for every position of the padded input along one axis the input index it is read from.
+     * The padded input starts at the first position read by the first output and ends at the last position read by
+     * the last output, so that kernel tap k of output o reads the padded position o * stride + k * dilation.
+     * This collapses the table of xvigra::calculateGatherIndices for backends which operate on a padded copy of the
+     * input. Constant borders are marked with xvigra::CONSTANT_BEGIN_INDEX or xvigra::CONSTANT_END_INDEX.
+     * </p>
+     *
+     * @param inputSize number of input elements along the axis
+     * @param kernelSize number of kernel taps along the axis
+     * @param options object containing information about padding, stride, dilation and border treatment
+     * @return vector of size (outputSize - 1) * stride + (kernelSize - 1) * dilation + 1 holding the input indices
+     */
+    inline std::vector<int> calculatePaddedSourceIndices(
+        int inputSize,
+        int kernelSize,
+        const KernelOptions& options
+    ) {
+        int outputSize = calculateOutputSize(inputSize, kernelSize, options);
+        int paddedSize = outputSize <= 0 ? 0 : (outputSize - 1) * options.stride + (kernelSize - 1) * options.dilation + 1;
+
+        std::vector<int> result(static_cast<std::size_t>(paddedSize));
+
+        for (int paddedIndex = 0; paddedIndex < paddedSize; ++paddedIndex) {
+            int index = paddedIndex - options.paddingBegin();
+
+            if (index < 0) {
+                if (options.borderTreatmentBegin.getType() == BorderTreatmentType::CONSTANT) {
+                    index = CONSTANT_BEGIN_INDEX;
+                } else {
+                    XVIGRA_GET_BEGIN_BORDER_INDEX(index, options.borderTreatmentBegin, index, inputSize)
+                }
+            } else if (inputSize <= index) {
+                if (options.borderTreatmentEnd.getType() == BorderTreatmentType::CONSTANT) {
+                    index = CONSTANT_END_INDEX;
+                } else {
+                    XVIGRA_GET_END_BORDER_INDEX(index, options.borderTreatmentEnd, index, inputSize)
+                }
+            }
+
+            result[paddedIndex] = index;
+        }
+
+        return result;
+    }
+
+    /*
+     * <p>
+     * Returns the constant border value which belongs to a marker produced by xvigra::calculateGatherIndices.
+     * Non-constant border treatments yield zero, since their markers never occur in the gather indices.
+     * </p>
+     */
+    template <typename InputType, typename ResultType>
+    ResultType gatherConstant(
+        const KernelOptions& options,
+        int marker
+    ) {
+        const BorderTreatment& treatment = marker == CONSTANT_BEGIN_INDEX ? options.borderTreatmentBegin : options.borderTreatmentEnd;
+
+        if (treatment.getType() == BorderTreatmentType::CONSTANT) {
+            return static_cast<ResultType>(treatment.getValue<InputType>());
+        } else {
+            return static_cast<ResultType>(0);
+        }
+    }
+
+    /*
+     * <p>
+     * Checks whether a 2-dimensional convolution is pointwise: a 1x1 kernel without padding and with stride 1 reads
+     * every input pixel exactly once, so its im2col patch is the input itself. The dilation has no effect on a single
+     * tap and is ignored.
+     * </p>
+     *
+     * @param kernelHeight number of kernel taps along the height
+     * @param kernelWidth number of kernel taps along the width
+     * @param optionsY options along the height
+     * @param optionsX options along the width
+     * @return true if the convolution is a plain matrix product of the kernel and the pixels of the input
+     */
+    inline bool isPointwise2D(
+        int kernelHeight,
+        int kernelWidth,
+        const KernelOptions& optionsY,
+        const KernelOptions& optionsX
+    ) {
+        return kernelHeight == 1 && kernelWidth == 1
+            && optionsY.paddingTotal() == 0 && optionsX.paddingTotal() == 0
+            && optionsY.stride == 1 && optionsX.stride == 1;
+    }
+
     // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
     // ║ general utility - end                                                                                        ║
     // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ algorithm selection - begin                                                                                  ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    // Relative costs of the elementary operations of the backends, used by the AUTO algorithm. A gathered or copied
+    // element is the unit; multiply-adds inside of BLAS and in contiguous, vectorizable loops are cheaper.
+    constexpr double COST_GATHER = 1.0;
+    constexpr double COST_BLAS_MULTIPLY_ADD = 0.125;
+    constexpr double COST_VECTOR_MULTIPLY_ADD = 0.25;
+    constexpr double COST_WINOGRAD_TRANSFORM = 1.0;
+    constexpr double COST_FFT_BUTTERFLY = 0.5;
+    constexpr double COST_COMPLEX_MULTIPLY_ADD = 1.0;
+
+    /*
+     * <p>
+     * Estimates the relative cost of the explicit 1-dimensional convolution with the given algorithm.
+     * Algorithms which are not available for convolve1D have an infinite cost.
+     * </p>
+     *
+     * @param algorithm algorithm whose cost is estimated; must not be AUTO
+     * @param inputChannels number of input channels
+     * @param inputWidth number of input elements along the width
+     * @param outputChannels number of output channels
+     * @param kernelSize number of kernel taps
+     * @param options object containing information about padding, stride and dilation
+     * @return the estimated cost in units of a gathered element
+     */
+    inline double estimateAlgorithmCost1D(
+        Algorithm algorithm,
+        int inputChannels,
+        int inputWidth,
+        int outputChannels,
+        int kernelSize,
+        const KernelOptions& options
+    ) {
+        double outputs = static_cast<double>(calculateOutputSize(inputWidth, kernelSize, options));
+        double taps = static_cast<double>(inputChannels) * kernelSize;
+
+        switch (algorithm) {
+            case Algorithm::GEMM:
+                return outputs * taps * (COST_GATHER + outputChannels * COST_BLAS_MULTIPLY_ADD);
+            case Algorithm::DIRECT:
+                return outputs * taps * outputChannels * COST_VECTOR_MULTIPLY_ADD;
+            default:
+                return std::numeric_limits<double>::infinity();
+        }
+    }
+
+    /*
+     * <p>
+     * Selects the cheapest algorithm for the explicit 1-dimensional convolution according to
+     * xvigra::estimateAlgorithmCost1D. This is the choice convolve1D makes for Algorithm::AUTO.
+     * </p>
+     *
+     * @param inputChannels number of input channels
+     * @param inputWidth number of input elements along the width
+     * @param outputChannels number of output channels
+     * @param kernelSize number of kernel taps
+     * @param options object containing information about padding, stride and dilation
+     * @return Algorithm::GEMM or Algorithm::DIRECT
+     */
+    inline Algorithm selectAlgorithm1D(
+        int inputChannels,
+        int inputWidth,
+        int outputChannels,
+        int kernelSize,
+        const KernelOptions& options
+    ) {
+        double gemmCost = estimateAlgorithmCost1D(Algorithm::GEMM, inputChannels, inputWidth, outputChannels, kernelSize, options);
+        double directCost = estimateAlgorithmCost1D(Algorithm::DIRECT, inputChannels, inputWidth, outputChannels, kernelSize, options);
+
+        return directCost < gemmCost ? Algorithm::DIRECT : Algorithm::GEMM;
+    }
+
+    /*
+     * <p>
+     * Estimates the relative cost of the explicit 2-dimensional convolution with the given algorithm from the number
+     * of gathered elements, multiply-adds, Winograd transformations and FFT butterflies the backend executes.
+     * The FFT cost includes the bands of output rows which keep its spectra within the workspace limit of optionsY,
+     * see xvigra::calculateFFTHeight.
+     * Algorithms which can not process the configuration have an infinite cost.
+     * </p>
+     *
+     * @param algorithm algorithm whose cost is estimated; must not be AUTO
+     * @param inputChannels number of input channels
+     * @param inputHeight number of input elements along the height
+     * @param inputWidth number of input elements along the width
+     * @param outputChannels number of output channels
+     * @param kernelHeight number of kernel taps along the height
+     * @param kernelWidth number of kernel taps along the width
+     * @param optionsY object containing information about padding, stride and dilation along the height
+     * @param optionsX object containing information about padding, stride and dilation along the width
+     * @param isFloatingPoint whether the result type of the convolution is a floating point type
+     * @return the estimated cost in units of a gathered element
+     */
+    inline double estimateAlgorithmCost2D(
+        Algorithm algorithm,
+        int inputChannels,
+        int inputHeight,
+        int inputWidth,
+        int outputChannels,
+        int kernelHeight,
+        int kernelWidth,
+        const KernelOptions& optionsY,
+        const KernelOptions& optionsX,
+        bool isFloatingPoint
+    ) {
+        int outputHeight = calculateOutputSize(inputHeight, kernelHeight, optionsY);
+        int outputWidth = calculateOutputSize(inputWidth, kernelWidth, optionsX);
+
+        double outputs = static_cast<double>(outputHeight) * outputWidth;
+        double taps = static_cast<double>(inputChannels) * kernelHeight * kernelWidth;
+        double channelPairs = static_cast<double>(inputChannels) * outputChannels;
+
+        switch (algorithm) {
+            case Algorithm::GEMM: {
+                // the pointwise GEMM multiplies the input in place, see xvigra::isPointwise2D
+                double gather = isPointwise2D(kernelHeight, kernelWidth, optionsY, optionsX) ? 0.0 : COST_GATHER;
+                return outputs * taps * (gather + outputChannels * COST_BLAS_MULTIPLY_ADD);
+            }
+            case Algorithm::DIRECT: {
+                return outputs * taps * outputChannels * COST_VECTOR_MULTIPLY_ADD;
+            }
+            case Algorithm::WINOGRAD_2X2:
+            case Algorithm::WINOGRAD_4X4: {
+                bool isSupported = isFloatingPoint
+                    && kernelHeight == 3 && kernelWidth == 3
+                    && optionsY.stride == 1 && optionsX.stride == 1
+                    && optionsY.dilation == 1 && optionsX.dilation == 1;
+
+                if (!isSupported) {
+                    return std::numeric_limits<double>::infinity();
+                }
+
+                // operations of the sparse input and output transformations per tile and channel
+                bool isLargeTile = algorithm == Algorithm::WINOGRAD_4X4;
+                int outputTileSize = isLargeTile ? 4 : 2;
+                double tileArea = isLargeTile ? 36.0 : 16.0;
+                double inputTransform = isLargeTile ? 264.0 : 64.0;
+                double outputTransform = isLargeTile ? 210.0 : 36.0;
+
+                double tiles = static_cast<double>((outputHeight + outputTileSize - 1) / outputTileSize)
+                             * static_cast<double>((outputWidth + outputTileSize - 1) / outputTileSize);
+                double padded = static_cast<double>(inputChannels) * (outputHeight + 2) * (outputWidth + 2);
+
+                return padded * COST_GATHER
+                     + tiles * (inputChannels * inputTransform + outputChannels * outputTransform) * COST_WINOGRAD_TRANSFORM
+                     + tiles * channelPairs * tileArea * COST_VECTOR_MULTIPLY_ADD;
+            }
+            case Algorithm::FFT: {
+                std::size_t strideY = static_cast<std::size_t>(optionsY.stride);
+                std::size_t kernelExtentY = static_cast<std::size_t>((kernelHeight - 1) * optionsY.dilation + 1);
+                std::size_t paddedHeight = static_cast<std::size_t>(outputHeight - 1) * strideY + kernelExtentY;
+                std::size_t paddedWidth = static_cast<std::size_t>((outputWidth - 1) * optionsX.stride + (kernelWidth - 1) * optionsX.dilation + 1);
+
+                std::size_t fftWidth = nextPowerOfTwo(std::max<std::size_t>(paddedWidth, 2));
+                std::size_t fftHeight = calculateFFTHeight(
+                    optionsY.workspaceLimit,
+                    static_cast<std::size_t>(inputChannels),
+                    paddedHeight,
+                    fftWidth,
+                    kernelExtentY
+                );
+
+                // every band of output rows repeats the input and output transforms, and the kernel transforms unless
+                // the kernel spectra fit into the workspace limit, see xvigra::fftConvolve2D
+                std::size_t bandHeight = std::min<std::size_t>(static_cast<std::size_t>(outputHeight), (fftHeight - kernelExtentY) / strideY + 1);
+                double bands = std::ceil(static_cast<double>(outputHeight) / static_cast<double>(bandHeight));
+                double spectrumBytes = static_cast<double>(fftHeight * (fftWidth / 2 + 1) * sizeof(std::complex<double>));
+                bool isKernelCached = 1.0 < bands && channelPairs * spectrumBytes <= static_cast<double>(optionsY.workspaceLimit);
+
+                double points = static_cast<double>(fftHeight) * static_cast<double>(fftWidth);
+                double transforms = bands * (inputChannels + outputChannels) + (isKernelCached ? 1.0 : bands) * channelPairs;
+
+                return bands * inputChannels * points * COST_GATHER
+                     + transforms * points * std::log2(points) * COST_FFT_BUTTERFLY
+                     + bands * channelPairs * (points / 2.0) * COST_COMPLEX_MULTIPLY_ADD;
+            }
+            default: {
+                return std::numeric_limits<double>::infinity();
+            }
+        }
+    }
+
+    /*
+     * <p>
+     * Selects the cheapest algorithm for the explicit 2-dimensional convolution according to
+     * xvigra::estimateAlgorithmCost2D. This is the choice convolve2D makes for Algorithm::AUTO, so it can be used
+     * to log the backend which runs.
+     * </p>
+     *
+     * @param inputChannels number of input channels
+     * @param inputHeight number of input elements along the height
+     * @param inputWidth number of input elements along the width
+     * @param outputChannels number of output channels
+     * @param kernelHeight number of kernel taps along the height
+     * @param kernelWidth number of kernel taps along the width
+     * @param optionsY object containing information about padding, stride and dilation along the height
+     * @param optionsX object containing information about padding, stride and dilation along the width
+     * @param isFloatingPoint whether the result type of the convolution is a floating point type
+     * @return the cheapest algorithm; never Algorithm::AUTO
+     */
+    inline Algorithm selectAlgorithm2D(
+        int inputChannels,
+        int inputHeight,
+        int inputWidth,
+        int outputChannels,
+        int kernelHeight,
+        int kernelWidth,
+        const KernelOptions& optionsY,
+        const KernelOptions& optionsX,
+        bool isFloatingPoint
+    ) {
+        Algorithm result = Algorithm::GEMM;
+        double minimalCost = std::numeric_limits<double>::infinity();
+
+        for (Algorithm candidate : {Algorithm::GEMM, Algorithm::DIRECT, Algorithm::WINOGRAD_2X2, Algorithm::WINOGRAD_4X4, Algorithm::FFT}) {
+            double cost = estimateAlgorithmCost2D(
+                candidate,
+                inputChannels,
+                inputHeight,
+                inputWidth,
+                outputChannels,
+                kernelHeight,
+                kernelWidth,
+                optionsY,
+                optionsX,
+                isFloatingPoint
+            );
+
+            if (cost < minimalCost) {
+                minimalCost = cost;
+                result = candidate;
+            }
+        }
+
+        return result;
+    }
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ algorithm selection - end                                                                                    ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ channel blocking - begin                                                                                     ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    // number of channels in a block of the ChannelPosition::BLOCKED layout, which fills a 256 bit vector of floats
+    constexpr std::size_t CHANNEL_BLOCK_SIZE = 8;
+
+    /*
+     * <p>
+     * Converts an H x W x C or C x H x W image into the channel blocked layout C/8 x H x W x 8 of
+     * ChannelPosition::BLOCKED: channel c is stored in block c / 8 at lane c % 8, so the channels of a pixel are
+     * contiguous in groups of xvigra::CHANNEL_BLOCK_SIZE. The lanes of the last block which have no channel are 0.
+     * </p>
+     *
+     * @tparam T derived type of the input xexpression
+     * @param inputExpression xexpression containing the image
+     * @param channelPosition position of the channels in the image, ChannelPosition::FIRST or ChannelPosition::LAST
+     * @return the channel blocked image
+     * @throws std::invalid_argument * if the image is not 3-dimensional
+                                     * if the channel position is neither FIRST nor LAST
+     */
+    template <typename T>
+    auto toChannelBlocked(const xt::xexpression<T>& inputExpression, const ChannelPosition& channelPosition) {
+        using ValueType = typename xt::xexpression<T>::derived_type::value_type;
+
+        const auto& input = inputExpression.derived_cast();
+
+        if (channelPosition != ChannelPosition::FIRST && channelPosition != ChannelPosition::LAST) {
+            throw std::invalid_argument("toChannelBlocked(): Only ChannelPosition::FIRST or ChannelPosition::LAST can be converted!");
+        }
+
+        if (input.dimension() != 3) {
+            throw std::invalid_argument("toChannelBlocked(): Need 3 dimensional (H x W x C or C x H x W) input!");
+        }
+
+        bool isChannelFirst = channelPosition == ChannelPosition::FIRST;
+        std::size_t channels = input.shape()[isChannelFirst ? 0 : 2];
+        std::size_t height = input.shape()[isChannelFirst ? 1 : 0];
+        std::size_t width = input.shape()[isChannelFirst ? 2 : 1];
+        std::size_t blocks = (channels + CHANNEL_BLOCK_SIZE - 1) / CHANNEL_BLOCK_SIZE;
+
+        xt::xtensor<ValueType, 4> result = xt::zeros<ValueType>({blocks, height, width, CHANNEL_BLOCK_SIZE});
+
+        for (std::size_t channel = 0; channel < channels; ++channel) {
+            std::size_t block = channel / CHANNEL_BLOCK_SIZE;
+            std::size_t lane = channel % CHANNEL_BLOCK_SIZE;
+
+            for (std::size_t y = 0; y < height; ++y) {
+                for (std::size_t x = 0; x < width; ++x) {
+                    result(block, y, x, lane) = isChannelFirst ? input(channel, y, x) : input(y, x, channel);
+                }
+            }
+        }
+
+        return result;
+    }
+
+    /*
+     * <p>
+     * Converts a channel blocked image C/8 x H x W x 8 back into an H x W x C or C x H x W image with the given number
+     * of channels; see xvigra::toChannelBlocked.
+     * </p>
+     *
+     * @tparam T derived type of the input xexpression
+     * @param inputExpression xexpression containing the channel blocked image
+     * @param channels number of channels of the image, the lanes behind it are dropped
+     * @param channelPosition position of the channels in the result, ChannelPosition::FIRST or ChannelPosition::LAST
+     * @return the image with the requested channel position
+     * @throws std::invalid_argument * if the image is not channel blocked
+                                     * if the channels don't fill the last block of the image
+                                     * if the channel position is neither FIRST nor LAST
+     */
+    template <typename T>
+    auto fromChannelBlocked(const xt::xexpression<T>& inputExpression, std::size_t channels, const ChannelPosition& channelPosition) {
+        using ValueType = typename xt::xexpression<T>::derived_type::value_type;
+
+        const auto& input = inputExpression.derived_cast();
+
+        if (channelPosition != ChannelPosition::FIRST && channelPosition != ChannelPosition::LAST) {
+            throw std::invalid_argument("fromChannelBlocked(): Only ChannelPosition::FIRST or ChannelPosition::LAST can be converted!");
+        }
+
+        if (input.dimension() != 4 || input.shape()[3] != CHANNEL_BLOCK_SIZE) {
+            throw std::invalid_argument("fromChannelBlocked(): Need 4 dimensional (C/8 x H x W x 8) input!");
+        }
+
+        std::size_t blocks = input.shape()[0];
+        std::size_t height = input.shape()[1];
+        std::size_t width = input.shape()[2];
+
+        if (channels == 0 || (channels + CHANNEL_BLOCK_SIZE - 1) / CHANNEL_BLOCK_SIZE != blocks) {
+            throw std::invalid_argument("fromChannelBlocked(): Channels don't fit the channel blocks!");
+        }
+
+        bool isChannelFirst = channelPosition == ChannelPosition::FIRST;
+        xt::xtensor<ValueType, 3> result(isChannelFirst
+            ? std::array<std::size_t, 3>{channels, height, width}
+            : std::array<std::size_t, 3>{height, width, channels}
+        );
+
+        for (std::size_t channel = 0; channel < channels; ++channel) {
+            std::size_t block = channel / CHANNEL_BLOCK_SIZE;
+            std::size_t lane = channel % CHANNEL_BLOCK_SIZE;
+
+            for (std::size_t y = 0; y < height; ++y) {
+                for (std::size_t x = 0; x < width; ++x) {
+                    (isChannelFirst ? result(channel, y, x) : result(y, x, channel)) = input(block, y, x, lane);
+                }
+            }
+        }
+
+        return result;
+    }
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ channel blocking - end                                                                                       ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ kernel symmetry - begin                                                                                      ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    /*
+     * <p>
+     * Detects whether the 1-dimensional kernel is symmetric or antisymmetric, see xvigra::KernelSymmetry. The mirrored
+     * taps have to match exactly, which holds for the sampled kernels of xvigra::initGaussian and
+     * xvigra::initGaussianDerivative. The center tap of an antisymmetric kernel of odd size has to be 0.
+     * </p>
+     *
+     * @tparam T derived type of the kernel xexpression
+     * @param kernelExpression xexpression containing the kernel data
+     * @return SYMMETRIC or ANTISYMMETRIC; NONE for kernels without symmetry, kernels with less than 2 taps and kernels
+     *         which are not 1-dimensional
+     */
+    template <typename T>
+    KernelSymmetry detectKernelSymmetry(const xt::xexpression<T>& kernelExpression) {
+        const auto& kernel = kernelExpression.derived_cast();
+
+        if (kernel.dimension() != 1 || kernel.size() < 2) {
+            return KernelSymmetry::NONE;
+        }
+
+        std::size_t kernelSize = kernel.size();
+        bool isSymmetric = true;
+        bool isAntisymmetric = true;
+
+        for (std::size_t index = 0; index <= kernelSize / 2; ++index) {
+            auto value = kernel(index);
+            auto mirrored = kernel(kernelSize - 1 - index);
+
+            isSymmetric = isSymmetric && value == mirrored;
+            isAntisymmetric = isAntisymmetric && value == -mirrored;
+        }
+
+        if (isSymmetric) {
+            return KernelSymmetry::SYMMETRIC;
+        }
+
+        return isAntisymmetric ? KernelSymmetry::ANTISYMMETRIC : KernelSymmetry::NONE;
+    }
+
+    /*
+     * <p>
+     * Returns the symmetry which the explicit 1-dimensional convolution exploits: the declared symmetry, or the
+     * detected one for KernelSymmetry::AUTO. Only Algorithm::DIRECT and Algorithm::AUTO fold, since every other
+     * algorithm, including an explicitly requested GEMM, is expected to run as requested. A declared symmetry is
+     * checked against the taps, so a wrong declaration can't silently produce a wrong result. Kernels which are not
+     * 1-dimensional mix the channels and are never treated as symmetric.
+     * </p>
+     *
+     * @tparam T derived type of the kernel xexpression
+     * @param kernelExpression xexpression containing the kernel data
+     * @param options object containing the declared symmetry and the algorithm, see KernelOptions#setKernelSymmetry
+     * @return the symmetry of the kernel; never KernelSymmetry::AUTO
+     * @throws std::invalid_argument if the taps don't have the declared symmetry
+     */
+    template <typename T>
+    KernelSymmetry resolveKernelSymmetry(const xt::xexpression<T>& kernelExpression, const KernelOptions& options) {
+        const auto& kernel = kernelExpression.derived_cast();
+        bool isFoldingAlgorithm = options.algorithm == Algorithm::DIRECT || options.algorithm == Algorithm::AUTO;
+
+        if (kernel.dimension() != 1 || !isFoldingAlgorithm || options.kernelSymmetry == KernelSymmetry::NONE) {
+            return KernelSymmetry::NONE;
+        }
+
+        if (options.kernelSymmetry == KernelSymmetry::AUTO) {
+            return detectKernelSymmetry(kernelExpression);
+        }
+
+        // the same comparisons as xvigra::detectKernelSymmetry, including the center, which must be 0 for ANTISYMMETRIC
+        bool isSymmetric = options.kernelSymmetry == KernelSymmetry::SYMMETRIC;
+        std::size_t kernelSize = kernel.size();
+
+        for (std::size_t index = 0; index < (kernelSize + 1) / 2; ++index) {
+            auto value = kernel(index);
+            auto mirrored = kernel(kernelSize - 1 - index);
+
+            if (isSymmetric ? value != mirrored : value != -mirrored) {
+                throw std::invalid_argument("resolveKernelSymmetry(): Kernel taps don't have the declared symmetry!");
+            }
+        }
+
+        return options.kernelSymmetry;
+    }
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ kernel symmetry - end                                                                                        ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
 } // xvigra
 
 #endif // XVIGRA_CONVOLUTION_UTIL_HPP
\ No newline at end of file
@@ -0,0 +1,729 @@
+#ifndef XVIGRA_DIRECT_CONVOLUTION_HPP
+#define XVIGRA_DIRECT_CONVOLUTION_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#ifdef VOID
+#undef VOID
+#endif
+
+#include "xtensor/xtensor.hpp"
+#include "xtensor/xview.hpp"
+
+#include "xvigra/convolution_util.hpp"
+#include "xvigra/epilogue.hpp"
+#include "xvigra/simd_util.hpp"
+#include "xvigra/thread_util.hpp"
+#include "xvigra/workspace.hpp"
+
+namespace xvigra {
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ utility - begin                                                                                              ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    /*
+     * <p>
+     * Provides the contiguous input of a direct convolution as rows of the result type. An input of the result type
+     * is returned as it is, every other input is converted once into memory drawn from the workspace.
+     * </p>
+     *
+     * @tparam ResultType value type of the result
+     * @param input pointer to the contiguous input
+     * @param size number of elements in the input
+     * @param workspace workspace which provides the memory of the converted input
+     * @return pointer to the input as result type, valid until the enclosing workspace scope ends
+     */
+    template <typename ResultType, typename InputType>
+    const ResultType* convertDirectInput(const InputType* input, std::size_t size, xvigra::Workspace& workspace) {
+        if constexpr (std::is_same_v<InputType, ResultType>) {
+            return input;
+        } else {
+            ResultType* converted = workspace.allocate<ResultType>(size);
+            xvigra::convertRow(input, 1, converted, size);
+            return converted;
+        }
+    }
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ utility - end                                                                                                ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ directConvolve1D - begin                                                                                     ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    /*
+     * <p>
+     * Calculates the explicit 1-dimensional convolution with a sliding window, which reads the input in place and
+     * accumulates every kernel tap straight into the output. No im2col patch is built.
+     * The inner loops run on the active instruction set, see xvigra::multiplyAdd. For channel first inputs of another
+     * type than the result, the input is converted once into memory drawn from the workspace of the options.
+     * The result is accumulated in tiles of workspace memory within the workspace limit of the options, and every
+     * tile is written into the output with the epilogue applied, see xvigra::applyEpilogueTile. The output channels
+     * (channel first) or output pixels (channel last) are distributed over the thread count of the options, and the
+     * repacked kernel of channel last inputs is drawn from the workspace as well.
+     * The caller is responsible for the validation of the input and kernel and for the shape of the output; see
+     * xvigra::convolve1D.
+     * </p>
+     *
+     * @tparam ResultType value type of the result
+     * @tparam InputContainerType row major container of the input, see xvigra::evaluateContiguous
+     * @tparam R derived type of the output xexpression
+     * @param input input of shape W x C or C x W
+     * @param kernel full kernel of shape OC x IC x K
+     * @param options object containing information about padding, stride, dilation, channel position and border
+                      treatment
+     * @param epilogue bias, scale, clipping and rounding which are applied to the result
+     * @param output output of shape W' x OC or OC x W', which receives the result
+     */
+    template <typename ResultType, typename InputType, typename KernelType, typename InputContainerType, typename R>
+    void directConvolve1D(
+        const InputContainerType& input,
+        const xt::xtensor<KernelType, 3>& kernel,
+        const xvigra::KernelOptions& options,
+        const xvigra::Epilogue& epilogue,
+        R& output
+    ) {
+        bool isChannelFirst = options.channelPosition == xvigra::ChannelPosition::FIRST;
+
+        std::size_t inputChannels = input.shape()[isChannelFirst ? 0 : 1];
+        std::size_t inputWidth = input.shape()[isChannelFirst ? 1 : 0];
+        std::size_t outputChannels = kernel.shape()[0];
+        std::size_t kernelSize = kernel.shape()[2];
+
+        std::vector<int> indices = xvigra::calculateGatherIndices(
+            static_cast<int>(inputWidth),
+            static_cast<int>(kernelSize),
+            options
+        );
+        std::size_t outputWidth = indices.size() / kernelSize;
+
+        ResultType constantBegin = xvigra::gatherConstant<InputType, ResultType>(options, xvigra::CONSTANT_BEGIN_INDEX);
+        ResultType constantEnd = xvigra::gatherConstant<InputType, ResultType>(options, xvigra::CONSTANT_END_INDEX);
+
+        const InputType* in = input.data();
+
+        xvigra::Workspace& workspace = xvigra::resolveWorkspace(options.workspace);
+        xvigra::Workspace::Scope workspaceScope(workspace);
+
+        if (isChannelFirst) {
+            const ResultType* rows = xvigra::convertDirectInput<ResultType>(in, inputChannels * inputWidth, workspace);
+
+            // without stride, the interior of every tap reads a contiguous input row
+            auto [interiorBegin, interiorEnd] = xvigra::calculateInteriorRange(static_cast<int>(inputWidth), static_cast<int>(kernelSize), options);
+            std::size_t vectorBegin = options.stride == 1 ? static_cast<std::size_t>(interiorBegin) : outputWidth;
+            std::size_t vectorEnd = options.stride == 1 ? static_cast<std::size_t>(interiorEnd) : outputWidth;
+
+            // a tile holds the output rows of a range of output channels
+            std::size_t tileChannels = static_cast<std::size_t>(
+                xvigra::calculateTileSize(options.workspaceLimit, outputWidth * sizeof(ResultType), static_cast<int>(outputChannels))
+            );
+            // every output channel writes its own rows, so the output channels are distributed over the threads
+            xvigra::parallelFor(0, static_cast<int>(outputChannels), options.threadCount, [&](int channelBegin, int channelEnd) {
+                // the workspace of the options belongs to the calling thread, which runs the first chunk
+                xvigra::Workspace& chunkWorkspace = channelBegin == 0 ? workspace : xvigra::threadLocalWorkspace();
+                xvigra::Workspace::Scope chunkScope(chunkWorkspace);
+                ResultType* tile = chunkWorkspace.allocate<ResultType>(tileChannels * outputWidth);
+
+                for (std::size_t tileBegin = static_cast<std::size_t>(channelBegin); tileBegin < static_cast<std::size_t>(channelEnd); tileBegin += tileChannels) {
+                    std::size_t tileEnd = std::min(tileBegin + tileChannels, static_cast<std::size_t>(channelEnd));
+                    std::fill(tile, tile + (tileEnd - tileBegin) * outputWidth, static_cast<ResultType>(0));
+
+                    for (std::size_t outputChannel = tileBegin; outputChannel < tileEnd; ++outputChannel) {
+                        ResultType* outRow = tile + (outputChannel - tileBegin) * outputWidth;
+
+                        for (std::size_t inputChannel = 0; inputChannel < inputChannels; ++inputChannel) {
+                            const ResultType* inRow = rows + inputChannel * inputWidth;
+
+                            for (std::size_t kernelX = 0; kernelX < kernelSize; ++kernelX) {
+                                ResultType weight = static_cast<ResultType>(kernel(outputChannel, inputChannel, kernelX));
+
+                                if (weight == static_cast<ResultType>(0)) {
+                                    continue;
+                                }
+
+                                const int* indexRow = indices.data() + kernelX * outputWidth;
+
+                                auto accumulateRange = [&](std::size_t rangeBegin, std::size_t rangeEnd) {
+                                    for (std::size_t outIndex = rangeBegin; outIndex < rangeEnd; ++outIndex) {
+                                        int inputX = indexRow[outIndex];
+                                        ResultType value = 0 <= inputX
+                                            ? inRow[inputX]
+                                            : (inputX == xvigra::CONSTANT_BEGIN_INDEX ? constantBegin : constantEnd);
+                                        outRow[outIndex] += weight * value;
+                                    }
+                                };
+
+                                if (vectorBegin < vectorEnd) {
+                                    xvigra::multiplyAdd(outRow + vectorBegin, inRow + indexRow[vectorBegin], weight, vectorEnd - vectorBegin);
+                                    accumulateRange(0, vectorBegin);
+                                    accumulateRange(vectorEnd, outputWidth);
+                                } else {
+                                    accumulateRange(0, outputWidth);
+                                }
+                            }
+                        }
+                    }
+
+                    xvigra::applyEpilogueTile(
+                        tile,
+                        std::array<std::size_t, 2>{tileEnd - tileBegin, outputWidth},
+                        epilogue,
+                        0,
+                        xt::view(output, xt::range(tileBegin, tileEnd), xt::all()),
+                        tileBegin
+                    );
+                }
+            });
+        } else {
+            // kernel repacked as K x IC x OC, so that the innermost loop runs over contiguous output channels
+            ResultType* packedKernel = workspace.allocate<ResultType>(kernelSize * inputChannels * outputChannels);
+            for (std::size_t kernelX = 0; kernelX < kernelSize; ++kernelX) {
+                for (std::size_t inputChannel = 0; inputChannel < inputChannels; ++inputChannel) {
+                    for (std::size_t outputChannel = 0; outputChannel < outputChannels; ++outputChannel) {
+                        packedKernel[(kernelX * inputChannels + inputChannel) * outputChannels + outputChannel] =
+                            static_cast<ResultType>(kernel(outputChannel, inputChannel, kernelX));
+                    }
+                }
+            }
+
+            // a tile holds all output channels of a range of output pixels
+            std::size_t tileWidth = static_cast<std::size_t>(
+                xvigra::calculateTileSize(options.workspaceLimit, outputChannels * sizeof(ResultType), static_cast<int>(outputWidth))
+            );
+            // every output pixel accumulates all output channels on its own, so the pixels are distributed over the threads
+            xvigra::parallelFor(0, static_cast<int>(outputWidth), options.threadCount, [&](int pixelBegin, int pixelEnd) {
+                // the workspace of the options belongs to the calling thread, which runs the first chunk
+                xvigra::Workspace& chunkWorkspace = pixelBegin == 0 ? workspace : xvigra::threadLocalWorkspace();
+                xvigra::Workspace::Scope chunkScope(chunkWorkspace);
+                ResultType* tile = chunkWorkspace.allocate<ResultType>(tileWidth * outputChannels);
+
+                for (std::size_t tileBegin = static_cast<std::size_t>(pixelBegin); tileBegin < static_cast<std::size_t>(pixelEnd); tileBegin += tileWidth) {
+                    std::size_t tileEnd = std::min(tileBegin + tileWidth, static_cast<std::size_t>(pixelEnd));
+                    std::fill(tile, tile + (tileEnd - tileBegin) * outputChannels, static_cast<ResultType>(0));
+
+                    for (std::size_t outIndex = tileBegin; outIndex < tileEnd; ++outIndex) {
+                        ResultType* accumulator = tile + (outIndex - tileBegin) * outputChannels;
+
+                        for (std::size_t kernelX = 0; kernelX < kernelSize; ++kernelX) {
+                            int inputX = indices[kernelX * outputWidth + outIndex];
+                            const ResultType* weights = packedKernel + kernelX * inputChannels * outputChannels;
+                            const InputType* pixel = 0 <= inputX ? in + static_cast<std::size_t>(inputX) * inputChannels : nullptr;
+                            ResultType constant = inputX == xvigra::CONSTANT_BEGIN_INDEX ? constantBegin : constantEnd;
+
+                            for (std::size_t inputChannel = 0; inputChannel < inputChannels; ++inputChannel) {
+                                ResultType value = pixel ? static_cast<ResultType>(pixel[inputChannel]) : constant;
+                                xvigra::multiplyAdd(accumulator, weights + inputChannel * outputChannels, value, outputChannels);
+                            }
+                        }
+                    }
+
+                    xvigra::applyEpilogueTile(
+                        tile,
+                        std::array<std::size_t, 2>{tileEnd - tileBegin, outputChannels},
+                        epilogue,
+                        1,
+                        xt::view(output, xt::range(tileBegin, tileEnd), xt::all())
+                    );
+                }
+            });
+        }
+    }
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ directConvolve1D - end                                                                                       ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ directConvolve2D - begin                                                                                     ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    /*
+     * <p>
+     * Calculates the explicit 2-dimensional convolution with a sliding window, which reads the input in place and
+     * accumulates every kernel tap straight into the output. No im2col patch is built, which makes this backend
+     * preferable to the GEMM-based one for inputs with few channels and small kernels.
+     * The inner loops run on the active instruction set, see xvigra::multiplyAdd. For channel first inputs of another
+     * type than the result, the input is converted once into memory drawn from the workspace of the options.
+     * The result is accumulated in tiles of output rows in workspace memory within the workspace limit of optionsY,
+     * and every tile is written into the output with the epilogue applied, see xvigra::applyEpilogueTile. The output
+     * rows are distributed over the thread count of optionsY, and the repacked kernel of channel last inputs is drawn
+     * from the workspace as well.
+     * The caller is responsible for the validation of the input and kernel and for the shape of the output; see
+     * xvigra::convolve2D.
+     * </p>
+     *
+     * @tparam ResultType value type of the result
+     * @tparam InputContainerType row major container of the input, see xvigra::evaluateContiguous
+     * @tparam R derived type of the output xexpression
+     * @param input input of shape H x W x C or C x H x W
+     * @param kernel full kernel of shape OC x IC x KH x KW
+     * @param optionsY object containing information about padding, stride, dilation, channel position and border
+                       treatment along the height
+     * @param optionsX object containing information about padding, stride, dilation, channel position and border
+                       treatment along the width
+     * @param epilogue bias, scale, clipping and rounding which are applied to the result
+     * @param output output of shape H' x W' x OC or OC x H' x W', which receives the result
+     */
+    template <typename ResultType, typename InputType, typename KernelType, typename InputContainerType, typename R>
+    void directConvolve2D(
+        const InputContainerType& input,
+        const xt::xtensor<KernelType, 4>& kernel,
+        const xvigra::KernelOptions& optionsY,
+        const xvigra::KernelOptions& optionsX,
+        const xvigra::Epilogue& epilogue,
+        R& output
+    ) {
+        bool isChannelFirst = optionsY.channelPosition == xvigra::ChannelPosition::FIRST;
+
+        std::size_t inputChannels = input.shape()[isChannelFirst ? 0 : 2];
+        std::size_t inputHeight = input.shape()[isChannelFirst ? 1 : 0];
+        std::size_t inputWidth = input.shape()[isChannelFirst ? 2 : 1];
+        std::size_t outputChannels = kernel.shape()[0];
+        std::size_t kernelHeight = kernel.shape()[2];
+        std::size_t kernelWidth = kernel.shape()[3];
+
+        std::vector<int> indicesY = xvigra::calculateGatherIndices(
+            static_cast<int>(inputHeight),
+            static_cast<int>(kernelHeight),
+            optionsY
+        );
+        std::vector<int> indicesX = xvigra::calculateGatherIndices(
+            static_cast<int>(inputWidth),
+            static_cast<int>(kernelWidth),
+            optionsX
+        );
+        std::size_t outputHeight = indicesY.size() / kernelHeight;
+        std::size_t outputWidth = indicesX.size() / kernelWidth;
+
+        ResultType constantBeginY = xvigra::gatherConstant<InputType, ResultType>(optionsY, xvigra::CONSTANT_BEGIN_INDEX);
+        ResultType constantEndY = xvigra::gatherConstant<InputType, ResultType>(optionsY, xvigra::CONSTANT_END_INDEX);
+        ResultType constantBeginX = xvigra::gatherConstant<InputType, ResultType>(optionsX, xvigra::CONSTANT_BEGIN_INDEX);
+        ResultType constantEndX = xvigra::gatherConstant<InputType, ResultType>(optionsX, xvigra::CONSTANT_END_INDEX);
+
+        const InputType* in = input.data();
+
+        xvigra::Workspace& workspace = xvigra::resolveWorkspace(optionsY.workspace);
+        xvigra::Workspace::Scope workspaceScope(workspace);
+
+        // a tile holds all output channels of a range of output rows
+        std::size_t tileHeight = static_cast<std::size_t>(
+            xvigra::calculateTileSize(optionsY.workspaceLimit, outputChannels * outputWidth * sizeof(ResultType), static_cast<int>(outputHeight))
+        );
+
+        if (isChannelFirst) {
+            const ResultType* rows = xvigra::convertDirectInput<ResultType>(in, inputChannels * inputHeight * inputWidth, workspace);
+            // without stride along the width, the interior of every tap reads a contiguous input row
+            auto [interiorBeginX, interiorEndX] = xvigra::calculateInteriorRange(static_cast<int>(inputWidth), static_cast<int>(kernelWidth), optionsX);
+            std::size_t vectorBegin = optionsX.stride == 1 ? static_cast<std::size_t>(interiorBeginX) : outputWidth;
+            std::size_t vectorEnd = optionsX.stride == 1 ? static_cast<std::size_t>(interiorEndX) : outputWidth;
+
+            // every output row is accumulated on its own, so the rows are distributed over the threads
+            xvigra::parallelFor(0, static_cast<int>(outputHeight), optionsY.threadCount, [&](int rowBegin, int rowEnd) {
+                // the workspace of the options belongs to the calling thread, which runs the first chunk
+                xvigra::Workspace& chunkWorkspace = rowBegin == 0 ? workspace : xvigra::threadLocalWorkspace();
+                xvigra::Workspace::Scope chunkScope(chunkWorkspace);
+                ResultType* tile = chunkWorkspace.allocate<ResultType>(outputChannels * tileHeight * outputWidth);
+
+                for (std::size_t tileBegin = static_cast<std::size_t>(rowBegin); tileBegin < static_cast<std::size_t>(rowEnd); tileBegin += tileHeight) {
+                    std::size_t tileEnd = std::min(tileBegin + tileHeight, static_cast<std::size_t>(rowEnd));
+                    std::size_t tileRows = tileEnd - tileBegin;
+                    std::fill(tile, tile + outputChannels * tileRows * outputWidth, static_cast<ResultType>(0));
+
+                    for (std::size_t outputChannel = 0; outputChannel < outputChannels; ++outputChannel) {
+                        for (std::size_t outIndexY = tileBegin; outIndexY < tileEnd; ++outIndexY) {
+                            ResultType* outRow = tile + (outputChannel * tileRows + outIndexY - tileBegin) * outputWidth;
+
+                            for (std::size_t inputChannel = 0; inputChannel < inputChannels; ++inputChannel) {
+                                for (std::size_t kernelY = 0; kernelY < kernelHeight; ++kernelY) {
+                                    int inputY = indicesY[kernelY * outputHeight + outIndexY];
+
+                                    if (inputY < 0) {
+                                        // the whole kernel row reads the constant border value of the height axis
+                                        ResultType weightSum = static_cast<ResultType>(0);
+                                        for (std::size_t kernelX = 0; kernelX < kernelWidth; ++kernelX) {
+                                            weightSum += static_cast<ResultType>(kernel(outputChannel, inputChannel, kernelY, kernelX));
+                                        }
+
+                                        ResultType value = weightSum * (inputY == xvigra::CONSTANT_BEGIN_INDEX ? constantBeginY : constantEndY);
+                                        for (std::size_t outIndexX = 0; outIndexX < outputWidth; ++outIndexX) {
+                                            outRow[outIndexX] += value;
+                                        }
+                                        continue;
+                                    }
+
+                                    const ResultType* inRow = rows + (inputChannel * inputHeight + static_cast<std::size_t>(inputY)) * inputWidth;
+
+                                    for (std::size_t kernelX = 0; kernelX < kernelWidth; ++kernelX) {
+                                        ResultType weight = static_cast<ResultType>(kernel(outputChannel, inputChannel, kernelY, kernelX));
+
+                                        if (weight == static_cast<ResultType>(0)) {
+                                            continue;
+                                        }
+
+                                        const int* indexRow = indicesX.data() + kernelX * outputWidth;
+
+                                        auto accumulateRange = [&](std::size_t rangeBegin, std::size_t rangeEnd) {
+                                            for (std::size_t outIndexX = rangeBegin; outIndexX < rangeEnd; ++outIndexX) {
+                                                int inputX = indexRow[outIndexX];
+                                                ResultType value = 0 <= inputX
+                                                    ? inRow[inputX]
+                                                    : (inputX == xvigra::CONSTANT_BEGIN_INDEX ? constantBeginX : constantEndX);
+                                                outRow[outIndexX] += weight * value;
+                                            }
+                                        };
+
+                                        if (vectorBegin < vectorEnd) {
+                                            xvigra::multiplyAdd(outRow + vectorBegin, inRow + indexRow[vectorBegin], weight, vectorEnd - vectorBegin);
+                                            accumulateRange(0, vectorBegin);
+                                            accumulateRange(vectorEnd, outputWidth);
+                                        } else {
+                                            accumulateRange(0, outputWidth);
+                                        }
+                                    }
+                                }
+                            }
+                        }
+                    }
+
+                    xvigra::applyEpilogueTile(
+                        tile,
+                        std::array<std::size_t, 3>{outputChannels, tileRows, outputWidth},
+                        epilogue,
+                        0,
+                        xt::view(output, xt::all(), xt::range(tileBegin, tileEnd), xt::all())
+                    );
+                }
+            });
+        } else {
+            // kernel repacked as KH x KW x IC x OC, so that the innermost loop runs over contiguous output channels
+            std::size_t tapSize = inputChannels * outputChannels;
+            ResultType* packedKernel = workspace.allocate<ResultType>(kernelHeight * kernelWidth * tapSize);
+            for (std::size_t kernelY = 0; kernelY < kernelHeight; ++kernelY) {
+                for (std::size_t kernelX = 0; kernelX < kernelWidth; ++kernelX) {
+                    for (std::size_t inputChannel = 0; inputChannel < inputChannels; ++inputChannel) {
+                        for (std::size_t outputChannel = 0; outputChannel < outputChannels; ++outputChannel) {
+                            packedKernel[(kernelY * kernelWidth + kernelX) * tapSize + inputChannel * outputChannels + outputChannel] =
+                                static_cast<ResultType>(kernel(outputChannel, inputChannel, kernelY, kernelX));
+                        }
+                    }
+                }
+            }
+
+            // every output row is accumulated on its own, so the rows are distributed over the threads
+            xvigra::parallelFor(0, static_cast<int>(outputHeight), optionsY.threadCount, [&](int rowBegin, int rowEnd) {
+                // the workspace of the options belongs to the calling thread, which runs the first chunk
+                xvigra::Workspace& chunkWorkspace = rowBegin == 0 ? workspace : xvigra::threadLocalWorkspace();
+                xvigra::Workspace::Scope chunkScope(chunkWorkspace);
+                ResultType* tile = chunkWorkspace.allocate<ResultType>(tileHeight * outputWidth * outputChannels);
+
+                for (std::size_t tileBegin = static_cast<std::size_t>(rowBegin); tileBegin < static_cast<std::size_t>(rowEnd); tileBegin += tileHeight) {
+                    std::size_t tileEnd = std::min(tileBegin + tileHeight, static_cast<std::size_t>(rowEnd));
+                    std::size_t tileRows = tileEnd - tileBegin;
+                    std::fill(tile, tile + tileRows * outputWidth * outputChannels, static_cast<ResultType>(0));
+
+                    for (std::size_t outIndexY = tileBegin; outIndexY < tileEnd; ++outIndexY) {
+                        for (std::size_t kernelY = 0; kernelY < kernelHeight; ++kernelY) {
+                            int inputY = indicesY[kernelY * outputHeight + outIndexY];
+                            ResultType constantY = inputY == xvigra::CONSTANT_BEGIN_INDEX ? constantBeginY : constantEndY;
+
+                            for (std::size_t outIndexX = 0; outIndexX < outputWidth; ++outIndexX) {
+                                ResultType* accumulator = tile + ((outIndexY - tileBegin) * outputWidth + outIndexX) * outputChannels;
+
+                                for (std::size_t kernelX = 0; kernelX < kernelWidth; ++kernelX) {
+                                    int inputX = indicesX[kernelX * outputWidth + outIndexX];
+                                    const ResultType* weights = packedKernel + (kernelY * kernelWidth + kernelX) * tapSize;
+
+                                    const InputType* pixel = nullptr;
+                                    ResultType constant = constantY;
+
+                                    if (0 <= inputY) {
+                                        if (0 <= inputX) {
+                                            pixel = in + (static_cast<std::size_t>(inputY) * inputWidth + static_cast<std::size_t>(inputX)) * inputChannels;
+                                        } else {
+                                            constant = inputX == xvigra::CONSTANT_BEGIN_INDEX ? constantBeginX : constantEndX;
+                                        }
+                                    }
+
+                                    for (std::size_t inputChannel = 0; inputChannel < inputChannels; ++inputChannel) {
+                                        ResultType value = pixel ? static_cast<ResultType>(pixel[inputChannel]) : constant;
+                                        xvigra::multiplyAdd(accumulator, weights + inputChannel * outputChannels, value, outputChannels);
+                                    }
+                                }
+                            }
+                        }
+                    }
+
+                    xvigra::applyEpilogueTile(
+                        tile,
+                        std::array<std::size_t, 3>{tileRows, outputWidth, outputChannels},
+                        epilogue,
+                        2,
+                        xt::view(output, xt::range(tileBegin, tileEnd), xt::all(), xt::all())
+                    );
+                }
+            });
+        }
+    }
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ directConvolve2D - end                                                                                       ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ symmetricConvolve1D - begin                                                                                  ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    /*
+     * <p>
+     * Calculates the depthwise 1-dimensional convolution with a symmetric or antisymmetric kernel, see
+     * xvigra::symmetricConvolve1D. Every tap k is paired with its mirrored tap K - 1 - k, so the two input samples
+     * are added (IsSymmetric) or subtracted before the single multiplication with the weight of k, see
+     * xvigra::multiplyAddFolded. The center tap of an odd kernel is only read for symmetric kernels.
+     * The channels of a channel first input and the output pixels of a channel last input are distributed over the
+     * threads of the options. Every thread accumulates its share in tiles of workspace memory and writes every tile
+     * into the output with the epilogue applied.
+     * </p>
+     */
+    template <bool IsSymmetric, typename ResultType, typename InputType, typename KernelType, typename InputContainerType, typename R>
+    void foldedConvolve1D(
+        const InputContainerType& input,
+        const xt::xtensor<KernelType, 1>& kernel,
+        const xvigra::KernelOptions& options,
+        const xvigra::Epilogue& epilogue,
+        R& output
+    ) {
+        bool isChannelFirst = options.channelPosition == xvigra::ChannelPosition::FIRST;
+
+        std::size_t channels = input.shape()[isChannelFirst ? 0 : 1];
+        std::size_t inputWidth = input.shape()[isChannelFirst ? 1 : 0];
+        std::size_t kernelSize = kernel.size();
+        std::size_t pairs = kernelSize / 2;
+        bool hasCenter = IsSymmetric && kernelSize % 2 == 1;
+
+        std::vector<int> indices = xvigra::calculateGatherIndices(
+            static_cast<int>(inputWidth),
+            static_cast<int>(kernelSize),
+            options
+        );
+        std::size_t outputWidth = indices.size() / kernelSize;
+
+        ResultType constantBegin = xvigra::gatherConstant<InputType, ResultType>(options, xvigra::CONSTANT_BEGIN_INDEX);
+        ResultType constantEnd = xvigra::gatherConstant<InputType, ResultType>(options, xvigra::CONSTANT_END_INDEX);
+
+        xvigra::Workspace& workspace = xvigra::resolveWorkspace(options.workspace);
+        xvigra::Workspace::Scope workspaceScope(workspace);
+        const ResultType* rows = xvigra::convertDirectInput<ResultType>(input.data(), channels * inputWidth, workspace);
+
+        if (isChannelFirst) {
+            // without stride, the interior of every tap reads a contiguous input row
+            auto [interiorBegin, interiorEnd] = xvigra::calculateInteriorRange(static_cast<int>(inputWidth), static_cast<int>(kernelSize), options);
+            std::size_t vectorBegin = options.stride == 1 ? static_cast<std::size_t>(interiorBegin) : outputWidth;
+            std::size_t vectorEnd = options.stride == 1 ? static_cast<std::size_t>(interiorEnd) : outputWidth;
+
+            // a tile holds the output rows of a range of channels
+            std::size_t tileChannels = static_cast<std::size_t>(
+                xvigra::calculateTileSize(options.workspaceLimit, outputWidth * sizeof(ResultType), static_cast<int>(channels))
+            );
+
+            auto accumulateChannel = [&](const ResultType* inRow, ResultType* outRow) {
+                auto sample = [&](int inputX) {
+                    return 0 <= inputX ? inRow[inputX] : (inputX == xvigra::CONSTANT_BEGIN_INDEX ? constantBegin : constantEnd);
+                };
+
+                for (std::size_t kernelX = 0; kernelX < pairs; ++kernelX) {
+                    ResultType weight = static_cast<ResultType>(kernel(kernelX));
+
+                    if (weight == static_cast<ResultType>(0)) {
+                        continue;
+                    }
+
+                    const int* firstIndices = indices.data() + kernelX * outputWidth;
+                    const int* secondIndices = indices.data() + (kernelSize - 1 - kernelX) * outputWidth;
+
+                    auto accumulateRange = [&](std::size_t rangeBegin, std::size_t rangeEnd) {
+                        for (std::size_t outIndex = rangeBegin; outIndex < rangeEnd; ++outIndex) {
+                            ResultType first = sample(firstIndices[outIndex]);
+                            ResultType second = sample(secondIndices[outIndex]);
+                            outRow[outIndex] += weight * (IsSymmetric ? first + second : first - second);
+                        }
+                    };
+
+                    if (vectorBegin < vectorEnd) {
+                        xvigra::multiplyAddFolded<IsSymmetric>(
+                            outRow + vectorBegin,
+                            inRow + firstIndices[vectorBegin],
+                            inRow + secondIndices[vectorBegin],
+                            weight,
+                            vectorEnd - vectorBegin
+                        );
+                        accumulateRange(0, vectorBegin);
+                        accumulateRange(vectorEnd, outputWidth);
+                    } else {
+                        accumulateRange(0, outputWidth);
+                    }
+                }
+
+                if (hasCenter) {
+                    ResultType weight = static_cast<ResultType>(kernel(pairs));
+                    const int* centerIndices = indices.data() + pairs * outputWidth;
+
+                    auto accumulateRange = [&](std::size_t rangeBegin, std::size_t rangeEnd) {
+                        for (std::size_t outIndex = rangeBegin; outIndex < rangeEnd; ++outIndex) {
+                            outRow[outIndex] += weight * sample(centerIndices[outIndex]);
+                        }
+                    };
+
+                    if (vectorBegin < vectorEnd) {
+                        xvigra::multiplyAdd(outRow + vectorBegin, inRow + centerIndices[vectorBegin], weight, vectorEnd - vectorBegin);
+                        accumulateRange(0, vectorBegin);
+                        accumulateRange(vectorEnd, outputWidth);
+                    } else {
+                        accumulateRange(0, outputWidth);
+                    }
+                }
+            };
+
+            // every channel reads and writes its own rows, so the channels are distributed over the threads
+            xvigra::parallelFor(0, static_cast<int>(channels), options.threadCount, [&](int channelBegin, int channelEnd) {
+                // the workspace of the options belongs to the calling thread, which runs the first chunk
+                xvigra::Workspace& chunkWorkspace = channelBegin == 0 ? workspace : xvigra::threadLocalWorkspace();
+                xvigra::Workspace::Scope chunkScope(chunkWorkspace);
+                ResultType* tile = chunkWorkspace.allocate<ResultType>(tileChannels * outputWidth);
+
+                for (std::size_t tileBegin = static_cast<std::size_t>(channelBegin); tileBegin < static_cast<std::size_t>(channelEnd); tileBegin += tileChannels) {
+                    std::size_t tileEnd = std::min(tileBegin + tileChannels, static_cast<std::size_t>(channelEnd));
+                    std::fill(tile, tile + (tileEnd - tileBegin) * outputWidth, static_cast<ResultType>(0));
+
+                    for (std::size_t channel = tileBegin; channel < tileEnd; ++channel) {
+                        accumulateChannel(rows + channel * inputWidth, tile + (channel - tileBegin) * outputWidth);
+                    }
+
+                    xvigra::applyEpilogueTile(
+                        tile,
+                        std::array<std::size_t, 2>{tileEnd - tileBegin, outputWidth},
+                        epilogue,
+                        0,
+                        xt::view(output, xt::range(tileBegin, tileEnd), xt::all()),
+                        tileBegin
+                    );
+                }
+            });
+        } else {
+            // constant border pixels, so that every tap reads a row of all channels
+            std::vector<ResultType> constantBeginPixel(channels, constantBegin);
+            std::vector<ResultType> constantEndPixel(channels, constantEnd);
+
+            auto pixel = [&](int inputX) {
+                return 0 <= inputX
+                    ? rows + static_cast<std::size_t>(inputX) * channels
+                    : (inputX == xvigra::CONSTANT_BEGIN_INDEX ? constantBeginPixel.data() : constantEndPixel.data());
+            };
+
+            // a tile holds all channels of a range of output pixels
+            std::size_t tileWidth = static_cast<std::size_t>(
+                xvigra::calculateTileSize(options.workspaceLimit, channels * sizeof(ResultType), static_cast<int>(outputWidth))
+            );
+
+            // every output pixel accumulates all channels on its own, so the pixels are distributed over the threads
+            xvigra::parallelFor(0, static_cast<int>(outputWidth), options.threadCount, [&](int pixelBegin, int pixelEnd) {
+                // the workspace of the options belongs to the calling thread, which runs the first chunk
+                xvigra::Workspace& chunkWorkspace = pixelBegin == 0 ? workspace : xvigra::threadLocalWorkspace();
+                xvigra::Workspace::Scope chunkScope(chunkWorkspace);
+                ResultType* tile = chunkWorkspace.allocate<ResultType>(tileWidth * channels);
+
+                for (std::size_t tileBegin = static_cast<std::size_t>(pixelBegin); tileBegin < static_cast<std::size_t>(pixelEnd); tileBegin += tileWidth) {
+                    std::size_t tileEnd = std::min(tileBegin + tileWidth, static_cast<std::size_t>(pixelEnd));
+                    std::fill(tile, tile + (tileEnd - tileBegin) * channels, static_cast<ResultType>(0));
+
+                    for (std::size_t outIndex = tileBegin; outIndex < tileEnd; ++outIndex) {
+                        ResultType* accumulator = tile + (outIndex - tileBegin) * channels;
+
+                        for (std::size_t kernelX = 0; kernelX < pairs; ++kernelX) {
+                            ResultType weight = static_cast<ResultType>(kernel(kernelX));
+
+                            if (weight == static_cast<ResultType>(0)) {
+                                continue;
+                            }
+
+                            const ResultType* first = pixel(indices[kernelX * outputWidth + outIndex]);
+                            const ResultType* second = pixel(indices[(kernelSize - 1 - kernelX) * outputWidth + outIndex]);
+                            xvigra::multiplyAddFolded<IsSymmetric>(accumulator, first, second, weight, channels);
+                        }
+
+                        if (hasCenter) {
+                            ResultType weight = static_cast<ResultType>(kernel(pairs));
+                            xvigra::multiplyAdd(accumulator, pixel(indices[pairs * outputWidth + outIndex]), weight, channels);
+                        }
+                    }
+
+                    xvigra::applyEpilogueTile(
+                        tile,
+                        std::array<std::size_t, 2>{tileEnd - tileBegin, channels},
+                        epilogue,
+                        1,
+                        xt::view(output, xt::range(tileBegin, tileEnd), xt::all())
+                    );
+                }
+            });
+        }
+    }
+
+    /*
+     * <p>
+     * Calculates the explicit depthwise 1-dimensional convolution of every channel with a symmetric or antisymmetric
+     * kernel, see xvigra::KernelSymmetry. The mirrored input samples are added or subtracted before the
+     * multiplication, which halves the multiplications of xvigra::directConvolve1D. Only the first half of the kernel
+     * and the center of a symmetric kernel are read, so the declared symmetry has to hold.
+     * The border treatments are applied as in xvigra::directConvolve1D, and the result is written into the output
+     * tile by tile with the epilogue applied. The caller is responsible for the validation of the input and kernel
+     * and for the shape of the output; see xvigra::convolve1D.
+     * </p>
+     *
+     * @tparam ResultType value type of the result
+     * @tparam InputContainerType row major container of the input, see xvigra::evaluateContiguous
+     * @tparam R derived type of the output xexpression
+     * @param input input of shape W x C or C x W
+     * @param kernel 1-dimensional kernel of shape K, which is applied to every channel
+     * @param symmetry KernelSymmetry::SYMMETRIC or KernelSymmetry::ANTISYMMETRIC
+     * @param options object containing information about padding, stride, dilation, channel position and border
+                      treatment
+     * @param epilogue bias, scale, clipping and rounding which are applied to the result
+     * @param output output of shape W' x C or C x W', which receives the result
+     * @throws std::invalid_argument if the symmetry is neither SYMMETRIC nor ANTISYMMETRIC
+     */
+    template <typename ResultType, typename InputType, typename KernelType, typename InputContainerType, typename R>
+    void symmetricConvolve1D(
+        const InputContainerType& input,
+        const xt::xtensor<KernelType, 1>& kernel,
+        xvigra::KernelSymmetry symmetry,
+        const xvigra::KernelOptions& options,
+        const xvigra::Epilogue& epilogue,
+        R& output
+    ) {
+        switch (symmetry) {
+            case xvigra::KernelSymmetry::SYMMETRIC:
+                xvigra::foldedConvolve1D<true, ResultType, InputType>(input, kernel, options, epilogue, output);
+                return;
+            case xvigra::KernelSymmetry::ANTISYMMETRIC:
+                xvigra::foldedConvolve1D<false, ResultType, InputType>(input, kernel, options, epilogue, output);
+                return;
+            default:
+                throw std::invalid_argument("symmetricConvolve1D(): Need a symmetric or antisymmetric kernel!");
+        }
+    }
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ symmetricConvolve1D - end                                                                                    ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+} // xvigra
+
+#endif // XVIGRA_DIRECT_CONVOLUTION_HPP
@@ -0,0 +1,385 @@
+#ifndef XVIGRA_EPILOGUE_HPP
+#define XVIGRA_EPILOGUE_HPP
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "xtensor/xadapt.hpp"
+#include "xtensor/xexpression.hpp"
+#include "xtensor/xnoalias.hpp"
+
+#include "xvigra/math.hpp"
+
+namespace xvigra {
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ forward declaration - begin                                                                                  ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    enum class RoundingMode;
+
+    class Epilogue;
+
+    inline void checkEpilogue(const Epilogue&, std::size_t, const std::string&);
+
+    inline Epilogue sliceEpilogue(const Epilogue&, std::size_t, std::size_t);
+
+    template <typename E, typename R>
+    void applyEpilogue(const xt::xexpression<E>&, const Epilogue&, std::size_t, xt::xexpression<R>&, std::size_t channelOffset=0);
+
+    template <typename ValueType, std::size_t N, typename R>
+    void applyEpilogueTile(const ValueType*, const std::array<std::size_t, N>&, const Epilogue&, std::size_t, R&&, std::size_t channelOffset=0);
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ forward declaration - end                                                                                    ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ enum class RoundingMode - begin                                                                              ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    /*
+     * <p>
+     * Rounding of the epilogue, which is applied after the clipping: NONE keeps the value, NEAREST rounds to the
+     * nearest integer and DECIMALS rounds with xvigra::roundValue to the given number of decimals.
+     * </p>
+     */
+    enum class RoundingMode {
+        NONE,
+        NEAREST,
+        DECIMALS
+    }; // RoundingMode
+
+    inline std::ostream& operator<<(std::ostream& out, const RoundingMode& rounding) {
+        switch (rounding) {
+            case RoundingMode::NONE:
+                return out << "RoundingMode::NONE";
+            case RoundingMode::NEAREST:
+                return out << "RoundingMode::NEAREST";
+            case RoundingMode::DECIMALS:
+                return out << "RoundingMode::DECIMALS";
+            default:
+                return out << "RoundingMode::UNKNOWN";
+        }
+    }
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ enum class RoundingMode - end                                                                                ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ class Epilogue - begin                                                                                       ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    /*
+     * <p>
+     * Element wise post processing which the convolutions apply to every output tile while it is still in cache,
+     * instead of separate passes over the whole result. A value v of output channel c becomes
+     * round(clip(scale * v + bias[c])), which is then converted to the value type of the output; integral outputs
+     * are rounded to the nearest integer and saturated at the limits of their type.
+     * An empty bias adds nothing; otherwise it needs one entry per output channel.
+     * The default epilogue is the identity for floating point outputs; integral outputs of another value type are
+     * still rounded and saturated by it, see Epilogue#isIdentity.
+     * </p>
+     */
+    class Epilogue {
+    public:
+        std::vector<double> bias;
+        double scale;
+        bool isClipped;
+        double clipMinimum;
+        double clipMaximum;
+        RoundingMode rounding;
+        int decimals;
+
+        Epilogue()
+        : bias(),
+          scale(1.0),
+          isClipped(false),
+          clipMinimum(0.0),
+          clipMaximum(0.0),
+          rounding(RoundingMode::NONE),
+          decimals(0)
+        {}
+
+        void setBias(const std::vector<double>&);
+        void setScale(double);
+        void setClip(double, double);
+        void setRounding(const RoundingMode&, int decimals=0);
+
+        bool isIdentity() const;
+
+        template <typename OutputType, typename ValueType>
+        bool isIdentity() const;
+
+        template <typename OutputType, typename ValueType>
+        OutputType apply(ValueType, std::size_t) const;
+
+        template <typename T>
+        static Epilogue normalize();
+    }; // Epilogue
+
+    inline std::ostream& operator<<(std::ostream& out, const Epilogue& epilogue) {
+        return out << "{"
+                   << "biasSize=" << epilogue.bias.size()
+                   << ", scale=" << epilogue.scale
+                   << ", clip=" << (epilogue.isClipped ? "(" + std::to_string(epilogue.clipMinimum) + ", " + std::to_string(epilogue.clipMaximum) + ")" : std::string("none"))
+                   << ", rounding=" << epilogue.rounding
+                   << ", decimals=" << epilogue.decimals
+                   << "}";
+    }
+
+    // one value per output channel which is added after the scale; an empty bias adds nothing
+    void Epilogue::setBias(const std::vector<double>& bias) {
+        this->bias = bias;
+    }
+
+    void Epilogue::setScale(double scale) {
+        this->scale = scale;
+    }
+
+    void Epilogue::setClip(double minimum, double maximum) {
+        if (maximum < minimum) {
+            throw std::invalid_argument("Epilogue::setClip(): Minimum is greater than maximum!");
+        }
+
+        this->isClipped = true;
+        this->clipMinimum = minimum;
+        this->clipMaximum = maximum;
+    }
+
+    void Epilogue::setRounding(const RoundingMode& rounding, int decimals) {
+        this->rounding = rounding;
+        this->decimals = decimals;
+    }
+
+    bool Epilogue::isIdentity() const {
+        return this->bias.empty() && this->scale == 1.0 && !this->isClipped && this->rounding == RoundingMode::NONE;
+    }
+
+    /*
+     * <p>
+     * Returns whether writing a ValueType value into an OutputType output with this epilogue is a plain conversion.
+     * An integral output of another value type is rounded and saturated even by the default epilogue, since the plain
+     * conversion would truncate and leave values outside of OutputType undefined.
+     * </p>
+     *
+     * @tparam OutputType value type of the output
+     * @tparam ValueType type of the accumulated value
+     * @return whether the epilogue can be skipped for the conversion
+     */
+    template <typename OutputType, typename ValueType>
+    bool Epilogue::isIdentity() const {
+        return isIdentity() && (!std::is_integral_v<OutputType> || std::is_same_v<OutputType, ValueType>);
+    }
+
+    /*
+     * <p>
+     * Applies the epilogue to a single value of the given output channel and converts it to OutputType.
+     * </p>
+     *
+     * @tparam OutputType value type of the output
+     * @tparam ValueType type of the accumulated value
+     * @param value accumulated value of the convolution
+     * @param channel output channel of the value, which selects the bias
+     * @return the post processed value
+     */
+    template <typename OutputType, typename ValueType>
+    OutputType Epilogue::apply(ValueType value, std::size_t channel) const {
+        double result = this->scale * static_cast<double>(value);
+
+        if (!this->bias.empty()) {
+            result += this->bias[channel];
+        }
+
+        if (this->isClipped) {
+            result = std::clamp(result, this->clipMinimum, this->clipMaximum);
+        }
+
+        if (this->rounding == RoundingMode::NEAREST) {
+            result = std::nearbyint(result);
+        } else if (this->rounding == RoundingMode::DECIMALS) {
+            result = xvigra::roundValue(result, this->decimals);
+        }
+
+        if constexpr (std::is_integral_v<OutputType>) {
+            result = std::clamp(
+                std::nearbyint(result),
+                static_cast<double>(std::numeric_limits<OutputType>::min()),
+                static_cast<double>(std::numeric_limits<OutputType>::max())
+            );
+        }
+
+        return static_cast<OutputType>(result);
+    }
+
+    /*
+     * <p>
+     * Returns the epilogue which matches xvigra::normalizeAfterConvolution: floating point values are clipped to
+     * [0, 1] and rounded to 11 decimals, integral values are clipped to [0, 255].
+     * </p>
+     *
+     * @tparam T value type of the convolution result
+     * @return the normalizing epilogue
+     */
+    template <typename T>
+    Epilogue Epilogue::normalize() {
+        Epilogue epilogue;
+
+        if constexpr (std::is_floating_point_v<T>) {
+            epilogue.setClip(0.0, 1.0);
+            epilogue.setRounding(RoundingMode::DECIMALS, 11);
+        } else {
+            epilogue.setClip(0.0, 255.0);
+        }
+
+        return epilogue;
+    }
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ class Epilogue - end                                                                                         ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ apply epilogue - begin                                                                                       ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    /*
+     * <p>
+     * Checks that the bias of the epilogue fits the output channels of a convolution.
+     * </p>
+     *
+     * @param epilogue epilogue of the convolution
+     * @param outputChannels number of output channels of the convolution
+     * @param functionName name of the calling function, which prefixes the error message
+     * @throws std::invalid_argument if the bias is neither empty nor has one entry per output channel
+     */
+    inline void checkEpilogue(const Epilogue& epilogue, std::size_t outputChannels, const std::string& functionName) {
+        if (!epilogue.bias.empty() && epilogue.bias.size() != outputChannels) {
+            throw std::invalid_argument(functionName + ": Bias size does not match the output channels!");
+        }
+    }
+
+    /*
+     * <p>
+     * Returns the epilogue for a convolution which only computes the output channels
+     * [channelBegin, channelBegin + channels), e.g. a single group of a grouped convolution. Only the bias is sliced;
+     * an empty bias stays empty.
+     * </p>
+     *
+     * @param epilogue epilogue of the full convolution
+     * @param channelBegin first output channel of the slice
+     * @param channels number of output channels of the slice
+     * @return the epilogue of the slice
+     */
+    inline Epilogue sliceEpilogue(const Epilogue& epilogue, std::size_t channelBegin, std::size_t channels) {
+        Epilogue result = epilogue;
+
+        if (!epilogue.bias.empty()) {
+            result.bias.assign(epilogue.bias.begin() + channelBegin, epilogue.bias.begin() + channelBegin + channels);
+        }
+
+        return result;
+    }
+
+    /*
+     * <p>
+     * Writes the values with the epilogue applied into the target, which must have the shape of the values. The output
+     * channel of an element is its index along channelAxis plus channelOffset, so a tile which only holds a range of
+     * the output channels selects the matching bias entries.
+     * An identity epilogue for the value types of values and target is a plain assignment, see Epilogue#isIdentity. Otherwise values and target are walked once in row major order,
+     * which is a single pass instead of one pass per post processing step.
+     * </p>
+     *
+     * @tparam E derived type of the values xexpression
+     * @tparam R derived type of the target xexpression
+     * @param valuesExpression xexpression containing the accumulated values
+     * @param epilogue epilogue which is applied to every value
+     * @param channelAxis axis of the output channels in values and target
+     * @param targetExpression xexpression which receives the post processed values
+     * @param channelOffset output channel of the first index along channelAxis
+     */
+    template <typename E, typename R>
+    void applyEpilogue(
+        const xt::xexpression<E>& valuesExpression,
+        const Epilogue& epilogue,
+        std::size_t channelAxis,
+        xt::xexpression<R>& targetExpression,
+        std::size_t channelOffset
+    ) {
+        using OutputType = typename xt::xexpression<R>::derived_type::value_type;
+        using ValueType = typename xt::xexpression<E>::derived_type::value_type;
+
+        const auto& values = valuesExpression.derived_cast();
+        auto& target = targetExpression.derived_cast();
+
+        if (epilogue.template isIdentity<OutputType, ValueType>()) {
+            xt::noalias(target) = values;
+            return;
+        }
+
+        std::size_t channels = values.shape()[channelAxis];
+        std::size_t channelStride = 1;
+        for (std::size_t axis = channelAxis + 1; axis < values.dimension(); ++axis) {
+            channelStride *= values.shape()[axis];
+        }
+
+        auto valueIter = values.begin();
+        auto targetIter = target.begin();
+        auto targetEnd = target.end();
+
+        for (std::size_t index = 0; targetIter != targetEnd; ++index, ++valueIter, ++targetIter) {
+            *targetIter = epilogue.template apply<OutputType>(*valueIter, channelOffset + (index / channelStride) % channels);
+        }
+    }
+
+    /*
+     * <p>
+     * Writes a row major tile of accumulated values with the epilogue applied into the target, see
+     * xvigra::applyEpilogue. The backends of the explicit convolutions accumulate a tile of the result in workspace
+     * memory and pass the matching view of the output as target, which may be a temporary.
+     * </p>
+     *
+     * @tparam ValueType type of the accumulated values
+     * @tparam N number of dimensions of the tile
+     * @tparam R type of the target xexpression
+     * @param tile pointer to the row major tile
+     * @param shape shape of the tile and of the target
+     * @param epilogue epilogue which is applied to every value
+     * @param channelAxis axis of the output channels in tile and target
+     * @param target xexpression which receives the post processed values
+     * @param channelOffset output channel of the first index along channelAxis
+     */
+    template <typename ValueType, std::size_t N, typename R>
+    void applyEpilogueTile(
+        const ValueType* tile,
+        const std::array<std::size_t, N>& shape,
+        const Epilogue& epilogue,
+        std::size_t channelAxis,
+        R&& target,
+        std::size_t channelOffset
+    ) {
+        std::size_t size = 1;
+        for (std::size_t extent : shape) {
+            size *= extent;
+        }
+
+        xvigra::applyEpilogue(xt::adapt(tile, size, xt::no_ownership(), shape), epilogue, channelAxis, target, channelOffset);
+    }
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ apply epilogue - end                                                                                         ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+} // xvigra
+
+#endif // XVIGRA_EPILOGUE_HPP
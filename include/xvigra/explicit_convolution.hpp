@@ -1,22 +1,43 @@
 #ifndef XVIGRA_EXPLICIT_CONVOLUTION_HPP
 #define XVIGRA_EXPLICIT_CONVOLUTION_HPP
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <stdexcept>
 #include <string>
+#include <tuple>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #ifdef VOID
 #undef VOID
 #endif
 
+#include "xtensor/xadapt.hpp"
 #include "xtensor/xbuilder.hpp"
+#include "xtensor/xnoalias.hpp"
+#include "xtensor/xstrided_view.hpp"
 #include "xtensor/xtensor.hpp"
+#include "xtensor/xutils.hpp"
+#include "xtensor/xview.hpp"
 
 #include "xtensor-blas/xlinalg.hpp"
 
 #include "xvigra/convolution_util.hpp"
+#include "xvigra/direct_convolution.hpp"
+#include "xvigra/epilogue.hpp"
+#include "xvigra/fft_convolution.hpp"
+#include "xvigra/gemm_util.hpp"
+#include "xvigra/half_precision.hpp"
 #include "xvigra/iter_util.hpp"
 #include "xvigra/kernel_util.hpp"
+#include "xvigra/simd_util.hpp"
+#include "xvigra/sparse_convolution.hpp"
+#include "xvigra/thread_util.hpp"
+#include "xvigra/winograd_convolution.hpp"
+#include "xvigra/workspace.hpp"
 
 namespace xvigra {
     // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
@@ -30,6 +51,8 @@ namespace xvigra {
     template <typename T>
     using Tensor3D = typename xt::xtensor<T, 3>;
     template <typename T>
+    using Tensor4D = typename xt::xtensor<T, 4>;
+    template <typename T>
     using Tensor5D = typename xt::xtensor<T, 5>;
 
     // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
@@ -193,70 +216,197 @@ namespace xvigra {
         patch(outIndex, inputChannel, patchKernelX) = static_cast<ResultType>(value);     \
     }
 
-    #define XVIGRA_GET_BEGIN_BORDER_INDEX(value, treatment, index, size) {                      \
-        switch((treatment).getType()) {                                                         \
-            case xvigra::BorderTreatmentType::ASYMMETRIC_REFLECT: {                             \
-                (value) = std::abs((index));                                                    \
-                break;                                                                          \
-            }                                                                                   \
-            case xvigra::BorderTreatmentType::AVOID: {                                          \
-                throw std::domain_error(                                                        \
-                    "getBorderIndex(): Border treatment AVOID should not be used here!"         \
-                );                                                                              \
-            }                                                                                   \
-            case xvigra::BorderTreatmentType::CONSTANT: {                                       \
-                (value) = -1;                                                                   \
-                break;                                                                          \
-            }                                                                                   \
-            case xvigra::BorderTreatmentType::REPEAT: {                                         \
-                (value) = 0;                                                                    \
-                break;                                                                          \
-            }                                                                                   \
-            case xvigra::BorderTreatmentType::SYMMETRIC_REFLECT: {                              \
-                (value) = std::abs((index) + 1);                                                \
-                break;                                                                          \
-            }                                                                                   \
-            case xvigra::BorderTreatmentType::WRAP: {                                           \
-                (value) = (index) + (size);                                                     \
-                break;                                                                          \
-            }                                                                                   \
-            default: {                                                                          \
-                throw std::domain_error("getBorderIndex(): Unknown begin border treatment!");   \
-            }                                                                                   \
-        }                                                                                       \
-    }
-
-    #define XVIGRA_GET_END_BORDER_INDEX(value, treatment, index, size) {                      \
-        switch((treatment).getType()) {                                                       \
-            case xvigra::BorderTreatmentType::ASYMMETRIC_REFLECT: {                           \
-                (value) = 2 * (size) - (index) - 2;                                           \
-                break;                                                                        \
-            }                                                                                 \
-            case xvigra::BorderTreatmentType::AVOID: {                                        \
-                throw std::domain_error(                                                      \
-                    "getBorderIndex(): Border treatment AVOID should not be used here!"       \
-                );                                                                            \
-            }                                                                                 \
-            case xvigra::BorderTreatmentType::CONSTANT: {                                     \
-                (value) = -1;                                                                 \
-                break;                                                                        \
-            }                                                                                 \
-            case xvigra::BorderTreatmentType::REPEAT: {                                       \
-                (value) = (size) - 1;                                                         \
-                break;                                                                        \
-            }                                                                                 \
-            case xvigra::BorderTreatmentType::SYMMETRIC_REFLECT: {                            \
-                (value) = 2 * (size) - (index) - 1;                                           \
-                break;                                                                        \
-            }                                                                                 \
-            case xvigra::BorderTreatmentType::WRAP: {                                         \
-                (value) = (index) - (size);                                                   \
-                break;                                                                        \
-            }                                                                                 \
-            default: {                                                                        \
-                throw std::domain_error("getBorderIndex(): Unknown end border treatment!");   \
-            }                                                                                 \
-        }                                                                                     \
+    /*
+     * <p>
+     * Returns the expression itself if it is a row major container, whose elements the direct, Winograd and FFT
+     * backends can read through its data pointer. This holds for xt::xtensor, xt::xarray and xt::adapt buffers;
+     * every other expression (views, broadcasts, ...) is evaluated once into an xt::xtensor.
+     * </p>
+     *
+     * @tparam N number of dimensions of the expression
+     * @param expression the input of an explicit convolution
+     * @return a reference to the expression or the evaluated xt::xtensor
+     */
+    template <std::size_t N, typename E>
+    decltype(auto) evaluateContiguous(const E& expression) {
+        if constexpr (std::is_base_of_v<xt::xcontainer<E>, E> && E::static_layout == xt::layout_type::row_major) {
+            return (expression);
+        } else {
+            return xt::xtensor<typename E::value_type, N>(expression);
+        }
+    }
+
+    /*
+     * <p>
+     * Returns the expression itself if its elements can be read through its data pointer, data offset and strides.
+     * Unlike xvigra::evaluateContiguous this also holds for strided views and for the channel range adaptors of
+     * xvigra::adaptChannelRange, so the patch of xvigra::convolveND reads them in place; every other expression is
+     * evaluated once into an xt::xtensor.
+     * </p>
+     *
+     * @tparam N number of dimensions of the expression
+     * @param expression the input of an explicit convolution
+     * @return a reference to the expression or the evaluated xt::xtensor
+     */
+    template <std::size_t N, typename E>
+    decltype(auto) evaluateStrided(const E& expression) {
+        if constexpr (xt::has_data_interface<E>::value) {
+            return (expression);
+        } else {
+            return xt::xtensor<typename E::value_type, N>(expression);
+        }
+    }
+
+    /*
+     * <p>
+     * Prepares the caller-provided output of an explicit convolution. An xt::xtensor is resized if its shape differs
+     * from the result shape, so it only allocates on the first call of a steady state pipeline. Its value type may
+     * differ from the result type, e.g. for 16-bit float storage of a result which is accumulated in float.
+     * Every other output (xt::adapt buffers, views) must already have the result shape.
+     * </p>
+     *
+     * @param output the output which is written by the convolution
+     * @param shape shape of the result
+     * @param functionName name of the calling function for the error message
+     * @throws std::invalid_argument if the output can't be resized and its shape differs from the result shape
+     */
+    template <typename R, std::size_t N>
+    void prepareConvolutionOutput(
+        R& output,
+        const std::array<std::size_t, N>& shape,
+        const std::string& functionName
+    ) {
+        if (output.dimension() == N && std::equal(shape.begin(), shape.end(), output.shape().begin())) {
+            return;
+        }
+
+        if constexpr (std::is_same_v<R, xt::xtensor<typename R::value_type, N>>) {
+            output.resize(shape);
+        } else {
+            throw std::invalid_argument(functionName + ": Output shape does not match the result shape!");
+        }
+    }
+
+    /*
+     * <p>
+     * Returns an adaptor of the channels [channelBegin, channelBegin + channels) along channelAxis of a row major
+     * container, which shares the memory of the container like a view. Unlike a view its type does not depend on the
+     * type of the container, so convolving a group through it doesn't instantiate a new convolution for every nesting.
+     * </p>
+     *
+     * @tparam N number of dimensions of the container
+     * @param container row major container, e.g. the result of xvigra::evaluateContiguous
+     * @param channelAxis axis of the channels
+     * @param channelBegin first channel of the range
+     * @param channels number of channels of the range
+     * @return the adaptor of the channel range
+     */
+    template <std::size_t N, typename E>
+    auto adaptChannelRange(E& container, std::size_t channelAxis, std::size_t channelBegin, std::size_t channels) {
+        std::array<std::size_t, N> shape;
+        std::array<std::ptrdiff_t, N> strides;
+        std::size_t stride = 1;
+
+        for (std::size_t axis = N; axis-- > 0;) {
+            shape[axis] = container.shape()[axis];
+            strides[axis] = static_cast<std::ptrdiff_t>(stride);
+            stride *= shape[axis];
+        }
+
+        std::size_t offset = channelBegin * static_cast<std::size_t>(strides[channelAxis]);
+        shape[channelAxis] = channels;
+
+        return xt::adapt(container.data() + offset, container.size() - offset, xt::no_ownership(), shape, strides);
+    }
+
+    /*
+     * <p>
+     * Returns the full kernel of an explicit convolution. A kernel which already is a full xt::xtensor of the kernel
+     * type is returned by reference, so a steady state pipeline with full kernels never copies it; every other kernel
+     * is promoted by xvigra::promoteKernelToFull1D, xvigra::promoteKernelToFull2D or xvigra::promoteKernelToFullND.
+     * </p>
+     *
+     * @tparam N number of non-channel dimensions of the convolution
+     * @tparam KernelType value type of the full kernel
+     * @param rawKernel the kernel passed to the convolution
+     * @param inputChannels number of input channels, which is used to promote lower dimensional kernels
+     * @return a reference to the kernel or the promoted xt::xtensor
+     */
+    template <std::size_t N, typename KernelType, typename K>
+    decltype(auto) resolveFullKernel(const K& rawKernel, std::size_t inputChannels) {
+        if constexpr (std::is_same_v<K, xt::xtensor<KernelType, N + 2>>) {
+            return (rawKernel);
+        } else if constexpr (N == 1) {
+            return xt::xtensor<KernelType, 3>(xvigra::promoteKernelToFull1D(rawKernel, inputChannels));
+        } else if constexpr (N == 2) {
+            return xt::xtensor<KernelType, 4>(xvigra::promoteKernelToFull2D(rawKernel, inputChannels));
+        } else {
+            return xt::xtensor<KernelType, N + 2>(xvigra::promoteKernelToFullND<N>(rawKernel, inputChannels));
+        }
+    }
+
+    /*
+     * <p>
+     * Packs a full kernel as the OC x (IC * taps) matrix of a GEMM-based convolution, or as its transpose, into the
+     * given memory, which the convolution draws from its workspace together with the patch and the product. The
+     * matrix is converted to the result type and row major, so the tiles of the convolution are multiplied by
+     * xvigra::matrixProduct without any further copy of the kernel.
+     * </p>
+     *
+     * @tparam ResultType value type of the matrix
+     * @param kernel the full kernel, a row major container of OC x IC x taps
+     * @param isTransposed whether the (IC * taps) x OC matrix of channel last convolutions is packed
+     * @param matrixData memory for kernel.size() elements
+     * @return an adaptor of the packed matrix
+     */
+    template <typename ResultType, typename K>
+    auto packKernelMatrix(const K& kernel, bool isTransposed, ResultType* matrixData) {
+        std::size_t outputChannels = kernel.shape()[0];
+        std::size_t depth = outputChannels == 0 ? 0 : kernel.size() / outputChannels;
+        const auto* kernelData = kernel.data();
+
+        if (isTransposed) {
+            for (std::size_t outputChannel = 0; outputChannel < outputChannels; ++outputChannel) {
+                for (std::size_t index = 0; index < depth; ++index) {
+                    matrixData[index * outputChannels + outputChannel] = static_cast<ResultType>(kernelData[outputChannel * depth + index]);
+                }
+            }
+
+            return xt::adapt(matrixData, kernel.size(), xt::no_ownership(), std::array<std::size_t, 2>{depth, outputChannels});
+        }
+
+        std::transform(kernelData, kernelData + kernel.size(), matrixData, [](auto value) { return static_cast<ResultType>(value); });
+        return xt::adapt(matrixData, kernel.size(), xt::no_ownership(), std::array<std::size_t, 2>{outputChannels, depth});
+    }
+
+    /*
+     * <p>
+     * Returns the options with which a sliding window over a channel last line agrees with the channel last patch of
+     * xvigra::convolve1D. The patch reflects the begin border one position further for ASYMMETRIC_REFLECT and one
+     * position closer for SYMMETRIC_REFLECT, so both begin treatments are swapped; every other option is kept.
+     * </p>
+     *
+     * @param options options of the channel last 1-dimensional convolution
+     * @return the options for xvigra::calculateGatherIndices and the direct backends
+     */
+    inline xvigra::KernelOptions channelLastLineOptions(const xvigra::KernelOptions& options) {
+        xvigra::KernelOptions lineOptions = options;
+
+        switch (options.borderTreatmentBegin.getType()) {
+            case xvigra::BorderTreatmentType::ASYMMETRIC_REFLECT: {
+                lineOptions.setBorderTreatmentBegin(xvigra::BorderTreatment::symmetricReflect());
+                break;
+            }
+            case xvigra::BorderTreatmentType::SYMMETRIC_REFLECT: {
+                lineOptions.setBorderTreatmentBegin(xvigra::BorderTreatment::asymmetricReflect());
+                break;
+            }
+            default: {
+                break;
+            }
+        }
+
+        return lineOptions;
     }
 
     // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
@@ -277,33 +427,64 @@ namespace xvigra {
      * Missing kernel dimensions are inserted by xvigra::promoteKernelToFull1D.
      * This function can only process ChannelPosition::FIRST or ChannelPosition::LAST inputs; for ChannelPosition::IMPLICIT
      * use xvigra::convolve1DImplicit.
+     * With Algorithm::DIRECT in the options the im2col patch is skipped and xvigra::directConvolve1D is used instead.
+     * Algorithm::AUTO chooses between both with xvigra::selectAlgorithm1D.
+     * Otherwise the im2col patch is built in tiles which stay below the workspace limit of the options.
+     * The patch memory is drawn from the workspace of the options or xvigra::threadLocalWorkspace if none is set.
+     * With more than 1 group in the options, the input channels are split into groups which are convolved
+     * independently; a full kernel then has the shape OC x IC/groups x K, with every group owning OC/groups output
+     * channels. A kernel without channel axis is always convolved depthwise instead of being promoted to a dense
+     * IC x IC filter, so its groups option must be 1 or IC. The groups are spread over the threads of the options and read and write their channel range of
+     * a row major input and output in place; other inputs are evaluated once for all groups.
+     * A kernel without channel axis whose taps are symmetric or antisymmetric is convolved by
+     * xvigra::symmetricConvolve1D for the DIRECT and AUTO algorithms, see KernelOptions#setKernelSymmetry; an
+     * explicitly requested GEMM always runs the patch backend.
+     * The input is read in place, so views and xt::adapt buffers are not copied by the GEMM algorithm. The result is
+     * written into the given output, see xvigra::prepareConvolutionOutput.
+     * xvigra::Float16 and xvigra::BFloat16 inputs and kernels are read as stored and accumulated in float, so only the
+     * output is rounded to 16 bits.
+     * The epilogue is applied to every output tile right after it is computed, see xvigra::applyEpilogue.
      * </p>
      *
      * @tparam O derived type of the input xexpression
      * @tparam T derived type of the kernel xexpression
+     * @tparam R derived type of the output xexpression
      * @param inputExpression xexpression containing the input data
      * @param rawKernelExpression xexpression containing the kernel data
      * @param options object containing information about padding, stride, dilation, channel position and border
                       treatment
-     * @return the result of the 1-dimensional convolution between the input and kernel as xt::xtensor
+     * @param epilogue bias, scale, clipping and rounding which are applied to the result before it is converted to
+                       the value type of the output
+     * @param outputExpression xexpression which receives the result of the 1-dimensional convolution
      * @throws std::invalid_argument * if input does not match the required shape
                                      * if IMPLICIT channel position is requested.
                                      * if the input channels in the input and kernel do not align
                                      * if the padded input is smaller than the dilated kernel
+                                     * if a Winograd or the FFT algorithm is requested
+                                     * if the groups are less than 1 or don't divide the input or output channels
+                                     * if the groups of a kernel without channel axes are neither 1 nor IC
+                                     * if the kernel taps don't have the declared symmetry
+                                     * if the bias of the epilogue does not match the output channels
+                                     * if the output does not have the shape of the result
      */
-    template <typename T, typename O>
-    auto convolve1D(
+    template <typename T, typename O, typename R>
+    void convolve1D(
         const xt::xexpression<T>& inputExpression,
         const xt::xexpression<O>& kernelExpression,
-        const xvigra::KernelOptions& options
+        const xvigra::KernelOptions& options,
+        const xvigra::Epilogue& epilogue,
+        xt::xexpression<R>& outputExpression
     ) {
         using InputContainerType = typename xt::xexpression<T>::derived_type;
         using InputType = typename InputContainerType::value_type;
         using KernelContainerType = typename xt::xexpression<O>::derived_type;
-        using KernelType = typename KernelContainerType::value_type;
-        using ResultType = typename std::common_type_t<InputType, KernelType>;
+        // 16-bit floats are only storage: the kernel is widened and every product is accumulated in float, the output
+        // receives the rounded result
+        using KernelType = xvigra::AccumulationType<typename KernelContainerType::value_type>;
+        using ResultType = xvigra::AccumulationType<std::common_type_t<InputType, KernelType>>;
 
-        InputContainerType input = inputExpression.derived_cast();
+        const auto& input = inputExpression.derived_cast();
+        auto& output = outputExpression.derived_cast();
 
         if (options.channelPosition == xvigra::ChannelPosition::IMPLICIT) {
             throw std::invalid_argument(
@@ -311,6 +492,12 @@ namespace xvigra {
             );
         }
 
+        if (options.channelPosition == xvigra::ChannelPosition::BLOCKED) {
+            throw std::invalid_argument(
+                "convolve1D(): Blocked channel option is only supported by convolve2DBlocked!"
+            );
+        }
+
         if (input.dimension() != 2) {
             throw std::invalid_argument("convolve1D(): Need 2 dimensional (W x C or C x W) input!");
         }
@@ -326,8 +513,141 @@ namespace xvigra {
             inputWidth = static_cast<int>(input.shape()[1]);
         }
 
+        // Groups
+        // a kernel without channel axis is promoted to a diagonal filter, which is exactly a depthwise convolution
+        const auto& rawKernel = kernelExpression.derived_cast();
+        int groups = rawKernel.dimension() == 1 ? inputChannels : options.groups;
+
+        if (options.groups < 1) {
+            throw std::invalid_argument("convolve1D(): Need at least 1 group!");
+        }
+
+        if (rawKernel.dimension() == 1 && options.groups != 1 && options.groups != inputChannels) {
+            throw std::invalid_argument("convolve1D(): Kernel without channel axis needs 1 group or one group per input channel!");
+        }
+
+        // a depthwise kernel with mirrored taps folds the two input samples of every tap pair before the
+        // multiplication, which halves the multiplications; only DIRECT and AUTO fold, see xvigra::resolveKernelSymmetry
+        if (rawKernel.dimension() == 1) {
+            int symmetricKernelSize = static_cast<int>(rawKernel.size());
+            bool fitsInput = (symmetricKernelSize - 1) * options.dilation + 1 <= inputWidth + options.paddingTotal();
+            xvigra::KernelSymmetry symmetry = fitsInput
+                ? xvigra::resolveKernelSymmetry(rawKernel, options)
+                : xvigra::KernelSymmetry::NONE;
+
+            if (symmetry != xvigra::KernelSymmetry::NONE) {
+                bool isChannelFirst = options.channelPosition == xvigra::ChannelPosition::FIRST;
+                std::size_t channels = static_cast<std::size_t>(inputChannels);
+                std::size_t outputWidth = static_cast<std::size_t>(xvigra::calculateOutputSize(inputWidth, symmetricKernelSize, options));
+
+                xvigra::prepareConvolutionOutput(
+                    output,
+                    isChannelFirst ? std::array<std::size_t, 2>{channels, outputWidth} : std::array<std::size_t, 2>{outputWidth, channels},
+                    "convolve1D()"
+                );
+                xvigra::checkEpilogue(epilogue, channels, "convolve1D()");
+
+                xt::xtensor<KernelType, 1> lineKernel = xt::zeros<KernelType>({rawKernel.size()});
+                std::transform(rawKernel.begin(), rawKernel.end(), lineKernel.begin(), [](auto weight) {
+                    return static_cast<KernelType>(weight);
+                });
+                decltype(auto) contiguousInput = xvigra::evaluateContiguous<2>(input);
+                xvigra::KernelOptions lineOptions = isChannelFirst ? options : xvigra::channelLastLineOptions(options);
+
+                xvigra::symmetricConvolve1D<ResultType, InputType, KernelType>(contiguousInput, lineKernel, symmetry, lineOptions, epilogue, output);
+                return;
+            }
+        }
+
+        if (1 < groups) {
+            if (inputChannels % groups != 0) {
+                throw std::invalid_argument("convolve1D(): Input channels are not divisible by the number of groups!");
+            }
+
+            // a kernel without output channel axis is promoted for a single group and shared by all groups
+            int groupInputChannels = inputChannels / groups;
+            bool isSharedKernel = rawKernel.dimension() != 3;
+            xt::xtensor<KernelType, 3> groupedKernel = xvigra::promoteKernelToFull1D(rawKernel, groupInputChannels);
+
+            if (groupInputChannels != static_cast<int>(groupedKernel.shape()[1])) {
+                throw std::invalid_argument("convolve1D(): Input channels of input and kernel do not align!");
+            }
+
+            if (!isSharedKernel && groupedKernel.shape()[0] % groups != 0) {
+                throw std::invalid_argument("convolve1D(): Output channels are not divisible by the number of groups!");
+            }
+
+            int groupOutputChannels = static_cast<int>(groupedKernel.shape()[0]) / (isSharedKernel ? 1 : groups);
+            int outputChannels = groups * groupOutputChannels;
+
+            int kernelSize = static_cast<int>(groupedKernel.shape()[2]);
+
+            if (inputWidth + options.paddingTotal() < (kernelSize - 1) * options.dilation + 1) {
+                throw std::invalid_argument("convolve1D(): Kernel width is greater than padded input width!");
+            }
+
+            bool isChannelFirst = options.channelPosition == xvigra::ChannelPosition::FIRST;
+            std::size_t channelAxis = isChannelFirst ? 0 : 1;
+            std::size_t outputWidth = static_cast<std::size_t>(xvigra::calculateOutputSize(inputWidth, kernelSize, options));
+
+            xvigra::prepareConvolutionOutput(
+                output,
+                isChannelFirst ? std::array<std::size_t, 2>{static_cast<std::size_t>(outputChannels), outputWidth}
+                               : std::array<std::size_t, 2>{outputWidth, static_cast<std::size_t>(outputChannels)},
+                "convolve1D()"
+            );
+            xvigra::checkEpilogue(epilogue, static_cast<std::size_t>(outputChannels), "convolve1D()");
+
+            // the groups are spread over the threads, and every group gets an equal share of the threads which are left
+            int threadCount = xvigra::resolveThreadCount(options.threadCount);
+            int groupThreadCount = std::max(1, threadCount / std::min(threadCount, groups));
+            decltype(auto) contiguousInput = xvigra::evaluateContiguous<2>(input);
+
+            // input and output of a group are adaptors of their channel range, so every group is read and written in
+            // place; only an output which is no row major container receives the result in one assignment at the end
+            auto convolveGroups = [&](auto& target) {
+                xvigra::parallelFor(0, groups, threadCount, [&](int groupBegin, int groupEnd) {
+                    xvigra::KernelOptions groupOptions = options;
+                    groupOptions.setGroups(1);
+                    groupOptions.setThreadCount(groupThreadCount);
+
+                    // a workspace of the options belongs to the calling thread, the other threads use their own
+                    if (groupBegin != 0) {
+                        groupOptions.setWorkspace(nullptr);
+                    }
+
+                    for (int group = groupBegin; group < groupEnd; ++group) {
+                        std::size_t inputBegin = static_cast<std::size_t>(group * groupInputChannels);
+                        std::size_t outputBegin = static_cast<std::size_t>(group * groupOutputChannels);
+                        int kernelBegin = isSharedKernel ? 0 : group * groupOutputChannels;
+                        xt::xtensor<KernelType, 3> groupKernel = xt::view(groupedKernel, xt::range(kernelBegin, kernelBegin + groupOutputChannels), xt::all(), xt::all());
+
+                        auto groupOutput = xvigra::adaptChannelRange<2>(target, channelAxis, outputBegin, static_cast<std::size_t>(groupOutputChannels));
+                        convolve1D(
+                            xvigra::adaptChannelRange<2>(contiguousInput, channelAxis, inputBegin, static_cast<std::size_t>(groupInputChannels)),
+                            groupKernel,
+                            groupOptions,
+                            xvigra::sliceEpilogue(epilogue, outputBegin, static_cast<std::size_t>(groupOutputChannels)),
+                            groupOutput
+                        );
+                    }
+                });
+            };
+
+            using OutputContainerType = std::decay_t<decltype(output)>;
+            if constexpr (std::is_base_of_v<xt::xcontainer<OutputContainerType>, OutputContainerType> && OutputContainerType::static_layout == xt::layout_type::row_major) {
+                convolveGroups(output);
+            } else {
+                xt::xtensor<typename OutputContainerType::value_type, 2> result = xt::zeros<typename OutputContainerType::value_type>(output.shape());
+                convolveGroups(result);
+                xt::noalias(output) = result;
+            }
+
+            return;
+        }
+
         // Kernel
-        xt::xtensor<KernelType, 3> kernel = xvigra::promoteKernelToFull1D(kernelExpression.derived_cast(), inputChannels);
+        decltype(auto) kernel = xvigra::resolveFullKernel<1, KernelType>(rawKernel, static_cast<std::size_t>(inputChannels));
 
         // Filter Specifications
         int kernelSize = kernel.shape()[2];
@@ -352,6 +672,46 @@ namespace xvigra {
             throw std::invalid_argument("convolve1D(): Kernel width is greater than padded input width!");
         }
 
+        xvigra::Algorithm algorithm = options.algorithm;
+
+        if (algorithm == xvigra::Algorithm::AUTO) {
+            algorithm = xvigra::selectAlgorithm1D(inputChannels, inputWidth, static_cast<int>(kernel.shape()[0]), kernelSize, options);
+        }
+
+        if (algorithm == xvigra::Algorithm::WINOGRAD_2X2 || algorithm == xvigra::Algorithm::WINOGRAD_4X4) {
+            throw std::invalid_argument("convolve1D(): Winograd algorithms are only available for convolve2D!");
+        }
+
+        if (algorithm == xvigra::Algorithm::FFT) {
+            throw std::invalid_argument("convolve1D(): FFT algorithm is only available for convolve2D!");
+        }
+
+        int outputChannels = kernel.shape()[0];
+        int outputWidth = xvigra::calculateOutputSize(inputWidth, kernelSize, options);
+
+        if (options.channelPosition == xvigra::ChannelPosition::FIRST) {
+            xvigra::prepareConvolutionOutput(output, std::array<std::size_t, 2>{static_cast<std::size_t>(outputChannels), static_cast<std::size_t>(outputWidth)}, "convolve1D()");
+        } else {
+            xvigra::prepareConvolutionOutput(output, std::array<std::size_t, 2>{static_cast<std::size_t>(outputWidth), static_cast<std::size_t>(outputChannels)}, "convolve1D()");
+        }
+
+        xvigra::checkEpilogue(epilogue, static_cast<std::size_t>(outputChannels), "convolve1D()");
+
+        if (algorithm == xvigra::Algorithm::DIRECT) {
+            decltype(auto) contiguousInput = xvigra::evaluateContiguous<2>(input);
+
+            if (options.channelPosition == xvigra::ChannelPosition::FIRST) {
+                xvigra::directConvolve1D<ResultType, InputType, KernelType>(contiguousInput, kernel, options, epilogue, output);
+                return;
+            }
+
+            // the channel last patch reflects the begin border shifted by one position, which is mirrored here to keep
+            // both algorithms in agreement
+            xvigra::KernelOptions directOptions = xvigra::channelLastLineOptions(options);
+            xvigra::directConvolve1D<ResultType, InputType, KernelType>(contiguousInput, kernel, directOptions, epilogue, output);
+            return;
+        }
+
         // input output meta data
         int inputWidthMinimum;
         int inputWidthMaximum;
@@ -369,77 +729,265 @@ namespace xvigra {
                                 - options.dilation * (radius);
         }
 
-        int outputWidth = xvigra::calculateOutputSize(inputWidth, kernelSize, options);
         std::vector<int> inputWidthIndices = xvigra::range(inputWidthMinimum, inputWidthMaximum, options.stride);
 
+        // the patch is built and multiplied in tiles of output columns, so that it never exceeds the workspace limit
+        int patchColumnSize = inputChannels * kernelSize;
+        int tileWidth = xvigra::calculateTileSize(options.workspaceLimit, patchColumnSize * sizeof(ResultType), outputWidth);
+
+        // the patch, the product and the kernel matrix share one allocation from the workspace, which is sized for the
+        // largest tile and reused by every tile
+        std::size_t patchSize = static_cast<std::size_t>(patchColumnSize) * tileWidth;
+        std::size_t productSize = static_cast<std::size_t>(outputChannels) * tileWidth;
+        xvigra::Workspace& workspace = xvigra::resolveWorkspace(options.workspace);
+        xvigra::Workspace::Scope workspaceScope(workspace);
+        ResultType* patchData = workspace.allocate<ResultType>(patchSize + productSize + kernel.size());
+        ResultType* productData = patchData + patchSize;
+
+        bool isChannelFirst = options.channelPosition == xvigra::ChannelPosition::FIRST;
+        auto kernelMatrix = xvigra::packKernelMatrix<ResultType>(kernel, !isChannelFirst, productData + productSize);
+
+        // the interior is copied without any border treatment, only the remaining strips need the border logic
+        auto [interiorBegin, interiorEnd] = xvigra::calculateInteriorRange(inputWidth, kernelSize, options);
+
         // calculate result
-        Tensor2D<ResultType> result;
+        if (isChannelFirst) {
+            for (int tileBegin = 0; tileBegin < outputWidth; tileBegin += tileWidth) {
+                int tileEnd = std::min(tileBegin + tileWidth, outputWidth);
+                int currentTileWidth = tileEnd - tileBegin;
+                int tileInteriorBegin = std::min(std::max(tileBegin, interiorBegin), tileEnd) - tileBegin;
+                int tileInteriorEnd = std::max(std::min(tileEnd, interiorEnd) - tileBegin, tileInteriorBegin);
+                std::array<std::pair<int, int>, 2> borderRanges{{{0, tileInteriorBegin}, {tileInteriorEnd, currentTileWidth}}};
+
+                std::array<std::size_t, 3> patchShape{
+                    static_cast<std::size_t>(inputChannels),
+                    static_cast<std::size_t>(kernelSize),
+                    static_cast<std::size_t>(currentTileWidth)
+                };
+                auto patch = xt::adapt(patchData, patchShape[0] * patchShape[1] * patchShape[2], xt::no_ownership(), patchShape);
+
+                // every kernel tap fills its own row of the patch, so the taps are distributed over the threads
+                xvigra::parallelFor(0, inputChannels * kernelSize, options.threadCount, [&](int tapBegin, int tapEnd) {
+                    for (int tap = tapBegin; tap < tapEnd; ++tap) {
+                        int inputChannel = tap / kernelSize;
+                        int kernelX = kernelMinimum + tap % kernelSize;
+                        auto kernelOffsetX = options.dilation * kernelX;
+                        auto patchKernelX = kernelX + std::abs(kernelMinimum);
+
+                        // interior
+                        if constexpr (xt::has_data_interface<InputContainerType>::value) {
+                            if (tileInteriorBegin < tileInteriorEnd) {
+                                xvigra::convertRow(
+                                    &input(inputChannel, inputWidthIndices[tileBegin + tileInteriorBegin] + kernelOffsetX),
+                                    static_cast<std::ptrdiff_t>(input.strides()[1]) * options.stride,
+                                    &patch(inputChannel, patchKernelX, tileInteriorBegin),
+                                    static_cast<std::size_t>(tileInteriorEnd - tileInteriorBegin)
+                                );
+                            }
+                        } else {
+                            for (auto outIndex = tileInteriorBegin; outIndex < tileInteriorEnd; ++outIndex) {
+                                patch(inputChannel, patchKernelX, outIndex) = static_cast<ResultType>(input(inputChannel, inputWidthIndices[tileBegin + outIndex] + kernelOffsetX));
+                            }
+                        }
 
-        if (options.channelPosition == xvigra::ChannelPosition::FIRST) {
-            Tensor3D<ResultType> patch = xt::zeros<ResultType>({
-                inputChannels,
-                kernelSize,
-                outputWidth
-            });
-            int outputChannels = kernel.shape()[0];
-
-            for (auto inputChannel = 0; inputChannel < inputChannels; ++inputChannel) {
-                for (auto kernelX = kernelMinimum; kernelX < kernelMaximum; ++kernelX) {
-                    auto kernelOffsetX = options.dilation * kernelX;
-                    auto patchKernelX = kernelX + std::abs(kernelMinimum);
-
-                    for (std::size_t outIndex = 0; outIndex < inputWidthIndices.size(); ++outIndex) {
-                        auto inputX = inputWidthIndices.at(outIndex) + kernelOffsetX;
-
-                        if(0 <= inputX && inputX < inputWidth) {
-                            patch(inputChannel, patchKernelX, outIndex) = static_cast<ResultType>(input(inputChannel, inputX));
-                        } else if (inputX < 0) {
-                            XVIGRA_SET_BEGIN_BORDER_VALUE_CHANNEL_FIRST
-                        } else if(inputWidth <= inputX) {
-                            XVIGRA_SET_END_BORDER_VALUE_CHANNEL_FIRST
+                        // border strips
+                        for (const auto& [rangeBegin, rangeEnd] : borderRanges) {
+                            for (auto outIndex = rangeBegin; outIndex < rangeEnd; ++outIndex) {
+                                auto inputX = inputWidthIndices.at(tileBegin + outIndex) + kernelOffsetX;
+
+                                if(0 <= inputX && inputX < inputWidth) {
+                                    patch(inputChannel, patchKernelX, outIndex) = static_cast<ResultType>(input(inputChannel, inputX));
+                                } else if (inputX < 0) {
+                                    XVIGRA_SET_BEGIN_BORDER_VALUE_CHANNEL_FIRST
+                                } else if(inputWidth <= inputX) {
+                                    XVIGRA_SET_END_BORDER_VALUE_CHANNEL_FIRST
+                                }
+                            }
                         }
                     }
-                }
-            }
+                });
 
-            auto reshapedKernel = xt::reshape_view(kernel, {outputChannels, inputChannels * kernelSize});
-            auto reshapedPatch = xt::reshape_view(patch, {inputChannels * kernelSize, outputWidth});
-            result = xt::linalg::dot(reshapedKernel, reshapedPatch);
+                std::array<std::size_t, 2> patchMatrixShape{static_cast<std::size_t>(patchColumnSize), static_cast<std::size_t>(currentTileWidth)};
+                std::array<std::size_t, 2> productShape{static_cast<std::size_t>(outputChannels), static_cast<std::size_t>(currentTileWidth)};
+                auto patchMatrix = xt::adapt(patchData, patchMatrixShape[0] * patchMatrixShape[1], xt::no_ownership(), patchMatrixShape);
+                auto product = xt::adapt(productData, productShape[0] * productShape[1], xt::no_ownership(), productShape);
+                xvigra::matrixProduct(kernelMatrix, patchMatrix, product, options.threadCount);
+
+                auto outputTile = xt::view(output, xt::all(), xt::range(tileBegin, tileEnd));
+                xvigra::applyEpilogue(product, epilogue, 0, outputTile);
+            }
         } else {
-            Tensor3D<ResultType> patch = xt::zeros<InputType>({
-                outputWidth,
-                inputChannels,
-                kernelSize
-            });
-            int outputChannels = kernel.shape()[0];
+            for (int tileBegin = 0; tileBegin < outputWidth; tileBegin += tileWidth) {
+                int tileEnd = std::min(tileBegin + tileWidth, outputWidth);
+                int currentTileWidth = tileEnd - tileBegin;
+                int tileInteriorBegin = std::min(std::max(tileBegin, interiorBegin), tileEnd) - tileBegin;
+                int tileInteriorEnd = std::max(std::min(tileEnd, interiorEnd) - tileBegin, tileInteriorBegin);
+                std::array<std::pair<int, int>, 2> borderRanges{{{0, tileInteriorBegin}, {tileInteriorEnd, currentTileWidth}}};
+
+                std::array<std::size_t, 3> patchShape{
+                    static_cast<std::size_t>(currentTileWidth),
+                    static_cast<std::size_t>(inputChannels),
+                    static_cast<std::size_t>(kernelSize)
+                };
+                auto patch = xt::adapt(patchData, patchShape[0] * patchShape[1] * patchShape[2], xt::no_ownership(), patchShape);
+
+                // every output column fills its own rows of the patch, so the columns are distributed over the threads
+                xvigra::parallelFor(0, currentTileWidth, options.threadCount, [&](int columnBegin, int columnEnd) {
+                    // interior
+                    for (auto outIndex = std::max(columnBegin, tileInteriorBegin); outIndex < std::min(columnEnd, tileInteriorEnd); ++outIndex) {
+                        for (auto kernelX = kernelMinimum; kernelX < kernelMaximum; ++kernelX) {
+                            auto patchKernelX = kernelX + std::abs(kernelMinimum);
+                            auto inputX = inputWidthIndices[tileBegin + outIndex] + options.dilation * kernelX;
+
+                            for (auto inputChannel = 0; inputChannel < inputChannels; ++inputChannel) {
+                                patch(outIndex, inputChannel, patchKernelX) = static_cast<ResultType>(input(inputX, inputChannel));
+                            }
+                        }
+                    }
 
-            for (std::size_t outIndex = 0; outIndex < inputWidthIndices.size(); ++outIndex) {
-                for (auto kernelX = kernelMinimum; kernelX < kernelMaximum; ++kernelX) {
-                    auto kernelOffsetX = options.dilation * kernelX;
-                    auto patchKernelX = kernelX + std::abs(kernelMinimum);
-                    auto inputX = inputWidthIndices.at(outIndex) + kernelOffsetX;
+                    // border strips
+                    for (const auto& [rangeBegin, rangeEnd] : borderRanges) {
+                        for (auto outIndex = std::max(rangeBegin, columnBegin); outIndex < std::min(rangeEnd, columnEnd); ++outIndex) {
+                            for (auto kernelX = kernelMinimum; kernelX < kernelMaximum; ++kernelX) {
+                                auto kernelOffsetX = options.dilation * kernelX;
+                                auto patchKernelX = kernelX + std::abs(kernelMinimum);
+                                auto inputX = inputWidthIndices.at(tileBegin + outIndex) + kernelOffsetX;
 
-                    if(0 <= inputX && inputX < inputWidth) {
-                        for (auto inputChannel = 0; inputChannel < inputChannels; ++inputChannel) {
-                            patch(outIndex, inputChannel, patchKernelX) = static_cast<ResultType>(input(inputX, inputChannel));
-                        }
-                    } else if (inputX < 0) {
-                        for (auto inputChannel = 0; inputChannel < inputChannels; ++inputChannel) {
-                            XVIGRA_SET_BEGIN_BORDER_VALUE_CHANNEL_LAST
-                        }
-                    } else if(inputWidth <= inputX) {
-                        for (auto inputChannel = 0; inputChannel < inputChannels; ++inputChannel) {
-                            XVIGRA_SET_END_BORDER_VALUE_CHANNEL_LAST
+                                if(0 <= inputX && inputX < inputWidth) {
+                                    for (auto inputChannel = 0; inputChannel < inputChannels; ++inputChannel) {
+                                        patch(outIndex, inputChannel, patchKernelX) = static_cast<ResultType>(input(inputX, inputChannel));
+                                    }
+                                } else if (inputX < 0) {
+                                    for (auto inputChannel = 0; inputChannel < inputChannels; ++inputChannel) {
+                                        XVIGRA_SET_BEGIN_BORDER_VALUE_CHANNEL_LAST
+                                    }
+                                } else if(inputWidth <= inputX) {
+                                    for (auto inputChannel = 0; inputChannel < inputChannels; ++inputChannel) {
+                                        XVIGRA_SET_END_BORDER_VALUE_CHANNEL_LAST
+                                    }
+                                }
+                            }
                         }
                     }
-                }
-            }
+                });
+
+                std::array<std::size_t, 2> patchMatrixShape{static_cast<std::size_t>(currentTileWidth), static_cast<std::size_t>(patchColumnSize)};
+                std::array<std::size_t, 2> productShape{static_cast<std::size_t>(currentTileWidth), static_cast<std::size_t>(outputChannels)};
+                auto patchMatrix = xt::adapt(patchData, patchMatrixShape[0] * patchMatrixShape[1], xt::no_ownership(), patchMatrixShape);
+                auto product = xt::adapt(productData, productShape[0] * productShape[1], xt::no_ownership(), productShape);
+                xvigra::matrixProduct(patchMatrix, kernelMatrix, product, options.threadCount);
 
-            auto reshapedKernel = xt::reshape_view(kernel, {outputChannels, inputChannels * kernelSize});
-            auto reshapedPatch = xt::reshape_view(patch, {outputWidth, kernelSize * inputChannels});
-            result = xt::linalg::dot(reshapedPatch, xt::transpose(reshapedKernel));
+                auto outputTile = xt::view(output, xt::range(tileBegin, tileEnd), xt::all());
+                xvigra::applyEpilogue(product, epilogue, 1, outputTile);
+            }
         }
+    }
+
+
+    template <typename T, typename O, typename R>
+    void convolve1D(
+        const xt::xexpression<T>& inputExpression,
+        const xt::xexpression<O>& kernelExpression,
+        const xvigra::KernelOptions& options,
+        const xvigra::Epilogue& epilogue,
+        xt::xexpression<R>&& outputExpression
+    ) {
+        convolve1D(inputExpression, kernelExpression, options, epilogue, outputExpression);
+    }
+
+
+    /*
+     * <p>
+     * Calculates the explicit 1-dimensional convolution of the input with the given 1-dimensional kernel into the
+     * given output without any epilogue; see the overload with an epilogue for details.
+     * </p>
+     *
+     * @tparam O derived type of the input xexpression
+     * @tparam T derived type of the kernel xexpression
+     * @tparam R derived type of the output xexpression
+     * @param inputExpression xexpression containing the input data
+     * @param rawKernelExpression xexpression containing the kernel data
+     * @param options object containing information about padding, stride, dilation, channel position and border
+                      treatment
+     * @param outputExpression xexpression which receives the result of the 1-dimensional convolution
+     * @throws std::invalid_argument for every invalid configuration rejected by the overload with an epilogue
+     */
+    template <typename T, typename O, typename R>
+    void convolve1D(
+        const xt::xexpression<T>& inputExpression,
+        const xt::xexpression<O>& kernelExpression,
+        const xvigra::KernelOptions& options,
+        xt::xexpression<R>& outputExpression
+    ) {
+        convolve1D(inputExpression, kernelExpression, options, xvigra::Epilogue(), outputExpression);
+    }
+
 
+    template <typename T, typename O, typename R>
+    void convolve1D(
+        const xt::xexpression<T>& inputExpression,
+        const xt::xexpression<O>& kernelExpression,
+        const xvigra::KernelOptions& options,
+        xt::xexpression<R>&& outputExpression
+    ) {
+        convolve1D(inputExpression, kernelExpression, options, outputExpression);
+    }
+
+
+    /*
+     * <p>
+     * Calculates the explicit 1-dimensional convolution of the input with the given 1-dimensional kernel and applies
+     * the epilogue while writing into a newly allocated xt::xtensor of OutputType; see the overload with an output for
+     * details.
+     * </p>
+     *
+     * @tparam OutputType value type of the result
+     * @tparam O derived type of the input xexpression
+     * @tparam T derived type of the kernel xexpression
+     * @param inputExpression xexpression containing the input data
+     * @param rawKernelExpression xexpression containing the kernel data
+     * @param options object containing information about padding, stride, dilation, channel position and border
+                      treatment
+     * @param epilogue bias, scale, clipping and rounding which are applied to the result
+     * @return the post processed result of the 1-dimensional convolution as xt::xtensor of OutputType
+     * @throws std::invalid_argument for every invalid configuration rejected by the overload with an output
+     */
+    template <typename OutputType, typename T, typename O>
+    Tensor2D<OutputType> convolve1D(
+        const xt::xexpression<T>& inputExpression,
+        const xt::xexpression<O>& kernelExpression,
+        const xvigra::KernelOptions& options,
+        const xvigra::Epilogue& epilogue
+    ) {
+        Tensor2D<OutputType> result;
+        convolve1D(inputExpression, kernelExpression, options, epilogue, result);
+        return result;
+    }
+
+
+    /*
+     * <p>
+     * Calculates the explicit 1-dimensional convolution of the input with the given 1-dimensional kernel into a newly
+     * allocated xt::xtensor; see the overload with an output for details.
+     * </p>
+     *
+     * @tparam O derived type of the input xexpression
+     * @tparam T derived type of the kernel xexpression
+     * @param inputExpression xexpression containing the input data
+     * @param rawKernelExpression xexpression containing the kernel data
+     * @param options object containing information about padding, stride, dilation, channel position and border
+                      treatment
+     * @return the result of the 1-dimensional convolution between the input and kernel as xt::xtensor
+     * @throws std::invalid_argument for every invalid configuration rejected by the overload with an output
+     */
+    template <typename T, typename O>
+    auto convolve1D(
+        const xt::xexpression<T>& inputExpression,
+        const xt::xexpression<O>& kernelExpression,
+        const xvigra::KernelOptions& options
+    ) -> Tensor2D<std::common_type_t<typename T::value_type, typename O::value_type>> {
+        Tensor2D<std::common_type_t<typename T::value_type, typename O::value_type>> result;
+        convolve1D(inputExpression, kernelExpression, options, result);
         return result;
     }
 
@@ -453,32 +1001,31 @@ namespace xvigra {
      * Missing kernel dimensions are inserted by xvigra::promoteKernelToFull1D.
      * This function can only process ChannelPosition::IMPLICIT inputs; for ChannelPosition::FIRST or ChannelPosition::LAST
      * use xvigra::convolve1D.
+     * The result is written into the given output, see xvigra::prepareConvolutionOutput.
      * </p>
      *
      * @tparam O derived type of the input xexpression
      * @tparam T derived type of the kernel xexpression
+     * @tparam R derived type of the output xexpression
      * @param inputExpression xexpression containing the input data
      * @param rawKernelExpression xexpression containing the kernel data
      * @param kernelOptions object containing information about padding, stride, dilation, channel position and border
                             treatment
-     * @return the result of the 1-dimensional convolution between the input and kernel as xt::xtensor
+     * @param outputExpression xexpression which receives the result of the 1-dimensional convolution
      * @throws std::invalid_argument * if input does not match the required shape
                                      * if the given channel position is not ChannelPosition::IMPLICIT
+                                     * if the output does not have the shape of the result
      */
-    template <typename T, typename O>
-    auto convolve1DImplicit(
+    template <typename T, typename O, typename R>
+    void convolve1DImplicit(
         const xt::xexpression<T>& inputExpression,
         const xt::xexpression<O>& kernelExpression,
-        const xvigra::KernelOptions& options
+        const xvigra::KernelOptions& options,
+        xt::xexpression<R>& outputExpression
     ) {
-        using InputContainerType = typename xt::xexpression<T>::derived_type;
-        using InputType = typename InputContainerType::value_type;
-        using KernelContainerType = typename xt::xexpression<O>::derived_type;
-        using KernelType = typename KernelContainerType::value_type;
-        using ResultType = typename std::common_type_t<InputType, KernelType>;
-
-        InputContainerType input = inputExpression.derived_cast();
-        KernelContainerType kernel = kernelExpression.derived_cast();
+        const auto& input = inputExpression.derived_cast();
+        const auto& kernel = kernelExpression.derived_cast();
+        auto& output = outputExpression.derived_cast();
 
         if (options.channelPosition != xvigra::ChannelPosition::IMPLICIT) {
             throw std::domain_error("convolve1DImplicit(): Expected implicit channels in options!");
@@ -488,24 +1035,70 @@ namespace xvigra {
             throw std::invalid_argument("convolve1DImplicit(): Need 1 dimensional (W) input!");
         }
 
+        // a kernel larger than the padded input is rejected by convolve1D, which is why the width is clamped here
+        int kernelSize = static_cast<int>(kernel.shape()[kernel.dimension() - 1]);
+        int outputWidth = std::max(xvigra::calculateOutputSize(static_cast<int>(input.shape()[0]), kernelSize, options), 0);
+        xvigra::prepareConvolutionOutput(output, std::array<std::size_t, 1>{static_cast<std::size_t>(outputWidth)}, "convolve1DImplicit()");
+
         xvigra::KernelOptions tempOptions(options);
         tempOptions.channelPosition = xvigra::ChannelPosition::LAST;
         auto normalizedInput = xt::expand_dims(input, input.dimension());
-        auto result = convolve1D(normalizedInput, kernel, tempOptions);
-
-        return Tensor1D<ResultType>(xt::squeeze(result));
+        auto normalizedOutput = xt::expand_dims(output, 1);
+        convolve1D(normalizedInput, kernel, tempOptions, normalizedOutput);
     }
 
-    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
-    // ║ convolve1D - end                                                                                                 ║
-    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
-
 
-    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
-    // ║ convolve2D - begin                                                                                               ║
-    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+    template <typename T, typename O, typename R>
+    void convolve1DImplicit(
+        const xt::xexpression<T>& inputExpression,
+        const xt::xexpression<O>& kernelExpression,
+        const xvigra::KernelOptions& options,
+        xt::xexpression<R>&& outputExpression
+    ) {
+        convolve1DImplicit(inputExpression, kernelExpression, options, outputExpression);
+    }
 
-     /*
+    /*
+     * <p>
+     * Calculates the explicit 1-dimensional convolution of the implicit channel input with the given kernel into a
+     * newly allocated xt::xtensor; see the overload with an output for details.
+     * </p>
+     *
+     * @tparam O derived type of the input xexpression
+     * @tparam T derived type of the kernel xexpression
+     * @param inputExpression xexpression containing the input data
+     * @param rawKernelExpression xexpression containing the kernel data
+     * @param kernelOptions object containing information about padding, stride, dilation, channel position and border
+                            treatment
+     * @return the result of the 1-dimensional convolution between the input and kernel as xt::xtensor
+     * @throws std::invalid_argument * if input does not match the required shape
+                                     * if the given channel position is not ChannelPosition::IMPLICIT
+     */
+    template <typename T, typename O>
+    auto convolve1DImplicit(
+        const xt::xexpression<T>& inputExpression,
+        const xt::xexpression<O>& kernelExpression,
+        const xvigra::KernelOptions& options
+    ) {
+        using InputType = typename xt::xexpression<T>::derived_type::value_type;
+        using KernelType = typename xt::xexpression<O>::derived_type::value_type;
+        using ResultType = typename std::common_type_t<InputType, KernelType>;
+
+        Tensor1D<ResultType> result;
+        convolve1DImplicit(inputExpression, kernelExpression, options, result);
+        return result;
+    }
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ convolve1D - end                                                                                                 ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ convolve2D - begin                                                                                               ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+     /*
      * <p>
      * Calculates the explicit 2-dimensional convolution of the input with the given 2-dimensional kernel based on the
      * GEMM-based algorithm of Chellapilla K., Puri S. and Simard P. .
@@ -514,34 +1107,72 @@ namespace xvigra {
      * Missing kernel dimensions are inserted by xvigra::promoteKernelToFull2D.
      * This function can only process ChannelPosition::FIRST or ChannelPosition::LAST inputs; for ChannelPosition::IMPLICIT
      * use xvigra::convolve2DImplicit.
+     * With Algorithm::DIRECT in the options the im2col patch is skipped and xvigra::directConvolve2D is used instead.
+     * Algorithm::WINOGRAD_2X2 and Algorithm::WINOGRAD_4X4 use xvigra::winogradConvolve2D for 3x3 kernels with stride 1
+     * and dilation 1; see there for the error bounds.
+     * Algorithm::FFT uses xvigra::fftConvolve2D, which is preferable for large kernels.
+     * Algorithm::AUTO picks the cheapest of these backends with xvigra::selectAlgorithm2D; the choice can be queried
+     * with xvigra::resolveAlgorithm2D. Before that, Algorithm::AUTO analyzes a kernel which is not pointwise: if at
+     * most xvigra::SPARSE_TAP_DENSITY (xvigra::SPARSE_TAP_DENSITY_CHANNEL_LAST for channel last inputs) of its taps
+     * are non-zero, xvigra::sparseConvolve2D only gathers and accumulates the non-zero taps. An explicitly requested
+     * algorithm never takes the sparse backend.
+     * For Algorithm::GEMM a pointwise convolution (see xvigra::isPointwise2D) is a single matrix product of the kernel
+     * and the input, which is read in place without a patch.
+     * Otherwise the im2col patch is built in tiles which stay below the workspace limit of the options.
+     * The patch memory is drawn from the workspace of the options or xvigra::threadLocalWorkspace if none is set.
+     * With more than 1 group in the options, the input channels are split into groups which are convolved
+     * independently; a full kernel then has the shape OC x IC/groups x KH x KW, with every group owning OC/groups
+     * output channels. A kernel without channel axes is always convolved depthwise instead of being promoted to a
+     * dense IC x IC filter, so its groups option must be 1 or IC. The groups are spread over the threads of the options and read and write their channel
+     * range of a row major input and output in place; other inputs are evaluated once for all groups.
+     * The input is read in place, so views and xt::adapt buffers are not copied by the GEMM algorithm. The result is
+     * written into the given output, see xvigra::prepareConvolutionOutput.
+     * xvigra::Float16 and xvigra::BFloat16 inputs and kernels are read as stored and accumulated in float, so only the
+     * output is rounded to 16 bits.
+     * The epilogue is applied to every output tile right after it is computed, see xvigra::applyEpilogue.
      * </p>
      *
      * @tparam O derived type of the input xexpression
      * @tparam T derived type of the kernel xexpression
+     * @tparam R derived type of the output xexpression
      * @param inputExpression xexpression containing the input data
      * @param rawKernelExpression xexpression containing the kernel data
      * @param options object containing information about padding, stride, dilation, channel position and border
                       treatment
-     * @return the result of the 2-dimensional convolution between the input and kernel as xt::xtensor
+     * @param epilogue bias, scale, clipping and rounding which are applied to the result before it is converted to
+                       the value type of the output
+     * @param outputExpression xexpression which receives the result of the 2-dimensional convolution
      * @throws std::invalid_argument * if input does not match the required shape
                                      * if IMPLICIT channel position is requested.
+                                     * if the algorithms or groups of optionsY and optionsX differ
                                      * if the input channels in the input and kernel do not align
                                      * if the padded input is smaller than the dilated kernel
+                                     * if a Winograd algorithm is requested for anything else than a 3x3
+                                       floating point kernel with stride 1 and dilation 1
+                                     * if the groups are less than 1 or don't divide the input or output channels
+                                     * if the groups of a kernel without channel axes are neither 1 nor IC
+                                     * if the bias of the epilogue does not match the output channels
+                                     * if the output does not have the shape of the result
      */
-    template <typename T, typename O>
-    auto convolve2D(
+    template <typename T, typename O, typename R>
+    void convolve2D(
         const xt::xexpression<T>& inputExpression,
         const xt::xexpression<O>& kernelExpression,
         const xvigra::KernelOptions& optionsY,
-        const xvigra::KernelOptions& optionsX
+        const xvigra::KernelOptions& optionsX,
+        const xvigra::Epilogue& epilogue,
+        xt::xexpression<R>& outputExpression
     ) {
         using InputContainerType = typename xt::xexpression<T>::derived_type;
         using InputType = typename InputContainerType::value_type;
         using KernelContainerType = typename xt::xexpression<O>::derived_type;
-        using KernelType = typename KernelContainerType::value_type;
-        using ResultType = typename std::common_type_t<InputType, KernelType>;
+        // 16-bit floats are only storage: the kernel is widened and every product is accumulated in float, the output
+        // receives the rounded result
+        using KernelType = xvigra::AccumulationType<typename KernelContainerType::value_type>;
+        using ResultType = xvigra::AccumulationType<std::common_type_t<InputType, KernelType>>;
 
-        InputContainerType input = inputExpression.derived_cast();
+        const auto& input = inputExpression.derived_cast();
+        auto& output = outputExpression.derived_cast();
 
         if (optionsY.channelPosition != optionsX.channelPosition) {
             throw std::invalid_argument(
@@ -549,12 +1180,30 @@ namespace xvigra {
             );
         }
 
+        if (optionsY.algorithm != optionsX.algorithm) {
+            throw std::invalid_argument(
+                "convolve2D(): Algorithm can't be different for optionsY and optionsX!"
+            );
+        }
+
+        if (optionsY.groups != optionsX.groups) {
+            throw std::invalid_argument(
+                "convolve2D(): Groups can't be different for optionsY and optionsX!"
+            );
+        }
+
         if (optionsY.channelPosition == xvigra::ChannelPosition::IMPLICIT) {
             throw std::invalid_argument(
                 "convolve2D(): Implicit channel option is not supported for explicit channels in input!"
             );
         }
 
+        if (optionsY.channelPosition == xvigra::ChannelPosition::BLOCKED) {
+            throw std::invalid_argument(
+                "convolve2D(): Blocked channel option is only supported by convolve2DBlocked!"
+            );
+        }
+
         if (input.dimension() != 3) {
             throw std::invalid_argument("convolve2D(): Need 3 dimensional (H x W x C or C x H x W) input!");
         }
@@ -573,8 +1222,119 @@ namespace xvigra {
             inputChannels = input.shape()[2];
         }
 
+        // Groups
+        // a kernel without channel axes is promoted to a diagonal filter, which is exactly a depthwise convolution
+        const auto& rawKernel = kernelExpression.derived_cast();
+        int groups = rawKernel.dimension() <= 2 ? inputChannels : optionsY.groups;
+
+        if (optionsY.groups < 1) {
+            throw std::invalid_argument("convolve2D(): Need at least 1 group!");
+        }
+
+        if (rawKernel.dimension() <= 2 && optionsY.groups != 1 && optionsY.groups != inputChannels) {
+            throw std::invalid_argument("convolve2D(): Kernel without channel axes needs 1 group or one group per input channel!");
+        }
+
+        if (1 < groups) {
+            if (inputChannels % groups != 0) {
+                throw std::invalid_argument("convolve2D(): Input channels are not divisible by the number of groups!");
+            }
+
+            // a kernel without output channel axis is promoted for a single group and shared by all groups
+            int groupInputChannels = inputChannels / groups;
+            bool isSharedKernel = rawKernel.dimension() != 4;
+            xt::xtensor<KernelType, 4> groupedKernel = xvigra::promoteKernelToFull2D(rawKernel, groupInputChannels);
+
+            if (groupInputChannels != static_cast<int>(groupedKernel.shape()[1])) {
+                throw std::invalid_argument("convolve2D(): Input channels of input and kernel do not align!");
+            }
+
+            if (!isSharedKernel && groupedKernel.shape()[0] % groups != 0) {
+                throw std::invalid_argument("convolve2D(): Output channels are not divisible by the number of groups!");
+            }
+
+            int groupOutputChannels = static_cast<int>(groupedKernel.shape()[0]) / (isSharedKernel ? 1 : groups);
+            int outputChannels = groups * groupOutputChannels;
+
+            int kernelHeight = static_cast<int>(groupedKernel.shape()[2]);
+            int kernelWidth = static_cast<int>(groupedKernel.shape()[3]);
+
+            if (inputHeight + optionsY.paddingTotal() < (kernelHeight - 1) * optionsY.dilation + 1) {
+                throw std::invalid_argument("convolve2D(): Kernel height is greater than padded input height!");
+            }
+
+            if (inputWidth + optionsX.paddingTotal() < (kernelWidth - 1) * optionsX.dilation + 1) {
+                throw std::invalid_argument("convolve2D(): Kernel width is greater than padded input width!");
+            }
+
+            bool isChannelFirst = optionsY.channelPosition == xvigra::ChannelPosition::FIRST;
+            std::size_t channelAxis = isChannelFirst ? 0 : 2;
+            std::size_t outputHeight = static_cast<std::size_t>(xvigra::calculateOutputSize(inputHeight, kernelHeight, optionsY));
+            std::size_t outputWidth = static_cast<std::size_t>(xvigra::calculateOutputSize(inputWidth, kernelWidth, optionsX));
+
+            xvigra::prepareConvolutionOutput(
+                output,
+                isChannelFirst ? std::array<std::size_t, 3>{static_cast<std::size_t>(outputChannels), outputHeight, outputWidth}
+                               : std::array<std::size_t, 3>{outputHeight, outputWidth, static_cast<std::size_t>(outputChannels)},
+                "convolve2D()"
+            );
+            xvigra::checkEpilogue(epilogue, static_cast<std::size_t>(outputChannels), "convolve2D()");
+
+            // the groups are spread over the threads, and every group gets an equal share of the threads which are left
+            int threadCount = xvigra::resolveThreadCount(optionsY.threadCount);
+            int groupThreadCount = std::max(1, threadCount / std::min(threadCount, groups));
+            decltype(auto) contiguousInput = xvigra::evaluateContiguous<3>(input);
+
+            // input and output of a group are adaptors of their channel range, so every group is read and written in
+            // place; only an output which is no row major container receives the result in one assignment at the end
+            auto convolveGroups = [&](auto& target) {
+                xvigra::parallelFor(0, groups, threadCount, [&](int groupBegin, int groupEnd) {
+                    xvigra::KernelOptions groupOptionsY = optionsY;
+                    xvigra::KernelOptions groupOptionsX = optionsX;
+                    groupOptionsY.setGroups(1);
+                    groupOptionsX.setGroups(1);
+                    groupOptionsY.setThreadCount(groupThreadCount);
+                    groupOptionsX.setThreadCount(groupThreadCount);
+
+                    // a workspace of the options belongs to the calling thread, the other threads use their own
+                    if (groupBegin != 0) {
+                        groupOptionsY.setWorkspace(nullptr);
+                        groupOptionsX.setWorkspace(nullptr);
+                    }
+
+                    for (int group = groupBegin; group < groupEnd; ++group) {
+                        std::size_t inputBegin = static_cast<std::size_t>(group * groupInputChannels);
+                        std::size_t outputBegin = static_cast<std::size_t>(group * groupOutputChannels);
+                        int kernelBegin = isSharedKernel ? 0 : group * groupOutputChannels;
+                        xt::xtensor<KernelType, 4> groupKernel = xt::view(groupedKernel, xt::range(kernelBegin, kernelBegin + groupOutputChannels), xt::all(), xt::all(), xt::all());
+
+                        auto groupOutput = xvigra::adaptChannelRange<3>(target, channelAxis, outputBegin, static_cast<std::size_t>(groupOutputChannels));
+                        convolve2D(
+                            xvigra::adaptChannelRange<3>(contiguousInput, channelAxis, inputBegin, static_cast<std::size_t>(groupInputChannels)),
+                            groupKernel,
+                            groupOptionsY,
+                            groupOptionsX,
+                            xvigra::sliceEpilogue(epilogue, outputBegin, static_cast<std::size_t>(groupOutputChannels)),
+                            groupOutput
+                        );
+                    }
+                });
+            };
+
+            using OutputContainerType = std::decay_t<decltype(output)>;
+            if constexpr (std::is_base_of_v<xt::xcontainer<OutputContainerType>, OutputContainerType> && OutputContainerType::static_layout == xt::layout_type::row_major) {
+                convolveGroups(output);
+            } else {
+                xt::xtensor<typename OutputContainerType::value_type, 3> result = xt::zeros<typename OutputContainerType::value_type>(output.shape());
+                convolveGroups(result);
+                xt::noalias(output) = result;
+            }
+
+            return;
+        }
+
         // Kernel
-        xt::xtensor<KernelType, 4> kernel = xvigra::promoteKernelToFull2D(kernelExpression.derived_cast(), inputChannels);
+        decltype(auto) kernel = xvigra::resolveFullKernel<2, KernelType>(rawKernel, static_cast<std::size_t>(inputChannels));
 
         int outputChannels = kernel.shape()[0];
         int kernelHeight = kernel.shape()[2];
@@ -593,6 +1353,113 @@ namespace xvigra {
             throw std::invalid_argument("convolve2D(): Kernel width is greater than padded input width!");
         }
 
+        xvigra::Algorithm algorithm = optionsY.algorithm;
+
+        if (algorithm == xvigra::Algorithm::AUTO) {
+            algorithm = xvigra::selectAlgorithm2D(
+                inputChannels,
+                inputHeight,
+                inputWidth,
+                outputChannels,
+                kernelHeight,
+                kernelWidth,
+                optionsY,
+                optionsX,
+                std::is_floating_point_v<ResultType>
+            );
+        }
+
+        int outputHeight = xvigra::calculateOutputSize(inputHeight, kernelHeight, optionsY);
+        int outputWidth = xvigra::calculateOutputSize(inputWidth, kernelWidth, optionsX);
+
+        if (optionsY.channelPosition == xvigra::ChannelPosition::FIRST) {
+            xvigra::prepareConvolutionOutput(output, std::array<std::size_t, 3>{static_cast<std::size_t>(outputChannels), static_cast<std::size_t>(outputHeight), static_cast<std::size_t>(outputWidth)}, "convolve2D()");
+        } else {
+            xvigra::prepareConvolutionOutput(output, std::array<std::size_t, 3>{static_cast<std::size_t>(outputHeight), static_cast<std::size_t>(outputWidth), static_cast<std::size_t>(outputChannels)}, "convolve2D()");
+        }
+
+        xvigra::checkEpilogue(epilogue, static_cast<std::size_t>(outputChannels), "convolve2D()");
+
+        // the cost model of Algorithm::AUTO multiplies every kernel tap, so sparse kernels only gather their non-zero
+        // taps instead; an explicitly requested algorithm always runs as requested
+        if (optionsY.algorithm == xvigra::Algorithm::AUTO && !xvigra::isPointwise2D(kernelHeight, kernelWidth, optionsY, optionsX)) {
+            xvigra::SparseKernel2D<ResultType> sparseKernel = xvigra::collectNonZeroTaps<ResultType>(kernel);
+
+            if (sparseKernel.isSparse(optionsY.channelPosition)) {
+                xvigra::sparseConvolve2D<ResultType, InputType>(xvigra::evaluateContiguous<3>(input), sparseKernel, optionsY, optionsX, epilogue, output);
+                return;
+            }
+        }
+
+        if (algorithm == xvigra::Algorithm::DIRECT) {
+            xvigra::directConvolve2D<ResultType, InputType, KernelType>(xvigra::evaluateContiguous<3>(input), kernel, optionsY, optionsX, epilogue, output);
+            return;
+        }
+
+        if (algorithm == xvigra::Algorithm::FFT) {
+            xvigra::fftConvolve2D<ResultType, InputType, KernelType>(xvigra::evaluateContiguous<3>(input), kernel, optionsY, optionsX, epilogue, output);
+            return;
+        }
+
+        if (algorithm == xvigra::Algorithm::WINOGRAD_2X2 || algorithm == xvigra::Algorithm::WINOGRAD_4X4) {
+            if (kernelHeight != 3 || kernelWidth != 3) {
+                throw std::invalid_argument("convolve2D(): Winograd algorithms require a 3x3 kernel!");
+            }
+
+            if (optionsY.stride != 1 || optionsX.stride != 1 || optionsY.dilation != 1 || optionsX.dilation != 1) {
+                throw std::invalid_argument("convolve2D(): Winograd algorithms require stride 1 and dilation 1!");
+            }
+
+            if constexpr (std::is_floating_point_v<ResultType>) {
+                if (algorithm == xvigra::Algorithm::WINOGRAD_2X2) {
+                    xvigra::winogradConvolve2D<ResultType, InputType, KernelType, 2>(xvigra::evaluateContiguous<3>(input), kernel, optionsY, optionsX, epilogue, output);
+                } else {
+                    xvigra::winogradConvolve2D<ResultType, InputType, KernelType, 4>(xvigra::evaluateContiguous<3>(input), kernel, optionsY, optionsX, epilogue, output);
+                }
+                return;
+            } else {
+                throw std::invalid_argument("convolve2D(): Winograd algorithms require a floating point input or kernel!");
+            }
+        }
+
+        // a pointwise kernel reads every input pixel exactly once, so the input itself is the patch and is multiplied
+        // in place as a C x (H * W) or (H * W) x C matrix
+        if (xvigra::isPointwise2D(kernelHeight, kernelWidth, optionsY, optionsX)) {
+            decltype(auto) contiguousInput = xvigra::evaluateContiguous<3>(input);
+            std::size_t channels = static_cast<std::size_t>(inputChannels);
+            std::size_t pixels = static_cast<std::size_t>(inputHeight) * static_cast<std::size_t>(inputWidth);
+
+            // only an input of another type than the result is converted once into memory drawn from the workspace
+            xvigra::Workspace& workspace = xvigra::resolveWorkspace(optionsY.workspace);
+            xvigra::Workspace::Scope workspaceScope(workspace);
+            const ResultType* inputData = xvigra::convertDirectInput<ResultType>(contiguousInput.data(), channels * pixels, workspace);
+
+            // the product and the kernel matrix share one allocation from the workspace
+            std::size_t productSize = static_cast<std::size_t>(outputChannels) * pixels;
+            ResultType* productData = workspace.allocate<ResultType>(productSize + kernel.size());
+
+            bool isChannelFirst = optionsY.channelPosition == xvigra::ChannelPosition::FIRST;
+            auto kernelMatrix = xvigra::packKernelMatrix<ResultType>(kernel, !isChannelFirst, productData + productSize);
+
+            if (isChannelFirst) {
+                auto inputMatrix = xt::adapt(inputData, channels * pixels, xt::no_ownership(), std::array<std::size_t, 2>{channels, pixels});
+                auto product = xt::adapt(productData, productSize, xt::no_ownership(), std::array<std::size_t, 2>{static_cast<std::size_t>(outputChannels), pixels});
+                xvigra::matrixProduct(kernelMatrix, inputMatrix, product, optionsY.threadCount);
+
+                std::array<std::size_t, 3> productShape{static_cast<std::size_t>(outputChannels), static_cast<std::size_t>(outputHeight), static_cast<std::size_t>(outputWidth)};
+                xvigra::applyEpilogue(xt::adapt(productData, productSize, xt::no_ownership(), productShape), epilogue, 0, output);
+            } else {
+                auto inputMatrix = xt::adapt(inputData, pixels * channels, xt::no_ownership(), std::array<std::size_t, 2>{pixels, channels});
+                auto product = xt::adapt(productData, productSize, xt::no_ownership(), std::array<std::size_t, 2>{pixels, static_cast<std::size_t>(outputChannels)});
+                xvigra::matrixProduct(inputMatrix, kernelMatrix, product, optionsY.threadCount);
+
+                std::array<std::size_t, 3> productShape{static_cast<std::size_t>(outputHeight), static_cast<std::size_t>(outputWidth), static_cast<std::size_t>(outputChannels)};
+                xvigra::applyEpilogue(xt::adapt(productData, productSize, xt::no_ownership(), productShape), epilogue, 2, output);
+            }
+            return;
+        }
+
+
         int kernelHeightRadius = kernelHeight / 2;
         int kernelHeightMinimum = kernelHeight % 2 == 0 ? 0 : -kernelHeightRadius;
         int kernelHeightMaximum = kernelHeight % 2 == 0 ? kernelHeight : kernelHeightRadius + 1;
@@ -601,9 +1468,6 @@ namespace xvigra {
         int kernelWidthMinimum = kernelWidth % 2 == 0 ? 0 : -kernelWidthRadius;
         int kernelWidthMaximum = kernelWidth % 2 == 0 ? kernelWidth : kernelWidthRadius + 1;
 
-        int outputHeight = xvigra::calculateOutputSize(inputHeight, kernelHeight, optionsY);
-        int outputWidth = xvigra::calculateOutputSize(inputWidth, kernelWidth, optionsX);
-
         int heightMinimum = -optionsY.paddingBegin() + optionsY.dilation * std::abs(kernelHeight % 2 == 0 ? 0 : kernelHeightMinimum);
         int heightMaximum = inputHeight + optionsY.paddingEnd() - optionsY.dilation * (kernelHeight % 2 == 0 ? kernelHeight - 1 : kernelHeightRadius);
 
@@ -613,21 +1477,86 @@ namespace xvigra {
         auto inputHeightIndices = xvigra::range(heightMinimum, heightMaximum, optionsY.stride);
         auto inputWidthIndices = xvigra::range(widthMinimum, widthMaximum, optionsX.stride);
 
-        xt::xtensor<ResultType, 3> result;
-        if (optionsY.channelPosition == xvigra::ChannelPosition::FIRST) {
-           Tensor5D<ResultType> patch = xt::zeros<ResultType>({inputChannels, kernelHeight, kernelWidth, outputHeight, outputWidth});
-
-            for (auto inputChannel = 0; inputChannel < inputChannels; ++inputChannel) {
-                for (auto kernelY = kernelHeightMinimum; kernelY < kernelHeightMaximum; ++kernelY) {
-                    auto outKernelY = kernelY + std::abs(kernelHeightMinimum);
-                    auto inputOffsetY = kernelY * optionsY.dilation;
+        // the patch is built and multiplied in tiles of output rows, so that it never exceeds the workspace limit
+        int patchRowSize = inputChannels * kernelHeight * kernelWidth * outputWidth;
+        int tileHeight = xvigra::calculateTileSize(optionsY.workspaceLimit, patchRowSize * sizeof(ResultType), outputHeight);
+
+        // the patch, the product and the kernel matrix share one allocation from the workspace, which is sized for the
+        // largest tile and reused by every tile
+        std::size_t patchColumns = static_cast<std::size_t>(inputChannels) * kernelHeight * kernelWidth;
+        std::size_t patchSize = static_cast<std::size_t>(patchRowSize) * tileHeight;
+        std::size_t largestProductSize = static_cast<std::size_t>(outputChannels) * outputWidth * tileHeight;
+        xvigra::Workspace& workspace = xvigra::resolveWorkspace(optionsY.workspace);
+        xvigra::Workspace::Scope workspaceScope(workspace);
+        ResultType* patchData = workspace.allocate<ResultType>(patchSize + largestProductSize + kernel.size());
+        ResultType* productData = patchData + patchSize;
+        auto kernelMatrix = xvigra::packKernelMatrix<ResultType>(kernel, optionsY.channelPosition == xvigra::ChannelPosition::LAST, productData + largestProductSize);
+
+        // the interior is copied without any border treatment, only the remaining strips need the border logic;
+        // plain variables instead of structured bindings, since the latter can't be captured by the patch lambdas
+        int interiorBeginY;
+        int interiorEndY;
+        int interiorBeginX;
+        int interiorEndX;
+        std::tie(interiorBeginY, interiorEndY) = xvigra::calculateInteriorRange(inputHeight, kernelHeight, optionsY);
+        std::tie(interiorBeginX, interiorEndX) = xvigra::calculateInteriorRange(inputWidth, kernelWidth, optionsX);
+
+        std::vector<std::pair<int, int>> borderRangesX{{0, interiorBeginX}, {interiorEndX, outputWidth}};
+        std::vector<std::pair<int, int>> fullRangesX{{0, outputWidth}};
 
-                    for (auto kernelX = kernelWidthMinimum; kernelX < kernelWidthMaximum; ++kernelX) {
+        if (optionsY.channelPosition == xvigra::ChannelPosition::FIRST) {
+            for (int tileBegin = 0; tileBegin < outputHeight; tileBegin += tileHeight) {
+                int tileEnd = std::min(tileBegin + tileHeight, outputHeight);
+                int currentTileHeight = tileEnd - tileBegin;
+                int tileInteriorBeginY = std::max(tileBegin, interiorBeginY);
+                int tileInteriorEndY = std::min(tileEnd, interiorEndY);
+
+                std::array<std::size_t, 5> patchShape{
+                    static_cast<std::size_t>(inputChannels),
+                    static_cast<std::size_t>(kernelHeight),
+                    static_cast<std::size_t>(kernelWidth),
+                    static_cast<std::size_t>(currentTileHeight),
+                    static_cast<std::size_t>(outputWidth)
+                };
+                auto patch = xt::adapt(patchData, static_cast<std::size_t>(patchRowSize) * currentTileHeight, xt::no_ownership(), patchShape);
+
+                // every kernel tap fills its own rows of the patch, so the taps are distributed over the threads
+                xvigra::parallelFor(0, inputChannels * kernelHeight * kernelWidth, optionsY.threadCount, [&](int tapBegin, int tapEnd) {
+                    for (int tap = tapBegin; tap < tapEnd; ++tap) {
+                        int inputChannel = tap / (kernelHeight * kernelWidth);
+                        int kernelY = kernelHeightMinimum + (tap / kernelWidth) % kernelHeight;
+                        int kernelX = kernelWidthMinimum + tap % kernelWidth;
+                        auto outKernelY = kernelY + std::abs(kernelHeightMinimum);
+                        auto inputOffsetY = kernelY * optionsY.dilation;
                         auto outKernelX = kernelX + std::abs(kernelWidthMinimum);
                         auto inputOffsetX = kernelX * optionsX.dilation;
 
-                        for (auto [outIndexY, inputIndexY] : xvigra::enumerate(inputHeightIndices)) {
-                            auto inputY = inputIndexY + inputOffsetY;
+                        // interior
+                        for (auto outIndexY = tileInteriorBeginY; outIndexY < tileInteriorEndY; ++outIndexY) {
+                            auto inputY = inputHeightIndices[outIndexY] + inputOffsetY;
+                            auto patchY = outIndexY - tileBegin;
+
+                            if constexpr (xt::has_data_interface<InputContainerType>::value) {
+                                if (interiorBeginX < interiorEndX) {
+                                    xvigra::convertRow(
+                                        &input(inputChannel, inputY, inputWidthIndices[interiorBeginX] + inputOffsetX),
+                                        static_cast<std::ptrdiff_t>(input.strides()[2]) * optionsX.stride,
+                                        &patch(inputChannel, outKernelY, outKernelX, patchY, interiorBeginX),
+                                        static_cast<std::size_t>(interiorEndX - interiorBeginX)
+                                    );
+                                }
+                            } else {
+                                for (auto outIndexX = interiorBeginX; outIndexX < interiorEndX; ++outIndexX) {
+                                    patch(inputChannel, outKernelY, outKernelX, patchY, outIndexX) = static_cast<ResultType>(input(inputChannel, inputY, inputWidthIndices[outIndexX] + inputOffsetX));
+                                }
+                            }
+                        }
+
+                        // border strips
+                        for (auto outIndexY = tileBegin; outIndexY < tileEnd; ++outIndexY) {
+                            auto inputY = inputHeightIndices[outIndexY] + inputOffsetY;
+                            auto patchY = outIndexY - tileBegin;
+                            bool isInteriorRow = tileInteriorBeginY <= outIndexY && outIndexY < tileInteriorEndY;
 
                             xvigra::BorderTreatment treatmentY = xvigra::BorderTreatment::avoid();
                             int indexY = inputY;
@@ -640,100 +1569,273 @@ namespace xvigra {
                                 XVIGRA_GET_END_BORDER_INDEX(indexY, treatmentY, indexY, inputHeight)
                             }
 
-                            for (auto [outIndexX, inputIndexX] : xvigra::enumerate(inputWidthIndices)) {
-                                auto inputX = inputIndexX + inputOffsetX;
-
-                                if (indexY == -1) {
-                                    patch(inputChannel, outKernelY, outKernelX, outIndexY, outIndexX) = static_cast<ResultType>(treatmentY.getValue<InputType>());
-                                } else {
-                                    xvigra::BorderTreatment treatmentX = xvigra::BorderTreatment::avoid();
-                                    int indexX = inputX;
-
-                                    if (indexX < 0) {
-                                        treatmentX = optionsX.borderTreatmentBegin;
-                                        XVIGRA_GET_BEGIN_BORDER_INDEX(indexX, treatmentX, indexX, inputWidth)
-                                    } else if(inputWidth <= indexX) {
-                                        treatmentX = optionsX.borderTreatmentEnd;
-                                        XVIGRA_GET_END_BORDER_INDEX(indexX, treatmentX, indexX, inputWidth)
-                                    }
+                            for (const auto& [rangeBegin, rangeEnd] : isInteriorRow ? borderRangesX : fullRangesX) {
+                                for (auto outIndexX = rangeBegin; outIndexX < rangeEnd; ++outIndexX) {
+                                    auto inputX = inputWidthIndices[outIndexX] + inputOffsetX;
 
-                                    if (indexX == -1) {
-                                        patch(inputChannel, outKernelY, outKernelX, outIndexY, outIndexX) = static_cast<ResultType>(treatmentX.getValue<InputType>());
+                                    if (indexY == -1) {
+                                        patch(inputChannel, outKernelY, outKernelX, patchY, outIndexX) = static_cast<ResultType>(treatmentY.getValue<InputType>());
                                     } else {
-                                        patch(inputChannel, outKernelY, outKernelX, outIndexY, outIndexX) = input(inputChannel, indexY, indexX);
+                                        xvigra::BorderTreatment treatmentX = xvigra::BorderTreatment::avoid();
+                                        int indexX = inputX;
+
+                                        if (indexX < 0) {
+                                            treatmentX = optionsX.borderTreatmentBegin;
+                                            XVIGRA_GET_BEGIN_BORDER_INDEX(indexX, treatmentX, indexX, inputWidth)
+                                        } else if(inputWidth <= indexX) {
+                                            treatmentX = optionsX.borderTreatmentEnd;
+                                            XVIGRA_GET_END_BORDER_INDEX(indexX, treatmentX, indexX, inputWidth)
+                                        }
+
+                                        if (indexX == -1) {
+                                            patch(inputChannel, outKernelY, outKernelX, patchY, outIndexX) = static_cast<ResultType>(treatmentX.getValue<InputType>());
+                                        } else {
+                                            patch(inputChannel, outKernelY, outKernelX, patchY, outIndexX) = input(inputChannel, indexY, indexX);
+                                        }
                                     }
-
                                 }
                             }
                         }
                     }
-                }
-            }
+                });
 
-            auto reshapedKernel = xt::reshape_view(kernel, {outputChannels, inputChannels * kernelHeight * kernelWidth});
-            auto reshapedPatch = xt::reshape_view(patch, {inputChannels * kernelHeight * kernelWidth, outputHeight * outputWidth});
-            result = xt::reshape_view(xt::linalg::dot(reshapedKernel, reshapedPatch), {outputChannels, outputHeight, outputWidth});
+                std::size_t tilePixels = static_cast<std::size_t>(currentTileHeight) * outputWidth;
+                std::size_t productSize = static_cast<std::size_t>(outputChannels) * tilePixels;
+                auto patchMatrix = xt::adapt(patchData, patchColumns * tilePixels, xt::no_ownership(), std::array<std::size_t, 2>{patchColumns, tilePixels});
+                auto product = xt::adapt(productData, productSize, xt::no_ownership(), std::array<std::size_t, 2>{static_cast<std::size_t>(outputChannels), tilePixels});
+                xvigra::matrixProduct(kernelMatrix, patchMatrix, product, optionsY.threadCount);
 
+                std::array<std::size_t, 3> productShape{static_cast<std::size_t>(outputChannels), static_cast<std::size_t>(currentTileHeight), static_cast<std::size_t>(outputWidth)};
+                auto outputTile = xt::view(output, xt::all(), xt::range(tileBegin, tileEnd), xt::all());
+                xvigra::applyEpilogue(xt::adapt(productData, productSize, xt::no_ownership(), productShape), epilogue, 0, outputTile);
+            }
         } else {
-            Tensor5D<ResultType> patch= xt::zeros<ResultType>({outputHeight, outputWidth, inputChannels, kernelHeight, kernelWidth});
-
-            for (auto [outIndexY, inputIndexY] : xvigra::enumerate(inputHeightIndices)) {
-                for (auto [outIndexX, inputIndexX] : xvigra::enumerate(inputWidthIndices)) {
-                    for (auto kernelY = kernelHeightMinimum; kernelY < kernelHeightMaximum; ++kernelY) {
-                        auto inputY = inputIndexY + kernelY * optionsY.dilation;
-                        auto outKernelY = kernelY + std::abs(kernelHeightMinimum);
-
-                        xvigra::BorderTreatment treatmentY = xvigra::BorderTreatment::avoid();
-                        int indexY = inputY;
+            for (int tileBegin = 0; tileBegin < outputHeight; tileBegin += tileHeight) {
+                int tileEnd = std::min(tileBegin + tileHeight, outputHeight);
+                int currentTileHeight = tileEnd - tileBegin;
+                int tileInteriorBeginY = std::max(tileBegin, interiorBeginY);
+                int tileInteriorEndY = std::min(tileEnd, interiorEndY);
+
+                std::array<std::size_t, 5> patchShape{
+                    static_cast<std::size_t>(currentTileHeight),
+                    static_cast<std::size_t>(outputWidth),
+                    static_cast<std::size_t>(inputChannels),
+                    static_cast<std::size_t>(kernelHeight),
+                    static_cast<std::size_t>(kernelWidth)
+                };
+                auto patch = xt::adapt(patchData, static_cast<std::size_t>(patchRowSize) * currentTileHeight, xt::no_ownership(), patchShape);
+
+                // every output row fills its own rows of the patch, so the rows are distributed over the threads
+                xvigra::parallelFor(tileBegin, tileEnd, optionsY.threadCount, [&](int rowBegin, int rowEnd) {
+                    // interior
+                    for (auto outIndexY = std::max(rowBegin, tileInteriorBeginY); outIndexY < std::min(rowEnd, tileInteriorEndY); ++outIndexY) {
+                        auto inputIndexY = inputHeightIndices[outIndexY];
+                        auto patchY = outIndexY - tileBegin;
+
+                        for (auto outIndexX = interiorBeginX; outIndexX < interiorEndX; ++outIndexX) {
+                            auto inputIndexX = inputWidthIndices[outIndexX];
+
+                            for (auto kernelY = kernelHeightMinimum; kernelY < kernelHeightMaximum; ++kernelY) {
+                                auto inputY = inputIndexY + kernelY * optionsY.dilation;
+                                auto outKernelY = kernelY + std::abs(kernelHeightMinimum);
+
+                                for (auto kernelX = kernelWidthMinimum; kernelX < kernelWidthMaximum; ++kernelX) {
+                                    auto inputX = inputIndexX + kernelX * optionsX.dilation;
+                                    auto outKernelX = kernelX + std::abs(kernelWidthMinimum);
 
-                        if (indexY < 0) {
-                            treatmentY = optionsY.borderTreatmentBegin;
-                            XVIGRA_GET_BEGIN_BORDER_INDEX(indexY, treatmentY, indexY, inputHeight)
-                        } else if(inputHeight <= indexY) {
-                            treatmentY = optionsY.borderTreatmentEnd;
-                            XVIGRA_GET_END_BORDER_INDEX(indexY, treatmentY, indexY, inputHeight)
-                        }
-
-                        for (auto kernelX = kernelWidthMinimum; kernelX < kernelWidthMaximum; ++kernelX) {
-                            auto inputX = inputIndexX + kernelX * optionsX.dilation;
-                            auto outKernelX = kernelX + std::abs(kernelWidthMinimum);
-
-                            if (indexY == -1) {
-                                for (auto inputChannel = 0; inputChannel < inputChannels; ++inputChannel) {
-                                    patch(outIndexY, outIndexX, inputChannel, outKernelY, outKernelX) = static_cast<ResultType>(treatmentY.getValue<InputType>());
-                                }
-                            } else {
-                                xvigra::BorderTreatment treatmentX = xvigra::BorderTreatment::avoid();
-                                int indexX = inputX;
-
-                                if (indexX < 0) {
-                                    treatmentX = optionsX.borderTreatmentBegin;
-                                    XVIGRA_GET_BEGIN_BORDER_INDEX(indexX, treatmentX, indexX, inputWidth)
-                                } else if(inputWidth <= indexX) {
-                                    treatmentX = optionsX.borderTreatmentEnd;
-                                    XVIGRA_GET_END_BORDER_INDEX(indexX, treatmentX, indexX, inputWidth)
+                                    for (auto inputChannel = 0; inputChannel < inputChannels; ++inputChannel) {
+                                        patch(patchY, outIndexX, inputChannel, outKernelY, outKernelX) = static_cast<ResultType>(input(inputY, inputX, inputChannel));
+                                    }
                                 }
+                            }
+                        }
+                    }
 
-                                if (indexX == -1) {
-                                    for (auto inputChannel = 0; inputChannel < inputChannels; ++inputChannel) {
-                                        patch(outIndexY, outIndexX, inputChannel, outKernelY, outKernelX) = static_cast<ResultType>(treatmentX.getValue<InputType>());
+                    // border strips
+                    for (auto outIndexY = rowBegin; outIndexY < rowEnd; ++outIndexY) {
+                        auto inputIndexY = inputHeightIndices[outIndexY];
+                        auto patchY = outIndexY - tileBegin;
+                        bool isInteriorRow = tileInteriorBeginY <= outIndexY && outIndexY < tileInteriorEndY;
+
+                        for (const auto& [rangeBegin, rangeEnd] : isInteriorRow ? borderRangesX : fullRangesX) {
+                            for (auto outIndexX = rangeBegin; outIndexX < rangeEnd; ++outIndexX) {
+                                auto inputIndexX = inputWidthIndices[outIndexX];
+
+                                for (auto kernelY = kernelHeightMinimum; kernelY < kernelHeightMaximum; ++kernelY) {
+                                    auto inputY = inputIndexY + kernelY * optionsY.dilation;
+                                    auto outKernelY = kernelY + std::abs(kernelHeightMinimum);
+
+                                    xvigra::BorderTreatment treatmentY = xvigra::BorderTreatment::avoid();
+                                    int indexY = inputY;
+
+                                    if (indexY < 0) {
+                                        treatmentY = optionsY.borderTreatmentBegin;
+                                        XVIGRA_GET_BEGIN_BORDER_INDEX(indexY, treatmentY, indexY, inputHeight)
+                                    } else if(inputHeight <= indexY) {
+                                        treatmentY = optionsY.borderTreatmentEnd;
+                                        XVIGRA_GET_END_BORDER_INDEX(indexY, treatmentY, indexY, inputHeight)
                                     }
-                                } else {
-                                    for (auto inputChannel = 0; inputChannel < inputChannels; ++inputChannel) {
-                                        patch(outIndexY, outIndexX, inputChannel, outKernelY, outKernelX) = static_cast<ResultType>(input(indexY, indexX, inputChannel));
+
+                                    for (auto kernelX = kernelWidthMinimum; kernelX < kernelWidthMaximum; ++kernelX) {
+                                        auto inputX = inputIndexX + kernelX * optionsX.dilation;
+                                        auto outKernelX = kernelX + std::abs(kernelWidthMinimum);
+
+                                        if (indexY == -1) {
+                                            for (auto inputChannel = 0; inputChannel < inputChannels; ++inputChannel) {
+                                                patch(patchY, outIndexX, inputChannel, outKernelY, outKernelX) = static_cast<ResultType>(treatmentY.getValue<InputType>());
+                                            }
+                                        } else {
+                                            xvigra::BorderTreatment treatmentX = xvigra::BorderTreatment::avoid();
+                                            int indexX = inputX;
+
+                                            if (indexX < 0) {
+                                                treatmentX = optionsX.borderTreatmentBegin;
+                                                XVIGRA_GET_BEGIN_BORDER_INDEX(indexX, treatmentX, indexX, inputWidth)
+                                            } else if(inputWidth <= indexX) {
+                                                treatmentX = optionsX.borderTreatmentEnd;
+                                                XVIGRA_GET_END_BORDER_INDEX(indexX, treatmentX, indexX, inputWidth)
+                                            }
+
+                                            if (indexX == -1) {
+                                                for (auto inputChannel = 0; inputChannel < inputChannels; ++inputChannel) {
+                                                    patch(patchY, outIndexX, inputChannel, outKernelY, outKernelX) = static_cast<ResultType>(treatmentX.getValue<InputType>());
+                                                }
+                                            } else {
+                                                for (auto inputChannel = 0; inputChannel < inputChannels; ++inputChannel) {
+                                                    patch(patchY, outIndexX, inputChannel, outKernelY, outKernelX) = static_cast<ResultType>(input(indexY, indexX, inputChannel));
+                                                }
+                                            }
+                                        }
                                     }
                                 }
                             }
                         }
                     }
-                }
-            }
+                });
+
+                std::size_t tilePixels = static_cast<std::size_t>(currentTileHeight) * outputWidth;
+                std::size_t productSize = tilePixels * static_cast<std::size_t>(outputChannels);
+                auto patchMatrix = xt::adapt(patchData, tilePixels * patchColumns, xt::no_ownership(), std::array<std::size_t, 2>{tilePixels, patchColumns});
+                auto product = xt::adapt(productData, productSize, xt::no_ownership(), std::array<std::size_t, 2>{tilePixels, static_cast<std::size_t>(outputChannels)});
+                xvigra::matrixProduct(patchMatrix, kernelMatrix, product, optionsY.threadCount);
 
-            auto reshapedKernel = xt::transpose(xt::reshape_view(kernel, {outputChannels, inputChannels * kernelHeight * kernelWidth}));
-            auto reshapedPatch = xt::reshape_view(patch, {outputHeight*outputWidth, inputChannels*kernelHeight*kernelWidth});
-            result = xt::reshape_view(xt::linalg::dot(reshapedPatch, reshapedKernel), {outputHeight, outputWidth, outputChannels});
+                std::array<std::size_t, 3> productShape{static_cast<std::size_t>(currentTileHeight), static_cast<std::size_t>(outputWidth), static_cast<std::size_t>(outputChannels)};
+                auto outputTile = xt::view(output, xt::range(tileBegin, tileEnd), xt::all(), xt::all());
+                xvigra::applyEpilogue(xt::adapt(productData, productSize, xt::no_ownership(), productShape), epilogue, 2, outputTile);
+            }
         }
+    }
+
+
+    template <typename T, typename O, typename R>
+    void convolve2D(
+        const xt::xexpression<T>& inputExpression,
+        const xt::xexpression<O>& kernelExpression,
+        const xvigra::KernelOptions& optionsY,
+        const xvigra::KernelOptions& optionsX,
+        const xvigra::Epilogue& epilogue,
+        xt::xexpression<R>&& outputExpression
+    ) {
+        convolve2D(inputExpression, kernelExpression, optionsY, optionsX, epilogue, outputExpression);
+    }
+
+
+    /*
+     * <p>
+     * Calculates the explicit 2-dimensional convolution of the input with the given 2-dimensional kernel into the
+     * given output without any epilogue; see the overload with an epilogue for details.
+     * </p>
+     *
+     * @tparam O derived type of the input xexpression
+     * @tparam T derived type of the kernel xexpression
+     * @tparam R derived type of the output xexpression
+     * @param inputExpression xexpression containing the input data
+     * @param rawKernelExpression xexpression containing the kernel data
+     * @param optionsY options along the height
+     * @param optionsX options along the width
+     * @param outputExpression xexpression which receives the result of the 2-dimensional convolution
+     * @throws std::invalid_argument for every invalid configuration rejected by the overload with an epilogue
+     */
+    template <typename T, typename O, typename R>
+    void convolve2D(
+        const xt::xexpression<T>& inputExpression,
+        const xt::xexpression<O>& kernelExpression,
+        const xvigra::KernelOptions& optionsY,
+        const xvigra::KernelOptions& optionsX,
+        xt::xexpression<R>& outputExpression
+    ) {
+        convolve2D(inputExpression, kernelExpression, optionsY, optionsX, xvigra::Epilogue(), outputExpression);
+    }
+
+
+    template <typename T, typename O, typename R>
+    void convolve2D(
+        const xt::xexpression<T>& inputExpression,
+        const xt::xexpression<O>& kernelExpression,
+        const xvigra::KernelOptions& optionsY,
+        const xvigra::KernelOptions& optionsX,
+        xt::xexpression<R>&& outputExpression
+    ) {
+        convolve2D(inputExpression, kernelExpression, optionsY, optionsX, outputExpression);
+    }
+
+
+    /*
+     * <p>
+     * Calculates the explicit 2-dimensional convolution of the input with the given 2-dimensional kernel and applies
+     * the epilogue while writing into a newly allocated xt::xtensor of OutputType; see the overload with an output for
+     * details.
+     * </p>
+     *
+     * @tparam OutputType value type of the result
+     * @tparam O derived type of the input xexpression
+     * @tparam T derived type of the kernel xexpression
+     * @param inputExpression xexpression containing the input data
+     * @param rawKernelExpression xexpression containing the kernel data
+     * @param optionsY options along the height
+     * @param optionsX options along the width
+     * @param epilogue bias, scale, clipping and rounding which are applied to the result
+     * @return the post processed result of the 2-dimensional convolution as xt::xtensor of OutputType
+     * @throws std::invalid_argument for every invalid configuration rejected by the overload with an output
+     */
+    template <typename OutputType, typename T, typename O>
+    Tensor3D<OutputType> convolve2D(
+        const xt::xexpression<T>& inputExpression,
+        const xt::xexpression<O>& kernelExpression,
+        const xvigra::KernelOptions& optionsY,
+        const xvigra::KernelOptions& optionsX,
+        const xvigra::Epilogue& epilogue
+    ) {
+        Tensor3D<OutputType> result;
+        convolve2D(inputExpression, kernelExpression, optionsY, optionsX, epilogue, result);
+        return result;
+    }
+
 
+    /*
+     * <p>
+     * Calculates the explicit 2-dimensional convolution of the input with the given 2-dimensional kernel into a newly
+     * allocated xt::xtensor; see the overload with an output for details.
+     * </p>
+     *
+     * @tparam O derived type of the input xexpression
+     * @tparam T derived type of the kernel xexpression
+     * @param inputExpression xexpression containing the input data
+     * @param rawKernelExpression xexpression containing the kernel data
+     * @param options object containing information about padding, stride, dilation, channel position and border
+                      treatment
+     * @return the result of the 2-dimensional convolution between the input and kernel as xt::xtensor
+     * @throws std::invalid_argument for every invalid configuration rejected by the overload with an output
+     */
+    template <typename T, typename O>
+    auto convolve2D(
+        const xt::xexpression<T>& inputExpression,
+        const xt::xexpression<O>& kernelExpression,
+        const xvigra::KernelOptions& optionsY,
+        const xvigra::KernelOptions& optionsX
+    ) -> Tensor3D<std::common_type_t<typename T::value_type, typename O::value_type>> {
+        Tensor3D<std::common_type_t<typename T::value_type, typename O::value_type>> result;
+        convolve2D(inputExpression, kernelExpression, optionsY, optionsX, result);
         return result;
     }
 
@@ -752,41 +1854,171 @@ namespace xvigra {
         );
     }
 
+
+    template <typename T, typename O, typename R>
+    inline void convolve2D(
+        const xt::xexpression<T>& inputExpression,
+        const xt::xexpression<O>& kernelExpression,
+        const xvigra::KernelOptions2D& options2D,
+        xt::xexpression<R>& outputExpression
+    ) {
+        convolve2D(
+            inputExpression.derived_cast(),
+            kernelExpression.derived_cast(),
+            options2D.optionsY,
+            options2D.optionsX,
+            outputExpression
+        );
+    }
+
+
+    template <typename T, typename O, typename R>
+    inline void convolve2D(
+        const xt::xexpression<T>& inputExpression,
+        const xt::xexpression<O>& kernelExpression,
+        const xvigra::KernelOptions2D& options2D,
+        xt::xexpression<R>&& outputExpression
+    ) {
+        convolve2D(inputExpression, kernelExpression, options2D, outputExpression);
+    }
+
     /*
      * <p>
-     * Calculates the explicit 2-dimensional convolution of the input with the given 2-dimensional kernel based on the
-     * GEMM-based algorithm of Chellapilla K., Puri S. and Simard P. .
-     * This function requires an input of shape H x W x C or C x H x W and a kernel with at least 2 dimension or at maximum
-     * a full filter of 4 dimensions.
-     * Missing kernel dimensions are inserted by xvigra::promoteKernelToFull1D.
-     * This function can only process ChannelPosition::IMPLICIT inputs; for ChannelPosition::FIRST or ChannelPosition::LAST
-     * use xvigra::convolve2D.
+     * Returns the algorithm which xvigra::convolve2D runs for the given input, kernel and options. Algorithm::AUTO is
+     * resolved with xvigra::selectAlgorithm2D exactly as in xvigra::convolve2D, so the result can be used to log the
+     * backend of an automatic convolution. Every other algorithm is returned unchanged. Under Algorithm::AUTO the
+     * kernel of every group is analyzed with the same density test as in xvigra::convolve2D; since the sparse backend
+     * has no algorithm of its own, it is reported through isSparse, while the returned algorithm is the one of the
+     * cost model which the dense groups run.
      * </p>
      *
      * @tparam O derived type of the input xexpression
      * @tparam T derived type of the kernel xexpression
      * @param inputExpression xexpression containing the input data
-     * @param rawKernelExpression xexpression containing the kernel data
-     * @param kernelOptions object containing information about padding, stride, dilation, channel position and border
-                            treatment
-     * @return the result of the 2-dimensional convolution between the input and kernel as xt::xtensor
+     * @param kernelExpression xexpression containing the kernel data
+     * @param options2D object containing information about padding, stride, dilation, channel position, border
+                        treatment and algorithm
+     * @param isSparse optional flag which is set to whether xvigra::convolve2D hands at least one group to
+                       xvigra::sparseConvolve2D
+     * @return the algorithm used by xvigra::convolve2D; never Algorithm::AUTO
      * @throws std::invalid_argument * if input does not match the required shape
-                                     * if the given channel position is not ChannelPosition::IMPLICIT
+                                     * if IMPLICIT channel position is requested
      */
     template <typename T, typename O>
-    auto convolve2DImplicit(
+    xvigra::Algorithm resolveAlgorithm2D(
         const xt::xexpression<T>& inputExpression,
         const xt::xexpression<O>& kernelExpression,
-        const xvigra::KernelOptions2D& options2D
+        const xvigra::KernelOptions2D& options2D,
+        bool* isSparse = nullptr
     ) {
-        using InputContainerType = typename xt::xexpression<T>::derived_type;
-        using InputType = typename InputContainerType::value_type;
-        using KernelContainerType = typename xt::xexpression<O>::derived_type;
-        using KernelType = typename KernelContainerType::value_type;
-        using ResultType = typename std::common_type_t<InputType, KernelType>;
+        using InputType = typename xt::xexpression<T>::derived_type::value_type;
+        // mirrors the accumulation of xvigra::convolve2D, which widens 16-bit floats to float
+        using KernelType = xvigra::AccumulationType<typename xt::xexpression<O>::derived_type::value_type>;
+        using ResultType = xvigra::AccumulationType<std::common_type_t<InputType, KernelType>>;
+
+        const auto& input = inputExpression.derived_cast();
+        const auto& kernel = kernelExpression.derived_cast();
+        const xvigra::KernelOptions& optionsY = options2D.optionsY;
+        const xvigra::KernelOptions& optionsX = options2D.optionsX;
+
+        if (isSparse != nullptr) {
+            *isSparse = false;
+        }
 
-        InputContainerType input = inputExpression.derived_cast();
-        KernelContainerType kernel = kernelExpression.derived_cast();
+        if (optionsY.algorithm != xvigra::Algorithm::AUTO) {
+            return optionsY.algorithm;
+        }
+
+        if (optionsY.channelPosition == xvigra::ChannelPosition::IMPLICIT) {
+            throw std::invalid_argument(
+                "resolveAlgorithm2D(): Implicit channel option is not supported for explicit channels in input!"
+            );
+        }
+
+        if (optionsY.channelPosition == xvigra::ChannelPosition::BLOCKED) {
+            throw std::invalid_argument(
+                "resolveAlgorithm2D(): Blocked channel option is only supported by convolve2DBlocked!"
+            );
+        }
+
+        if (input.dimension() != 3) {
+            throw std::invalid_argument("resolveAlgorithm2D(): Need 3 dimensional (H x W x C or C x H x W) input!");
+        }
+
+        bool isChannelFirst = optionsY.channelPosition == xvigra::ChannelPosition::FIRST;
+        int inputChannels = static_cast<int>(input.shape()[isChannelFirst ? 0 : 2]);
+        int inputHeight = static_cast<int>(input.shape()[isChannelFirst ? 1 : 0]);
+        int inputWidth = static_cast<int>(input.shape()[isChannelFirst ? 2 : 1]);
+
+        // mirrors the groups of xvigra::convolve2D and the kernel shapes produced by xvigra::promoteKernelToFull2D,
+        // since the algorithm is selected for every group on its own
+        std::size_t kernelDimension = kernel.dimension();
+        int groups = std::max(kernelDimension <= 2 ? inputChannels : optionsY.groups, 1);
+        int groupInputChannels = inputChannels / groups;
+        int groupOutputChannels = kernelDimension == 4 ? static_cast<int>(kernel.shape()[0]) / groups : groupInputChannels;
+        int kernelHeight = static_cast<int>(kernel.shape()[kernelDimension == 1 ? 0 : kernelDimension - 2]);
+        int kernelWidth = static_cast<int>(kernel.shape()[kernelDimension - 1]);
+
+        // mirrors the density test of xvigra::convolve2D, which runs for every group on its own
+        if (isSparse != nullptr && !xvigra::isPointwise2D(kernelHeight, kernelWidth, optionsY, optionsX)) {
+            using RawKernelType = typename xt::xexpression<O>::derived_type::value_type;
+            xt::xtensor<RawKernelType, 4> groupedKernel = xvigra::promoteKernelToFull2D(kernel, groupInputChannels);
+            bool isSharedKernel = groups == 1 || kernelDimension != 4;
+
+            for (int group = 0; group < (isSharedKernel ? 1 : groups) && !*isSparse; ++group) {
+                int kernelBegin = isSharedKernel ? 0 : group * groupOutputChannels;
+                xt::xtensor<RawKernelType, 4> groupKernel = xt::view(groupedKernel, xt::range(kernelBegin, kernelBegin + groupOutputChannels), xt::all(), xt::all(), xt::all());
+                *isSparse = xvigra::collectNonZeroTaps<ResultType>(groupKernel).isSparse(optionsY.channelPosition);
+            }
+        }
+
+        return xvigra::selectAlgorithm2D(
+            groupInputChannels,
+            inputHeight,
+            inputWidth,
+            groupOutputChannels,
+            kernelHeight,
+            kernelWidth,
+            optionsY,
+            optionsX,
+            std::is_floating_point_v<ResultType>
+        );
+    }
+
+    /*
+     * <p>
+     * Calculates the explicit 2-dimensional convolution of the input with the given 2-dimensional kernel based on the
+     * GEMM-based algorithm of Chellapilla K., Puri S. and Simard P. .
+     * This function requires an input of shape H x W x C or C x H x W and a kernel with at least 2 dimension or at maximum
+     * a full filter of 4 dimensions.
+     * Missing kernel dimensions are inserted by xvigra::promoteKernelToFull1D.
+     * This function can only process ChannelPosition::IMPLICIT inputs; for ChannelPosition::FIRST or ChannelPosition::LAST
+     * use xvigra::convolve2D.
+     * The result is written into the given output, see xvigra::prepareConvolutionOutput.
+     * </p>
+     *
+     * @tparam O derived type of the input xexpression
+     * @tparam T derived type of the kernel xexpression
+     * @tparam R derived type of the output xexpression
+     * @param inputExpression xexpression containing the input data
+     * @param rawKernelExpression xexpression containing the kernel data
+     * @param kernelOptions object containing information about padding, stride, dilation, channel position and border
+                            treatment
+     * @param outputExpression xexpression which receives the result of the 2-dimensional convolution
+     * @throws std::invalid_argument * if input does not match the required shape
+                                     * if the given channel position is not ChannelPosition::IMPLICIT
+                                     * if the output does not have the shape of the result
+     */
+    template <typename T, typename O, typename R>
+    void convolve2DImplicit(
+        const xt::xexpression<T>& inputExpression,
+        const xt::xexpression<O>& kernelExpression,
+        const xvigra::KernelOptions2D& options2D,
+        xt::xexpression<R>& outputExpression
+    ) {
+        const auto& input = inputExpression.derived_cast();
+        const auto& kernel = kernelExpression.derived_cast();
+        auto& output = outputExpression.derived_cast();
 
         if (options2D.optionsY.channelPosition != xvigra::ChannelPosition::IMPLICIT) {
             throw std::domain_error("convolve2DImplicit(): Expected implicit channels in options!");
@@ -796,17 +2028,1215 @@ namespace xvigra {
             throw std::invalid_argument("convolve2DImplicit(): Need 2 dimensional (H x W) input!");
         }
 
+        // a kernel larger than the padded input is rejected by convolve2D, which is why the sizes are clamped here
+        std::size_t kernelDimension = kernel.dimension();
+        int kernelHeight = static_cast<int>(kernel.shape()[kernelDimension == 1 ? 0 : kernelDimension - 2]);
+        int kernelWidth = static_cast<int>(kernel.shape()[kernelDimension - 1]);
+        int outputHeight = std::max(xvigra::calculateOutputSize(static_cast<int>(input.shape()[0]), kernelHeight, options2D.optionsY), 0);
+        int outputWidth = std::max(xvigra::calculateOutputSize(static_cast<int>(input.shape()[1]), kernelWidth, options2D.optionsX), 0);
+        xvigra::prepareConvolutionOutput(output, std::array<std::size_t, 2>{static_cast<std::size_t>(outputHeight), static_cast<std::size_t>(outputWidth)}, "convolve2DImplicit()");
+
         xvigra::KernelOptions2D tempOptions(options2D);
         tempOptions.setChannelPosition(xvigra::ChannelPosition::LAST);
         auto normalizedInput = xt::expand_dims(input, input.dimension());
-        auto result = convolve2D(normalizedInput, kernel, tempOptions);
+        auto normalizedOutput = xt::expand_dims(output, 2);
+        convolve2D(normalizedInput, kernel, tempOptions, normalizedOutput);
+    }
 
-        return Tensor2D<ResultType>(xt::squeeze(result));
+
+    template <typename T, typename O, typename R>
+    void convolve2DImplicit(
+        const xt::xexpression<T>& inputExpression,
+        const xt::xexpression<O>& kernelExpression,
+        const xvigra::KernelOptions2D& options2D,
+        xt::xexpression<R>&& outputExpression
+    ) {
+        convolve2DImplicit(inputExpression, kernelExpression, options2D, outputExpression);
+    }
+
+    /*
+     * <p>
+     * Calculates the explicit 2-dimensional convolution of the implicit channel input with the given kernel into a
+     * newly allocated xt::xtensor; see the overload with an output for details.
+     * </p>
+     *
+     * @tparam O derived type of the input xexpression
+     * @tparam T derived type of the kernel xexpression
+     * @param inputExpression xexpression containing the input data
+     * @param rawKernelExpression xexpression containing the kernel data
+     * @param kernelOptions object containing information about padding, stride, dilation, channel position and border
+                            treatment
+     * @return the result of the 2-dimensional convolution between the input and kernel as xt::xtensor
+     * @throws std::invalid_argument * if input does not match the required shape
+                                     * if the given channel position is not ChannelPosition::IMPLICIT
+     */
+    template <typename T, typename O>
+    auto convolve2DImplicit(
+        const xt::xexpression<T>& inputExpression,
+        const xt::xexpression<O>& kernelExpression,
+        const xvigra::KernelOptions2D& options2D
+    ) {
+        using InputType = typename xt::xexpression<T>::derived_type::value_type;
+        using KernelType = typename xt::xexpression<O>::derived_type::value_type;
+        using ResultType = typename std::common_type_t<InputType, KernelType>;
+
+        Tensor2D<ResultType> result;
+        convolve2DImplicit(inputExpression, kernelExpression, options2D, result);
+        return result;
     }
 
     // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
     // ║ convolve2D - end                                                                                                 ║
     // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ convolve2DBlocked - begin                                                                                        ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    /*
+     * <p>
+     * Calculates the explicit 2-dimensional convolution of a channel blocked input C/8 x H x W x 8
+     * (ChannelPosition::BLOCKED, see xvigra::toChannelBlocked) into a channel blocked output OC/8 x H_out x W_out x 8.
+     * The kernel is promoted by xvigra::promoteKernelToFull2D and packed into 8 x 8 blocks of input and output lanes.
+     * Every input pixel is read as its 8 contiguous lanes and multiplied with such a block by
+     * xvigra::multiplyAddChannelBlock, which keeps the block in registers and accumulates the 8 contiguous output
+     * channels of a whole row of pixels at once; only the pixels at the left and right border are multiplied one by
+     * one. A kernel with less than 4 dimensions uses all lanes of the input blocks as channels.
+     * Lanes behind the last channel are 0 in the input and are written as 0 into the output.
+     * The border treatments are the same as for xvigra::convolve2D; the algorithm of the options is ignored and the
+     * output rows are distributed over the thread count of optionsY.
+     * The packed kernel, an input of another type than the result and one accumulated output row per thread are drawn
+     * from the workspace of optionsY or xvigra::threadLocalWorkspace if none is set. The result is written into the
+     * given output, see xvigra::prepareConvolutionOutput.
+     * The epilogue is applied to every output row right after it is accumulated; its channels are the channels of
+     * the kernel, i.e. channel c is lane c % 8 of block c / 8.
+     * </p>
+     *
+     * @tparam T derived type of the input xexpression
+     * @tparam O derived type of the kernel xexpression
+     * @tparam R derived type of the output xexpression
+     * @param inputExpression xexpression containing the channel blocked input data
+     * @param rawKernelExpression xexpression containing the kernel data
+     * @param optionsY object containing information about padding, stride, dilation and border treatment along the
+                       height
+     * @param optionsX object containing information about padding, stride, dilation and border treatment along the
+                       width
+     * @param epilogue bias, scale, clipping and rounding which are applied to the result before it is converted to
+                       the value type of the output
+     * @param outputExpression xexpression which receives the channel blocked result of the 2-dimensional convolution
+     * @throws std::invalid_argument * if the channel position of the options is not ChannelPosition::BLOCKED
+                                     * if more than 1 group is requested
+                                     * if input is not channel blocked
+                                     * if the input channels in the input and kernel do not align
+                                     * if the padded input is smaller than the dilated kernel
+                                     * if the bias of the epilogue does not match the output channels
+                                     * if the output does not have the shape of the result
+     */
+    template <typename T, typename O, typename R>
+    void convolve2DBlocked(
+        const xt::xexpression<T>& inputExpression,
+        const xt::xexpression<O>& kernelExpression,
+        const xvigra::KernelOptions& optionsY,
+        const xvigra::KernelOptions& optionsX,
+        const xvigra::Epilogue& epilogue,
+        xt::xexpression<R>& outputExpression
+    ) {
+        using InputContainerType = typename xt::xexpression<T>::derived_type;
+        using InputType = typename InputContainerType::value_type;
+        using KernelContainerType = typename xt::xexpression<O>::derived_type;
+        using KernelType = xvigra::AccumulationType<typename KernelContainerType::value_type>;
+        using ResultType = xvigra::AccumulationType<std::common_type_t<InputType, KernelType>>;
+        using OutputContainerType = typename xt::xexpression<R>::derived_type;
+        using OutputType = typename OutputContainerType::value_type;
+
+        constexpr int blockSize = static_cast<int>(xvigra::CHANNEL_BLOCK_SIZE);
+        static_assert(xvigra::CHANNEL_BLOCK_SIZE == 8, "convolve2DBlocked(): xvigra::multiplyAddChannelBlock works on blocks of 8 channels!");
+
+        const auto& input = inputExpression.derived_cast();
+        const auto& rawKernel = kernelExpression.derived_cast();
+        auto& output = outputExpression.derived_cast();
+
+        if (optionsY.channelPosition != xvigra::ChannelPosition::BLOCKED || optionsX.channelPosition != xvigra::ChannelPosition::BLOCKED) {
+            throw std::invalid_argument("convolve2DBlocked(): Need ChannelPosition::BLOCKED in optionsY and optionsX!");
+        }
+
+        if (optionsY.groups != 1 || optionsX.groups != 1) {
+            throw std::invalid_argument("convolve2DBlocked(): Groups are not supported!");
+        }
+
+        if (input.dimension() != 4 || input.shape()[3] != xvigra::CHANNEL_BLOCK_SIZE) {
+            throw std::invalid_argument("convolve2DBlocked(): Need 4 dimensional (C/8 x H x W x 8) input!");
+        }
+
+        int inputBlocks = static_cast<int>(input.shape()[0]);
+        int inputHeight = static_cast<int>(input.shape()[1]);
+        int inputWidth = static_cast<int>(input.shape()[2]);
+
+        // Kernel
+        xt::xtensor<KernelType, 4> kernel = xvigra::promoteKernelToFull2D(rawKernel, static_cast<std::size_t>(inputBlocks * blockSize));
+
+        int outputChannels = kernel.shape()[0];
+        int inputChannels = kernel.shape()[1];
+        int kernelHeight = kernel.shape()[2];
+        int kernelWidth = kernel.shape()[3];
+        int outputBlocks = (outputChannels + blockSize - 1) / blockSize;
+
+        if ((inputChannels + blockSize - 1) / blockSize != inputBlocks) {
+            throw std::invalid_argument("convolve2DBlocked(): Input channels of input and kernel do not align!");
+        }
+
+        // size mismatch
+        if (inputHeight + optionsY.paddingTotal() < (kernelHeight - 1) * optionsY.dilation + 1) {
+            throw std::invalid_argument("convolve2DBlocked(): Kernel height is greater than padded input height!");
+        }
+
+        if (inputWidth + optionsX.paddingTotal() < (kernelWidth - 1) * optionsX.dilation + 1) {
+            throw std::invalid_argument("convolve2DBlocked(): Kernel width is greater than padded input width!");
+        }
+
+        int outputHeight = xvigra::calculateOutputSize(inputHeight, kernelHeight, optionsY);
+        int outputWidth = xvigra::calculateOutputSize(inputWidth, kernelWidth, optionsX);
+
+        xvigra::prepareConvolutionOutput(
+            output,
+            std::array<std::size_t, 4>{static_cast<std::size_t>(outputBlocks), static_cast<std::size_t>(outputHeight), static_cast<std::size_t>(outputWidth), xvigra::CHANNEL_BLOCK_SIZE},
+            "convolve2DBlocked()"
+        );
+        xvigra::checkEpilogue(epilogue, static_cast<std::size_t>(outputChannels), "convolve2DBlocked()");
+
+        int rows = outputBlocks * outputHeight;
+        if (rows == 0 || outputWidth == 0) {
+            return;
+        }
+
+        decltype(auto) contiguousInput = xvigra::evaluateContiguous<4>(input);
+
+        // every thread accumulates its own output row, which is only written to the output after the epilogue
+        int tasks = std::min(xvigra::resolveThreadCount(optionsY.threadCount), rows);
+        constexpr std::size_t weightBlockSize = xvigra::CHANNEL_BLOCK_SIZE * xvigra::CHANNEL_BLOCK_SIZE;
+        std::size_t weightsSize = static_cast<std::size_t>(outputBlocks * inputBlocks * kernelHeight * kernelWidth) * weightBlockSize;
+        std::size_t rowSize = static_cast<std::size_t>(outputWidth) * xvigra::CHANNEL_BLOCK_SIZE;
+
+        xvigra::Workspace& workspace = xvigra::resolveWorkspace(optionsY.workspace);
+        xvigra::Workspace::Scope workspaceScope(workspace);
+        ResultType* weights = workspace.allocate<ResultType>(weightsSize + rowSize * static_cast<std::size_t>(tasks));
+        ResultType* accumulators = weights + weightsSize;
+        const ResultType* inputData = xvigra::convertDirectInput<ResultType>(contiguousInput.data(), contiguousInput.size(), workspace);
+
+        // the kernel is packed as OC/8 x IC/8 x KH x KW x 8 (input lane) x 8 (output lane), missing channels are 0
+        std::fill(weights, weights + weightsSize, static_cast<ResultType>(0));
+        for (int outputChannel = 0; outputChannel < outputChannels; ++outputChannel) {
+            for (int inputChannel = 0; inputChannel < inputChannels; ++inputChannel) {
+                for (int kernelY = 0; kernelY < kernelHeight; ++kernelY) {
+                    for (int kernelX = 0; kernelX < kernelWidth; ++kernelX) {
+                        std::size_t weightBlock = (((outputChannel / blockSize) * inputBlocks + inputChannel / blockSize) * kernelHeight + kernelY) * kernelWidth + kernelX;
+                        weights[weightBlock * weightBlockSize + (inputChannel % blockSize) * blockSize + outputChannel % blockSize] =
+                            static_cast<ResultType>(kernel(outputChannel, inputChannel, kernelY, kernelX));
+                    }
+                }
+            }
+        }
+
+        std::vector<int> indicesY = xvigra::calculateGatherIndices(inputHeight, kernelHeight, optionsY);
+        std::vector<int> indicesX = xvigra::calculateGatherIndices(inputWidth, kernelWidth, optionsX);
+        int interiorBeginX;
+        int interiorEndX;
+        std::tie(interiorBeginX, interiorEndX) = xvigra::calculateInteriorRange(inputWidth, kernelWidth, optionsX);
+        std::array<std::pair<int, int>, 2> borderRangesX{{{0, interiorBeginX}, {interiorEndX, outputWidth}}};
+
+        // constant borders are read like input pixels, whose 8 lanes all hold the constant
+        ResultType constantPixels[4][blockSize];
+        std::fill(constantPixels[0], constantPixels[0] + blockSize, xvigra::gatherConstant<InputType, ResultType>(optionsY, xvigra::CONSTANT_BEGIN_INDEX));
+        std::fill(constantPixels[1], constantPixels[1] + blockSize, xvigra::gatherConstant<InputType, ResultType>(optionsY, xvigra::CONSTANT_END_INDEX));
+        std::fill(constantPixels[2], constantPixels[2] + blockSize, xvigra::gatherConstant<InputType, ResultType>(optionsX, xvigra::CONSTANT_BEGIN_INDEX));
+        std::fill(constantPixels[3], constantPixels[3] + blockSize, xvigra::gatherConstant<InputType, ResultType>(optionsX, xvigra::CONSTANT_END_INDEX));
+
+        bool isIdentity = epilogue.template isIdentity<OutputType, ResultType>();
+        std::size_t blockStride = static_cast<std::size_t>(inputHeight) * static_cast<std::size_t>(inputWidth) * xvigra::CHANNEL_BLOCK_SIZE;
+        std::size_t rowStride = static_cast<std::size_t>(inputWidth) * xvigra::CHANNEL_BLOCK_SIZE;
+        std::ptrdiff_t pixelStride = static_cast<std::ptrdiff_t>(optionsX.stride) * blockSize;
+
+        xvigra::parallelFor(0, tasks, tasks, [&](int taskBegin, int taskEnd) {
+            for (int task = taskBegin; task < taskEnd; ++task) {
+                ResultType* accumulator = accumulators + static_cast<std::size_t>(task) * rowSize;
+                int rowBegin = static_cast<int>(static_cast<long long>(rows) * task / tasks);
+                int rowEnd = static_cast<int>(static_cast<long long>(rows) * (task + 1) / tasks);
+
+                for (int row = rowBegin; row < rowEnd; ++row) {
+                    int outputBlock = row / outputHeight;
+                    int outIndexY = row % outputHeight;
+                    std::fill(accumulator, accumulator + rowSize, static_cast<ResultType>(0));
+
+                    for (int inputBlock = 0; inputBlock < inputBlocks; ++inputBlock) {
+                        for (int kernelY = 0; kernelY < kernelHeight; ++kernelY) {
+                            int inputY = indicesY[kernelY * outputHeight + outIndexY];
+                            const ResultType* inputRow = inputY < 0
+                                ? nullptr
+                                : inputData + static_cast<std::size_t>(inputBlock) * blockStride + static_cast<std::size_t>(inputY) * rowStride;
+
+                            for (int kernelX = 0; kernelX < kernelWidth; ++kernelX) {
+                                const int* rowIndicesX = indicesX.data() + kernelX * outputWidth;
+                                std::size_t weightBlock = ((static_cast<std::size_t>(outputBlock) * inputBlocks + inputBlock) * kernelHeight + kernelY) * kernelWidth + kernelX;
+                                const ResultType* blockWeights = weights + weightBlock * weightBlockSize;
+
+                                if (inputRow == nullptr) {
+                                    const ResultType* constantPixel = constantPixels[inputY == xvigra::CONSTANT_BEGIN_INDEX ? 0 : 1];
+                                    xvigra::multiplyAddChannelBlock(accumulator, constantPixel, 0, blockWeights, static_cast<std::size_t>(outputWidth));
+                                    continue;
+                                }
+
+                                // the interior pixels follow each other with the stride of optionsX
+                                if (interiorBeginX < interiorEndX) {
+                                    xvigra::multiplyAddChannelBlock(
+                                        accumulator + static_cast<std::size_t>(interiorBeginX) * blockSize,
+                                        inputRow + static_cast<std::size_t>(rowIndicesX[interiorBeginX]) * blockSize,
+                                        pixelStride,
+                                        blockWeights,
+                                        static_cast<std::size_t>(interiorEndX - interiorBeginX)
+                                    );
+                                }
+
+                                // the pixels left and right of the interior may be resolved by the border treatment
+                                for (const auto& [rangeBegin, rangeEnd] : borderRangesX) {
+                                    for (int outIndexX = rangeBegin; outIndexX < rangeEnd; ++outIndexX) {
+                                        int inputX = rowIndicesX[outIndexX];
+                                        const ResultType* pixel = inputX < 0
+                                            ? constantPixels[inputX == xvigra::CONSTANT_BEGIN_INDEX ? 2 : 3]
+                                            : inputRow + static_cast<std::size_t>(inputX) * blockSize;
+                                        xvigra::multiplyAddChannelBlock(accumulator + static_cast<std::size_t>(outIndexX) * blockSize, pixel, 0, blockWeights, 1);
+                                    }
+                                }
+                            }
+                        }
+                    }
+
+                    for (int outIndexX = 0; outIndexX < outputWidth; ++outIndexX) {
+                        for (int lane = 0; lane < blockSize; ++lane) {
+                            std::size_t channel = static_cast<std::size_t>(outputBlock * blockSize + lane);
+                            ResultType value = accumulator[static_cast<std::size_t>(outIndexX) * blockSize + lane];
+                            output(outputBlock, outIndexY, outIndexX, lane) = channel >= static_cast<std::size_t>(outputChannels)
+                                ? static_cast<OutputType>(0)
+                                : (isIdentity ? static_cast<OutputType>(value) : epilogue.template apply<OutputType>(value, channel));
+                        }
+                    }
+                }
+            }
+        });
+    }
+
+
+    template <typename T, typename O, typename R>
+    void convolve2DBlocked(
+        const xt::xexpression<T>& inputExpression,
+        const xt::xexpression<O>& kernelExpression,
+        const xvigra::KernelOptions& optionsY,
+        const xvigra::KernelOptions& optionsX,
+        const xvigra::Epilogue& epilogue,
+        xt::xexpression<R>&& outputExpression
+    ) {
+        convolve2DBlocked(inputExpression, kernelExpression, optionsY, optionsX, epilogue, outputExpression);
+    }
+
+
+    /*
+     * <p>
+     * Calculates the explicit 2-dimensional convolution of a channel blocked input into the given channel blocked
+     * output without any epilogue; see the overload with an epilogue for details.
+     * </p>
+     *
+     * @tparam T derived type of the input xexpression
+     * @tparam O derived type of the kernel xexpression
+     * @tparam R derived type of the output xexpression
+     * @param inputExpression xexpression containing the channel blocked input data
+     * @param rawKernelExpression xexpression containing the kernel data
+     * @param optionsY options along the height
+     * @param optionsX options along the width
+     * @param outputExpression xexpression which receives the channel blocked result of the 2-dimensional convolution
+     * @throws std::invalid_argument for every invalid configuration rejected by the overload with an epilogue
+     */
+    template <typename T, typename O, typename R>
+    void convolve2DBlocked(
+        const xt::xexpression<T>& inputExpression,
+        const xt::xexpression<O>& kernelExpression,
+        const xvigra::KernelOptions& optionsY,
+        const xvigra::KernelOptions& optionsX,
+        xt::xexpression<R>& outputExpression
+    ) {
+        convolve2DBlocked(inputExpression, kernelExpression, optionsY, optionsX, xvigra::Epilogue(), outputExpression);
+    }
+
+
+    template <typename T, typename O, typename R>
+    void convolve2DBlocked(
+        const xt::xexpression<T>& inputExpression,
+        const xt::xexpression<O>& kernelExpression,
+        const xvigra::KernelOptions& optionsY,
+        const xvigra::KernelOptions& optionsX,
+        xt::xexpression<R>&& outputExpression
+    ) {
+        convolve2DBlocked(inputExpression, kernelExpression, optionsY, optionsX, outputExpression);
+    }
+
+
+    /*
+     * <p>
+     * Calculates the explicit 2-dimensional convolution of a channel blocked input and applies the epilogue while
+     * writing into a newly allocated channel blocked xt::xtensor of OutputType; see the overload with an output for
+     * details.
+     * </p>
+     *
+     * @tparam OutputType value type of the result
+     * @tparam T derived type of the input xexpression
+     * @tparam O derived type of the kernel xexpression
+     * @param inputExpression xexpression containing the channel blocked input data
+     * @param rawKernelExpression xexpression containing the kernel data
+     * @param optionsY options along the height
+     * @param optionsX options along the width
+     * @param epilogue bias, scale, clipping and rounding which are applied to the result
+     * @return the post processed channel blocked result of the 2-dimensional convolution as xt::xtensor of OutputType
+     * @throws std::invalid_argument for every invalid configuration rejected by the overload with an output
+     */
+    template <typename OutputType, typename T, typename O>
+    Tensor4D<OutputType> convolve2DBlocked(
+        const xt::xexpression<T>& inputExpression,
+        const xt::xexpression<O>& kernelExpression,
+        const xvigra::KernelOptions& optionsY,
+        const xvigra::KernelOptions& optionsX,
+        const xvigra::Epilogue& epilogue
+    ) {
+        Tensor4D<OutputType> result;
+        convolve2DBlocked(inputExpression, kernelExpression, optionsY, optionsX, epilogue, result);
+        return result;
+    }
+
+
+    /*
+     * <p>
+     * Calculates the explicit 2-dimensional convolution of a channel blocked input into a newly allocated channel
+     * blocked xt::xtensor of the accumulation type; see the overload with an output for details.
+     * </p>
+     *
+     * @tparam T derived type of the input xexpression
+     * @tparam O derived type of the kernel xexpression
+     * @param inputExpression xexpression containing the channel blocked input data
+     * @param rawKernelExpression xexpression containing the kernel data
+     * @param optionsY options along the height
+     * @param optionsX options along the width
+     * @return the channel blocked result of the 2-dimensional convolution
+     * @throws std::invalid_argument for every invalid configuration rejected by the overload with an output
+     */
+    template <typename T, typename O>
+    auto convolve2DBlocked(
+        const xt::xexpression<T>& inputExpression,
+        const xt::xexpression<O>& kernelExpression,
+        const xvigra::KernelOptions& optionsY,
+        const xvigra::KernelOptions& optionsX
+    ) {
+        using InputType = typename xt::xexpression<T>::derived_type::value_type;
+        using KernelType = xvigra::AccumulationType<typename xt::xexpression<O>::derived_type::value_type>;
+        using ResultType = xvigra::AccumulationType<std::common_type_t<InputType, KernelType>>;
+
+        Tensor4D<ResultType> result;
+        convolve2DBlocked(inputExpression, kernelExpression, optionsY, optionsX, result);
+        return result;
+    }
+
+
+    template <typename T, typename O>
+    inline auto convolve2DBlocked(
+        const xt::xexpression<T>& inputExpression,
+        const xt::xexpression<O>& kernelExpression,
+        const xvigra::KernelOptions2D& options2D
+    ) {
+        return convolve2DBlocked(inputExpression, kernelExpression, options2D.optionsY, options2D.optionsX);
+    }
+
+
+    template <typename T, typename O, typename R>
+    inline void convolve2DBlocked(
+        const xt::xexpression<T>& inputExpression,
+        const xt::xexpression<O>& kernelExpression,
+        const xvigra::KernelOptions2D& options2D,
+        xt::xexpression<R>& outputExpression
+    ) {
+        convolve2DBlocked(inputExpression, kernelExpression, options2D.optionsY, options2D.optionsX, outputExpression);
+    }
+
+
+    template <typename T, typename O, typename R>
+    inline void convolve2DBlocked(
+        const xt::xexpression<T>& inputExpression,
+        const xt::xexpression<O>& kernelExpression,
+        const xvigra::KernelOptions2D& options2D,
+        xt::xexpression<R>&& outputExpression
+    ) {
+        convolve2DBlocked(inputExpression, kernelExpression, options2D, outputExpression);
+    }
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ convolve2DBlocked - end                                                                                          ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ convolveND - begin                                                                                               ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    /*
+     * <p>
+     * Calculates the explicit N-dimensional convolution of the input with the given N-dimensional kernel based on the
+     * GEMM-based algorithm of Chellapilla K., Puri S. and Simard P. .
+     * This function requires an input of shape D_N x ... x D_1 x C or C x D_N x ... x D_1 and a kernel without channel
+     * axes (N dimensions), with input channels (N + 1 dimensions) or a full filter of N + 2 dimensions; for N > 1 a
+     * 1-dimensional kernel is used along every axis. Missing kernel dimensions are inserted by
+     * xvigra::promoteKernelToFullND.
+     * This function can only process ChannelPosition::FIRST or ChannelPosition::LAST inputs.
+     * Every axis has its own options with the same padding, stride, dilation and border semantics as
+     * xvigra::convolve1D and xvigra::convolve2D, and Algorithm::GEMM yields the same results as these. For N = 1 and
+     * N = 2 every other algorithm is forwarded to them; for N > 2 only the GEMM algorithm is available, which
+     * Algorithm::AUTO resolves to.
+     * The rank is a template parameter, so all index arrays have a fixed size and the loops over the axes are
+     * unrolled by the compiler. Every axis resolves its borders once with xvigra::calculateGatherIndices.
+     * The im2col patch is built in tiles of output rows (all indices except the innermost one) which stay below the
+     * workspace limit of the first options. The patch memory is drawn from the workspace of the first options or
+     * xvigra::threadLocalWorkspace if none is set.
+     * Groups and kernels without channel axes behave as in xvigra::convolve2D: the groups are spread over the threads
+     * and read and write their channel range in place.
+     * The input is read in place through its data pointer and strides (see xvigra::evaluateStrided), and the result is
+     * written into the given output, see xvigra::prepareConvolutionOutput. The epilogue is applied to every output
+     * tile right after it is computed.
+     * </p>
+     *
+     * @tparam N number of non-channel dimensions in the input
+     * @tparam O derived type of the input xexpression
+     * @tparam T derived type of the kernel xexpression
+     * @tparam R derived type of the output xexpression
+     * @param inputExpression xexpression containing the input data
+     * @param kernelExpression xexpression containing the kernel data
+     * @param kernelOptions array of options for each dimension, from the outermost to the innermost, containing
+                            independent information about padding, stride, dilation and border treatment
+     * @param epilogue bias, scale, clipping and rounding which are applied to the result before it is converted to
+                       the value type of the output
+     * @param outputExpression xexpression which receives the result of the N-dimensional convolution
+     * @throws std::invalid_argument * if input does not match the required shape
+                                     * if IMPLICIT channel position is requested.
+                                     * if the channel positions, algorithms or groups of the options differ
+                                     * if another algorithm than GEMM or AUTO is requested for N > 2
+                                     * if the input channels in the input and kernel do not align
+                                     * if the padded input is smaller than the dilated kernel
+                                     * if the groups are less than 1 or don't divide the input or output channels
+                                     * if the groups of a kernel without channel axes are neither 1 nor IC
+                                     * if the bias of the epilogue does not match the output channels
+                                     * if the output does not have the shape of the result
+     */
+    template <std::size_t N, typename T, typename O, typename R>
+    void convolveND(
+        const xt::xexpression<T>& inputExpression,
+        const xt::xexpression<O>& kernelExpression,
+        const std::array<xvigra::KernelOptions, N>& kernelOptions,
+        const xvigra::Epilogue& epilogue,
+        xt::xexpression<R>& outputExpression
+    ) {
+        static_assert(0 < N, "convolveND(): Need at least 1 non-channel dimension!");
+
+        using InputContainerType = typename xt::xexpression<T>::derived_type;
+        using InputType = typename InputContainerType::value_type;
+        using KernelContainerType = typename xt::xexpression<O>::derived_type;
+        using KernelType = xvigra::AccumulationType<typename KernelContainerType::value_type>;
+        using ResultType = xvigra::AccumulationType<std::common_type_t<InputType, KernelType>>;
+
+        using OutputType = typename xt::xexpression<R>::derived_type::value_type;
+
+        const auto& input = inputExpression.derived_cast();
+        auto& output = outputExpression.derived_cast();
+        const xvigra::KernelOptions& options = kernelOptions[0];
+
+        for (std::size_t axis = 1; axis < N; ++axis) {
+            if (kernelOptions[axis].channelPosition != options.channelPosition) {
+                throw std::invalid_argument("convolveND(): Channel can't be on different positions for the options of different axes!");
+            }
+
+            if (kernelOptions[axis].algorithm != options.algorithm) {
+                throw std::invalid_argument("convolveND(): Algorithm can't be different for the options of different axes!");
+            }
+
+            if (kernelOptions[axis].groups != options.groups) {
+                throw std::invalid_argument("convolveND(): Groups can't be different for the options of different axes!");
+            }
+        }
+
+        if (options.channelPosition == xvigra::ChannelPosition::IMPLICIT) {
+            throw std::invalid_argument(
+                "convolveND(): Implicit channel option is not supported for explicit channels in input!"
+            );
+        }
+
+        if (options.channelPosition == xvigra::ChannelPosition::BLOCKED) {
+            throw std::invalid_argument(
+                "convolveND(): Blocked channel option is only supported by convolve2DBlocked!"
+            );
+        }
+
+        if (input.dimension() != N + 1) {
+            throw std::invalid_argument("convolveND(): Number of dimensions of input does not match the given non-channel dimension template parameter!");
+        }
+
+        // the direct, Winograd and FFT backends only exist for 1 and 2 dimensions
+        if constexpr (N == 1) {
+            if (options.algorithm != xvigra::Algorithm::GEMM) {
+                convolve1D(input, kernelExpression.derived_cast(), options, epilogue, output);
+                return;
+            }
+        } else if constexpr (N == 2) {
+            if (options.algorithm != xvigra::Algorithm::GEMM) {
+                convolve2D(input, kernelExpression.derived_cast(), kernelOptions[0], kernelOptions[1], epilogue, output);
+                return;
+            }
+        } else {
+            if (options.algorithm != xvigra::Algorithm::GEMM && options.algorithm != xvigra::Algorithm::AUTO) {
+                throw std::invalid_argument("convolveND(): Only the GEMM algorithm is supported for more than 2 dimensions!");
+            }
+        }
+
+        bool isChannelFirst = options.channelPosition == xvigra::ChannelPosition::FIRST;
+        std::size_t channelAxis = isChannelFirst ? 0 : N;
+        std::size_t firstAxis = isChannelFirst ? 1 : 0;
+        std::size_t lastAxis = firstAxis + N - 1;
+
+        int inputChannels = static_cast<int>(input.shape()[channelAxis]);
+        std::array<int, N> inputSizes;
+        for (std::size_t axis = 0; axis < N; ++axis) {
+            inputSizes[axis] = static_cast<int>(input.shape()[firstAxis + axis]);
+        }
+
+        // Groups
+        // a kernel without channel axes is promoted to a diagonal filter, which is exactly a depthwise convolution
+        const auto& rawKernel = kernelExpression.derived_cast();
+        int groups = rawKernel.dimension() <= N ? inputChannels : options.groups;
+
+        if (options.groups < 1) {
+            throw std::invalid_argument("convolveND(): Need at least 1 group!");
+        }
+
+        if (rawKernel.dimension() <= N && options.groups != 1 && options.groups != inputChannels) {
+            throw std::invalid_argument("convolveND(): Kernel without channel axes needs 1 group or one group per input channel!");
+        }
+
+        if (1 < groups) {
+            if (inputChannels % groups != 0) {
+                throw std::invalid_argument("convolveND(): Input channels are not divisible by the number of groups!");
+            }
+
+            // a kernel without output channel axis is promoted for a single group and shared by all groups
+            int groupInputChannels = inputChannels / groups;
+            bool isSharedKernel = rawKernel.dimension() != N + 2;
+            xt::xtensor<KernelType, N + 2> groupedKernel = xvigra::promoteKernelToFullND<N>(rawKernel, groupInputChannels);
+
+            if (groupInputChannels != static_cast<int>(groupedKernel.shape()[1])) {
+                throw std::invalid_argument("convolveND(): Input channels of input and kernel do not align!");
+            }
+
+            if (!isSharedKernel && groupedKernel.shape()[0] % groups != 0) {
+                throw std::invalid_argument("convolveND(): Output channels are not divisible by the number of groups!");
+            }
+
+            int groupOutputChannels = static_cast<int>(groupedKernel.shape()[0]) / (isSharedKernel ? 1 : groups);
+            int outputChannels = groups * groupOutputChannels;
+
+            std::array<std::size_t, N + 1> outputShape;
+            outputShape[channelAxis] = static_cast<std::size_t>(outputChannels);
+
+            for (std::size_t axis = 0; axis < N; ++axis) {
+                int kernelSize = static_cast<int>(groupedKernel.shape()[2 + axis]);
+
+                if (inputSizes[axis] + kernelOptions[axis].paddingTotal() < (kernelSize - 1) * kernelOptions[axis].dilation + 1) {
+                    throw std::invalid_argument("convolveND(): Kernel is greater than padded input along axis " + std::to_string(axis) + "!");
+                }
+
+                outputShape[firstAxis + axis] = static_cast<std::size_t>(xvigra::calculateOutputSize(inputSizes[axis], kernelSize, kernelOptions[axis]));
+            }
+
+            xvigra::prepareConvolutionOutput(output, outputShape, "convolveND()");
+            xvigra::checkEpilogue(epilogue, static_cast<std::size_t>(outputChannels), "convolveND()");
+
+            // the groups are spread over the threads, and every group gets an equal share of the threads which are left
+            int threadCount = xvigra::resolveThreadCount(options.threadCount);
+            int groupThreadCount = std::max(1, threadCount / std::min(threadCount, groups));
+            decltype(auto) contiguousInput = xvigra::evaluateContiguous<N + 1>(input);
+
+            // input and output of a group are adaptors of their channel range, so every group is read and written in
+            // place; only an output which is no row major container receives the result in one assignment at the end
+            auto convolveGroups = [&](auto& target) {
+                xvigra::parallelFor(0, groups, threadCount, [&](int groupBegin, int groupEnd) {
+                    std::array<xvigra::KernelOptions, N> groupOptions = kernelOptions;
+
+                    for (auto& axisOptions : groupOptions) {
+                        axisOptions.setGroups(1);
+                        axisOptions.setThreadCount(groupThreadCount);
+
+                        // a workspace of the options belongs to the calling thread, the other threads use their own
+                        if (groupBegin != 0) {
+                            axisOptions.setWorkspace(nullptr);
+                        }
+                    }
+
+                    for (int group = groupBegin; group < groupEnd; ++group) {
+                        std::size_t inputBegin = static_cast<std::size_t>(group * groupInputChannels);
+                        std::size_t outputBegin = static_cast<std::size_t>(group * groupOutputChannels);
+                        int kernelBegin = isSharedKernel ? 0 : group * groupOutputChannels;
+                        xt::xstrided_slice_vector kernelSlice(N + 2, xt::all());
+                        kernelSlice[0] = xt::range(kernelBegin, kernelBegin + groupOutputChannels);
+                        xt::xtensor<KernelType, N + 2> groupKernel = xt::strided_view(groupedKernel, kernelSlice);
+
+                        auto groupOutput = xvigra::adaptChannelRange<N + 1>(target, channelAxis, outputBegin, static_cast<std::size_t>(groupOutputChannels));
+                        convolveND<N>(
+                            xvigra::adaptChannelRange<N + 1>(contiguousInput, channelAxis, inputBegin, static_cast<std::size_t>(groupInputChannels)),
+                            groupKernel,
+                            groupOptions,
+                            xvigra::sliceEpilogue(epilogue, outputBegin, static_cast<std::size_t>(groupOutputChannels)),
+                            groupOutput
+                        );
+                    }
+                });
+            };
+
+            using OutputContainerType = std::decay_t<decltype(output)>;
+            if constexpr (std::is_base_of_v<xt::xcontainer<OutputContainerType>, OutputContainerType> && OutputContainerType::static_layout == xt::layout_type::row_major) {
+                convolveGroups(output);
+            } else {
+                xt::xtensor<typename OutputContainerType::value_type, N + 1> result = xt::zeros<typename OutputContainerType::value_type>(output.shape());
+                convolveGroups(result);
+                xt::noalias(output) = result;
+            }
+
+            return;
+        }
+
+        // Kernel
+        decltype(auto) kernel = xvigra::resolveFullKernel<N, KernelType>(rawKernel, static_cast<std::size_t>(inputChannels));
+
+        int outputChannels = static_cast<int>(kernel.shape()[0]);
+
+        if (inputChannels != static_cast<int>(kernel.shape()[1])) {
+            throw std::invalid_argument("convolveND(): Input channels of input and kernel do not align!");
+        }
+
+        std::array<int, N> kernelSizes;
+        std::array<int, N> outputSizes;
+        std::array<std::vector<int>, N> gatherIndices;
+        std::array<std::size_t, N + 1> outputShape;
+        outputShape[channelAxis] = static_cast<std::size_t>(outputChannels);
+
+        for (std::size_t axis = 0; axis < N; ++axis) {
+            const xvigra::KernelOptions& axisOptions = kernelOptions[axis];
+            kernelSizes[axis] = static_cast<int>(kernel.shape()[2 + axis]);
+
+            if (inputSizes[axis] + axisOptions.paddingTotal() < (kernelSizes[axis] - 1) * axisOptions.dilation + 1) {
+                throw std::invalid_argument("convolveND(): Kernel is greater than padded input along axis " + std::to_string(axis) + "!");
+            }
+
+            outputSizes[axis] = xvigra::calculateOutputSize(inputSizes[axis], kernelSizes[axis], axisOptions);
+            outputShape[firstAxis + axis] = static_cast<std::size_t>(outputSizes[axis]);
+
+            // a tap reads the input at the gathered indices unless one of them is marked as constant border;
+            // the channel last patch of xvigra::convolve1D reflects the begin border shifted by one position,
+            // which is mirrored here as in its direct backend to keep both functions in agreement
+            xvigra::KernelOptions gatherOptions = axisOptions;
+
+            if constexpr (N == 1) {
+                if (!isChannelFirst) {
+                    gatherOptions = xvigra::channelLastLineOptions(axisOptions);
+                }
+            }
+
+            gatherIndices[axis] = xvigra::calculateGatherIndices(inputSizes[axis], kernelSizes[axis], gatherOptions);
+        }
+
+        xvigra::prepareConvolutionOutput(output, outputShape, "convolveND()");
+        xvigra::checkEpilogue(epilogue, static_cast<std::size_t>(outputChannels), "convolveND()");
+
+        // the innermost axis is copied row by row, only its border strips need a look at every index
+        const xvigra::KernelOptions& optionsX = kernelOptions[N - 1];
+        int kernelWidth = kernelSizes[N - 1];
+        int outputWidth = outputSizes[N - 1];
+        int interiorBeginX;
+        int interiorEndX;
+        std::tie(interiorBeginX, interiorEndX) = xvigra::calculateInteriorRange(inputSizes[N - 1], kernelWidth, optionsX);
+        std::vector<std::pair<int, int>> borderRangesX{{0, interiorBeginX}, {interiorEndX, outputWidth}};
+
+        int kernelVolume = 1;
+        int outputRows = 1;
+        for (std::size_t axis = 0; axis < N; ++axis) {
+            kernelVolume *= kernelSizes[axis];
+            outputRows *= axis + 1 < N ? outputSizes[axis] : 1;
+        }
+
+        // splits an output row into the indices of the outer axes, the innermost entry is left to the caller
+        auto decomposeRow = [&](int row) {
+            std::array<int, N> outIndex{};
+            for (std::size_t axis = N - 1; 0 < axis; --axis) {
+                outIndex[axis - 1] = row % outputSizes[axis - 1];
+                row /= outputSizes[axis - 1];
+            }
+            return outIndex;
+        };
+
+        // splits a tap of the kernel volume into the kernel index of every axis
+        auto decomposeTap = [&](int tap) {
+            std::array<int, N> kernelIndex{};
+            for (std::size_t axis = N; 0 < axis; --axis) {
+                kernelIndex[axis - 1] = tap % kernelSizes[axis - 1];
+                tap /= kernelSizes[axis - 1];
+            }
+            return kernelIndex;
+        };
+
+        // input and output are accessed through their data pointer and strides, so strided views and the channel
+        // ranges of the groups are neither copied nor indexed element by element
+        decltype(auto) stridedInput = xvigra::evaluateStrided<N + 1>(input);
+        const InputType* inputData = stridedInput.data() + stridedInput.data_offset();
+        std::array<std::ptrdiff_t, N + 1> inputStrides;
+        for (std::size_t axis = 0; axis < N + 1; ++axis) {
+            inputStrides[axis] = static_cast<std::ptrdiff_t>(stridedInput.strides()[axis]);
+        }
+
+        // adds the input offsets of the outer axes; returns the first axis with a constant border or N - 1
+        auto gatherOuterOffset = [&](const std::array<int, N>& outIndex, const std::array<int, N>& kernelIndex, std::ptrdiff_t& inputOffset) {
+            for (std::size_t axis = 0; axis + 1 < N; ++axis) {
+                int index = gatherIndices[axis][static_cast<std::size_t>(kernelIndex[axis]) * outputSizes[axis] + outIndex[axis]];
+
+                if (index < 0) {
+                    return std::make_pair(axis, index);
+                }
+                inputOffset += index * inputStrides[firstAxis + axis];
+            }
+            return std::make_pair(N - 1, 0);
+        };
+
+        // an output without data interface receives the result in one assignment at the end
+        using OutputContainerType = std::decay_t<decltype(output)>;
+        constexpr bool isStridedOutput = xt::has_data_interface<OutputContainerType>::value;
+        xt::xtensor<OutputType, N + 1> stridedResult;
+        OutputType* outputData;
+        std::array<std::ptrdiff_t, N + 1> outputStrides;
+
+        if constexpr (isStridedOutput) {
+            outputData = output.data() + output.data_offset();
+        } else {
+            stridedResult.resize(outputShape);
+            outputData = stridedResult.data();
+        }
+
+        for (std::size_t axis = 0; axis < N + 1; ++axis) {
+            if constexpr (isStridedOutput) {
+                outputStrides[axis] = static_cast<std::ptrdiff_t>(output.strides()[axis]);
+            } else {
+                outputStrides[axis] = static_cast<std::ptrdiff_t>(stridedResult.strides()[axis]);
+            }
+        }
+
+        // the patch is built and multiplied in tiles of output rows, so that it never exceeds the workspace limit
+        int patchColumns = inputChannels * kernelVolume;
+        int patchRowSize = patchColumns * outputWidth;
+        int tileRows = xvigra::calculateTileSize(options.workspaceLimit, patchRowSize * sizeof(ResultType), outputRows);
+
+        // the patch, the product and the kernel matrix share one allocation from the workspace, which is sized for the
+        // largest tile and reused by every tile
+        std::size_t patchSize = static_cast<std::size_t>(patchRowSize) * tileRows;
+        std::size_t largestProductSize = static_cast<std::size_t>(outputChannels) * outputWidth * tileRows;
+        xvigra::Workspace& workspace = xvigra::resolveWorkspace(options.workspace);
+        xvigra::Workspace::Scope workspaceScope(workspace);
+        ResultType* patchData = workspace.allocate<ResultType>(patchSize + largestProductSize + kernel.size());
+        ResultType* productData = patchData + patchSize;
+        auto kernelMatrix = xvigra::packKernelMatrix<ResultType>(kernel, !isChannelFirst, productData + largestProductSize);
+
+        bool isIdentityEpilogue = epilogue.template isIdentity<OutputType, ResultType>();
+
+        for (int tileBegin = 0; tileBegin < outputRows; tileBegin += tileRows) {
+            int tileEnd = std::min(tileBegin + tileRows, outputRows);
+            int currentTileRows = tileEnd - tileBegin;
+            std::size_t tilePixels = static_cast<std::size_t>(currentTileRows) * outputWidth;
+            std::size_t productSize = static_cast<std::size_t>(outputChannels) * tilePixels;
+            std::array<std::size_t, 2> productShape = isChannelFirst
+                ? std::array<std::size_t, 2>{static_cast<std::size_t>(outputChannels), tilePixels}
+                : std::array<std::size_t, 2>{tilePixels, static_cast<std::size_t>(outputChannels)};
+            auto product = xt::adapt(productData, productSize, xt::no_ownership(), productShape);
+
+            if (isChannelFirst) {
+                // every kernel tap fills its own row of the patch, so the taps are distributed over the threads
+                xvigra::parallelFor(0, patchColumns, options.threadCount, [&](int tapBegin, int tapEnd) {
+                    for (int tap = tapBegin; tap < tapEnd; ++tap) {
+                        std::array<int, N> kernelIndex = decomposeTap(tap % kernelVolume);
+                        const int* indicesX = gatherIndices[N - 1].data() + static_cast<std::size_t>(kernelIndex[N - 1]) * outputWidth;
+                        std::ptrdiff_t channelOffset = (tap / kernelVolume) * inputStrides[channelAxis];
+                        std::ptrdiff_t strideX = inputStrides[lastAxis];
+
+                        for (int row = tileBegin; row < tileEnd; ++row) {
+                            ResultType* patchRow = patchData + (static_cast<std::size_t>(tap) * currentTileRows + (row - tileBegin)) * outputWidth;
+                            std::ptrdiff_t rowOffset = channelOffset;
+                            auto [constantAxis, constantIndex] = gatherOuterOffset(decomposeRow(row), kernelIndex, rowOffset);
+
+                            if (constantAxis + 1 < N) {
+                                std::fill(patchRow, patchRow + outputWidth, xvigra::gatherConstant<InputType, ResultType>(kernelOptions[constantAxis], constantIndex));
+                                continue;
+                            }
+
+                            const InputType* inputRow = inputData + rowOffset;
+
+                            // interior
+                            if (interiorBeginX < interiorEndX) {
+                                xvigra::convertRow(
+                                    inputRow + indicesX[interiorBeginX] * strideX,
+                                    strideX * optionsX.stride,
+                                    patchRow + interiorBeginX,
+                                    static_cast<std::size_t>(interiorEndX - interiorBeginX)
+                                );
+                            }
+
+                            // border strips
+                            for (const auto& [rangeBegin, rangeEnd] : borderRangesX) {
+                                for (int outIndexX = rangeBegin; outIndexX < rangeEnd; ++outIndexX) {
+                                    int indexX = indicesX[outIndexX];
+
+                                    if (indexX < 0) {
+                                        patchRow[outIndexX] = xvigra::gatherConstant<InputType, ResultType>(optionsX, indexX);
+                                    } else {
+                                        patchRow[outIndexX] = static_cast<ResultType>(inputRow[indexX * strideX]);
+                                    }
+                                }
+                            }
+                        }
+                    }
+                });
+
+                auto patch = xt::adapt(patchData, static_cast<std::size_t>(patchRowSize) * currentTileRows, xt::no_ownership(), std::array<std::size_t, 2>{static_cast<std::size_t>(patchColumns), static_cast<std::size_t>(currentTileRows) * outputWidth});
+                xvigra::matrixProduct(kernelMatrix, patch, product, options.threadCount);
+            } else {
+                // every output row fills its own rows of the patch, so the rows are distributed over the threads
+                xvigra::parallelFor(tileBegin, tileEnd, options.threadCount, [&](int rowBegin, int rowEnd) {
+                    for (int row = rowBegin; row < rowEnd; ++row) {
+                        std::array<int, N> outIndex = decomposeRow(row);
+                        ResultType* patchRow = patchData + static_cast<std::size_t>(row - tileBegin) * patchRowSize;
+
+                        for (int kernelTap = 0; kernelTap < kernelVolume; ++kernelTap) {
+                            std::array<int, N> kernelIndex = decomposeTap(kernelTap);
+                            const int* indicesX = gatherIndices[N - 1].data() + static_cast<std::size_t>(kernelIndex[N - 1]) * outputWidth;
+
+                            std::ptrdiff_t pixelOffset = 0;
+                            auto [constantAxis, constantIndex] = gatherOuterOffset(outIndex, kernelIndex, pixelOffset);
+
+                            for (int outIndexX = 0; outIndexX < outputWidth; ++outIndexX) {
+                                int indexX = indicesX[outIndexX];
+                                ResultType* target = patchRow + static_cast<std::size_t>(outIndexX) * patchColumns + kernelTap;
+
+                                if (constantAxis + 1 < N || indexX < 0) {
+                                    ResultType value = constantAxis + 1 < N
+                                        ? xvigra::gatherConstant<InputType, ResultType>(kernelOptions[constantAxis], constantIndex)
+                                        : xvigra::gatherConstant<InputType, ResultType>(optionsX, indexX);
+
+                                    for (int inputChannel = 0; inputChannel < inputChannels; ++inputChannel) {
+                                        target[inputChannel * kernelVolume] = value;
+                                    }
+                                    continue;
+                                }
+
+                                const InputType* inputPixel = inputData + pixelOffset + indexX * inputStrides[lastAxis];
+
+                                for (int inputChannel = 0; inputChannel < inputChannels; ++inputChannel) {
+                                    target[inputChannel * kernelVolume] = static_cast<ResultType>(inputPixel[inputChannel * inputStrides[channelAxis]]);
+                                }
+                            }
+                        }
+                    }
+                });
+
+                auto patch = xt::adapt(patchData, static_cast<std::size_t>(patchRowSize) * currentTileRows, xt::no_ownership(), std::array<std::size_t, 2>{static_cast<std::size_t>(currentTileRows) * outputWidth, static_cast<std::size_t>(patchColumns)});
+                xvigra::matrixProduct(patch, kernelMatrix, product, options.threadCount);
+            }
+
+            // the product holds the tile as OC x (rows * W) or (rows * W) x OC, which is scattered row by row while the
+            // epilogue is applied
+            xvigra::parallelFor(tileBegin, tileEnd, options.threadCount, [&](int rowBegin, int rowEnd) {
+                for (int row = rowBegin; row < rowEnd; ++row) {
+                    std::array<int, N> outIndex = decomposeRow(row);
+                    std::ptrdiff_t rowOffset = 0;
+                    for (std::size_t axis = 0; axis + 1 < N; ++axis) {
+                        rowOffset += outIndex[axis] * outputStrides[firstAxis + axis];
+                    }
+
+                    std::size_t productOffset = static_cast<std::size_t>(row - tileBegin) * outputWidth;
+
+                    for (int outputChannel = 0; outputChannel < outputChannels; ++outputChannel) {
+                        OutputType* outputRow = outputData + rowOffset + outputChannel * outputStrides[channelAxis];
+
+                        for (int outIndexX = 0; outIndexX < outputWidth; ++outIndexX) {
+                            ResultType value = isChannelFirst
+                                ? product(outputChannel, productOffset + outIndexX)
+                                : product(productOffset + outIndexX, outputChannel);
+
+                            if (isIdentityEpilogue) {
+                                outputRow[outIndexX * outputStrides[lastAxis]] = static_cast<OutputType>(value);
+                            } else {
+                                outputRow[outIndexX * outputStrides[lastAxis]] = epilogue.template apply<OutputType>(value, static_cast<std::size_t>(outputChannel));
+                            }
+                        }
+                    }
+                }
+            });
+        }
+
+        if constexpr (!isStridedOutput) {
+            xt::noalias(output) = stridedResult;
+        }
+    }
+
+
+    template <std::size_t N, typename T, typename O, typename R>
+    void convolveND(
+        const xt::xexpression<T>& inputExpression,
+        const xt::xexpression<O>& kernelExpression,
+        const std::array<xvigra::KernelOptions, N>& kernelOptions,
+        const xvigra::Epilogue& epilogue,
+        xt::xexpression<R>&& outputExpression
+    ) {
+        convolveND<N>(inputExpression, kernelExpression, kernelOptions, epilogue, outputExpression);
+    }
+
+
+    /*
+     * <p>
+     * Calculates the explicit N-dimensional convolution of the input with the given N-dimensional kernel into the
+     * given output without any epilogue; see the overload with an epilogue for details.
+     * </p>
+     *
+     * @tparam N number of non-channel dimensions in the input
+     * @tparam O derived type of the input xexpression
+     * @tparam T derived type of the kernel xexpression
+     * @tparam R derived type of the output xexpression
+     * @param inputExpression xexpression containing the input data
+     * @param kernelExpression xexpression containing the kernel data
+     * @param kernelOptions array of options for each dimension, from the outermost to the innermost
+     * @param outputExpression xexpression which receives the result of the N-dimensional convolution
+     * @throws std::invalid_argument for every invalid configuration rejected by the overload with an epilogue
+     */
+    template <std::size_t N, typename T, typename O, typename R>
+    void convolveND(
+        const xt::xexpression<T>& inputExpression,
+        const xt::xexpression<O>& kernelExpression,
+        const std::array<xvigra::KernelOptions, N>& kernelOptions,
+        xt::xexpression<R>& outputExpression
+    ) {
+        convolveND<N>(inputExpression, kernelExpression, kernelOptions, xvigra::Epilogue(), outputExpression);
+    }
+
+
+    template <std::size_t N, typename T, typename O, typename R>
+    void convolveND(
+        const xt::xexpression<T>& inputExpression,
+        const xt::xexpression<O>& kernelExpression,
+        const std::array<xvigra::KernelOptions, N>& kernelOptions,
+        xt::xexpression<R>&& outputExpression
+    ) {
+        convolveND<N>(inputExpression, kernelExpression, kernelOptions, outputExpression);
+    }
+
+
+    /*
+     * <p>
+     * Calculates the explicit N-dimensional convolution of the input with the given N-dimensional kernel and applies
+     * the epilogue while writing into a newly allocated xt::xtensor of OutputType; see the overload with an output for
+     * details.
+     * </p>
+     *
+     * @tparam N number of non-channel dimensions in the input
+     * @tparam OutputType value type of the result
+     * @tparam O derived type of the input xexpression
+     * @tparam T derived type of the kernel xexpression
+     * @param inputExpression xexpression containing the input data
+     * @param kernelExpression xexpression containing the kernel data
+     * @param kernelOptions array of options for each dimension, from the outermost to the innermost
+     * @param epilogue bias, scale, clipping and rounding which are applied to the result
+     * @return the post processed result of the N-dimensional convolution as xt::xtensor of OutputType
+     * @throws std::invalid_argument for every invalid configuration rejected by the overload with an output
+     */
+    template <std::size_t N, typename OutputType, typename T, typename O>
+    xt::xtensor<OutputType, N + 1> convolveND(
+        const xt::xexpression<T>& inputExpression,
+        const xt::xexpression<O>& kernelExpression,
+        const std::array<xvigra::KernelOptions, N>& kernelOptions,
+        const xvigra::Epilogue& epilogue
+    ) {
+        xt::xtensor<OutputType, N + 1> result;
+        convolveND<N>(inputExpression, kernelExpression, kernelOptions, epilogue, result);
+        return result;
+    }
+
+
+    /*
+     * <p>
+     * Calculates the explicit N-dimensional convolution of the input with the given N-dimensional kernel into a newly
+     * allocated xt::xtensor; see the overload with an output for details.
+     * </p>
+     *
+     * @tparam N number of non-channel dimensions in the input
+     * @tparam O derived type of the input xexpression
+     * @tparam T derived type of the kernel xexpression
+     * @param inputExpression xexpression containing the input data
+     * @param kernelExpression xexpression containing the kernel data
+     * @param kernelOptions array of options for each dimension, from the outermost to the innermost
+     * @return the result of the N-dimensional convolution between the input and kernel as xt::xtensor
+     * @throws std::invalid_argument for every invalid configuration rejected by the overload with an output
+     */
+    template <std::size_t N, typename T, typename O>
+    auto convolveND(
+        const xt::xexpression<T>& inputExpression,
+        const xt::xexpression<O>& kernelExpression,
+        const std::array<xvigra::KernelOptions, N>& kernelOptions
+    ) -> xt::xtensor<std::common_type_t<typename T::value_type, typename O::value_type>, N + 1> {
+        xt::xtensor<std::common_type_t<typename T::value_type, typename O::value_type>, N + 1> result;
+        convolveND<N>(inputExpression, kernelExpression, kernelOptions, result);
+        return result;
+    }
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ convolveND - end                                                                                                 ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ convolve3D - begin                                                                                               ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    /*
+     * <p>
+     * Calculates the explicit 3-dimensional convolution of the input with the given 3-dimensional kernel with
+     * xvigra::convolveND.
+     * This function requires an input of shape D x H x W x C or C x D x H x W and a kernel with 1, 3 or 4 dimensions
+     * or a full filter of 5 dimensions, see xvigra::promoteKernelToFull3D.
+     * Every axis has its own options with the same padding, stride, dilation and border semantics as in
+     * xvigra::convolve2D; only the GEMM algorithm is available. The im2col patch is built in tiles of output rows
+     * (pairs of depth and height index) which stay below the workspace limit of optionsZ, so it never holds the whole
+     * volume.
+     * </p>
+     *
+     * @tparam O derived type of the input xexpression
+     * @tparam T derived type of the kernel xexpression
+     * @tparam R derived type of the output xexpression
+     * @param inputExpression xexpression containing the input data
+     * @param kernelExpression xexpression containing the kernel data
+     * @param optionsZ object containing information about padding, stride, dilation, channel position and border
+                       treatment along the depth
+     * @param optionsY options along the height
+     * @param optionsX options along the width
+     * @param outputExpression xexpression which receives the result of the 3-dimensional convolution
+     * @throws std::invalid_argument for every invalid configuration rejected by xvigra::convolveND
+     */
+    template <typename T, typename O, typename R>
+    void convolve3D(
+        const xt::xexpression<T>& inputExpression,
+        const xt::xexpression<O>& kernelExpression,
+        const xvigra::KernelOptions& optionsZ,
+        const xvigra::KernelOptions& optionsY,
+        const xvigra::KernelOptions& optionsX,
+        xt::xexpression<R>& outputExpression
+    ) {
+        convolveND<3>(inputExpression, kernelExpression, std::array<xvigra::KernelOptions, 3>{optionsZ, optionsY, optionsX}, outputExpression);
+    }
+
+
+    template <typename T, typename O, typename R>
+    void convolve3D(
+        const xt::xexpression<T>& inputExpression,
+        const xt::xexpression<O>& kernelExpression,
+        const xvigra::KernelOptions& optionsZ,
+        const xvigra::KernelOptions& optionsY,
+        const xvigra::KernelOptions& optionsX,
+        xt::xexpression<R>&& outputExpression
+    ) {
+        convolve3D(inputExpression, kernelExpression, optionsZ, optionsY, optionsX, outputExpression);
+    }
+
+
+    /*
+     * <p>
+     * Calculates the explicit 3-dimensional convolution of the input with the given 3-dimensional kernel and applies
+     * the epilogue to every output tile, see xvigra::convolveND.
+     * </p>
+     *
+     * @tparam O derived type of the input xexpression
+     * @tparam T derived type of the kernel xexpression
+     * @tparam R derived type of the output xexpression
+     * @param inputExpression xexpression containing the input data
+     * @param kernelExpression xexpression containing the kernel data
+     * @param optionsZ options along the depth
+     * @param optionsY options along the height
+     * @param optionsX options along the width
+     * @param epilogue bias, scale, clipping and rounding which are applied to the result before it is converted to
+                       the value type of the output
+     * @param outputExpression xexpression which receives the result of the 3-dimensional convolution
+     * @throws std::invalid_argument for every invalid configuration rejected by xvigra::convolveND
+     */
+    template <typename T, typename O, typename R>
+    void convolve3D(
+        const xt::xexpression<T>& inputExpression,
+        const xt::xexpression<O>& kernelExpression,
+        const xvigra::KernelOptions& optionsZ,
+        const xvigra::KernelOptions& optionsY,
+        const xvigra::KernelOptions& optionsX,
+        const xvigra::Epilogue& epilogue,
+        xt::xexpression<R>& outputExpression
+    ) {
+        convolveND<3>(inputExpression, kernelExpression, std::array<xvigra::KernelOptions, 3>{optionsZ, optionsY, optionsX}, epilogue, outputExpression);
+    }
+
+
+    template <typename T, typename O, typename R>
+    void convolve3D(
+        const xt::xexpression<T>& inputExpression,
+        const xt::xexpression<O>& kernelExpression,
+        const xvigra::KernelOptions& optionsZ,
+        const xvigra::KernelOptions& optionsY,
+        const xvigra::KernelOptions& optionsX,
+        const xvigra::Epilogue& epilogue,
+        xt::xexpression<R>&& outputExpression
+    ) {
+        convolve3D(inputExpression, kernelExpression, optionsZ, optionsY, optionsX, epilogue, outputExpression);
+    }
+
+
+    /*
+     * <p>
+     * Calculates the explicit 3-dimensional convolution of the input with the given 3-dimensional kernel into a newly
+     * allocated xt::xtensor; see the overload with an output for details.
+     * </p>
+     *
+     * @tparam O derived type of the input xexpression
+     * @tparam T derived type of the kernel xexpression
+     * @param inputExpression xexpression containing the input data
+     * @param kernelExpression xexpression containing the kernel data
+     * @param optionsZ options along the depth
+     * @param optionsY options along the height
+     * @param optionsX options along the width
+     * @return the result of the 3-dimensional convolution between the input and kernel as xt::xtensor
+     * @throws std::invalid_argument for every invalid configuration rejected by the overload with an output
+     */
+    template <typename T, typename O>
+    auto convolve3D(
+        const xt::xexpression<T>& inputExpression,
+        const xt::xexpression<O>& kernelExpression,
+        const xvigra::KernelOptions& optionsZ,
+        const xvigra::KernelOptions& optionsY,
+        const xvigra::KernelOptions& optionsX
+    ) -> Tensor4D<std::common_type_t<typename T::value_type, typename O::value_type>> {
+        Tensor4D<std::common_type_t<typename T::value_type, typename O::value_type>> result;
+        convolve3D(inputExpression, kernelExpression, optionsZ, optionsY, optionsX, result);
+        return result;
+    }
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ convolve3D - end                                                                                                 ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
 } // xvigra
 
 #endif // XVIGRA_EXPLICIT_CONVOLUTION_HPP
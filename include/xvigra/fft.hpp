@@ -0,0 +1,331 @@
+#ifndef XVIGRA_FFT_HPP
+#define XVIGRA_FFT_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace xvigra {
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ forward declaration - begin                                                                                  ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    inline std::size_t nextPowerOfTwo(std::size_t);
+
+    class FFT1D;
+
+    class RealFFT2D;
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ forward declaration - end                                                                                    ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ class FFT1D - begin                                                                                          ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    /*
+     * <p>
+     * Returns the smallest power of two which is greater or equal to the given value; at least 1.
+     * </p>
+     */
+    inline std::size_t nextPowerOfTwo(std::size_t value) {
+        std::size_t result = 1;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    /*
+     * <p>
+     * Iterative radix-2 Cooley-Tukey FFT of complex sequences with a fixed power of two size.
+     * The bit reversal permutation and the twiddle factors are calculated once in the constructor, so that repeated
+     * transforms of the same size only run the butterflies. Neither direction is normalized.
+     * </p>
+     */
+    class FFT1D {
+    private:
+        std::size_t size;
+        std::vector<std::size_t> reversedIndices;
+        std::vector<std::complex<double>> twiddles;
+
+    public:
+        explicit FFT1D(std::size_t);
+
+        std::size_t getSize() const;
+
+        void transform(std::complex<double>*, bool) const;
+    }; // FFT1D
+
+    /*
+     * <p>
+     * Creates the transform for sequences of the given size.
+     * </p>
+     *
+     * @param size length of the transformed sequences
+     * @throws std::invalid_argument if size is not a power of two
+     */
+    FFT1D::FFT1D(std::size_t size)
+    : size(size), reversedIndices(size), twiddles(size / 2) {
+        if (size == 0 || (size & (size - 1)) != 0) {
+            throw std::invalid_argument("FFT1D(): Size has to be a power of two!");
+        }
+
+        std::size_t bits = 0;
+        while ((std::size_t(1) << bits) < size) {
+            ++bits;
+        }
+
+        for (std::size_t index = 0; index < size; ++index) {
+            std::size_t reversed = 0;
+            for (std::size_t bit = 0; bit < bits; ++bit) {
+                reversed |= ((index >> bit) & 1) << (bits - 1 - bit);
+            }
+            this->reversedIndices[index] = reversed;
+        }
+
+        // exp(-2 pi i k / n) is evaluated directly instead of by recurrence to keep the rounding error independent of k
+        const double pi = std::acos(-1.0);
+        for (std::size_t index = 0; index < size / 2; ++index) {
+            this->twiddles[index] = std::polar(1.0, -2.0 * pi * static_cast<double>(index) / static_cast<double>(size));
+        }
+    }
+
+    std::size_t FFT1D::getSize() const {
+        return this->size;
+    }
+
+    /*
+     * <p>
+     * Transforms the sequence in place.
+     * </p>
+     *
+     * @param data pointer to FFT1D#getSize() contiguous values
+     * @param inverse if true, the unnormalized inverse transform is calculated
+     */
+    void FFT1D::transform(std::complex<double>* data, bool inverse) const {
+        for (std::size_t index = 0; index < this->size; ++index) {
+            std::size_t reversed = this->reversedIndices[index];
+            if (index < reversed) {
+                std::swap(data[index], data[reversed]);
+            }
+        }
+
+        for (std::size_t length = 2; length <= this->size; length <<= 1) {
+            std::size_t half = length / 2;
+            std::size_t step = this->size / length;
+
+            for (std::size_t begin = 0; begin < this->size; begin += length) {
+                for (std::size_t offset = 0; offset < half; ++offset) {
+                    std::complex<double> twiddle = this->twiddles[offset * step];
+                    if (inverse) {
+                        twiddle = std::conj(twiddle);
+                    }
+
+                    std::complex<double> even = data[begin + offset];
+                    std::complex<double> odd = data[begin + offset + half] * twiddle;
+                    data[begin + offset] = even + odd;
+                    data[begin + offset + half] = even - odd;
+                }
+            }
+        }
+    }
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ class FFT1D - end                                                                                            ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ class RealFFT2D - begin                                                                                      ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    /*
+     * <p>
+     * Real-to-complex 2-dimensional FFT of a fixed power of two shape H x W.
+     * Since the spectrum of a real image is hermitian, only the H x (W / 2 + 1) non-redundant coefficients are stored.
+     * Two real rows are transformed at once as real and imaginary part of a single complex row, which halves the
+     * work of the row transforms. The inverse transform is normalized, so that RealFFT2D#inverse undoes
+     * RealFFT2D#forward.
+     * A RealFFT2D owns its row and column buffers, so a single instance must not be used concurrently.
+     * </p>
+     */
+    class RealFFT2D {
+    private:
+        std::size_t height;
+        std::size_t width;
+        std::size_t spectrumWidth;
+
+        FFT1D rowTransform;
+        FFT1D columnTransform;
+
+        std::vector<std::complex<double>> rowBuffer;
+        std::vector<std::complex<double>> columnBuffer;
+        std::vector<std::complex<double>> spectrumBuffer;
+
+    public:
+        RealFFT2D(std::size_t, std::size_t);
+
+        std::size_t getHeight() const;
+        std::size_t getWidth() const;
+        std::size_t getSpectrumWidth() const;
+
+        void forward(const double*, std::complex<double>*);
+        void inverse(const std::complex<double>*, double*);
+    }; // RealFFT2D
+
+    /*
+     * <p>
+     * Creates the transform for images of the given shape.
+     * </p>
+     *
+     * @param height number of rows; has to be a power of two
+     * @param width number of columns; has to be a power of two and at least 2
+     * @throws std::invalid_argument if the shape is not supported
+     */
+    RealFFT2D::RealFFT2D(std::size_t height, std::size_t width)
+    : height(height),
+      width(width),
+      spectrumWidth(width / 2 + 1),
+      rowTransform(width),
+      columnTransform(height),
+      rowBuffer(width),
+      columnBuffer(height),
+      spectrumBuffer(height * (width / 2 + 1)) {
+        if (width < 2) {
+            throw std::invalid_argument("RealFFT2D(): Width has to be at least 2!");
+        }
+    }
+
+    std::size_t RealFFT2D::getHeight() const {
+        return this->height;
+    }
+
+    std::size_t RealFFT2D::getWidth() const {
+        return this->width;
+    }
+
+    std::size_t RealFFT2D::getSpectrumWidth() const {
+        return this->spectrumWidth;
+    }
+
+    /*
+     * <p>
+     * Calculates the non-redundant part of the spectrum of a real image.
+     * </p>
+     *
+     * @param input pointer to H x W row-major real values
+     * @param spectrum pointer to H x (W / 2 + 1) row-major complex values receiving the spectrum
+     */
+    void RealFFT2D::forward(const double* input, std::complex<double>* spectrum) {
+        std::complex<double>* buffer = this->rowBuffer.data();
+
+        for (std::size_t row = 0; row < this->height; row += 2) {
+            bool hasPair = row + 1 < this->height;
+            const double* first = input + row * this->width;
+            const double* second = hasPair ? first + this->width : nullptr;
+
+            for (std::size_t x = 0; x < this->width; ++x) {
+                buffer[x] = std::complex<double>(first[x], hasPair ? second[x] : 0.0);
+            }
+
+            this->rowTransform.transform(buffer, false);
+
+            // Z = A + i B with hermitian A and B, so A(k) = (Z(k) + Z*(n - k)) / 2 and B(k) = (Z(k) - Z*(n - k)) / 2i
+            std::complex<double>* firstSpectrum = spectrum + row * this->spectrumWidth;
+            for (std::size_t k = 0; k < this->spectrumWidth; ++k) {
+                std::complex<double> value = buffer[k];
+                std::complex<double> mirrored = std::conj(buffer[(this->width - k) % this->width]);
+
+                firstSpectrum[k] = 0.5 * (value + mirrored);
+                if (hasPair) {
+                    firstSpectrum[this->spectrumWidth + k] = std::complex<double>(0.0, -0.5) * (value - mirrored);
+                }
+            }
+        }
+
+        std::complex<double>* column = this->columnBuffer.data();
+        for (std::size_t k = 0; k < this->spectrumWidth; ++k) {
+            for (std::size_t y = 0; y < this->height; ++y) {
+                column[y] = spectrum[y * this->spectrumWidth + k];
+            }
+
+            this->columnTransform.transform(column, false);
+
+            for (std::size_t y = 0; y < this->height; ++y) {
+                spectrum[y * this->spectrumWidth + k] = column[y];
+            }
+        }
+    }
+
+    /*
+     * <p>
+     * Calculates the real image which belongs to the non-redundant part of a hermitian spectrum.
+     * </p>
+     *
+     * @param spectrum pointer to H x (W / 2 + 1) row-major complex values
+     * @param output pointer to H x W row-major real values receiving the image
+     */
+    void RealFFT2D::inverse(const std::complex<double>* spectrum, double* output) {
+        std::complex<double>* columns = this->spectrumBuffer.data();
+        std::copy(spectrum, spectrum + this->height * this->spectrumWidth, columns);
+
+        std::complex<double>* column = this->columnBuffer.data();
+        for (std::size_t k = 0; k < this->spectrumWidth; ++k) {
+            for (std::size_t y = 0; y < this->height; ++y) {
+                column[y] = columns[y * this->spectrumWidth + k];
+            }
+
+            this->columnTransform.transform(column, true);
+
+            for (std::size_t y = 0; y < this->height; ++y) {
+                columns[y * this->spectrumWidth + k] = column[y];
+            }
+        }
+
+        double scale = 1.0 / static_cast<double>(this->height * this->width);
+        std::complex<double>* buffer = this->rowBuffer.data();
+        const std::complex<double> imaginaryUnit(0.0, 1.0);
+
+        for (std::size_t row = 0; row < this->height; row += 2) {
+            bool hasPair = row + 1 < this->height;
+            const std::complex<double>* first = columns + row * this->spectrumWidth;
+            const std::complex<double>* second = hasPair ? first + this->spectrumWidth : nullptr;
+
+            // both rows are the spectra of real rows, so their upper halves follow from hermitian symmetry
+            for (std::size_t k = 0; k < this->width; ++k) {
+                bool isStored = k < this->spectrumWidth;
+                std::size_t source = isStored ? k : this->width - k;
+
+                std::complex<double> a = isStored ? first[source] : std::conj(first[source]);
+                std::complex<double> b = hasPair
+                    ? (isStored ? second[source] : std::conj(second[source]))
+                    : std::complex<double>(0.0, 0.0);
+
+                buffer[k] = a + imaginaryUnit * b;
+            }
+
+            this->rowTransform.transform(buffer, true);
+
+            double* firstRow = output + row * this->width;
+            for (std::size_t x = 0; x < this->width; ++x) {
+                firstRow[x] = buffer[x].real() * scale;
+                if (hasPair) {
+                    firstRow[this->width + x] = buffer[x].imag() * scale;
+                }
+            }
+        }
+    }
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ class RealFFT2D - end                                                                                        ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+} // xvigra
+
+#endif // XVIGRA_FFT_HPP
@@ -0,0 +1,292 @@
+#ifndef XVIGRA_FFT_CONVOLUTION_HPP
+#define XVIGRA_FFT_CONVOLUTION_HPP
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#ifdef VOID
+#undef VOID
+#endif
+
+#include "xtensor/xtensor.hpp"
+#include "xtensor/xview.hpp"
+
+#include "xvigra/convolution_util.hpp"
+#include "xvigra/epilogue.hpp"
+#include "xvigra/fft.hpp"
+#include "xvigra/thread_util.hpp"
+#include "xvigra/workspace.hpp"
+
+namespace xvigra {
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ fftConvolve2D - begin                                                                                        ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    /*
+     * <p>
+     * Calculates the explicit 2-dimensional convolution by pointwise multiplication in the frequency domain.
+     * Every input channel is padded according to the border treatments, embedded into a power of two image which
+     * holds the padded input without wrap around and transformed by xvigra::RealFFT2D. The products of the input
+     * spectra with the conjugated kernel spectra are summed over the input channels and transformed back once per
+     * output channel. Stride and dilation are supported by sampling the result and by spreading the kernel taps.
+     * The cost per output value grows with the logarithm of the padded input size instead of the kernel size, which
+     * pays off for kernels larger than about 15 x 15.
+     * The output is processed in bands of rows, whose transforms are just high enough to keep the input spectra of
+     * the band within the workspace limit of optionsY, see xvigra::calculateFFTHeight. The kernel spectra are
+     * calculated once for all bands if they fit into the workspace limit as well, and once per band otherwise.
+     * The input and output channels of a band are distributed over the thread count of optionsY, and every output
+     * channel is sampled into a plane of workspace memory, which is written into the output with the epilogue
+     * applied, see xvigra::applyEpilogueTile.
+     * The caller is responsible for the validation of the input and kernel and for the shape of the output; see
+     * xvigra::convolve2D.
+     * </p>
+     * <p>
+     * The transforms are calculated in double for every result type. Their rounding error is spread over the whole
+     * image, so the absolute error of an output value is bounded relative to the largest values of input and kernel
+     * rather than relative to the output value itself. Integral results are rounded to the nearest value.
+     * </p>
+     *
+     * @tparam ResultType value type of the result
+     * @tparam InputContainerType row major container of the input, see xvigra::evaluateContiguous
+     * @tparam R derived type of the output xexpression
+     * @param input input of shape H x W x C or C x H x W
+     * @param kernel full kernel of shape OC x IC x KH x KW
+     * @param optionsY object containing information about padding, stride, dilation, channel position and border
+                       treatment along the height
+     * @param optionsX object containing information about padding, stride, dilation, channel position and border
+                       treatment along the width
+     * @param epilogue bias, scale, clipping and rounding which are applied to the result
+     * @param output output of shape H' x W' x OC or OC x H' x W', which receives the result
+     */
+    template <typename ResultType, typename InputType, typename KernelType, typename InputContainerType, typename R>
+    void fftConvolve2D(
+        const InputContainerType& input,
+        const xt::xtensor<KernelType, 4>& kernel,
+        const xvigra::KernelOptions& optionsY,
+        const xvigra::KernelOptions& optionsX,
+        const xvigra::Epilogue& epilogue,
+        R& output
+    ) {
+        bool isChannelFirst = optionsY.channelPosition == xvigra::ChannelPosition::FIRST;
+
+        std::size_t inputChannels = input.shape()[isChannelFirst ? 0 : 2];
+        std::size_t inputHeight = input.shape()[isChannelFirst ? 1 : 0];
+        std::size_t inputWidth = input.shape()[isChannelFirst ? 2 : 1];
+        std::size_t outputChannels = kernel.shape()[0];
+        std::size_t kernelHeight = kernel.shape()[2];
+        std::size_t kernelWidth = kernel.shape()[3];
+
+        std::size_t outputHeight = static_cast<std::size_t>(
+            xvigra::calculateOutputSize(static_cast<int>(inputHeight), static_cast<int>(kernelHeight), optionsY)
+        );
+        std::size_t outputWidth = static_cast<std::size_t>(
+            xvigra::calculateOutputSize(static_cast<int>(inputWidth), static_cast<int>(kernelWidth), optionsX)
+        );
+
+        std::vector<int> sourceY = xvigra::calculatePaddedSourceIndices(
+            static_cast<int>(inputHeight),
+            static_cast<int>(kernelHeight),
+            optionsY
+        );
+        std::vector<int> sourceX = xvigra::calculatePaddedSourceIndices(
+            static_cast<int>(inputWidth),
+            static_cast<int>(kernelWidth),
+            optionsX
+        );
+
+        double constantBeginY = xvigra::gatherConstant<InputType, double>(optionsY, xvigra::CONSTANT_BEGIN_INDEX);
+        double constantEndY = xvigra::gatherConstant<InputType, double>(optionsY, xvigra::CONSTANT_END_INDEX);
+        double constantBeginX = xvigra::gatherConstant<InputType, double>(optionsX, xvigra::CONSTANT_BEGIN_INDEX);
+        double constantEndX = xvigra::gatherConstant<InputType, double>(optionsX, xvigra::CONSTANT_END_INDEX);
+
+        std::size_t strideY = static_cast<std::size_t>(optionsY.stride);
+        std::size_t strideX = static_cast<std::size_t>(optionsX.stride);
+        std::size_t dilationY = static_cast<std::size_t>(optionsY.dilation);
+        std::size_t dilationX = static_cast<std::size_t>(optionsX.dilation);
+        std::size_t kernelExtentY = (kernelHeight - 1) * dilationY + 1;
+
+        // the kernel only reaches positions o * stride + k * dilation inside of the padded input, so a transform
+        // covering the padded rows of a band leaves every sampled output of the band free of circular wrap around
+        std::size_t fftWidth = xvigra::nextPowerOfTwo(std::max<std::size_t>(sourceX.size(), 2));
+        std::size_t fftHeight = xvigra::calculateFFTHeight(optionsY.workspaceLimit, inputChannels, sourceY.size(), fftWidth, kernelExtentY);
+        std::size_t imageSize = fftHeight * fftWidth;
+        std::size_t spectrumSize = fftHeight * (fftWidth / 2 + 1);
+        std::size_t bandHeight = std::min(outputHeight, (fftHeight - kernelExtentY) / strideY + 1);
+
+        const InputType* in = input.data();
+        std::size_t channelStride = isChannelFirst ? inputHeight * inputWidth : 1;
+        std::size_t pixelStride = isChannelFirst ? 1 : inputChannels;
+
+        xvigra::Workspace& workspace = xvigra::resolveWorkspace(optionsY.workspace);
+        xvigra::Workspace::Scope workspaceScope(workspace);
+        std::complex<double>* inputSpectra = workspace.allocate<std::complex<double>>(inputChannels * spectrumSize);
+
+        // all bands share the shape of the transforms, so the kernel spectra are calculated only once if they fit
+        // into the workspace limit
+        bool isKernelCached = bandHeight < outputHeight
+            && outputChannels * inputChannels * spectrumSize * sizeof(std::complex<double>) <= optionsY.workspaceLimit;
+        std::complex<double>* kernelSpectra = isKernelCached
+            ? workspace.allocate<std::complex<double>>(outputChannels * inputChannels * spectrumSize)
+            : nullptr;
+
+        auto transformKernel = [&](
+            xvigra::RealFFT2D& transform,
+            double* image,
+            std::size_t outputChannel,
+            std::size_t inputChannel,
+            std::complex<double>* spectrum
+        ) {
+            std::fill(image, image + imageSize, 0.0);
+
+            for (std::size_t kernelY = 0; kernelY < kernelHeight; ++kernelY) {
+                for (std::size_t kernelX = 0; kernelX < kernelWidth; ++kernelX) {
+                    image[kernelY * dilationY * fftWidth + kernelX * dilationX] =
+                        static_cast<double>(kernel(outputChannel, inputChannel, kernelY, kernelX));
+                }
+            }
+
+            transform.forward(image, spectrum);
+        };
+
+        if (isKernelCached) {
+            xvigra::parallelFor(0, static_cast<int>(outputChannels), optionsY.threadCount, [&](int channelBegin, int channelEnd) {
+                // the workspace of the options belongs to the calling thread, which runs the first chunk
+                xvigra::Workspace& chunkWorkspace = channelBegin == 0 ? workspace : xvigra::threadLocalWorkspace();
+                xvigra::Workspace::Scope chunkScope(chunkWorkspace);
+                double* image = chunkWorkspace.allocate<double>(imageSize);
+                xvigra::RealFFT2D transform(fftHeight, fftWidth);
+
+                for (std::size_t outputChannel = static_cast<std::size_t>(channelBegin); outputChannel < static_cast<std::size_t>(channelEnd); ++outputChannel) {
+                    for (std::size_t inputChannel = 0; inputChannel < inputChannels; ++inputChannel) {
+                        transformKernel(transform, image, outputChannel, inputChannel, kernelSpectra + (outputChannel * inputChannels + inputChannel) * spectrumSize);
+                    }
+                }
+            });
+        }
+
+        for (std::size_t bandBegin = 0; bandBegin < outputHeight; bandBegin += bandHeight) {
+            std::size_t bandEnd = std::min(bandBegin + bandHeight, outputHeight);
+            std::size_t bandRows = bandEnd - bandBegin;
+
+            // the band reads the padded rows from its first output row times the stride on
+            std::size_t paddedBegin = bandBegin * strideY;
+            std::size_t paddedRows = std::min(fftHeight, sourceY.size() - paddedBegin);
+
+            xvigra::parallelFor(0, static_cast<int>(inputChannels), optionsY.threadCount, [&](int channelBegin, int channelEnd) {
+                // the workspace of the options belongs to the calling thread, which runs the first chunk
+                xvigra::Workspace& chunkWorkspace = channelBegin == 0 ? workspace : xvigra::threadLocalWorkspace();
+                xvigra::Workspace::Scope chunkScope(chunkWorkspace);
+                double* image = chunkWorkspace.allocate<double>(imageSize);
+                xvigra::RealFFT2D transform(fftHeight, fftWidth);
+
+                for (std::size_t inputChannel = static_cast<std::size_t>(channelBegin); inputChannel < static_cast<std::size_t>(channelEnd); ++inputChannel) {
+                    std::fill(image, image + imageSize, 0.0);
+                    const InputType* channel = in + inputChannel * channelStride;
+
+                    for (std::size_t bandY = 0; bandY < paddedRows; ++bandY) {
+                        int inputY = sourceY[paddedBegin + bandY];
+                        double* imageRow = image + bandY * fftWidth;
+
+                        if (inputY < 0) {
+                            // a constant row of the height axis wins over a constant column of the width axis
+                            double constant = inputY == xvigra::CONSTANT_BEGIN_INDEX ? constantBeginY : constantEndY;
+                            std::fill(imageRow, imageRow + sourceX.size(), constant);
+                            continue;
+                        }
+
+                        const InputType* inRow = channel + static_cast<std::size_t>(inputY) * inputWidth * pixelStride;
+
+                        for (std::size_t paddedX = 0; paddedX < sourceX.size(); ++paddedX) {
+                            int inputX = sourceX[paddedX];
+                            imageRow[paddedX] = 0 <= inputX
+                                ? static_cast<double>(inRow[static_cast<std::size_t>(inputX) * pixelStride])
+                                : (inputX == xvigra::CONSTANT_BEGIN_INDEX ? constantBeginX : constantEndX);
+                        }
+                    }
+
+                    transform.forward(image, inputSpectra + inputChannel * spectrumSize);
+                }
+            });
+
+            // every output channel is sampled into a plane of the result type and written through the epilogue
+            xvigra::parallelFor(0, static_cast<int>(outputChannels), optionsY.threadCount, [&](int channelBegin, int channelEnd) {
+                // the workspace of the options belongs to the calling thread, which runs the first chunk
+                xvigra::Workspace& chunkWorkspace = channelBegin == 0 ? workspace : xvigra::threadLocalWorkspace();
+                xvigra::Workspace::Scope chunkScope(chunkWorkspace);
+                double* image = chunkWorkspace.allocate<double>(imageSize);
+                std::complex<double>* accumulator = chunkWorkspace.allocate<std::complex<double>>(spectrumSize);
+                std::complex<double>* kernelSpectrum = isKernelCached ? nullptr : chunkWorkspace.allocate<std::complex<double>>(spectrumSize);
+                ResultType* plane = chunkWorkspace.allocate<ResultType>(bandRows * outputWidth);
+                xvigra::RealFFT2D transform(fftHeight, fftWidth);
+
+                for (std::size_t outputChannel = static_cast<std::size_t>(channelBegin); outputChannel < static_cast<std::size_t>(channelEnd); ++outputChannel) {
+                    std::fill(accumulator, accumulator + spectrumSize, std::complex<double>(0.0, 0.0));
+
+                    for (std::size_t inputChannel = 0; inputChannel < inputChannels; ++inputChannel) {
+                        const std::complex<double>* pairSpectrum = kernelSpectrum;
+
+                        if (isKernelCached) {
+                            pairSpectrum = kernelSpectra + (outputChannel * inputChannels + inputChannel) * spectrumSize;
+                        } else {
+                            transformKernel(transform, image, outputChannel, inputChannel, kernelSpectrum);
+                        }
+
+                        // the conjugated kernel spectrum turns the circular convolution into the correlation of convolve2D
+                        const std::complex<double>* inputSpectrum = inputSpectra + inputChannel * spectrumSize;
+                        for (std::size_t index = 0; index < spectrumSize; ++index) {
+                            accumulator[index] += inputSpectrum[index] * std::conj(pairSpectrum[index]);
+                        }
+                    }
+
+                    transform.inverse(accumulator, image);
+
+                    for (std::size_t bandY = 0; bandY < bandRows; ++bandY) {
+                        const double* imageRow = image + bandY * strideY * fftWidth;
+
+                        for (std::size_t outIndexX = 0; outIndexX < outputWidth; ++outIndexX) {
+                            double value = imageRow[outIndexX * strideX];
+                            ResultType* target = plane + bandY * outputWidth + outIndexX;
+
+                            if constexpr (std::is_integral_v<ResultType>) {
+                                *target = static_cast<ResultType>(std::round(value));
+                            } else {
+                                *target = static_cast<ResultType>(value);
+                            }
+                        }
+                    }
+
+                    if (isChannelFirst) {
+                        xvigra::applyEpilogueTile(
+                            plane,
+                            std::array<std::size_t, 3>{1, bandRows, outputWidth},
+                            epilogue,
+                            0,
+                            xt::view(output, xt::range(outputChannel, outputChannel + 1), xt::range(bandBegin, bandEnd), xt::all()),
+                            outputChannel
+                        );
+                    } else {
+                        xvigra::applyEpilogueTile(
+                            plane,
+                            std::array<std::size_t, 3>{bandRows, outputWidth, 1},
+                            epilogue,
+                            2,
+                            xt::view(output, xt::range(bandBegin, bandEnd), xt::all(), xt::range(outputChannel, outputChannel + 1)),
+                            outputChannel
+                        );
+                    }
+                }
+            });
+        }
+    }
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ fftConvolve2D - end                                                                                          ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+} // xvigra
+
+#endif // XVIGRA_FFT_CONVOLUTION_HPP
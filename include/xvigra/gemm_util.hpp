@@ -0,0 +1,428 @@
+#ifndef XVIGRA_GEMM_UTIL_HPP
+#define XVIGRA_GEMM_UTIL_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+#include "xtensor/xexpression.hpp"
+#include "xtensor/xnoalias.hpp"
+#include "xtensor/xtensor.hpp"
+#include "xtensor/xutils.hpp"
+
+#include "xtensor-blas/xblas.hpp"
+#include "xtensor-blas/xlinalg.hpp"
+
+#include "xvigra/thread_util.hpp"
+
+namespace xvigra {
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ forward declaration - begin                                                                                  ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    inline bool isSmallGemm(std::size_t, std::size_t, std::size_t);
+
+    template <typename ResultType, typename LeftType, typename RightType>
+    void smallGemm(int, int, int, const LeftType*, std::ptrdiff_t, std::ptrdiff_t, const RightType*, std::ptrdiff_t, std::ptrdiff_t, ResultType*, std::ptrdiff_t);
+
+    template <typename L, typename R, typename P>
+    void matrixProduct(const xt::xexpression<L>&, const xt::xexpression<R>&, xt::xexpression<P>&, int threadCount=1);
+
+    template <typename L, typename R>
+    auto matrixProduct(const xt::xexpression<L>&, const xt::xexpression<R>&, int threadCount=1);
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ forward declaration - end                                                                                    ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ small gemm - begin                                                                                           ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    // products with at most this many rows or columns and at most xvigra::SMALL_GEMM_WORK_LIMIT multiply-adds are
+    // computed by xvigra::smallGemm instead of BLAS, where call overhead and packing dominate such skinny products;
+    // benchmark_smallGemm_outputChannels shows BLAS ahead from 2 rows on, even for products of 10^4 multiply-adds
+    constexpr std::size_t SMALL_GEMM_LIMIT = 1;
+    // multiply-adds up to which a single row or column is faster in xvigra::smallGemm than in BLAS
+    constexpr std::size_t SMALL_GEMM_WORK_LIMIT = std::size_t(1) << 16;
+
+    // multiply-adds which every thread of xvigra::smallGemm has to get inside of xvigra::matrixProduct, since starting
+    // a thread costs more than products of xvigra::SMALL_GEMM_WORK_LIMIT multiply-adds; those always run serially
+    constexpr std::size_t SMALL_GEMM_THREAD_WORK = std::size_t(1) << 17;
+
+    // size of the register block of xvigra::smallGemm, 4 x 8 accumulators fit the vector registers of every
+    // instruction set for float and double
+    constexpr int SMALL_GEMM_BLOCK_ROWS = 4;
+    constexpr int SMALL_GEMM_BLOCK_COLUMNS = 8;
+
+    /*
+     * <p>
+     * Returns whether a product with the given number of result rows and columns and the given depth is computed by
+     * xvigra::smallGemm. Both the skinny shape and the total work are required, since a single row or column of a
+     * large product still runs faster through BLAS.
+     * </p>
+     *
+     * @param rows number of rows of the result
+     * @param columns number of columns of the result
+     * @param depth number of multiply-adds of every result element
+     * @return true if rows or columns is at most xvigra::SMALL_GEMM_LIMIT and rows * columns * depth is at most
+               xvigra::SMALL_GEMM_WORK_LIMIT
+     */
+    inline bool isSmallGemm(std::size_t rows, std::size_t columns, std::size_t depth) {
+        return (rows <= SMALL_GEMM_LIMIT || columns <= SMALL_GEMM_LIMIT) && rows * columns * depth <= SMALL_GEMM_WORK_LIMIT;
+    }
+
+    namespace detail {
+        // computes a BlockRows x BlockColumns block of the result, whose accumulators are kept in registers over the
+        // whole depth, so every element of the operands is loaded once per block
+        template <int BlockRows, int BlockColumns, typename ResultType, typename LeftType, typename RightType>
+        inline void smallGemmBlock(
+            int depth,
+            const LeftType* left,
+            std::ptrdiff_t leftRowStride,
+            std::ptrdiff_t leftColumnStride,
+            const RightType* right,
+            std::ptrdiff_t rightRowStride,
+            std::ptrdiff_t rightColumnStride,
+            ResultType* result,
+            std::ptrdiff_t resultRowStride
+        ) {
+            ResultType accumulator[BlockRows][BlockColumns] = {};
+
+            for (int k = 0; k < depth; ++k) {
+                ResultType leftValues[BlockRows];
+                ResultType rightValues[BlockColumns];
+
+                for (int row = 0; row < BlockRows; ++row) {
+                    leftValues[row] = static_cast<ResultType>(left[row * leftRowStride + k * leftColumnStride]);
+                }
+
+                for (int column = 0; column < BlockColumns; ++column) {
+                    rightValues[column] = static_cast<ResultType>(right[k * rightRowStride + column * rightColumnStride]);
+                }
+
+                for (int row = 0; row < BlockRows; ++row) {
+                    for (int column = 0; column < BlockColumns; ++column) {
+                        accumulator[row][column] += leftValues[row] * rightValues[column];
+                    }
+                }
+            }
+
+            for (int row = 0; row < BlockRows; ++row) {
+                for (int column = 0; column < BlockColumns; ++column) {
+                    result[row * resultRowStride + column] = accumulator[row][column];
+                }
+            }
+        }
+
+        // selects the block with exactly columnsLeft < SMALL_GEMM_BLOCK_COLUMNS columns at compile time
+        template <int BlockRows, int BlockColumns, typename ResultType, typename LeftType, typename RightType>
+        inline void smallGemmColumnTail(
+            int columnsLeft,
+            int depth,
+            const LeftType* left,
+            std::ptrdiff_t leftRowStride,
+            std::ptrdiff_t leftColumnStride,
+            const RightType* right,
+            std::ptrdiff_t rightRowStride,
+            std::ptrdiff_t rightColumnStride,
+            ResultType* result,
+            std::ptrdiff_t resultRowStride
+        ) {
+            if (columnsLeft == BlockColumns) {
+                smallGemmBlock<BlockRows, BlockColumns>(depth, left, leftRowStride, leftColumnStride, right, rightRowStride, rightColumnStride, result, resultRowStride);
+            } else if constexpr (1 < BlockColumns) {
+                smallGemmColumnTail<BlockRows, BlockColumns - 1>(columnsLeft, depth, left, leftRowStride, leftColumnStride, right, rightRowStride, rightColumnStride, result, resultRowStride);
+            }
+        }
+
+        // computes BlockRows full rows of the result
+        template <int BlockRows, typename ResultType, typename LeftType, typename RightType>
+        inline void smallGemmRows(
+            int columns,
+            int depth,
+            const LeftType* left,
+            std::ptrdiff_t leftRowStride,
+            std::ptrdiff_t leftColumnStride,
+            const RightType* right,
+            std::ptrdiff_t rightRowStride,
+            std::ptrdiff_t rightColumnStride,
+            ResultType* result,
+            std::ptrdiff_t resultRowStride
+        ) {
+            int column = 0;
+
+            for (; column + SMALL_GEMM_BLOCK_COLUMNS <= columns; column += SMALL_GEMM_BLOCK_COLUMNS) {
+                smallGemmBlock<BlockRows, SMALL_GEMM_BLOCK_COLUMNS>(
+                    depth, left, leftRowStride, leftColumnStride,
+                    right + column * rightColumnStride, rightRowStride, rightColumnStride,
+                    result + column, resultRowStride
+                );
+            }
+
+            if (column < columns) {
+                smallGemmColumnTail<BlockRows, SMALL_GEMM_BLOCK_COLUMNS - 1>(
+                    columns - column, depth, left, leftRowStride, leftColumnStride,
+                    right + column * rightColumnStride, rightRowStride, rightColumnStride,
+                    result + column, resultRowStride
+                );
+            }
+        }
+
+        // selects the rows with exactly rowsLeft < SMALL_GEMM_BLOCK_ROWS rows at compile time
+        template <int BlockRows, typename ResultType, typename LeftType, typename RightType>
+        inline void smallGemmRowTail(
+            int rowsLeft,
+            int columns,
+            int depth,
+            const LeftType* left,
+            std::ptrdiff_t leftRowStride,
+            std::ptrdiff_t leftColumnStride,
+            const RightType* right,
+            std::ptrdiff_t rightRowStride,
+            std::ptrdiff_t rightColumnStride,
+            ResultType* result,
+            std::ptrdiff_t resultRowStride
+        ) {
+            if (rowsLeft == BlockRows) {
+                smallGemmRows<BlockRows>(columns, depth, left, leftRowStride, leftColumnStride, right, rightRowStride, rightColumnStride, result, resultRowStride);
+            } else if constexpr (1 < BlockRows) {
+                smallGemmRowTail<BlockRows - 1>(rowsLeft, columns, depth, left, leftRowStride, leftColumnStride, right, rightRowStride, rightColumnStride, result, resultRowStride);
+            }
+        }
+    }
+
+    /*
+     * <p>
+     * Calculates the matrix product result = left * right of a rows x depth and a depth x columns matrix with a
+     * register blocked micro-kernel, which needs neither BLAS nor packed copies of the operands. The operands are
+     * addressed by element strides, so transposed matrices are passed by swapping their strides. The result is stored
+     * row major with the given row stride.
+     * Intended for small products with a single row or column, like the GEMM of a small convolution with a single output
+     * channel, where it is faster than the BLAS call (see xvigra::isSmallGemm), and for integer products, which BLAS
+     * does not provide.
+     * </p>
+     *
+     * @tparam ResultType value type of the result, which is also used for the accumulation
+     * @tparam LeftType value type of the left matrix
+     * @tparam RightType value type of the right matrix
+     * @param rows number of rows of left and result
+     * @param columns number of columns of right and result
+     * @param depth number of columns of left and rows of right
+     * @param left pointer to the first element of the left matrix
+     * @param leftRowStride element distance of two rows of the left matrix
+     * @param leftColumnStride element distance of two columns of the left matrix
+     * @param right pointer to the first element of the right matrix
+     * @param rightRowStride element distance of two rows of the right matrix
+     * @param rightColumnStride element distance of two columns of the right matrix
+     * @param result pointer to the first element of the result
+     * @param resultRowStride element distance of two rows of the result
+     */
+    template <typename ResultType, typename LeftType, typename RightType>
+    void smallGemm(
+        int rows,
+        int columns,
+        int depth,
+        const LeftType* left,
+        std::ptrdiff_t leftRowStride,
+        std::ptrdiff_t leftColumnStride,
+        const RightType* right,
+        std::ptrdiff_t rightRowStride,
+        std::ptrdiff_t rightColumnStride,
+        ResultType* result,
+        std::ptrdiff_t resultRowStride
+    ) {
+        int row = 0;
+
+        for (; row + SMALL_GEMM_BLOCK_ROWS <= rows; row += SMALL_GEMM_BLOCK_ROWS) {
+            detail::smallGemmRows<SMALL_GEMM_BLOCK_ROWS>(
+                columns, depth,
+                left + row * leftRowStride, leftRowStride, leftColumnStride,
+                right, rightRowStride, rightColumnStride,
+                result + row * resultRowStride, resultRowStride
+            );
+        }
+
+        if (row < rows) {
+            detail::smallGemmRowTail<SMALL_GEMM_BLOCK_ROWS - 1>(
+                rows - row, columns, depth,
+                left + row * leftRowStride, leftRowStride, leftColumnStride,
+                right, rightRowStride, rightColumnStride,
+                result + row * resultRowStride, resultRowStride
+            );
+        }
+    }
+
+    /*
+     * <p>
+     * Calculates the matrix product of two 2-dimensional expressions into the given product, which must already have
+     * the rows x columns shape of the result; nothing is allocated for it. Small products (see xvigra::isSmallGemm)
+     * of expressions with a data interface are computed by xvigra::smallGemm straight into the product, split along
+     * the larger dimension of the result over at most threadCount threads with at least
+     * xvigra::SMALL_GEMM_THREAD_WORK multiply-adds each, so small products run on the calling thread; so are
+     * products of any size whose value type BLAS does not provide, e.g. integer products, which then need no
+     * temporary either. Float and double products of
+     * operands with the value type of the product are computed by xt::blas::gemm if the product is a row major
+     * container, all others by xt::linalg::dot; the BLAS threads follow the threading mode (see
+     * xvigra::ThreadingMode). Operands and product
+     * should be row major containers, e.g. xt::adapt buffers of workspace memory, since other expressions are
+     * evaluated into a temporary by BLAS.
+     * </p>
+     *
+     * @tparam L derived type of the left xexpression
+     * @tparam R derived type of the right xexpression
+     * @tparam P derived type of the product xexpression
+     * @param leftExpression xexpression containing the rows x depth left matrix
+     * @param rightExpression xexpression containing the depth x columns right matrix
+     * @param productExpression xexpression which receives the rows x columns product
+     * @param threadCount thread budget of the product, 0 selects one thread per hardware thread
+     * @throws std::invalid_argument * if the matrices are not 2-dimensional or their inner dimensions differ
+                                     * if the product does not have the shape of the result
+     */
+    template <typename L, typename R, typename P>
+    void matrixProduct(
+        const xt::xexpression<L>& leftExpression,
+        const xt::xexpression<R>& rightExpression,
+        xt::xexpression<P>& productExpression,
+        int threadCount
+    ) {
+        using LeftType = typename L::value_type;
+        using RightType = typename R::value_type;
+        using ResultType = typename P::value_type;
+
+        const auto& left = leftExpression.derived_cast();
+        const auto& right = rightExpression.derived_cast();
+        auto& product = productExpression.derived_cast();
+
+        if (left.dimension() != 2 || right.dimension() != 2) {
+            throw std::invalid_argument("matrixProduct(): Only 2-dimensional matrices are supported!");
+        }
+
+        if (left.shape()[1] != right.shape()[0]) {
+            throw std::invalid_argument("matrixProduct(): Inner dimensions of the matrices do not match!");
+        }
+
+        std::size_t rows = left.shape()[0];
+        std::size_t columns = right.shape()[1];
+        std::size_t depth = left.shape()[1];
+
+        if (product.dimension() != 2 || product.shape()[0] != rows || product.shape()[1] != columns) {
+            throw std::invalid_argument("matrixProduct(): Product does not have the shape of the result!");
+        }
+
+        if (rows == 0 || columns == 0) {
+            return;
+        }
+
+        if (depth == 0) {
+            std::fill(product.begin(), product.end(), static_cast<ResultType>(0));
+            return;
+        }
+
+        constexpr bool isBlasType = std::is_same_v<ResultType, float> || std::is_same_v<ResultType, double>;
+
+        if constexpr (xt::has_data_interface<L>::value && xt::has_data_interface<R>::value && xt::has_data_interface<P>::value) {
+            // xtensor sets the stride of an axis of size 1 to 0, so a single column has no column stride
+            bool isDenseRow = columns == 1 || product.strides()[1] == 1;
+
+            if ((isSmallGemm(rows, columns, depth) || !isBlasType) && isDenseRow) {
+                const LeftType* leftData = &left(0, 0);
+                const RightType* rightData = &right(0, 0);
+                auto leftRowStride = static_cast<std::ptrdiff_t>(left.strides()[0]);
+                auto leftColumnStride = static_cast<std::ptrdiff_t>(left.strides()[1]);
+                auto rightRowStride = static_cast<std::ptrdiff_t>(right.strides()[0]);
+                auto rightColumnStride = static_cast<std::ptrdiff_t>(right.strides()[1]);
+                auto resultRowStride = rows == 1 ? static_cast<std::ptrdiff_t>(columns) : static_cast<std::ptrdiff_t>(product.strides()[0]);
+                ResultType* resultData = &product(0, 0);
+
+                // every thread gets at least xvigra::SMALL_GEMM_THREAD_WORK multiply-adds
+                int productThreads = static_cast<int>(std::min<std::size_t>(
+                    static_cast<std::size_t>(xvigra::resolveThreadCount(threadCount)),
+                    std::max<std::size_t>(1, rows * columns * depth / SMALL_GEMM_THREAD_WORK)
+                ));
+
+                // the threads get whole register blocks along the larger dimension, so the small one stays in a block
+                if (columns <= rows) {
+                    int blocks = static_cast<int>((rows + SMALL_GEMM_BLOCK_ROWS - 1) / SMALL_GEMM_BLOCK_ROWS);
+
+                    xvigra::parallelFor(0, blocks, productThreads, [&](int blockBegin, int blockEnd) {
+                        int rowBegin = blockBegin * SMALL_GEMM_BLOCK_ROWS;
+                        int rowEnd = std::min(blockEnd * SMALL_GEMM_BLOCK_ROWS, static_cast<int>(rows));
+
+                        smallGemm(
+                            rowEnd - rowBegin, static_cast<int>(columns), static_cast<int>(depth),
+                            leftData + rowBegin * leftRowStride, leftRowStride, leftColumnStride,
+                            rightData, rightRowStride, rightColumnStride,
+                            resultData + rowBegin * resultRowStride, resultRowStride
+                        );
+                    });
+                } else {
+                    int blocks = static_cast<int>((columns + SMALL_GEMM_BLOCK_COLUMNS - 1) / SMALL_GEMM_BLOCK_COLUMNS);
+
+                    xvigra::parallelFor(0, blocks, productThreads, [&](int blockBegin, int blockEnd) {
+                        int columnBegin = blockBegin * SMALL_GEMM_BLOCK_COLUMNS;
+                        int columnEnd = std::min(blockEnd * SMALL_GEMM_BLOCK_COLUMNS, static_cast<int>(columns));
+
+                        smallGemm(
+                            static_cast<int>(rows), columnEnd - columnBegin, static_cast<int>(depth),
+                            leftData, leftRowStride, leftColumnStride,
+                            rightData + columnBegin * rightColumnStride, rightRowStride, rightColumnStride,
+                            resultData + columnBegin, resultRowStride
+                        );
+                    });
+                }
+
+                return;
+            }
+        }
+
+        xvigra::BlasThreadScope blasThreads(threadCount);
+
+        // xt::blas::gemm writes through the memory of the product, which only a row major container is guaranteed to expose
+        constexpr bool isBlasProduct = std::is_base_of_v<xt::xcontainer<P>, P> && P::static_layout == xt::layout_type::row_major;
+        if constexpr (isBlasType && std::is_same_v<LeftType, ResultType> && std::is_same_v<RightType, ResultType> && isBlasProduct) {
+            xt::blas::gemm(left, right, product);
+        } else {
+            xt::noalias(product) = xt::linalg::dot(left, right);
+        }
+    }
+
+    /*
+     * <p>
+     * Calculates the matrix product of two 2-dimensional expressions into a new xt::xtensor of their common value
+     * type; see the overload with a product for the backends.
+     * </p>
+     *
+     * @tparam L derived type of the left xexpression
+     * @tparam R derived type of the right xexpression
+     * @param leftExpression xexpression containing the rows x depth left matrix
+     * @param rightExpression xexpression containing the depth x columns right matrix
+     * @param threadCount thread budget of the product, 0 selects one thread per hardware thread
+     * @return the rows x columns product
+     * @throws std::invalid_argument if the matrices are not 2-dimensional or their inner dimensions differ
+     */
+    template <typename L, typename R>
+    auto matrixProduct(const xt::xexpression<L>& leftExpression, const xt::xexpression<R>& rightExpression, int threadCount) {
+        using ResultType = std::common_type_t<typename L::value_type, typename R::value_type>;
+
+        const auto& left = leftExpression.derived_cast();
+        const auto& right = rightExpression.derived_cast();
+
+        if (left.dimension() != 2 || right.dimension() != 2) {
+            throw std::invalid_argument("matrixProduct(): Only 2-dimensional matrices are supported!");
+        }
+
+        xt::xtensor<ResultType, 2> result(std::array<std::size_t, 2>{left.shape()[0], right.shape()[1]});
+        matrixProduct(left, right, result, threadCount);
+        return result;
+    }
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ small gemm - end                                                                                             ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+} // xvigra
+
+#endif // XVIGRA_GEMM_UTIL_HPP
@@ -0,0 +1,285 @@
+#ifndef XVIGRA_HALF_PRECISION_HPP
+#define XVIGRA_HALF_PRECISION_HPP
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <type_traits>
+
+namespace xvigra {
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ bit conversion - begin                                                                                       ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    /*
+     * <p>
+     * Converts a float into the bits of an IEEE 754 binary16 value, rounding to nearest even. Values beyond the
+     * binary16 range become infinity, values below the smallest normal binary16 value become subnormal and NaN stays
+     * a quiet NaN.
+     * </p>
+     *
+     * @param value the value to convert
+     * @return the binary16 bits of the value
+     */
+    inline std::uint16_t floatToFloat16Bits(float value) {
+        std::uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+
+        std::uint32_t sign = (bits >> 16) & 0x8000u;
+        std::uint32_t magnitude = bits & 0x7fffffffu;
+
+        if (magnitude >= 0x7f800000u) {
+            // infinity or NaN
+            return static_cast<std::uint16_t>(sign | 0x7c00u | (magnitude > 0x7f800000u ? 0x0200u : 0u));
+        }
+
+        if (magnitude >= 0x477ff000u) {
+            // rounds past the largest binary16 value 65504
+            return static_cast<std::uint16_t>(sign | 0x7c00u);
+        }
+
+        if (magnitude < 0x38800000u) {
+            // below 2^-14 the value is a multiple of 2^-24, scaling by 2^24 is exact and rounds to nearest even
+            float absolute;
+            std::memcpy(&absolute, &magnitude, sizeof(absolute));
+            auto mantissa = static_cast<std::uint32_t>(std::nearbyint(absolute * 16777216.0f));
+            return static_cast<std::uint16_t>(sign | mantissa);
+        }
+
+        // rebias the exponent from 127 to 15 and round away the lower 13 mantissa bits, a carry moves into the exponent
+        std::uint32_t rebiased = magnitude - 0x38000000u;
+        std::uint32_t rounded = (rebiased + 0x0fffu + ((rebiased >> 13) & 1u)) >> 13;
+        return static_cast<std::uint16_t>(sign | rounded);
+    }
+
+    /*
+     * <p>
+     * Converts the bits of an IEEE 754 binary16 value into a float. The conversion is exact.
+     * </p>
+     *
+     * @param bits the binary16 bits
+     * @return the value of the bits as float
+     */
+    inline float float16BitsToFloat(std::uint16_t bits) {
+        std::uint32_t sign = static_cast<std::uint32_t>(bits & 0x8000u) << 16;
+        std::uint32_t exponent = (bits >> 10) & 0x1fu;
+        std::uint32_t mantissa = bits & 0x03ffu;
+
+        if (exponent == 0) {
+            float value = static_cast<float>(mantissa) * (1.0f / 16777216.0f);
+            return sign != 0 ? -value : value;
+        }
+
+        std::uint32_t result;
+        if (exponent == 0x1fu) {
+            result = sign | 0x7f800000u | (mantissa << 13);
+        } else {
+            result = sign | ((exponent + 112u) << 23) | (mantissa << 13);
+        }
+
+        float value;
+        std::memcpy(&value, &result, sizeof(value));
+        return value;
+    }
+
+    /*
+     * <p>
+     * Converts a float into the bits of a bfloat16 value, which are the upper 16 bits of the float rounded to
+     * nearest even. NaN stays a quiet NaN.
+     * </p>
+     *
+     * @param value the value to convert
+     * @return the bfloat16 bits of the value
+     */
+    inline std::uint16_t floatToBFloat16Bits(float value) {
+        std::uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+
+        if ((bits & 0x7fffffffu) > 0x7f800000u) {
+            return static_cast<std::uint16_t>((bits >> 16) | 0x0040u);
+        }
+
+        bits += 0x7fffu + ((bits >> 16) & 1u);
+        return static_cast<std::uint16_t>(bits >> 16);
+    }
+
+    /*
+     * <p>
+     * Converts the bits of a bfloat16 value into a float. The conversion is exact.
+     * </p>
+     *
+     * @param bits the bfloat16 bits
+     * @return the value of the bits as float
+     */
+    inline float bfloat16BitsToFloat(std::uint16_t bits) {
+        std::uint32_t result = static_cast<std::uint32_t>(bits) << 16;
+
+        float value;
+        std::memcpy(&value, &result, sizeof(value));
+        return value;
+    }
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ bit conversion - end                                                                                         ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ class Float16 - begin                                                                                        ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    /*
+     * <p>
+     * Storage type for IEEE 754 binary16 values with 11 bits of precision. It only stores values; every arithmetic
+     * operation converts to float, so tensors of Float16 halve the memory traffic of float tensors while the
+     * convolutions accumulate in float, see xvigra::AccumulationType.
+     * </p>
+     */
+    class Float16 {
+    private:
+        std::uint16_t bits;
+
+    public:
+        Float16() = default;
+
+        Float16(float value)
+        : bits(floatToFloat16Bits(value))
+        {}
+
+        operator float() const {
+            return float16BitsToFloat(bits);
+        }
+
+        static Float16 fromBits(std::uint16_t bits) {
+            Float16 result;
+            result.bits = bits;
+            return result;
+        }
+
+        std::uint16_t getBits() const {
+            return bits;
+        }
+    }; // Float16
+
+    inline std::ostream& operator<<(std::ostream& out, const Float16& value) {
+        return out << static_cast<float>(value);
+    }
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ class Float16 - end                                                                                          ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ class BFloat16 - begin                                                                                       ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    /*
+     * <p>
+     * Storage type for bfloat16 values, which keep the 8 exponent bits of a float but only 8 bits of precision.
+     * Like xvigra::Float16 it only stores values and every arithmetic operation converts to float.
+     * </p>
+     */
+    class BFloat16 {
+    private:
+        std::uint16_t bits;
+
+    public:
+        BFloat16() = default;
+
+        BFloat16(float value)
+        : bits(floatToBFloat16Bits(value))
+        {}
+
+        operator float() const {
+            return bfloat16BitsToFloat(bits);
+        }
+
+        static BFloat16 fromBits(std::uint16_t bits) {
+            BFloat16 result;
+            result.bits = bits;
+            return result;
+        }
+
+        std::uint16_t getBits() const {
+            return bits;
+        }
+    }; // BFloat16
+
+    inline std::ostream& operator<<(std::ostream& out, const BFloat16& value) {
+        return out << static_cast<float>(value);
+    }
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ class BFloat16 - end                                                                                         ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ type traits - begin                                                                                          ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    template <typename T>
+    constexpr bool isHalfPrecision = std::is_same_v<T, Float16> || std::is_same_v<T, BFloat16>;
+
+    // type in which values of T are accumulated, 16-bit floats are widened to float
+    template <typename T>
+    using AccumulationType = std::conditional_t<isHalfPrecision<T>, float, T>;
+
+    // a 16-bit float combined with itself or an integer stays a 16-bit float, otherwise it widens to at least float
+    template <typename Half, typename T>
+    using HalfCommonType = std::conditional_t<
+        std::is_integral_v<std::decay_t<T>> || std::is_same_v<std::decay_t<T>, Half>,
+        Half,
+        std::common_type_t<float, std::decay_t<T>>
+    >;
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ type traits - end                                                                                            ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+}
+
+namespace std {
+    template <>
+    struct common_type<xvigra::Float16, xvigra::Float16> {
+        using type = xvigra::Float16;
+    };
+
+    template <>
+    struct common_type<xvigra::BFloat16, xvigra::BFloat16> {
+        using type = xvigra::BFloat16;
+    };
+
+    template <>
+    struct common_type<xvigra::Float16, xvigra::BFloat16> {
+        using type = float;
+    };
+
+    template <>
+    struct common_type<xvigra::BFloat16, xvigra::Float16> {
+        using type = float;
+    };
+
+    template <typename T>
+    struct common_type<xvigra::Float16, T> {
+        using type = xvigra::HalfCommonType<xvigra::Float16, T>;
+    };
+
+    template <typename T>
+    struct common_type<T, xvigra::Float16> {
+        using type = xvigra::HalfCommonType<xvigra::Float16, T>;
+    };
+
+    template <typename T>
+    struct common_type<xvigra::BFloat16, T> {
+        using type = xvigra::HalfCommonType<xvigra::BFloat16, T>;
+    };
+
+    template <typename T>
+    struct common_type<T, xvigra::BFloat16> {
+        using type = xvigra::HalfCommonType<xvigra::BFloat16, T>;
+    };
+}
+
+#endif // XVIGRA_HALF_PRECISION_HPP
@@ -10,12 +10,16 @@
 #include "xtensor/xexpression.hpp"
 #include "xtensor/xstrided_view.hpp"
 
+#include "xvigra/half_precision.hpp"
+
 namespace xvigra {
     template <class KernelValueType>
     xt::xarray<KernelValueType> initGaussian(double stdDev,
                                              double windowRatio=0.0) {
         if (stdDev > 0.0) {
-            vigra::Gaussian<KernelValueType> gauss(static_cast<KernelValueType>(stdDev));
+            // 16-bit float kernels are sampled in float and only rounded when they are stored
+            using GaussianType = xvigra::AccumulationType<KernelValueType>;
+            vigra::Gaussian<GaussianType> gauss(static_cast<GaussianType>(stdDev));
 
             int radius;
             if (windowRatio == 0.0) {
@@ -51,7 +55,8 @@ namespace xvigra {
             return initGaussian<KernelValueType>(stdDev, windowRatio);
         }
 
-        vigra::Gaussian<KernelValueType> gauss(static_cast<KernelValueType>(stdDev), order);
+        using GaussianType = xvigra::AccumulationType<KernelValueType>;
+        vigra::Gaussian<GaussianType> gauss(static_cast<GaussianType>(stdDev), order);
 
         int radius;
         if (windowRatio == 0.0) {
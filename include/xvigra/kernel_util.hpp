@@ -4,6 +4,7 @@
 #include <stdexcept>
 #include <string>
 
+#include "xtensor/xarray.hpp"
 #include "xtensor/xbuilder.hpp"
 #include "xtensor/xexpression.hpp"
 #include "xtensor/xstrided_view.hpp"
@@ -161,6 +162,103 @@ namespace xvigra {
         }
     }
 
+    /*
+     * <p>
+     * Promotes a kernel to a full N-dimensional filter of shape OC x IC x K_N x ... x K_1. A 1-dimensional kernel is
+     * used along every axis (outer product, only for N > 1) and a K_N x ... x K_1 kernel is applied to every channel on
+     * its own, both yield a diagonal filter with outputChannels input channels. An IC x K_N x ... x K_1 kernel is
+     * shared by all output channels.
+     * </p>
+     *
+     * @tparam N number of non-channel dimensions of the filter
+     * @param kernelExpression xexpression containing the kernel data
+     * @param outputChannels number of output channels of the promoted filter
+     * @return the full (N + 2)-dimensional filter
+     * @throws std::invalid_argument if the kernel can't be promoted or outputChannels is 0 for a kernel with less than
+                                     N + 2 dimensions
+     */
+    template <std::size_t N, typename T>
+    auto promoteKernelToFullND(const xt::xexpression<T>& kernelExpression, std::size_t outputChannels=0) {
+        using KernelContainerType = typename xt::xexpression<T>::derived_type;
+        using KernelType = typename KernelContainerType::value_type;
+
+        const auto& originalKernel = kernelExpression.derived_cast();
+        std::size_t kernelDimension = originalKernel.dimension();
+
+        if (kernelDimension == N + 2) {
+            return xt::xtensor<KernelType, N + 2>(originalKernel);
+        }
+
+        bool isOuterProduct = kernelDimension == 1 && N != 1;
+
+        if (kernelDimension != N && kernelDimension != N + 1 && !isOuterProduct) {
+            throw std::invalid_argument("promoteKernelToFullND(): Can't promote " + std::to_string(kernelDimension) + " dimensional kernel!");
+        }
+
+        if (outputChannels == 0) {
+            throw std::invalid_argument("promoteKernelToFullND(): Need atleast 1 output channel!");
+        }
+
+        bool isShared = kernelDimension == N + 1;
+        std::size_t inputChannels = isShared ? originalKernel.shape()[0] : outputChannels;
+
+        typename xt::xtensor<KernelType, N + 2>::shape_type kernelShape;
+        kernelShape[0] = outputChannels;
+        kernelShape[1] = inputChannels;
+        std::size_t kernelVolume = 1;
+
+        for (std::size_t axis = 0; axis < N; ++axis) {
+            kernelShape[2 + axis] = originalKernel.shape()[isOuterProduct ? 0 : kernelDimension - N + axis];
+            kernelVolume *= kernelShape[2 + axis];
+        }
+
+        xt::xtensor<KernelType, N + 2> result = xt::zeros<KernelType>(kernelShape);
+        xt::xarray<KernelType> flatKernel = originalKernel;
+
+        for (std::size_t outIndex = 0; outIndex < outputChannels; ++outIndex) {
+            for (std::size_t inIndex = 0; inIndex < inputChannels; ++inIndex) {
+                if (!isShared && outIndex != inIndex) {
+                    continue;
+                }
+
+                for (std::size_t tap = 0; tap < kernelVolume; ++tap) {
+                    KernelType value;
+
+                    if (isOuterProduct) {
+                        value = static_cast<KernelType>(1);
+
+                        for (std::size_t remainder = tap, axis = 0; axis < N; ++axis) {
+                            value *= flatKernel(remainder % kernelShape[1 + N - axis]);
+                            remainder /= kernelShape[1 + N - axis];
+                        }
+                    } else {
+                        value = flatKernel.flat((isShared ? inIndex * kernelVolume : 0) + tap);
+                    }
+
+                    result.flat((outIndex * inputChannels + inIndex) * kernelVolume + tap) = value;
+                }
+            }
+        }
+
+        return result;
+    }
+
+    /*
+     * <p>
+     * Promotes a kernel to a full 3-dimensional filter of shape OC x IC x D x H x W, see xvigra::promoteKernelToFullND.
+     * </p>
+     *
+     * @param kernelExpression xexpression containing the kernel data
+     * @param outputChannels number of output channels of the promoted filter
+     * @return the full 5-dimensional filter
+     * @throws std::invalid_argument if the kernel has 2 or more than 5 dimensions or outputChannels is 0 for a kernel
+                                     with less than 5 dimensions
+     */
+    template <typename T>
+    auto promoteKernelToFull3D(const xt::xexpression<T>& kernelExpression, std::size_t outputChannels=0) {
+        return promoteKernelToFullND<3>(kernelExpression, outputChannels);
+    }
+
     // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
     // ║ kernel promote - end                                                                                         ║
     // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
@@ -0,0 +1,455 @@
+#ifndef XVIGRA_QUANTIZED_CONVOLUTION_HPP
+#define XVIGRA_QUANTIZED_CONVOLUTION_HPP
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#ifdef VOID
+#undef VOID
+#endif
+
+#include "xtensor/xbuilder.hpp"
+#include "xtensor/xexpression.hpp"
+#include "xtensor/xtensor.hpp"
+
+#include "xvigra/convolution_util.hpp"
+#include "xvigra/explicit_convolution.hpp"
+#include "xvigra/gemm_util.hpp"
+#include "xvigra/kernel_util.hpp"
+#include "xvigra/thread_util.hpp"
+#include "xvigra/workspace.hpp"
+
+namespace xvigra {
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ struct QuantizationParameters - begin                                                                        ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    /*
+     * <p>
+     * Affine quantization of a tensor: the real value of a quantized value q is scale * (q - zeroPoint).
+     * </p>
+     */
+    struct QuantizationParameters {
+        float scale;
+        int zeroPoint;
+
+        QuantizationParameters(float scale=1.0f, int zeroPoint=0)
+        : scale(scale), zeroPoint(zeroPoint)
+        {}
+    }; // QuantizationParameters
+
+    inline std::ostream& operator<<(std::ostream& out, const QuantizationParameters& parameters) {
+        return out << "{"
+                   << "scale=" << parameters.scale
+                   << ", zeroPoint=" << parameters.zeroPoint
+                   << "}";
+    }
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ struct QuantizationParameters - end                                                                          ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ quantize - begin                                                                                             ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    /*
+     * <p>
+     * Quantizes a single real value by rounding to the nearest quantized value and saturating at the limits of
+     * QuantizedType.
+     * </p>
+     *
+     * @tparam QuantizedType integral type of the quantized value
+     * @param value real value
+     * @param parameters scale and zero point of the quantization
+     * @return the quantized value
+     */
+    template <typename QuantizedType>
+    QuantizedType quantizeValue(double value, const QuantizationParameters& parameters) {
+        static_assert(std::is_integral_v<QuantizedType>, "quantizeValue(): Quantized type must be integral!");
+
+        double quantized = std::nearbyint(value / parameters.scale) + parameters.zeroPoint;
+        quantized = std::clamp(
+            quantized,
+            static_cast<double>(std::numeric_limits<QuantizedType>::min()),
+            static_cast<double>(std::numeric_limits<QuantizedType>::max())
+        );
+
+        return static_cast<QuantizedType>(quantized);
+    }
+
+    /*
+     * <p>
+     * Quantizes every element of the expression with xvigra::quantizeValue.
+     * </p>
+     *
+     * @tparam QuantizedType integral type of the quantized values
+     * @tparam T derived type of the xexpression
+     * @param expression xexpression containing the real values
+     * @param parameters scale and zero point of the quantization
+     * @return the quantized values with the shape of the expression
+     */
+    template <typename QuantizedType, typename T>
+    auto quantize(const xt::xexpression<T>& expression, const QuantizationParameters& parameters) {
+        const auto& values = expression.derived_cast();
+        auto result = xt::empty<QuantizedType>(values.shape());
+
+        std::transform(values.begin(), values.end(), result.begin(), [&parameters](const auto& value) {
+            return quantizeValue<QuantizedType>(static_cast<double>(value), parameters);
+        });
+
+        return result;
+    }
+
+    /*
+     * <p>
+     * Returns the real values of the quantized expression.
+     * </p>
+     *
+     * @tparam RealType floating point type of the result
+     * @tparam T derived type of the xexpression
+     * @param expression xexpression containing the quantized values
+     * @param parameters scale and zero point of the quantization
+     * @return the real values with the shape of the expression
+     */
+    template <typename RealType=float, typename T>
+    auto dequantize(const xt::xexpression<T>& expression, const QuantizationParameters& parameters) {
+        const auto& values = expression.derived_cast();
+        auto result = xt::empty<RealType>(values.shape());
+
+        std::transform(values.begin(), values.end(), result.begin(), [&parameters](const auto& value) {
+            return static_cast<RealType>(parameters.scale) * static_cast<RealType>(static_cast<int>(value) - parameters.zeroPoint);
+        });
+
+        return result;
+    }
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ quantize - end                                                                                               ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ quantizedConvolve2D - begin                                                                                  ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    /*
+     * <p>
+     * Largest reduction depth IC * KH * KW of xvigra::quantizedConvolve2D. A shifted 8 bit value lies in [-255, 255],
+     * so a single product is at most 255 * 255 and the sum of this many products still fits into std::int32_t.
+     * </p>
+     */
+    constexpr std::size_t QUANTIZED_MAX_DEPTH = static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max()) / (255 * 255);
+
+    template <typename QuantizedType>
+    void checkQuantizationParameters(const QuantizationParameters& parameters, const std::string& name) {
+        if (!(0.0f < parameters.scale)) {
+            throw std::invalid_argument("quantizedConvolve2D(): Scale of the " + name + " must be positive!");
+        }
+
+        if (parameters.zeroPoint < std::numeric_limits<QuantizedType>::min() || std::numeric_limits<QuantizedType>::max() < parameters.zeroPoint) {
+            throw std::invalid_argument("quantizedConvolve2D(): Zero point of the " + name + " is out of range!");
+        }
+    }
+
+    /*
+     * <p>
+     * Calculates the explicit 2-dimensional convolution of a quantized 8 bit input with a quantized 8 bit kernel.
+     * Input and kernel are shifted by their zero points into 16 bit values and the products are accumulated in
+     * 32 bit integers, so the accumulation is exact up to a reduction depth IC * KH * KW of
+     * xvigra::QUANTIZED_MAX_DEPTH (33025); deeper reductions are rejected. The accumulator acc is converted depending on OutputType:
+     * * std::int32_t returns acc itself
+     * * floating point types return the real value inputScale * kernelScale * acc
+     * * other integral types requantize the real value with the output parameters, rounding to the nearest value
+     *   and saturating at the limits of OutputType
+     * The im2col patch of 16 bit values is built in tiles which stay below the workspace limit of the options. Every
+     * tile is gathered completely and then multiplied with the kernel by the register blocked xvigra::smallGemm, so
+     * each loaded patch value is reused for a whole block of output channels. Patch, kernel matrix and accumulators
+     * are drawn from the workspace of the options; the output pixels are distributed over the threads of the options.
+     * Constant border values are real values and are quantized with the input parameters. The kernel is promoted with
+     * xvigra::promoteKernelToFull2D after its zero point has been removed, so promoted zeros are real zeros;
+     * 1-dimensional kernels are not supported, since their outer product would square the kernel scale.
+     * The result matches xvigra::convolve2D of the dequantized input and kernel, up to the requantization.
+     * </p>
+     *
+     * @tparam OutputType type of the result, see above
+     * @tparam T derived type of the input xexpression with std::uint8_t or std::int8_t values
+     * @tparam O derived type of the kernel xexpression with std::int8_t or std::uint8_t values
+     * @param inputExpression xexpression containing the quantized input data
+     * @param kernelExpression xexpression containing the quantized kernel data with 2, 3 or 4 dimensions
+     * @param inputParameters scale and zero point of the input
+     * @param kernelParameters scale and zero point of the kernel
+     * @param options2D object containing information about padding, stride, dilation, channel position, border
+                        treatment, workspace limit and thread count
+     * @param outputParameters scale and zero point of the result, only used for requantized integral results
+     * @return the result of the convolution as xt::xtensor of OutputType
+     * @throws std::invalid_argument * if the channel positions of optionsY and optionsX differ
+                                     * if IMPLICIT channel position is requested
+                                     * if more than 1 group is requested
+                                     * if input or kernel do not match the required shape
+                                     * if the input channels in input and kernel do not align
+                                     * if the padded input is smaller than the dilated kernel
+                                     * if the reduction depth exceeds xvigra::QUANTIZED_MAX_DEPTH
+                                     * if a scale is not positive or a zero point is out of the range of its type
+     */
+    template <typename OutputType=float, typename T, typename O>
+    xt::xtensor<OutputType, 3> quantizedConvolve2D(
+        const xt::xexpression<T>& inputExpression,
+        const xt::xexpression<O>& kernelExpression,
+        const QuantizationParameters& inputParameters,
+        const QuantizationParameters& kernelParameters,
+        const KernelOptions2D& options2D,
+        const QuantizationParameters& outputParameters=QuantizationParameters()
+    ) {
+        using InputType = typename T::value_type;
+        using KernelType = typename O::value_type;
+        using ShiftedType = std::int16_t;
+        using AccumulatorType = std::int32_t;
+
+        static_assert(
+            std::is_same_v<InputType, std::uint8_t> || std::is_same_v<InputType, std::int8_t>,
+            "quantizedConvolve2D(): Input must be quantized to std::uint8_t or std::int8_t!"
+        );
+        static_assert(
+            std::is_same_v<KernelType, std::int8_t> || std::is_same_v<KernelType, std::uint8_t>,
+            "quantizedConvolve2D(): Kernel must be quantized to std::int8_t or std::uint8_t!"
+        );
+        static_assert(
+            std::is_arithmetic_v<OutputType> && !std::is_same_v<OutputType, bool>,
+            "quantizedConvolve2D(): Output type must be arithmetic!"
+        );
+
+        const KernelOptions& optionsY = options2D.optionsY;
+        const KernelOptions& optionsX = options2D.optionsX;
+        const auto& rawInput = inputExpression.derived_cast();
+        const auto& rawKernel = kernelExpression.derived_cast();
+
+        if (optionsY.channelPosition != optionsX.channelPosition) {
+            throw std::invalid_argument(
+                "quantizedConvolve2D(): Channel can't be on different positions for optionsY and optionsX!"
+            );
+        }
+
+        if (optionsY.channelPosition == ChannelPosition::IMPLICIT) {
+            throw std::invalid_argument(
+                "quantizedConvolve2D(): Implicit channel option is not supported for explicit channels in input!"
+            );
+        }
+
+        if (optionsY.channelPosition == ChannelPosition::BLOCKED) {
+            throw std::invalid_argument(
+                "quantizedConvolve2D(): Blocked channel option is only supported by convolve2DBlocked!"
+            );
+        }
+
+        if (optionsY.groups != 1 || optionsX.groups != 1) {
+            throw std::invalid_argument("quantizedConvolve2D(): Groups are not supported!");
+        }
+
+        if (rawInput.dimension() != 3) {
+            throw std::invalid_argument("quantizedConvolve2D(): Need 3 dimensional (H x W x C or C x H x W) input!");
+        }
+
+        if (rawKernel.dimension() < 2 || 4 < rawKernel.dimension()) {
+            throw std::invalid_argument("quantizedConvolve2D(): Need 2, 3 or 4 dimensional kernel!");
+        }
+
+        checkQuantizationParameters<InputType>(inputParameters, "input");
+        checkQuantizationParameters<KernelType>(kernelParameters, "kernel");
+
+        if constexpr (std::is_integral_v<OutputType> && !std::is_same_v<OutputType, AccumulatorType>) {
+            checkQuantizationParameters<OutputType>(outputParameters, "output");
+        }
+
+        bool isChannelFirst = optionsY.channelPosition == ChannelPosition::FIRST;
+        std::size_t inputChannels = rawInput.shape()[isChannelFirst ? 0 : 2];
+        std::size_t inputHeight = rawInput.shape()[isChannelFirst ? 1 : 0];
+        std::size_t inputWidth = rawInput.shape()[isChannelFirst ? 2 : 1];
+
+        // the zero point is removed before the promotion, so that the inserted zeros are real zeros
+        xt::xtensor<ShiftedType, 4> kernel = promoteKernelToFull2D(
+            xt::eval(xt::cast<ShiftedType>(xt::cast<int>(rawKernel) - kernelParameters.zeroPoint)),
+            inputChannels
+        );
+
+        std::size_t outputChannels = kernel.shape()[0];
+        std::size_t kernelHeight = kernel.shape()[2];
+        std::size_t kernelWidth = kernel.shape()[3];
+
+        if (inputChannels != kernel.shape()[1]) {
+            throw std::invalid_argument("quantizedConvolve2D(): Input channels of input and kernel do not align!");
+        }
+
+        if (static_cast<int>(inputHeight) + optionsY.paddingTotal() < (static_cast<int>(kernelHeight) - 1) * optionsY.dilation + 1) {
+            throw std::invalid_argument("quantizedConvolve2D(): Kernel height is greater than padded input height!");
+        }
+
+        if (static_cast<int>(inputWidth) + optionsX.paddingTotal() < (static_cast<int>(kernelWidth) - 1) * optionsX.dilation + 1) {
+            throw std::invalid_argument("quantizedConvolve2D(): Kernel width is greater than padded input width!");
+        }
+
+        std::vector<int> indicesY = calculateGatherIndices(static_cast<int>(inputHeight), static_cast<int>(kernelHeight), optionsY);
+        std::vector<int> indicesX = calculateGatherIndices(static_cast<int>(inputWidth), static_cast<int>(kernelWidth), optionsX);
+        std::size_t outputHeight = indicesY.size() / kernelHeight;
+        std::size_t outputWidth = indicesX.size() / kernelWidth;
+        std::size_t depth = inputChannels * kernelHeight * kernelWidth;
+
+        if (QUANTIZED_MAX_DEPTH < depth) {
+            throw std::invalid_argument("quantizedConvolve2D(): Reduction depth would overflow the 32 bit accumulator!");
+        }
+
+        auto shiftedConstant = [&inputParameters](const KernelOptions& options, int marker) {
+            double value = gatherConstant<double, double>(options, marker);
+            return static_cast<ShiftedType>(quantizeValue<InputType>(value, inputParameters) - inputParameters.zeroPoint);
+        };
+        ShiftedType constantBeginY = shiftedConstant(optionsY, CONSTANT_BEGIN_INDEX);
+        ShiftedType constantEndY = shiftedConstant(optionsY, CONSTANT_END_INDEX);
+        ShiftedType constantBeginX = shiftedConstant(optionsX, CONSTANT_BEGIN_INDEX);
+        ShiftedType constantEndX = shiftedConstant(optionsX, CONSTANT_END_INDEX);
+
+        std::array<std::size_t, 3> outputShape = isChannelFirst
+            ? std::array<std::size_t, 3>{outputChannels, outputHeight, outputWidth}
+            : std::array<std::size_t, 3>{outputHeight, outputWidth, outputChannels};
+        xt::xtensor<OutputType, 3> output(outputShape);
+
+        double realScale = static_cast<double>(inputParameters.scale) * static_cast<double>(kernelParameters.scale);
+        double requantizationScale = realScale / static_cast<double>(outputParameters.scale);
+
+        auto convert = [&](AccumulatorType accumulator) {
+            if constexpr (std::is_same_v<OutputType, AccumulatorType>) {
+                return accumulator;
+            } else if constexpr (std::is_floating_point_v<OutputType>) {
+                return static_cast<OutputType>(realScale * accumulator);
+            } else {
+                double quantized = std::nearbyint(requantizationScale * accumulator) + outputParameters.zeroPoint;
+                quantized = std::clamp(
+                    quantized,
+                    static_cast<double>(std::numeric_limits<OutputType>::min()),
+                    static_cast<double>(std::numeric_limits<OutputType>::max())
+                );
+                return static_cast<OutputType>(quantized);
+            }
+        };
+
+        decltype(auto) input = evaluateContiguous<3>(rawInput);
+        const InputType* inputData = input.data();
+        OutputType* outputData = output.data();
+        ShiftedType zeroPoint = static_cast<ShiftedType>(inputParameters.zeroPoint);
+
+        // the patch and the accumulators are built in tiles of output rows, so that they never exceed the workspace limit
+        std::size_t pixelBytes = depth * sizeof(ShiftedType) + outputChannels * sizeof(AccumulatorType);
+        int tileHeight = calculateTileSize(optionsY.workspaceLimit, pixelBytes * outputWidth, static_cast<int>(outputHeight));
+        std::size_t tilePixels = outputWidth * static_cast<std::size_t>(tileHeight);
+
+        Workspace& workspace = resolveWorkspace(optionsY.workspace);
+        Workspace::Scope workspaceScope(workspace);
+        ShiftedType* patch = workspace.allocate<ShiftedType>(depth * tilePixels + depth * outputChannels);
+        ShiftedType* kernelMatrix = patch + depth * tilePixels;
+        AccumulatorType* accumulators = workspace.allocate<AccumulatorType>(tilePixels * outputChannels);
+
+        // depth x OC, so that the micro-kernel loads a block of output channels contiguously; the depth follows the
+        // memory order of a pixel neighbourhood in the input: (IC, KH, KW) for channel first and (KH, KW, IC) for
+        // channel last inputs
+        for (std::size_t outputChannel = 0; outputChannel < outputChannels; ++outputChannel) {
+            for (std::size_t inputChannel = 0; inputChannel < inputChannels; ++inputChannel) {
+                for (std::size_t kernelY = 0; kernelY < kernelHeight; ++kernelY) {
+                    for (std::size_t kernelX = 0; kernelX < kernelWidth; ++kernelX) {
+                        std::size_t depthIndex = isChannelFirst
+                            ? (inputChannel * kernelHeight + kernelY) * kernelWidth + kernelX
+                            : (kernelY * kernelWidth + kernelX) * inputChannels + inputChannel;
+                        kernelMatrix[depthIndex * outputChannels + outputChannel] = kernel(outputChannel, inputChannel, kernelY, kernelX);
+                    }
+                }
+            }
+        }
+
+        for (std::size_t tileBegin = 0; tileBegin < outputHeight; tileBegin += tileHeight) {
+            std::size_t tileEnd = std::min(tileBegin + static_cast<std::size_t>(tileHeight), outputHeight);
+            int columns = static_cast<int>((tileEnd - tileBegin) * outputWidth);
+
+            // every output pixel gathers its own row of the patch, so the pixels are distributed over the threads
+            parallelFor(0, columns, optionsY.threadCount, [&](int columnBegin, int columnEnd) {
+                for (int column = columnBegin; column < columnEnd; ++column) {
+                    std::size_t outIndexY = tileBegin + static_cast<std::size_t>(column) / outputWidth;
+                    std::size_t outIndexX = static_cast<std::size_t>(column) % outputWidth;
+                    ShiftedType* patchRow = patch + static_cast<std::size_t>(column) * depth;
+
+                    for (std::size_t kernelY = 0; kernelY < kernelHeight; ++kernelY) {
+                        int inputY = indicesY[kernelY * outputHeight + outIndexY];
+
+                        for (std::size_t kernelX = 0; kernelX < kernelWidth; ++kernelX) {
+                            int inputX = indicesX[kernelX * outputWidth + outIndexX];
+
+                            for (std::size_t inputChannel = 0; inputChannel < inputChannels; ++inputChannel) {
+                                ShiftedType value;
+
+                                if (inputY < 0) {
+                                    value = inputY == CONSTANT_BEGIN_INDEX ? constantBeginY : constantEndY;
+                                } else if (inputX < 0) {
+                                    value = inputX == CONSTANT_BEGIN_INDEX ? constantBeginX : constantEndX;
+                                } else if (isChannelFirst) {
+                                    value = static_cast<ShiftedType>(inputData[(inputChannel * inputHeight + inputY) * inputWidth + inputX]) - zeroPoint;
+                                } else {
+                                    value = static_cast<ShiftedType>(inputData[(inputY * inputWidth + inputX) * inputChannels + inputChannel]) - zeroPoint;
+                                }
+
+                                std::size_t depthIndex = isChannelFirst
+                                    ? (inputChannel * kernelHeight + kernelY) * kernelWidth + kernelX
+                                    : (kernelY * kernelWidth + kernelX) * inputChannels + inputChannel;
+                                patchRow[depthIndex] = value;
+                            }
+                        }
+                    }
+                }
+            });
+
+            // the tile is multiplied as pixels x depth by depth x OC into 32 bit accumulators; the threads get whole
+            // register blocks of pixels and convert their accumulators while they are still in cache
+            int blocks = (columns + SMALL_GEMM_BLOCK_ROWS - 1) / SMALL_GEMM_BLOCK_ROWS;
+
+            parallelFor(0, blocks, optionsY.threadCount, [&](int blockBegin, int blockEnd) {
+                int columnBegin = blockBegin * SMALL_GEMM_BLOCK_ROWS;
+                int columnEnd = std::min(blockEnd * SMALL_GEMM_BLOCK_ROWS, columns);
+                AccumulatorType* accumulatorRows = accumulators + static_cast<std::size_t>(columnBegin) * outputChannels;
+
+                smallGemm(
+                    columnEnd - columnBegin, static_cast<int>(outputChannels), static_cast<int>(depth),
+                    static_cast<const ShiftedType*>(patch + static_cast<std::size_t>(columnBegin) * depth), static_cast<std::ptrdiff_t>(depth), std::ptrdiff_t(1),
+                    static_cast<const ShiftedType*>(kernelMatrix), static_cast<std::ptrdiff_t>(outputChannels), std::ptrdiff_t(1),
+                    accumulatorRows, static_cast<std::ptrdiff_t>(outputChannels)
+                );
+
+                for (int column = columnBegin; column < columnEnd; ++column) {
+                    std::size_t outIndexY = tileBegin + static_cast<std::size_t>(column) / outputWidth;
+                    std::size_t outIndexX = static_cast<std::size_t>(column) % outputWidth;
+                    const AccumulatorType* accumulatorRow = accumulators + static_cast<std::size_t>(column) * outputChannels;
+
+                    for (std::size_t outputChannel = 0; outputChannel < outputChannels; ++outputChannel) {
+                        std::size_t outputIndex = isChannelFirst
+                            ? (outputChannel * outputHeight + outIndexY) * outputWidth + outIndexX
+                            : (outIndexY * outputWidth + outIndexX) * outputChannels + outputChannel;
+                        outputData[outputIndex] = convert(accumulatorRow[outputChannel]);
+                    }
+                }
+            });
+        }
+
+        return output;
+    }
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ quantizedConvolve2D - end                                                                                    ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+} // xvigra
+
+#endif // XVIGRA_QUANTIZED_CONVOLUTION_HPP
@@ -4,6 +4,7 @@
 #include <array>
 #include <stdexcept>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #ifdef VOID
@@ -33,6 +34,9 @@ namespace xvigra {
             KernelContainerType rawKernel = rawKernelExpressions[index];                               \
             std::size_t kernelSize = rawKernel.shape()[0];                                             \
             xt::xtensor<KernelType, 3> kernel = xvigra::promoteKernelToFull1D(rawKernel, channels);    \
+            /* a symmetric kernel is resolved once and convolved depthwise without promotion */        \
+            xvigra::KernelSymmetry symmetry = xvigra::resolveKernelSymmetry(rawKernel, options);       \
+            options.setKernelSymmetry(symmetry);                                                       \
                                                                                                        \
             int size = xvigra::calculateOutputSize(resultShape[(currentAxis)], kernelSize, options);   \
             resultShape[(currentAxis)] = static_cast<std::size_t>(size);                               \
@@ -53,12 +57,16 @@ namespace xvigra {
                     endAxis                                                                            \
                 );                                                                                     \
                                                                                                        \
-                xt::xtensor<ResultType, 2> row(xt::strided_view(result, sliceVector));                 \
-                xt::xtensor<ResultType, 2> convolvedRow = xvigra::convolve1D(row, kernel, options);    \
-                xt::strided_view(tmp, sliceVector) = convolvedRow;                                     \
+                /* the row is read and written in place, its scratch memory comes from the workspace */ \
+                auto convolvedRow = xt::strided_view(tmp, sliceVector);                                \
+                if (symmetry == xvigra::KernelSymmetry::NONE) {                                        \
+                    xvigra::convolve1D(xt::strided_view(result, sliceVector), kernel, options, convolvedRow); \
+                } else {                                                                               \
+                    xvigra::convolve1D(xt::strided_view(result, sliceVector), rawKernel, options, convolvedRow); \
+                }                                                                                      \
             }                                                                                          \
                                                                                                        \
-            result = tmp;                                                                              \
+            result = std::move(tmp);                                                                   \
                                                                                                        \
     }
 
@@ -194,6 +202,11 @@ namespace xvigra {
         }
 
         std::size_t channels = input.shape()[locationOfChannel];
+        if (xvigra::resolveKernelSymmetry(rawKernel, kernelOptions) != xvigra::KernelSymmetry::NONE) {
+            // a symmetric kernel is convolved depthwise without promotion, see xvigra::symmetricConvolve1D
+            return xt::xtensor<ResultType, 2>(xvigra::convolve1D(input, rawKernel, kernelOptions));
+        }
+
         xt::xtensor<KernelType, 3> kernel = xvigra::promoteKernelToFull1D(rawKernel, channels);
 
         return xt::xtensor<ResultType, 2>(xvigra::convolve1D(input, kernel, kernelOptions));
@@ -565,6 +578,10 @@ namespace xvigra {
             std::size_t kernelSize = rawKernel.shape()[0];
             xt::xtensor<KernelType, 3> kernel = xvigra::promoteKernelToFull1D(rawKernel, channels);
 
+            // a symmetric kernel is resolved once and convolved depthwise without promotion
+            xvigra::KernelSymmetry symmetry = xvigra::resolveKernelSymmetry(rawKernel, options);
+            options.setKernelSymmetry(symmetry);
+
             int size = xvigra::calculateOutputSize(resultShape[currentAxis], kernelSize, options);
             resultShape[currentAxis] = static_cast<std::size_t>(size);
 
@@ -574,12 +591,17 @@ namespace xvigra {
             for (std::size_t compoundIndex = 0; compoundIndex < maxIndex; ++compoundIndex) {
                 xt::xstrided_slice_vector sliceVector = xvigra::decomposeIndex<N + 1>(compoundIndex, resultShape, currentAxis, startAxis, endAxis);
 
-                xt::xtensor<ResultType, 2> row(xt::strided_view(result, sliceVector));
-                xt::xtensor<ResultType, 2> convolvedRow = xvigra::convolve1D(row, kernel, options);
-                xt::strided_view(tmp, sliceVector) = convolvedRow;
+                // the row is read and written in place, its scratch memory comes from the workspace
+                auto convolvedRow = xt::strided_view(tmp, sliceVector);
+
+                if (symmetry == xvigra::KernelSymmetry::NONE) {
+                    xvigra::convolve1D(xt::strided_view(result, sliceVector), kernel, options, convolvedRow);
+                } else {
+                    xvigra::convolve1D(xt::strided_view(result, sliceVector), rawKernel, options, convolvedRow);
+                }
             }
 
-            result = tmp;
+            result = std::move(tmp);
         }
 
         return result;
@@ -0,0 +1,729 @@
+#ifndef XVIGRA_SIMD_UTIL_HPP
+#define XVIGRA_SIMD_UTIL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <type_traits>
+
+// the vectorized kernels are compiled for every instruction set with function target attributes (GCC, Clang) or
+// plain intrinsics (MSVC), so the whole library stays buildable for the baseline architecture
+#if !defined(XVIGRA_DISABLE_SIMD) && (defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86))
+#define XVIGRA_SIMD_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define XVIGRA_SIMD_TARGET(instructionSets)
+#else
+#define XVIGRA_SIMD_TARGET(instructionSets) __attribute__((target(instructionSets)))
+#endif
+#else
+#define XVIGRA_SIMD_X86 0
+#endif
+
+namespace xvigra {
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ forward declaration - begin                                                                                  ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    enum class InstructionSet;
+
+    inline InstructionSet detectInstructionSet();
+
+    inline InstructionSet activeInstructionSet();
+
+    inline InstructionSet setInstructionSet(InstructionSet);
+
+    template <typename T>
+    void multiplyAdd(T*, const T*, T, std::size_t);
+
+    template <bool IsSymmetric, typename T>
+    void multiplyAddFolded(T*, const T*, const T*, T, std::size_t);
+
+    template <typename T>
+    void multiplyAddChannelBlock(T*, const T*, std::ptrdiff_t, const T*, std::size_t);
+
+    template <typename SourceType, typename TargetType>
+    void convertRow(const SourceType*, std::ptrdiff_t, TargetType*, std::size_t);
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ forward declaration - end                                                                                    ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ enum class InstructionSet - begin                                                                            ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    // ordered by width, so a wider instruction set compares greater
+    enum class InstructionSet {
+        SCALAR,
+        SSE4,
+        AVX2,
+        AVX512
+    }; // InstructionSet
+
+    inline std::ostream& operator<<(std::ostream& out, const InstructionSet& instructionSet) {
+        switch (instructionSet) {
+            case InstructionSet::SCALAR:
+                return out << "InstructionSet::SCALAR";
+            case InstructionSet::SSE4:
+                return out << "InstructionSet::SSE4";
+            case InstructionSet::AVX2:
+                return out << "InstructionSet::AVX2";
+            case InstructionSet::AVX512:
+                return out << "InstructionSet::AVX512";
+            default:
+                return out << "InstructionSet::UNKNOWN";
+        }
+    }
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ enum class InstructionSet - end                                                                              ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ dispatch - begin                                                                                             ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    /*
+     * <p>
+     * Detects the widest instruction set which the host CPU and the operating system support. AVX2 requires FMA as
+     * well, AVX512 only requires AVX512F. Without x86 or with XVIGRA_DISABLE_SIMD defined the result is always
+     * InstructionSet::SCALAR.
+     * </p>
+     *
+     * @return the widest supported instruction set
+     */
+    inline InstructionSet detectInstructionSet() {
+#if XVIGRA_SIMD_X86
+#if defined(_MSC_VER) && !defined(__clang__)
+        int info[4];
+        __cpuid(info, 0);
+        int maximumLeaf = info[0];
+
+        __cpuid(info, 1);
+        bool hasSSE4 = (info[2] & (1 << 19)) != 0;
+        bool hasFMA = (info[2] & (1 << 12)) != 0;
+        bool hasOSXSave = (info[2] & (1 << 27)) != 0;
+        bool hasAVX = (info[2] & (1 << 28)) != 0;
+
+        // the operating system has to save the vector registers on a context switch
+        unsigned long long enabledStates = hasOSXSave ? _xgetbv(0) : 0;
+        bool hasAVXState = (enabledStates & 0x06) == 0x06;
+        bool hasAVX512State = (enabledStates & 0xe6) == 0xe6;
+
+        bool hasAVX2 = false;
+        bool hasAVX512 = false;
+        if (7 <= maximumLeaf) {
+            __cpuidex(info, 7, 0);
+            hasAVX2 = (info[1] & (1 << 5)) != 0;
+            hasAVX512 = (info[1] & (1 << 16)) != 0;
+        }
+
+        if (hasAVX512 && hasAVX512State) {
+            return InstructionSet::AVX512;
+        }
+        if (hasAVX && hasAVX2 && hasFMA && hasAVXState) {
+            return InstructionSet::AVX2;
+        }
+        if (hasSSE4) {
+            return InstructionSet::SSE4;
+        }
+#else
+        __builtin_cpu_init();
+
+        if (__builtin_cpu_supports("avx512f")) {
+            return InstructionSet::AVX512;
+        }
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+            return InstructionSet::AVX2;
+        }
+        if (__builtin_cpu_supports("sse4.1")) {
+            return InstructionSet::SSE4;
+        }
+#endif
+#endif
+        return InstructionSet::SCALAR;
+    }
+
+    inline std::atomic<InstructionSet>& instructionSetStorage() {
+        static std::atomic<InstructionSet> instructionSet(detectInstructionSet());
+        return instructionSet;
+    }
+
+    /*
+     * <p>
+     * Returns the instruction set which the vectorized kernels use; it is detected once on the first call.
+     * </p>
+     *
+     * @return the active instruction set
+     */
+    inline InstructionSet activeInstructionSet() {
+        return instructionSetStorage().load(std::memory_order_relaxed);
+    }
+
+    /*
+     * <p>
+     * Restricts the vectorized kernels to the given instruction set, e.g. to compare the results of different
+     * instruction sets or to measure their speed. An instruction set wider than the detected one is clamped to the
+     * detected one.
+     * </p>
+     *
+     * @param instructionSet the requested instruction set
+     * @return the instruction set which is active from now on
+     */
+    inline InstructionSet setInstructionSet(InstructionSet instructionSet) {
+        InstructionSet clamped = std::min(instructionSet, detectInstructionSet());
+        instructionSetStorage().store(clamped, std::memory_order_relaxed);
+        return clamped;
+    }
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ dispatch - end                                                                                               ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ multiplyAdd - begin                                                                                          ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+#if XVIGRA_SIMD_X86
+    XVIGRA_SIMD_TARGET("sse4.1")
+    inline std::size_t multiplyAddSSE4(float* target, const float* source, float weight, std::size_t size) {
+        __m128 weights = _mm_set1_ps(weight);
+        std::size_t index = 0;
+        for (; index + 4 <= size; index += 4) {
+            __m128 product = _mm_mul_ps(weights, _mm_loadu_ps(source + index));
+            _mm_storeu_ps(target + index, _mm_add_ps(_mm_loadu_ps(target + index), product));
+        }
+        return index;
+    }
+
+    XVIGRA_SIMD_TARGET("sse4.1")
+    inline std::size_t multiplyAddSSE4(double* target, const double* source, double weight, std::size_t size) {
+        __m128d weights = _mm_set1_pd(weight);
+        std::size_t index = 0;
+        for (; index + 2 <= size; index += 2) {
+            __m128d product = _mm_mul_pd(weights, _mm_loadu_pd(source + index));
+            _mm_storeu_pd(target + index, _mm_add_pd(_mm_loadu_pd(target + index), product));
+        }
+        return index;
+    }
+
+    XVIGRA_SIMD_TARGET("avx2,fma")
+    inline std::size_t multiplyAddAVX2(float* target, const float* source, float weight, std::size_t size) {
+        __m256 weights = _mm256_set1_ps(weight);
+        std::size_t index = 0;
+        for (; index + 8 <= size; index += 8) {
+            __m256 sum = _mm256_fmadd_ps(weights, _mm256_loadu_ps(source + index), _mm256_loadu_ps(target + index));
+            _mm256_storeu_ps(target + index, sum);
+        }
+        return index;
+    }
+
+    XVIGRA_SIMD_TARGET("avx2,fma")
+    inline std::size_t multiplyAddAVX2(double* target, const double* source, double weight, std::size_t size) {
+        __m256d weights = _mm256_set1_pd(weight);
+        std::size_t index = 0;
+        for (; index + 4 <= size; index += 4) {
+            __m256d sum = _mm256_fmadd_pd(weights, _mm256_loadu_pd(source + index), _mm256_loadu_pd(target + index));
+            _mm256_storeu_pd(target + index, sum);
+        }
+        return index;
+    }
+
+    XVIGRA_SIMD_TARGET("avx512f")
+    inline std::size_t multiplyAddAVX512(float* target, const float* source, float weight, std::size_t size) {
+        __m512 weights = _mm512_set1_ps(weight);
+        std::size_t index = 0;
+        for (; index + 16 <= size; index += 16) {
+            __m512 sum = _mm512_fmadd_ps(weights, _mm512_loadu_ps(source + index), _mm512_loadu_ps(target + index));
+            _mm512_storeu_ps(target + index, sum);
+        }
+        return index;
+    }
+
+    XVIGRA_SIMD_TARGET("avx512f")
+    inline std::size_t multiplyAddAVX512(double* target, const double* source, double weight, std::size_t size) {
+        __m512d weights = _mm512_set1_pd(weight);
+        std::size_t index = 0;
+        for (; index + 8 <= size; index += 8) {
+            __m512d sum = _mm512_fmadd_pd(weights, _mm512_loadu_pd(source + index), _mm512_loadu_pd(target + index));
+            _mm512_storeu_pd(target + index, sum);
+        }
+        return index;
+    }
+#endif
+
+    /*
+     * <p>
+     * Adds the weighted source to the target: target[i] += weight * source[i] for i < size. This is the inner loop
+     * of the direct convolutions. For float and double it runs on the active instruction set; with AVX2 and AVX512
+     * the products are fused into the sum, so the result may differ from the scalar one in the last bit.
+     * </p>
+     *
+     * @tparam T value type of the target and the source
+     * @param target the accumulated row
+     * @param source the row which is weighted and added
+     * @param weight the weight of the source
+     * @param size number of elements in both rows
+     */
+    template <typename T>
+    void multiplyAdd(T* target, const T* source, T weight, std::size_t size) {
+        std::size_t index = 0;
+
+#if XVIGRA_SIMD_X86
+        if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>) {
+            switch (activeInstructionSet()) {
+                case InstructionSet::AVX512:
+                    index = multiplyAddAVX512(target, source, weight, size);
+                    break;
+                case InstructionSet::AVX2:
+                    index = multiplyAddAVX2(target, source, weight, size);
+                    break;
+                case InstructionSet::SSE4:
+                    index = multiplyAddSSE4(target, source, weight, size);
+                    break;
+                default:
+                    break;
+            }
+        }
+#endif
+
+        for (; index < size; ++index) {
+            target[index] += weight * source[index];
+        }
+    }
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ multiplyAdd - end                                                                                            ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ multiplyAddFolded - begin                                                                                    ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+#if XVIGRA_SIMD_X86
+    template <bool IsSymmetric>
+    XVIGRA_SIMD_TARGET("sse4.1")
+    inline std::size_t multiplyAddFoldedSSE4(float* target, const float* first, const float* second, float weight, std::size_t size) {
+        __m128 weights = _mm_set1_ps(weight);
+        std::size_t index = 0;
+        for (; index + 4 <= size; index += 4) {
+            __m128 left = _mm_loadu_ps(first + index);
+            __m128 right = _mm_loadu_ps(second + index);
+            __m128 folded = IsSymmetric ? _mm_add_ps(left, right) : _mm_sub_ps(left, right);
+            _mm_storeu_ps(target + index, _mm_add_ps(_mm_loadu_ps(target + index), _mm_mul_ps(weights, folded)));
+        }
+        return index;
+    }
+
+    template <bool IsSymmetric>
+    XVIGRA_SIMD_TARGET("sse4.1")
+    inline std::size_t multiplyAddFoldedSSE4(double* target, const double* first, const double* second, double weight, std::size_t size) {
+        __m128d weights = _mm_set1_pd(weight);
+        std::size_t index = 0;
+        for (; index + 2 <= size; index += 2) {
+            __m128d left = _mm_loadu_pd(first + index);
+            __m128d right = _mm_loadu_pd(second + index);
+            __m128d folded = IsSymmetric ? _mm_add_pd(left, right) : _mm_sub_pd(left, right);
+            _mm_storeu_pd(target + index, _mm_add_pd(_mm_loadu_pd(target + index), _mm_mul_pd(weights, folded)));
+        }
+        return index;
+    }
+
+    template <bool IsSymmetric>
+    XVIGRA_SIMD_TARGET("avx2,fma")
+    inline std::size_t multiplyAddFoldedAVX2(float* target, const float* first, const float* second, float weight, std::size_t size) {
+        __m256 weights = _mm256_set1_ps(weight);
+        std::size_t index = 0;
+        for (; index + 8 <= size; index += 8) {
+            __m256 left = _mm256_loadu_ps(first + index);
+            __m256 right = _mm256_loadu_ps(second + index);
+            __m256 folded = IsSymmetric ? _mm256_add_ps(left, right) : _mm256_sub_ps(left, right);
+            __m256 sum = _mm256_fmadd_ps(weights, folded, _mm256_loadu_ps(target + index));
+            _mm256_storeu_ps(target + index, sum);
+        }
+        return index;
+    }
+
+    template <bool IsSymmetric>
+    XVIGRA_SIMD_TARGET("avx2,fma")
+    inline std::size_t multiplyAddFoldedAVX2(double* target, const double* first, const double* second, double weight, std::size_t size) {
+        __m256d weights = _mm256_set1_pd(weight);
+        std::size_t index = 0;
+        for (; index + 4 <= size; index += 4) {
+            __m256d left = _mm256_loadu_pd(first + index);
+            __m256d right = _mm256_loadu_pd(second + index);
+            __m256d folded = IsSymmetric ? _mm256_add_pd(left, right) : _mm256_sub_pd(left, right);
+            __m256d sum = _mm256_fmadd_pd(weights, folded, _mm256_loadu_pd(target + index));
+            _mm256_storeu_pd(target + index, sum);
+        }
+        return index;
+    }
+
+    template <bool IsSymmetric>
+    XVIGRA_SIMD_TARGET("avx512f")
+    inline std::size_t multiplyAddFoldedAVX512(float* target, const float* first, const float* second, float weight, std::size_t size) {
+        __m512 weights = _mm512_set1_ps(weight);
+        std::size_t index = 0;
+        for (; index + 16 <= size; index += 16) {
+            __m512 left = _mm512_loadu_ps(first + index);
+            __m512 right = _mm512_loadu_ps(second + index);
+            __m512 folded = IsSymmetric ? _mm512_add_ps(left, right) : _mm512_sub_ps(left, right);
+            __m512 sum = _mm512_fmadd_ps(weights, folded, _mm512_loadu_ps(target + index));
+            _mm512_storeu_ps(target + index, sum);
+        }
+        return index;
+    }
+
+    template <bool IsSymmetric>
+    XVIGRA_SIMD_TARGET("avx512f")
+    inline std::size_t multiplyAddFoldedAVX512(double* target, const double* first, const double* second, double weight, std::size_t size) {
+        __m512d weights = _mm512_set1_pd(weight);
+        std::size_t index = 0;
+        for (; index + 8 <= size; index += 8) {
+            __m512d left = _mm512_loadu_pd(first + index);
+            __m512d right = _mm512_loadu_pd(second + index);
+            __m512d folded = IsSymmetric ? _mm512_add_pd(left, right) : _mm512_sub_pd(left, right);
+            __m512d sum = _mm512_fmadd_pd(weights, folded, _mm512_loadu_pd(target + index));
+            _mm512_storeu_pd(target + index, sum);
+        }
+        return index;
+    }
+#endif
+
+    /*
+     * <p>
+     * Adds the weighted sum or difference of two sources to the target: target[i] += weight * (first[i] + second[i])
+     * for a symmetric and target[i] += weight * (first[i] - second[i]) for an antisymmetric pair of kernel taps, see
+     * xvigra::symmetricConvolve1D. Folding the pair before the multiplication halves the multiplications of
+     * xvigra::multiplyAdd. For float and double it runs on the active instruction set.
+     * </p>
+     *
+     * @tparam IsSymmetric whether the sources are added (true) or subtracted (false)
+     * @tparam T value type of the target and the sources
+     * @param target the accumulated row
+     * @param first the row of the first tap of the pair
+     * @param second the row of the mirrored tap of the pair
+     * @param weight the weight of the first tap
+     * @param size number of elements in all rows
+     */
+    template <bool IsSymmetric, typename T>
+    void multiplyAddFolded(T* target, const T* first, const T* second, T weight, std::size_t size) {
+        std::size_t index = 0;
+
+#if XVIGRA_SIMD_X86
+        if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>) {
+            switch (activeInstructionSet()) {
+                case InstructionSet::AVX512:
+                    index = multiplyAddFoldedAVX512<IsSymmetric>(target, first, second, weight, size);
+                    break;
+                case InstructionSet::AVX2:
+                    index = multiplyAddFoldedAVX2<IsSymmetric>(target, first, second, weight, size);
+                    break;
+                case InstructionSet::SSE4:
+                    index = multiplyAddFoldedSSE4<IsSymmetric>(target, first, second, weight, size);
+                    break;
+                default:
+                    break;
+            }
+        }
+#endif
+
+        for (; index < size; ++index) {
+            target[index] += weight * (IsSymmetric ? first[index] + second[index] : first[index] - second[index]);
+        }
+    }
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ multiplyAddFolded - end                                                                                      ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ multiplyAddChannelBlock - begin                                                                              ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+#if XVIGRA_SIMD_X86
+    XVIGRA_SIMD_TARGET("sse4.1")
+    inline std::size_t multiplyAddChannelBlockSSE4(float* target, const float* source, std::ptrdiff_t sourceStride, const float* weights, std::size_t pixels) {
+        for (std::size_t pixel = 0; pixel < pixels; ++pixel) {
+            const float* values = source + static_cast<std::ptrdiff_t>(pixel) * sourceStride;
+            float* sums = target + pixel * 8;
+            __m128 low = _mm_loadu_ps(sums);
+            __m128 high = _mm_loadu_ps(sums + 4);
+            for (int lane = 0; lane < 8; ++lane) {
+                __m128 value = _mm_set1_ps(values[lane]);
+                low = _mm_add_ps(low, _mm_mul_ps(value, _mm_loadu_ps(weights + lane * 8)));
+                high = _mm_add_ps(high, _mm_mul_ps(value, _mm_loadu_ps(weights + lane * 8 + 4)));
+            }
+            _mm_storeu_ps(sums, low);
+            _mm_storeu_ps(sums + 4, high);
+        }
+        return pixels;
+    }
+
+    XVIGRA_SIMD_TARGET("avx2,fma")
+    inline std::size_t multiplyAddChannelBlockAVX2(float* target, const float* source, std::ptrdiff_t sourceStride, const float* weights, std::size_t pixels) {
+        // the 8 x 8 weights stay in 8 registers for all pixels, 4 pixels are accumulated at once
+        __m256 rows[8];
+        for (int lane = 0; lane < 8; ++lane) {
+            rows[lane] = _mm256_loadu_ps(weights + lane * 8);
+        }
+
+        std::size_t pixel = 0;
+        for (; pixel + 4 <= pixels; pixel += 4) {
+            const float* values = source + static_cast<std::ptrdiff_t>(pixel) * sourceStride;
+            __m256 sums[4];
+            for (int offset = 0; offset < 4; ++offset) {
+                sums[offset] = _mm256_loadu_ps(target + (pixel + offset) * 8);
+            }
+            for (int lane = 0; lane < 8; ++lane) {
+                for (int offset = 0; offset < 4; ++offset) {
+                    sums[offset] = _mm256_fmadd_ps(_mm256_set1_ps(values[offset * sourceStride + lane]), rows[lane], sums[offset]);
+                }
+            }
+            for (int offset = 0; offset < 4; ++offset) {
+                _mm256_storeu_ps(target + (pixel + offset) * 8, sums[offset]);
+            }
+        }
+
+        for (; pixel < pixels; ++pixel) {
+            const float* values = source + static_cast<std::ptrdiff_t>(pixel) * sourceStride;
+            __m256 sum = _mm256_loadu_ps(target + pixel * 8);
+            for (int lane = 0; lane < 8; ++lane) {
+                sum = _mm256_fmadd_ps(_mm256_set1_ps(values[lane]), rows[lane], sum);
+            }
+            _mm256_storeu_ps(target + pixel * 8, sum);
+        }
+        return pixels;
+    }
+
+    XVIGRA_SIMD_TARGET("avx2,fma")
+    inline std::size_t multiplyAddChannelBlockAVX2(double* target, const double* source, std::ptrdiff_t sourceStride, const double* weights, std::size_t pixels) {
+        // 8 x 8 weights need all 16 registers, so they are read from the L1 cache instead
+        for (std::size_t pixel = 0; pixel < pixels; ++pixel) {
+            const double* values = source + static_cast<std::ptrdiff_t>(pixel) * sourceStride;
+            double* sums = target + pixel * 8;
+            __m256d low = _mm256_loadu_pd(sums);
+            __m256d high = _mm256_loadu_pd(sums + 4);
+            for (int lane = 0; lane < 8; ++lane) {
+                __m256d value = _mm256_set1_pd(values[lane]);
+                low = _mm256_fmadd_pd(value, _mm256_loadu_pd(weights + lane * 8), low);
+                high = _mm256_fmadd_pd(value, _mm256_loadu_pd(weights + lane * 8 + 4), high);
+            }
+            _mm256_storeu_pd(sums, low);
+            _mm256_storeu_pd(sums + 4, high);
+        }
+        return pixels;
+    }
+
+    XVIGRA_SIMD_TARGET("avx512f")
+    inline std::size_t multiplyAddChannelBlockAVX512(double* target, const double* source, std::ptrdiff_t sourceStride, const double* weights, std::size_t pixels) {
+        // the 8 x 8 weights stay in 8 registers for all pixels, 4 pixels are accumulated at once
+        __m512d rows[8];
+        for (int lane = 0; lane < 8; ++lane) {
+            rows[lane] = _mm512_loadu_pd(weights + lane * 8);
+        }
+
+        std::size_t pixel = 0;
+        for (; pixel + 4 <= pixels; pixel += 4) {
+            const double* values = source + static_cast<std::ptrdiff_t>(pixel) * sourceStride;
+            __m512d sums[4];
+            for (int offset = 0; offset < 4; ++offset) {
+                sums[offset] = _mm512_loadu_pd(target + (pixel + offset) * 8);
+            }
+            for (int lane = 0; lane < 8; ++lane) {
+                for (int offset = 0; offset < 4; ++offset) {
+                    sums[offset] = _mm512_fmadd_pd(_mm512_set1_pd(values[offset * sourceStride + lane]), rows[lane], sums[offset]);
+                }
+            }
+            for (int offset = 0; offset < 4; ++offset) {
+                _mm512_storeu_pd(target + (pixel + offset) * 8, sums[offset]);
+            }
+        }
+
+        for (; pixel < pixels; ++pixel) {
+            const double* values = source + static_cast<std::ptrdiff_t>(pixel) * sourceStride;
+            __m512d sum = _mm512_loadu_pd(target + pixel * 8);
+            for (int lane = 0; lane < 8; ++lane) {
+                sum = _mm512_fmadd_pd(_mm512_set1_pd(values[lane]), rows[lane], sum);
+            }
+            _mm512_storeu_pd(target + pixel * 8, sum);
+        }
+        return pixels;
+    }
+#endif
+
+    /*
+     * <p>
+     * Multiplies pixels of 8 channels with an 8 x 8 block of weights and adds the products to the target:
+     * target[p * 8 + o] += sum_i source[p * sourceStride + i] * weights[i * 8 + o] for p < pixels and o, i < 8.
+     * This is the inner loop of xvigra::convolve2DBlocked, where the 8 lanes of an input pixel are contiguous and
+     * every lane is broadcast straight from them while the weights are kept in registers for all pixels of the call.
+     * A source stride of 0 multiplies the same pixel (e.g. a constant border) into every target pixel.
+     * For float and double it runs on the active instruction set; an 8-lane float block fills a single AVX2
+     * register, so AVX512 hosts use the AVX2 kernel for float.
+     * </p>
+     *
+     * @tparam T value type of the target, the source and the weights
+     * @param target the accumulated pixels, 8 contiguous values per pixel
+     * @param source the first lane of the first source pixel
+     * @param sourceStride distance in elements between the first lanes of two consecutive source pixels
+     * @param weights the 8 x 8 weights, row major with the source lane as row and the target lane as column
+     * @param pixels number of pixels in the target and the source
+     */
+    template <typename T>
+    void multiplyAddChannelBlock(T* target, const T* source, std::ptrdiff_t sourceStride, const T* weights, std::size_t pixels) {
+        std::size_t pixel = 0;
+
+#if XVIGRA_SIMD_X86
+        if constexpr (std::is_same_v<T, float>) {
+            switch (activeInstructionSet()) {
+                case InstructionSet::AVX512:
+                case InstructionSet::AVX2:
+                    pixel = multiplyAddChannelBlockAVX2(target, source, sourceStride, weights, pixels);
+                    break;
+                case InstructionSet::SSE4:
+                    pixel = multiplyAddChannelBlockSSE4(target, source, sourceStride, weights, pixels);
+                    break;
+                default:
+                    break;
+            }
+        } else if constexpr (std::is_same_v<T, double>) {
+            switch (activeInstructionSet()) {
+                case InstructionSet::AVX512:
+                    pixel = multiplyAddChannelBlockAVX512(target, source, sourceStride, weights, pixels);
+                    break;
+                case InstructionSet::AVX2:
+                    pixel = multiplyAddChannelBlockAVX2(target, source, sourceStride, weights, pixels);
+                    break;
+                default:
+                    break;
+            }
+        }
+#endif
+
+        for (; pixel < pixels; ++pixel) {
+            const T* values = source + static_cast<std::ptrdiff_t>(pixel) * sourceStride;
+            T* sums = target + pixel * 8;
+            for (int lane = 0; lane < 8; ++lane) {
+                for (int column = 0; column < 8; ++column) {
+                    sums[column] += values[lane] * weights[lane * 8 + column];
+                }
+            }
+        }
+    }
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ multiplyAddChannelBlock - end                                                                                ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ convertRow - begin                                                                                           ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+#if XVIGRA_SIMD_X86
+    XVIGRA_SIMD_TARGET("sse4.1")
+    inline std::size_t convertRowSSE4(const std::int16_t* source, float* target, std::size_t size) {
+        std::size_t index = 0;
+        for (; index + 4 <= size; index += 4) {
+            __m128i values = _mm_cvtepi16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(source + index)));
+            _mm_storeu_ps(target + index, _mm_cvtepi32_ps(values));
+        }
+        return index;
+    }
+
+    XVIGRA_SIMD_TARGET("sse4.1")
+    inline std::size_t convertRowSSE4(const std::int32_t* source, float* target, std::size_t size) {
+        std::size_t index = 0;
+        for (; index + 4 <= size; index += 4) {
+            __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + index));
+            _mm_storeu_ps(target + index, _mm_cvtepi32_ps(values));
+        }
+        return index;
+    }
+
+    XVIGRA_SIMD_TARGET("avx2,fma")
+    inline std::size_t convertRowAVX2(const std::int16_t* source, float* target, std::size_t size) {
+        std::size_t index = 0;
+        for (; index + 8 <= size; index += 8) {
+            __m256i values = _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source + index)));
+            _mm256_storeu_ps(target + index, _mm256_cvtepi32_ps(values));
+        }
+        return index;
+    }
+
+    XVIGRA_SIMD_TARGET("avx2,fma")
+    inline std::size_t convertRowAVX2(const std::int32_t* source, float* target, std::size_t size) {
+        std::size_t index = 0;
+        for (; index + 8 <= size; index += 8) {
+            __m256i values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + index));
+            _mm256_storeu_ps(target + index, _mm256_cvtepi32_ps(values));
+        }
+        return index;
+    }
+#endif
+
+    /*
+     * <p>
+     * Copies a strided source row into a contiguous target row and converts every value to the target type:
+     * target[i] = source[i * sourceStride] for i < size. This gathers the interior of the im2col patches and of the
+     * direct convolutions. Contiguous rows of equal type are copied, contiguous 16-bit and 32-bit integer rows are
+     * converted to float with SSE4 or AVX2; everything else is converted element by element.
+     * </p>
+     *
+     * @tparam SourceType value type of the source
+     * @tparam TargetType value type of the target
+     * @param source first element of the source row
+     * @param sourceStride distance in elements between two consecutive source elements
+     * @param target first element of the target row
+     * @param size number of elements to convert
+     */
+    template <typename SourceType, typename TargetType>
+    void convertRow(const SourceType* source, std::ptrdiff_t sourceStride, TargetType* target, std::size_t size) {
+        std::size_t index = 0;
+
+        if (sourceStride == 1) {
+            if constexpr (std::is_same_v<SourceType, TargetType>) {
+                std::copy(source, source + size, target);
+                return;
+            }
+
+#if XVIGRA_SIMD_X86
+            if constexpr ((std::is_same_v<SourceType, std::int16_t> || std::is_same_v<SourceType, std::int32_t>)
+                          && std::is_same_v<TargetType, float>) {
+                // the conversion is bound by the memory bandwidth, so AVX512 hosts use the AVX2 kernel as well
+                switch (activeInstructionSet()) {
+                    case InstructionSet::AVX512:
+                    case InstructionSet::AVX2:
+                        index = convertRowAVX2(source, target, size);
+                        break;
+                    case InstructionSet::SSE4:
+                        index = convertRowSSE4(source, target, size);
+                        break;
+                    default:
+                        break;
+                }
+            }
+#endif
+        }
+
+        for (; index < size; ++index) {
+            target[index] = static_cast<TargetType>(source[static_cast<std::ptrdiff_t>(index) * sourceStride]);
+        }
+    }
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ convertRow - end                                                                                             ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+}
+
+#endif // XVIGRA_SIMD_UTIL_HPP
@@ -0,0 +1,446 @@
+#ifndef XVIGRA_SPARSE_CONVOLUTION_HPP
+#define XVIGRA_SPARSE_CONVOLUTION_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#ifdef VOID
+#undef VOID
+#endif
+
+#include "xtensor/xtensor.hpp"
+#include "xtensor/xview.hpp"
+
+#include "xvigra/convolution_util.hpp"
+#include "xvigra/direct_convolution.hpp"
+#include "xvigra/epilogue.hpp"
+#include "xvigra/simd_util.hpp"
+#include "xvigra/thread_util.hpp"
+#include "xvigra/workspace.hpp"
+
+namespace xvigra {
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ sparse kernel - begin                                                                                        ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    /*
+     * <p>
+     * Fraction of non-zero kernel taps up to which the explicit 2-dimensional convolution of a channel first input
+     * with Algorithm::AUTO skips the im2col patch and only gathers the non-zero taps, see
+     * xvigra::SparseKernel2D#isSparse. Every tap is a vectorized row update there, which beats the GEMM-based
+     * algorithm up to about half of the taps for 3 to 64 channels; the threshold keeps a margin below that.
+     * </p>
+     */
+    constexpr double SPARSE_TAP_DENSITY = 0.25;
+
+    /*
+     * <p>
+     * Fraction of non-zero kernel taps up to which a channel last input takes the sparse gather, see
+     * xvigra::SPARSE_TAP_DENSITY. Its taps are gathered one scalar at a time for every output channel, so the
+     * GEMM-based algorithm is already faster from about 5% non-zero taps on for 16 and 64 channels.
+     * See benchmark_convolve2D_sparseKernel_channelLast.
+     * </p>
+     */
+    constexpr double SPARSE_TAP_DENSITY_CHANNEL_LAST = 0.03;
+
+    /*
+     * <p>
+     * Non-zero tap of a full 2-dimensional kernel for a single output channel.
+     * </p>
+     */
+    template <typename ResultType>
+    struct KernelTap {
+        std::size_t inputChannel;
+        std::size_t kernelY;
+        std::size_t kernelX;
+        ResultType weight;
+    }; // KernelTap
+
+    /*
+     * <p>
+     * Compact list of the non-zero taps of a full kernel of shape OC x IC x KH x KW, see xvigra::collectNonZeroTaps.
+     * The taps of output channel c are stored in taps[offsets[c]] to taps[offsets[c + 1] - 1], ordered by input
+     * channel, kernel row and kernel column, so that consecutive taps read neighbouring input rows.
+     * </p>
+     */
+    template <typename ResultType>
+    struct SparseKernel2D {
+        std::size_t outputChannels = 0;
+        std::size_t inputChannels = 0;
+        std::size_t kernelHeight = 0;
+        std::size_t kernelWidth = 0;
+
+        std::vector<std::size_t> offsets;
+        std::vector<KernelTap<ResultType>> taps;
+
+        double density() const;
+        bool isSparse(ChannelPosition) const;
+    }; // SparseKernel2D
+
+    /*
+     * <p>
+     * Returns the fraction of non-zero taps of the kernel; 1 for an empty kernel, so that it is never treated as
+     * sparse.
+     * </p>
+     */
+    template <typename ResultType>
+    double SparseKernel2D<ResultType>::density() const {
+        std::size_t totalTaps = this->outputChannels * this->inputChannels * this->kernelHeight * this->kernelWidth;
+        return totalTaps == 0 ? 1.0 : static_cast<double>(this->taps.size()) / static_cast<double>(totalTaps);
+    }
+
+    /*
+     * <p>
+     * Returns whether the kernel is sparse enough for xvigra::sparseConvolve2D on an input with the given channel
+     * position, see xvigra::SPARSE_TAP_DENSITY and xvigra::SPARSE_TAP_DENSITY_CHANNEL_LAST.
+     * </p>
+     */
+    template <typename ResultType>
+    bool SparseKernel2D<ResultType>::isSparse(ChannelPosition channelPosition) const {
+        return this->density() <= (channelPosition == ChannelPosition::LAST ? SPARSE_TAP_DENSITY_CHANNEL_LAST : SPARSE_TAP_DENSITY);
+    }
+
+    /*
+     * <p>
+     * Analyzes the full kernel and collects its non-zero taps into a xvigra::SparseKernel2D. The weights are
+     * converted to the result type once, so a weight which only becomes zero by the conversion is skipped as well.
+     * </p>
+     *
+     * @tparam ResultType value type of the result
+     * @param kernel full kernel of shape OC x IC x KH x KW
+     * @return the non-zero taps of the kernel grouped by output channel
+     */
+    template <typename ResultType, typename KernelType>
+    SparseKernel2D<ResultType> collectNonZeroTaps(const xt::xtensor<KernelType, 4>& kernel) {
+        SparseKernel2D<ResultType> sparseKernel;
+        sparseKernel.outputChannels = kernel.shape()[0];
+        sparseKernel.inputChannels = kernel.shape()[1];
+        sparseKernel.kernelHeight = kernel.shape()[2];
+        sparseKernel.kernelWidth = kernel.shape()[3];
+        sparseKernel.offsets.reserve(sparseKernel.outputChannels + 1);
+        sparseKernel.offsets.push_back(0);
+
+        for (std::size_t outputChannel = 0; outputChannel < sparseKernel.outputChannels; ++outputChannel) {
+            for (std::size_t inputChannel = 0; inputChannel < sparseKernel.inputChannels; ++inputChannel) {
+                for (std::size_t kernelY = 0; kernelY < sparseKernel.kernelHeight; ++kernelY) {
+                    for (std::size_t kernelX = 0; kernelX < sparseKernel.kernelWidth; ++kernelX) {
+                        ResultType weight = static_cast<ResultType>(kernel(outputChannel, inputChannel, kernelY, kernelX));
+
+                        if (weight != static_cast<ResultType>(0)) {
+                            sparseKernel.taps.push_back({inputChannel, kernelY, kernelX, weight});
+                        }
+                    }
+                }
+            }
+
+            sparseKernel.offsets.push_back(sparseKernel.taps.size());
+        }
+
+        return sparseKernel;
+    }
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ sparse kernel - end                                                                                          ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ sparseConvolve2D - begin                                                                                     ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    /*
+     * <p>
+     * Gather tables of a sparse 2-dimensional convolution: the gather indices of both axes, see
+     * xvigra::calculateGatherIndices, the values of constant borders and the output columns whose taps read
+     * contiguous input rows.
+     * </p>
+     */
+    template <typename ResultType>
+    struct SparseGather2D {
+        std::vector<int> indicesY;
+        std::vector<int> indicesX;
+
+        std::size_t outputHeight;
+        std::size_t outputWidth;
+        std::size_t vectorBegin;
+        std::size_t vectorEnd;
+
+        ResultType constantBeginY;
+        ResultType constantEndY;
+        ResultType constantBeginX;
+        ResultType constantEndX;
+    }; // SparseGather2D
+
+    /*
+     * <p>
+     * Builds the gather tables of a sparse 2-dimensional convolution for an input of the given size.
+     * </p>
+     *
+     * @tparam ResultType value type of the result
+     * @tparam InputType value type of the input, which determines the constant border values
+     * @param inputHeight number of input elements along the height
+     * @param inputWidth number of input elements along the width
+     * @param kernelHeight number of kernel taps along the height
+     * @param kernelWidth number of kernel taps along the width
+     * @param optionsY object containing information about padding, stride, dilation and border treatment along the
+                       height
+     * @param optionsX object containing information about padding, stride, dilation and border treatment along the
+                       width
+     * @return the gather tables
+     */
+    template <typename ResultType, typename InputType>
+    SparseGather2D<ResultType> calculateSparseGather2D(
+        std::size_t inputHeight,
+        std::size_t inputWidth,
+        std::size_t kernelHeight,
+        std::size_t kernelWidth,
+        const xvigra::KernelOptions& optionsY,
+        const xvigra::KernelOptions& optionsX
+    ) {
+        SparseGather2D<ResultType> gather;
+        gather.indicesY = xvigra::calculateGatherIndices(static_cast<int>(inputHeight), static_cast<int>(kernelHeight), optionsY);
+        gather.indicesX = xvigra::calculateGatherIndices(static_cast<int>(inputWidth), static_cast<int>(kernelWidth), optionsX);
+        gather.outputHeight = gather.indicesY.size() / kernelHeight;
+        gather.outputWidth = gather.indicesX.size() / kernelWidth;
+
+        // without stride along the width, the interior of every tap reads a contiguous input row
+        auto [interiorBeginX, interiorEndX] = xvigra::calculateInteriorRange(static_cast<int>(inputWidth), static_cast<int>(kernelWidth), optionsX);
+        gather.vectorBegin = optionsX.stride == 1 ? static_cast<std::size_t>(interiorBeginX) : gather.outputWidth;
+        gather.vectorEnd = optionsX.stride == 1 ? static_cast<std::size_t>(interiorEndX) : gather.outputWidth;
+
+        gather.constantBeginY = xvigra::gatherConstant<InputType, ResultType>(optionsY, xvigra::CONSTANT_BEGIN_INDEX);
+        gather.constantEndY = xvigra::gatherConstant<InputType, ResultType>(optionsY, xvigra::CONSTANT_END_INDEX);
+        gather.constantBeginX = xvigra::gatherConstant<InputType, ResultType>(optionsX, xvigra::CONSTANT_BEGIN_INDEX);
+        gather.constantEndX = xvigra::gatherConstant<InputType, ResultType>(optionsX, xvigra::CONSTANT_END_INDEX);
+
+        return gather;
+    }
+
+    /*
+     * <p>
+     * Accumulates the non-zero taps of the sparse kernel into the output rows rowBegin to rowEnd - 1 of a single
+     * image. The output holds the rows outputFirstRow to outputFirstRow + outputRows - 1, which is either the whole
+     * image or a tile of its rows. It must be initialized, usually with zeros; rows outside of the range are not
+     * touched, so disjoint row ranges can be accumulated concurrently.
+     * For channel first inputs every tap is a scaled copy of an input row, which runs on the active instruction set
+     * for inputs of the result type, see xvigra::multiplyAdd. For channel last inputs every output pixel gathers the
+     * taps of each output channel.
+     * </p>
+     *
+     * @tparam ResultType value type of the result
+     * @tparam InputType value type of the input
+     * @param sparseKernel non-zero taps of the kernel, see xvigra::collectNonZeroTaps
+     * @param gather gather tables, see xvigra::calculateSparseGather2D
+     * @param input contiguous input of shape H x W x C or C x H x W
+     * @param isChannelFirst whether input and output store the channels first
+     * @param inputHeight number of input elements along the height
+     * @param inputWidth number of input elements along the width
+     * @param output contiguous output of shape R x W' x OC or OC x R x W' for R = outputRows
+     * @param outputFirstRow output row which is stored first in the output
+     * @param outputRows number of output rows stored in the output
+     * @param rowBegin first output row
+     * @param rowEnd end of the output rows
+     */
+    template <typename ResultType, typename InputType>
+    void accumulateSparseRows2D(
+        const SparseKernel2D<ResultType>& sparseKernel,
+        const SparseGather2D<ResultType>& gather,
+        const InputType* input,
+        bool isChannelFirst,
+        std::size_t inputHeight,
+        std::size_t inputWidth,
+        ResultType* output,
+        std::size_t outputFirstRow,
+        std::size_t outputRows,
+        std::size_t rowBegin,
+        std::size_t rowEnd
+    ) {
+        std::size_t outputChannels = sparseKernel.outputChannels;
+        std::size_t inputChannels = sparseKernel.inputChannels;
+        std::size_t outputHeight = gather.outputHeight;
+        std::size_t outputWidth = gather.outputWidth;
+
+        if (isChannelFirst) {
+            for (std::size_t outputChannel = 0; outputChannel < outputChannels; ++outputChannel) {
+                for (std::size_t outIndexY = rowBegin; outIndexY < rowEnd; ++outIndexY) {
+                    ResultType* outRow = output + (outputChannel * outputRows + outIndexY - outputFirstRow) * outputWidth;
+
+                    for (std::size_t tap = sparseKernel.offsets[outputChannel]; tap < sparseKernel.offsets[outputChannel + 1]; ++tap) {
+                        const KernelTap<ResultType>& kernelTap = sparseKernel.taps[tap];
+                        int inputY = gather.indicesY[kernelTap.kernelY * outputHeight + outIndexY];
+
+                        if (inputY < 0) {
+                            ResultType value = kernelTap.weight * (inputY == xvigra::CONSTANT_BEGIN_INDEX ? gather.constantBeginY : gather.constantEndY);
+                            for (std::size_t outIndexX = 0; outIndexX < outputWidth; ++outIndexX) {
+                                outRow[outIndexX] += value;
+                            }
+                            continue;
+                        }
+
+                        const InputType* inRow = input + (kernelTap.inputChannel * inputHeight + static_cast<std::size_t>(inputY)) * inputWidth;
+                        const int* indexRow = gather.indicesX.data() + kernelTap.kernelX * outputWidth;
+
+                        auto accumulateRange = [&](std::size_t rangeBegin, std::size_t rangeEnd) {
+                            for (std::size_t outIndexX = rangeBegin; outIndexX < rangeEnd; ++outIndexX) {
+                                int inputX = indexRow[outIndexX];
+                                ResultType value = 0 <= inputX
+                                    ? static_cast<ResultType>(inRow[inputX])
+                                    : (inputX == xvigra::CONSTANT_BEGIN_INDEX ? gather.constantBeginX : gather.constantEndX);
+                                outRow[outIndexX] += kernelTap.weight * value;
+                            }
+                        };
+
+                        if constexpr (std::is_same_v<InputType, ResultType>) {
+                            if (gather.vectorBegin < gather.vectorEnd) {
+                                xvigra::multiplyAdd(outRow + gather.vectorBegin, inRow + indexRow[gather.vectorBegin], kernelTap.weight, gather.vectorEnd - gather.vectorBegin);
+                                accumulateRange(0, gather.vectorBegin);
+                                accumulateRange(gather.vectorEnd, outputWidth);
+                                continue;
+                            }
+                        }
+
+                        accumulateRange(0, outputWidth);
+                    }
+                }
+            }
+        } else {
+            for (std::size_t outIndexY = rowBegin; outIndexY < rowEnd; ++outIndexY) {
+                for (std::size_t outIndexX = 0; outIndexX < outputWidth; ++outIndexX) {
+                    ResultType* accumulator = output + ((outIndexY - outputFirstRow) * outputWidth + outIndexX) * outputChannels;
+
+                    for (std::size_t outputChannel = 0; outputChannel < outputChannels; ++outputChannel) {
+                        ResultType sum = static_cast<ResultType>(0);
+
+                        for (std::size_t tap = sparseKernel.offsets[outputChannel]; tap < sparseKernel.offsets[outputChannel + 1]; ++tap) {
+                            const KernelTap<ResultType>& kernelTap = sparseKernel.taps[tap];
+                            int inputY = gather.indicesY[kernelTap.kernelY * outputHeight + outIndexY];
+                            int inputX = gather.indicesX[kernelTap.kernelX * outputWidth + outIndexX];
+
+                            ResultType value;
+                            if (inputY < 0) {
+                                value = inputY == xvigra::CONSTANT_BEGIN_INDEX ? gather.constantBeginY : gather.constantEndY;
+                            } else if (inputX < 0) {
+                                value = inputX == xvigra::CONSTANT_BEGIN_INDEX ? gather.constantBeginX : gather.constantEndX;
+                            } else {
+                                value = static_cast<ResultType>(input[(static_cast<std::size_t>(inputY) * inputWidth + static_cast<std::size_t>(inputX)) * inputChannels + kernelTap.inputChannel]);
+                            }
+
+                            sum += kernelTap.weight * value;
+                        }
+
+                        accumulator[outputChannel] += sum;
+                    }
+                }
+            }
+        }
+    }
+
+    /*
+     * <p>
+     * Calculates the explicit 2-dimensional convolution with a gather-accumulate loop over the non-zero taps of the
+     * kernel only. No im2col patch is built and zero taps cost nothing, which makes this backend preferable to the
+     * GEMM-based one for sparse kernels like derivative stencils, Laplacians, rings or dilated patterns.
+     * The output rows are distributed over the threads of optionsY. For channel first inputs of another type than the
+     * result, the input is converted once into memory drawn from the workspace of the options.
+     * Every thread accumulates its rows in tiles of workspace memory within the workspace limit of optionsY and
+     * writes every tile into the output with the epilogue applied, see xvigra::applyEpilogueTile.
+     * The caller is responsible for the validation of the input and kernel and for the shape of the output; see
+     * xvigra::convolve2D.
+     * </p>
+     *
+     * @tparam ResultType value type of the result
+     * @tparam InputContainerType row major container of the input, see xvigra::evaluateContiguous
+     * @tparam R derived type of the output xexpression
+     * @param input input of shape H x W x C or C x H x W
+     * @param sparseKernel non-zero taps of the full kernel, see xvigra::collectNonZeroTaps
+     * @param optionsY object containing information about padding, stride, dilation, channel position and border
+                       treatment along the height
+     * @param optionsX object containing information about padding, stride, dilation, channel position and border
+                       treatment along the width
+     * @param epilogue bias, scale, clipping and rounding which are applied to the result
+     * @param output output of shape H' x W' x OC or OC x H' x W', which receives the result
+     */
+    template <typename ResultType, typename InputType, typename InputContainerType, typename R>
+    void sparseConvolve2D(
+        const InputContainerType& input,
+        const SparseKernel2D<ResultType>& sparseKernel,
+        const xvigra::KernelOptions& optionsY,
+        const xvigra::KernelOptions& optionsX,
+        const xvigra::Epilogue& epilogue,
+        R& output
+    ) {
+        bool isChannelFirst = optionsY.channelPosition == xvigra::ChannelPosition::FIRST;
+
+        std::size_t inputChannels = input.shape()[isChannelFirst ? 0 : 2];
+        std::size_t inputHeight = input.shape()[isChannelFirst ? 1 : 0];
+        std::size_t inputWidth = input.shape()[isChannelFirst ? 2 : 1];
+        std::size_t outputChannels = sparseKernel.outputChannels;
+
+        SparseGather2D<ResultType> gather = xvigra::calculateSparseGather2D<ResultType, InputType>(
+            inputHeight,
+            inputWidth,
+            sparseKernel.kernelHeight,
+            sparseKernel.kernelWidth,
+            optionsY,
+            optionsX
+        );
+        std::size_t outputHeight = gather.outputHeight;
+        std::size_t outputWidth = gather.outputWidth;
+
+        xvigra::Workspace& workspace = xvigra::resolveWorkspace(optionsY.workspace);
+        xvigra::Workspace::Scope workspaceScope(workspace);
+
+        // the rows of the result type let the interior of every tap run on the active instruction set
+        const InputType* in = input.data();
+        const ResultType* rows = isChannelFirst
+            ? xvigra::convertDirectInput<ResultType>(in, inputChannels * inputHeight * inputWidth, workspace)
+            : nullptr;
+
+        // a tile holds all output channels of a range of output rows
+        std::size_t tileHeight = static_cast<std::size_t>(
+            xvigra::calculateTileSize(optionsY.workspaceLimit, outputChannels * outputWidth * sizeof(ResultType), static_cast<int>(outputHeight))
+        );
+
+        xvigra::parallelFor(0, static_cast<int>(outputHeight), optionsY.threadCount, [&](int rowBegin, int rowEnd) {
+            // the workspace of the options belongs to the calling thread, which runs the first chunk
+            xvigra::Workspace& chunkWorkspace = rowBegin == 0 ? workspace : xvigra::threadLocalWorkspace();
+            xvigra::Workspace::Scope chunkScope(chunkWorkspace);
+            ResultType* tile = chunkWorkspace.allocate<ResultType>(outputChannels * tileHeight * outputWidth);
+
+            for (std::size_t tileBegin = static_cast<std::size_t>(rowBegin); tileBegin < static_cast<std::size_t>(rowEnd); tileBegin += tileHeight) {
+                std::size_t tileEnd = std::min(tileBegin + tileHeight, static_cast<std::size_t>(rowEnd));
+                std::size_t tileRows = tileEnd - tileBegin;
+                std::fill(tile, tile + outputChannels * tileRows * outputWidth, static_cast<ResultType>(0));
+
+                if (isChannelFirst) {
+                    xvigra::accumulateSparseRows2D(sparseKernel, gather, rows, true, inputHeight, inputWidth, tile, tileBegin, tileRows, tileBegin, tileEnd);
+                    xvigra::applyEpilogueTile(
+                        tile,
+                        std::array<std::size_t, 3>{outputChannels, tileRows, outputWidth},
+                        epilogue,
+                        0,
+                        xt::view(output, xt::all(), xt::range(tileBegin, tileEnd), xt::all())
+                    );
+                } else {
+                    xvigra::accumulateSparseRows2D(sparseKernel, gather, in, false, inputHeight, inputWidth, tile, tileBegin, tileRows, tileBegin, tileEnd);
+                    xvigra::applyEpilogueTile(
+                        tile,
+                        std::array<std::size_t, 3>{tileRows, outputWidth, outputChannels},
+                        epilogue,
+                        2,
+                        xt::view(output, xt::range(tileBegin, tileEnd), xt::all(), xt::all())
+                    );
+                }
+            }
+        });
+    }
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ sparseConvolve2D - end                                                                                       ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+} // xvigra
+
+#endif // XVIGRA_SPARSE_CONVOLUTION_HPP
@@ -0,0 +1,379 @@
+#ifndef XVIGRA_THREAD_UTIL_HPP
+#define XVIGRA_THREAD_UTIL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <ostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+// the thread count of OpenBLAS is controlled through its C interface, other BLAS libraries can be connected with
+// xvigra::setBlasThreadFunctions
+#if defined(XVIGRA_USE_OPENBLAS)
+extern "C" {
+    void openblas_set_num_threads(int);
+    int openblas_get_num_threads(void);
+}
+#endif
+
+namespace xvigra {
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ forward declaration - begin                                                                                  ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    enum class ThreadingMode;
+
+    inline ThreadingMode activeThreadingMode();
+
+    inline ThreadingMode setThreadingMode(ThreadingMode);
+
+    inline bool isInParallelRegion();
+
+    class ParallelRegion;
+
+    inline void setBlasThreadFunctions(int (*)(), void (*)(int));
+
+    inline int resolveBlasThreadCount(int);
+
+    class BlasThreadScope;
+
+    inline int resolveThreadCount(int);
+
+    template <typename Function>
+    void parallelFor(int, int, int, const Function&);
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ forward declaration - end                                                                                    ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ enum class ThreadingMode - begin                                                                             ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    /*
+     * <p>
+     * Coordination of the BLAS threads with the parallelism of xvigra and of the caller:
+     * UNMANAGED leaves the thread count of the BLAS library untouched, so every product uses its whole thread pool.
+     * BUDGET runs every BLAS call of a convolution with the thread count of its options (KernelOptions::threadCount).
+     * SINGLE_IN_PARALLEL behaves like BUDGET, but inside a parallel region (see xvigra::ParallelRegion) BLAS calls and
+     * nested xvigra::parallelFor calls are single-threaded, so concurrent callers don't oversubscribe the cores.
+     * </p>
+     */
+    enum class ThreadingMode {
+        UNMANAGED,
+        BUDGET,
+        SINGLE_IN_PARALLEL
+    }; // ThreadingMode
+
+    inline std::ostream& operator<<(std::ostream& out, const ThreadingMode& threadingMode) {
+        switch (threadingMode) {
+            case ThreadingMode::UNMANAGED:
+                return out << "ThreadingMode::UNMANAGED";
+            case ThreadingMode::BUDGET:
+                return out << "ThreadingMode::BUDGET";
+            case ThreadingMode::SINGLE_IN_PARALLEL:
+                return out << "ThreadingMode::SINGLE_IN_PARALLEL";
+            default:
+                return out << "ThreadingMode::UNKNOWN";
+        }
+    }
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ enum class ThreadingMode - end                                                                               ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ threading configuration - begin                                                                              ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    inline std::atomic<ThreadingMode>& threadingModeStorage() {
+        static std::atomic<ThreadingMode> threadingMode(ThreadingMode::UNMANAGED);
+        return threadingMode;
+    }
+
+    inline int& parallelRegionDepth() {
+        thread_local int depth = 0;
+        return depth;
+    }
+
+    /*
+     * <p>
+     * Returns the threading mode of the library, which is ThreadingMode::UNMANAGED until it is set.
+     * </p>
+     *
+     * @return the active threading mode
+     */
+    inline ThreadingMode activeThreadingMode() {
+        return threadingModeStorage().load(std::memory_order_relaxed);
+    }
+
+    /*
+     * <p>
+     * Sets the threading mode of the library for all threads.
+     * </p>
+     *
+     * @param threadingMode the requested threading mode
+     * @return the threading mode which was active before
+     */
+    inline ThreadingMode setThreadingMode(ThreadingMode threadingMode) {
+        return threadingModeStorage().exchange(threadingMode, std::memory_order_relaxed);
+    }
+
+    /*
+     * <p>
+     * Returns whether the calling thread is inside a parallel region, either a chunk of a multi-threaded
+     * xvigra::parallelFor or an xvigra::ParallelRegion of the caller.
+     * </p>
+     *
+     * @return true if the calling thread is inside a parallel region
+     */
+    inline bool isInParallelRegion() {
+        return 0 < parallelRegionDepth();
+    }
+
+    /*
+     * <p>
+     * Marks the calling thread as part of a parallel region for the lifetime of the object. Callers which run several
+     * convolutions concurrently create one region per thread, so with ThreadingMode::SINGLE_IN_PARALLEL every
+     * convolution stays on its own thread. Regions can be nested.
+     * </p>
+     */
+    class ParallelRegion {
+    public:
+        ParallelRegion() {
+            ++parallelRegionDepth();
+        }
+
+        ~ParallelRegion() {
+            --parallelRegionDepth();
+        }
+
+        ParallelRegion(const ParallelRegion&) = delete;
+        ParallelRegion& operator=(const ParallelRegion&) = delete;
+    }; // ParallelRegion
+
+    struct BlasThreadFunctions {
+        std::atomic<int (*)()> getThreadCount;
+        std::atomic<void (*)(int)> setThreadCount;
+    };
+
+    inline BlasThreadFunctions& blasThreadFunctionsStorage() {
+#if defined(XVIGRA_USE_OPENBLAS)
+        static BlasThreadFunctions functions{{&openblas_get_num_threads}, {&openblas_set_num_threads}};
+#else
+        static BlasThreadFunctions functions{{nullptr}, {nullptr}};
+#endif
+        return functions;
+    }
+
+    /*
+     * <p>
+     * Connects the BLAS library whose thread count is controlled by the threading mode. With XVIGRA_USE_OPENBLAS
+     * defined, OpenBLAS is connected by default; without a setter the BLAS threads are never changed.
+     * </p>
+     *
+     * @param getThreadCount function returning the current thread count of the BLAS library, may be nullptr
+     * @param setThreadCount function setting the thread count of the BLAS library, may be nullptr
+     */
+    inline void setBlasThreadFunctions(int (*getThreadCount)(), void (*setThreadCount)(int)) {
+        blasThreadFunctionsStorage().getThreadCount.store(getThreadCount);
+        blasThreadFunctionsStorage().setThreadCount.store(setThreadCount);
+    }
+
+    /*
+     * <p>
+     * Resolves the number of BLAS threads of a product of a convolution with the given thread count according to the
+     * threading mode; ThreadingMode::UNMANAGED returns 0 for no change.
+     * </p>
+     *
+     * @param threadCount thread count of the convolution, see xvigra::resolveThreadCount
+     * @return the number of BLAS threads or 0 if the BLAS threads are not managed
+     * @throws std::invalid_argument if threadCount is negative
+     */
+    inline int resolveBlasThreadCount(int threadCount) {
+        int resolvedThreadCount = resolveThreadCount(threadCount);
+
+        switch (activeThreadingMode()) {
+            case ThreadingMode::UNMANAGED:
+                return 0;
+            case ThreadingMode::SINGLE_IN_PARALLEL:
+                return isInParallelRegion() ? 1 : resolvedThreadCount;
+            default:
+                return resolvedThreadCount;
+        }
+    }
+
+    inline std::mutex& blasThreadMutex() {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    /*
+     * <p>
+     * Sets the BLAS threads for the lifetime of the object to the count resolved by xvigra::resolveBlasThreadCount and
+     * restores the previous count when the last scope ends. The thread count of BLAS libraries like OpenBLAS is a
+     * single process wide setting, so overlapping scopes of different threads should request the same count, which
+     * is the case with ThreadingMode::SINGLE_IN_PARALLEL when every concurrent caller is inside a parallel region.
+     * </p>
+     */
+    class BlasThreadScope {
+    private:
+        bool isActive;
+
+        static int& activeScopes() {
+            static int scopes = 0;
+            return scopes;
+        }
+
+        static int& previousThreadCount() {
+            static int threadCount = 0;
+            return threadCount;
+        }
+
+    public:
+        explicit BlasThreadScope(int threadCount) : isActive(false) {
+            int blasThreadCount = resolveBlasThreadCount(threadCount);
+            auto setThreadCount = blasThreadFunctionsStorage().setThreadCount.load();
+
+            if (blasThreadCount == 0 || setThreadCount == nullptr) {
+                return;
+            }
+
+            std::lock_guard<std::mutex> lock(blasThreadMutex());
+
+            if (activeScopes()++ == 0) {
+                auto getThreadCount = blasThreadFunctionsStorage().getThreadCount.load();
+                previousThreadCount() = getThreadCount != nullptr ? getThreadCount() : 0;
+            }
+
+            setThreadCount(blasThreadCount);
+            this->isActive = true;
+        }
+
+        ~BlasThreadScope() {
+            if (!this->isActive) {
+                return;
+            }
+
+            std::lock_guard<std::mutex> lock(blasThreadMutex());
+            auto setThreadCount = blasThreadFunctionsStorage().setThreadCount.load();
+
+            if (--activeScopes() == 0 && 0 < previousThreadCount() && setThreadCount != nullptr) {
+                setThreadCount(previousThreadCount());
+            }
+        }
+
+        BlasThreadScope(const BlasThreadScope&) = delete;
+        BlasThreadScope& operator=(const BlasThreadScope&) = delete;
+    }; // BlasThreadScope
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ threading configuration - end                                                                                ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ parallelFor - begin                                                                                          ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    /*
+     * <p>
+     * Resolves the thread count of the options; 0 selects one thread per hardware thread.
+     * </p>
+     *
+     * @param threadCount requested number of threads
+     * @return number of threads which is at least 1
+     * @throws std::invalid_argument if threadCount is negative
+     */
+    inline int resolveThreadCount(int threadCount) {
+        if (threadCount < 0) {
+            throw std::invalid_argument("resolveThreadCount(): Thread count can't be negative!");
+        }
+
+        if (threadCount == 0) {
+            return std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+        }
+
+        return threadCount;
+    }
+
+    /*
+     * <p>
+     * Splits the range [begin, end) into at most threadCount contiguous chunks of almost equal size and calls
+     * function(chunkBegin, chunkEnd) for every chunk. The first chunk runs on the calling thread, the others on
+     * threads which are joined before returning. With a single thread or a single element, the function is called
+     * once on the calling thread. The chunks must not write to shared memory locations.
+     * The chunks of multiple threads run inside a parallel region; with ThreadingMode::SINGLE_IN_PARALLEL, a call
+     * inside a parallel region runs on the calling thread only.
+     * If any call throws, the first exception is rethrown after all threads are joined.
+     * </p>
+     *
+     * @tparam Function callable with the signature void(int, int)
+     * @param begin first index of the range
+     * @param end index behind the last index of the range
+     * @param threadCount maximal number of threads, see xvigra::resolveThreadCount
+     * @param function callable which processes a chunk
+     */
+    template <typename Function>
+    void parallelFor(int begin, int end, int threadCount, const Function& function) {
+        int size = end - begin;
+        int chunks = std::min(resolveThreadCount(threadCount), size);
+
+        if (activeThreadingMode() == ThreadingMode::SINGLE_IN_PARALLEL && isInParallelRegion()) {
+            chunks = 1;
+        }
+
+        if (chunks <= 1) {
+            if (0 < size) {
+                function(begin, end);
+            }
+            return;
+        }
+
+        std::vector<std::thread> threads;
+        std::vector<std::exception_ptr> errors(chunks);
+        threads.reserve(chunks - 1);
+
+        for (int chunk = 1; chunk < chunks; ++chunk) {
+            int chunkBegin = begin + static_cast<int>(static_cast<long long>(size) * chunk / chunks);
+            int chunkEnd = begin + static_cast<int>(static_cast<long long>(size) * (chunk + 1) / chunks);
+
+            threads.emplace_back([&function, &errors, chunk, chunkBegin, chunkEnd]() {
+                try {
+                    ParallelRegion region;
+                    function(chunkBegin, chunkEnd);
+                } catch (...) {
+                    errors[chunk] = std::current_exception();
+                }
+            });
+        }
+
+        try {
+            ParallelRegion region;
+            function(begin, begin + size / chunks);
+        } catch (...) {
+            errors[0] = std::current_exception();
+        }
+
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        for (const std::exception_ptr& error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ parallelFor - end                                                                                            ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+} // xvigra
+
+#endif // XVIGRA_THREAD_UTIL_HPP
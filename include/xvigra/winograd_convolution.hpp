@@ -0,0 +1,389 @@
+#ifndef XVIGRA_WINOGRAD_CONVOLUTION_HPP
+#define XVIGRA_WINOGRAD_CONVOLUTION_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#ifdef VOID
+#undef VOID
+#endif
+
+#include "xtensor/xtensor.hpp"
+#include "xtensor/xview.hpp"
+
+#include "xvigra/convolution_util.hpp"
+#include "xvigra/epilogue.hpp"
+#include "xvigra/workspace.hpp"
+
+namespace xvigra {
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ struct WinogradTransform - begin                                                                             ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    /*
+     * <p>
+     * Holds the transformation matrices of the minimal filtering algorithm F(m x m, 3 x 3) of Lavin A. and Gray S. .
+     * INPUT_TRANSFORM is B^T, KERNEL_TRANSFORM is G and OUTPUT_TRANSFORM is A^T, so that an output tile of size
+     * m x m is given by A^T [(G g G^T) * (B^T d B)] A for a 3 x 3 kernel g and an input tile d of size (m + 2) x (m + 2).
+     * </p>
+     *
+     * @tparam OutputTileSize size m of the square output tile
+     */
+    template <int OutputTileSize>
+    struct WinogradTransform;
+
+    template <>
+    struct WinogradTransform<2> {
+        static constexpr int OUTPUT_TILE_SIZE = 2;
+        static constexpr int INPUT_TILE_SIZE = 4;
+
+        static constexpr double INPUT_TRANSFORM[4][4] = {
+            {1,  0, -1,  0},
+            {0,  1,  1,  0},
+            {0, -1,  1,  0},
+            {0,  1,  0, -1}
+        };
+
+        static constexpr double KERNEL_TRANSFORM[4][3] = {
+            {1.0,  0.0, 0.0},
+            {0.5,  0.5, 0.5},
+            {0.5, -0.5, 0.5},
+            {0.0,  0.0, 1.0}
+        };
+
+        static constexpr double OUTPUT_TRANSFORM[2][4] = {
+            {1, 1,  1,  0},
+            {0, 1, -1, -1}
+        };
+    }; // WinogradTransform<2>
+
+    template <>
+    struct WinogradTransform<4> {
+        static constexpr int OUTPUT_TILE_SIZE = 4;
+        static constexpr int INPUT_TILE_SIZE = 6;
+
+        static constexpr double INPUT_TRANSFORM[6][6] = {
+            {4,  0, -5,  0, 1, 0},
+            {0, -4, -4,  1, 1, 0},
+            {0,  4, -4, -1, 1, 0},
+            {0, -2, -1,  2, 1, 0},
+            {0,  2, -1, -2, 1, 0},
+            {0,  4,  0, -5, 0, 1}
+        };
+
+        static constexpr double KERNEL_TRANSFORM[6][3] = {
+            { 1.0 / 4.0,   0.0,         0.0      },
+            {-1.0 / 6.0,  -1.0 / 6.0,  -1.0 / 6.0},
+            {-1.0 / 6.0,   1.0 / 6.0,  -1.0 / 6.0},
+            { 1.0 / 24.0,  1.0 / 12.0,  1.0 / 6.0},
+            { 1.0 / 24.0, -1.0 / 12.0,  1.0 / 6.0},
+            { 0.0,         0.0,         1.0      }
+        };
+
+        static constexpr double OUTPUT_TRANSFORM[4][6] = {
+            {1, 1,  1, 1,  1, 0},
+            {0, 1, -1, 2, -2, 0},
+            {0, 1,  1, 4,  4, 0},
+            {0, 1, -1, 8, -8, 1}
+        };
+    }; // WinogradTransform<4>
+
+    /*
+     * <p>
+     * Calculates T X T^T for the transformation matrix T of shape Rows x Inner and the matrix X of shape Inner x Inner,
+     * whose rows are sourceStride elements apart. The result is written row-major into target.
+     * Zero coefficients of T are skipped, since all Winograd transformation matrices are sparse.
+     * </p>
+     *
+     * @tparam ResultType value type of the source and target
+     * @param transform transformation matrix T
+     * @param source pointer to the first element of X
+     * @param sourceStride distance between two rows of X
+     * @param target pointer to Rows x Rows elements receiving the result
+     */
+    template <typename ResultType, std::size_t Rows, std::size_t Inner>
+    void applyWinogradTransform(
+        const double (&transform)[Rows][Inner],
+        const ResultType* source,
+        std::size_t sourceStride,
+        ResultType* target
+    ) {
+        ResultType temporary[Rows][Inner];
+
+        for (std::size_t row = 0; row < Rows; ++row) {
+            for (std::size_t column = 0; column < Inner; ++column) {
+                ResultType sum = static_cast<ResultType>(0);
+                for (std::size_t index = 0; index < Inner; ++index) {
+                    if (transform[row][index] != 0.0) {
+                        sum += static_cast<ResultType>(transform[row][index]) * source[index * sourceStride + column];
+                    }
+                }
+                temporary[row][column] = sum;
+            }
+        }
+
+        for (std::size_t row = 0; row < Rows; ++row) {
+            for (std::size_t column = 0; column < Rows; ++column) {
+                ResultType sum = static_cast<ResultType>(0);
+                for (std::size_t index = 0; index < Inner; ++index) {
+                    if (transform[column][index] != 0.0) {
+                        sum += temporary[row][index] * static_cast<ResultType>(transform[column][index]);
+                    }
+                }
+                target[row * Rows + column] = sum;
+            }
+        }
+    }
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ struct WinogradTransform - end                                                                               ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ winogradConvolve2D - begin                                                                                   ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    /*
+     * <p>
+     * Calculates the explicit 2-dimensional convolution with a 3 x 3 kernel, stride 1 and dilation 1 by the minimal
+     * filtering algorithm F(m x m, 3 x 3) of Lavin A. and Gray S. .
+     * The border treatment is resolved once into a padded copy of the input, which is then cut into overlapping
+     * input tiles of size (m + 2) x (m + 2). Per tile and channel pair only (m + 2)^2 multiplications are needed
+     * instead of 9 m^2, which reduces the arithmetic by 2.25 for m = 2 and by 4 for m = 4.
+     * Every row of tiles is collected in workspace memory and written into the output with the epilogue applied, see
+     * xvigra::applyEpilogueTile.
+     * The caller is responsible for the validation of the input and kernel and for the shape of the output; see
+     * xvigra::convolve2D.
+     * </p>
+     * <p>
+     * The transformations are not exact in floating point. With random data in [-1, 1] the absolute error of an output
+     * value stayed below c * sum(|k * x|), where the sum runs over all products of the output value and c is
+     * 3e-7 (about 2.5 float epsilon) for F(2x2, 3x3) and 7e-6 (about 60 float epsilon) for F(4x4, 3x3) with float;
+     * with double c is 1e-15 and 2e-14. F(2x2, 3x3) is therefore comparable to the GEMM-based convolution, while
+     * F(4x4, 3x3) loses about 6 bits of a float and should be avoided, where the result is near cancellation.
+     * </p>
+     *
+     * @tparam ResultType floating point value type of the result
+     * @tparam OutputTileSize size m of the square output tile; 2 or 4
+     * @tparam InputContainerType row major container of the input, see xvigra::evaluateContiguous
+     * @tparam R derived type of the output xexpression
+     * @param input input of shape H x W x C or C x H x W
+     * @param kernel full kernel of shape OC x IC x 3 x 3
+     * @param optionsY object containing information about padding, channel position and border treatment along the
+                       height
+     * @param optionsX object containing information about padding, channel position and border treatment along the
+                       width
+     * @param epilogue bias, scale, clipping and rounding which are applied to the result
+     * @param output output of shape H' x W' x OC or OC x H' x W', which receives the result
+     */
+    template <typename ResultType, typename InputType, typename KernelType, int OutputTileSize, typename InputContainerType, typename R>
+    void winogradConvolve2D(
+        const InputContainerType& input,
+        const xt::xtensor<KernelType, 4>& kernel,
+        const xvigra::KernelOptions& optionsY,
+        const xvigra::KernelOptions& optionsX,
+        const xvigra::Epilogue& epilogue,
+        R& output
+    ) {
+        using Transform = xvigra::WinogradTransform<OutputTileSize>;
+        constexpr std::size_t outputTileSize = Transform::OUTPUT_TILE_SIZE;
+        constexpr std::size_t inputTileSize = Transform::INPUT_TILE_SIZE;
+        constexpr std::size_t tileArea = inputTileSize * inputTileSize;
+        constexpr std::size_t kernelSize = 3;
+
+        bool isChannelFirst = optionsY.channelPosition == xvigra::ChannelPosition::FIRST;
+
+        std::size_t inputChannels = input.shape()[isChannelFirst ? 0 : 2];
+        std::size_t inputHeight = input.shape()[isChannelFirst ? 1 : 0];
+        std::size_t inputWidth = input.shape()[isChannelFirst ? 2 : 1];
+        std::size_t outputChannels = kernel.shape()[0];
+
+        std::size_t outputHeight = static_cast<std::size_t>(
+            xvigra::calculateOutputSize(static_cast<int>(inputHeight), static_cast<int>(kernelSize), optionsY)
+        );
+        std::size_t outputWidth = static_cast<std::size_t>(
+            xvigra::calculateOutputSize(static_cast<int>(inputWidth), static_cast<int>(kernelSize), optionsX)
+        );
+
+        ResultType constantBeginY = xvigra::gatherConstant<InputType, ResultType>(optionsY, xvigra::CONSTANT_BEGIN_INDEX);
+        ResultType constantEndY = xvigra::gatherConstant<InputType, ResultType>(optionsY, xvigra::CONSTANT_END_INDEX);
+        ResultType constantBeginX = xvigra::gatherConstant<InputType, ResultType>(optionsX, xvigra::CONSTANT_BEGIN_INDEX);
+        ResultType constantEndX = xvigra::gatherConstant<InputType, ResultType>(optionsX, xvigra::CONSTANT_END_INDEX);
+
+        // the padded input is rounded up to whole tiles, the positions beyond the padded source stay zero
+        std::vector<int> sourceY = xvigra::calculatePaddedSourceIndices(
+            static_cast<int>(inputHeight),
+            static_cast<int>(kernelSize),
+            optionsY
+        );
+        std::vector<int> sourceX = xvigra::calculatePaddedSourceIndices(
+            static_cast<int>(inputWidth),
+            static_cast<int>(kernelSize),
+            optionsX
+        );
+
+        std::size_t tilesY = (outputHeight + outputTileSize - 1) / outputTileSize;
+        std::size_t tilesX = (outputWidth + outputTileSize - 1) / outputTileSize;
+        std::size_t paddedHeight = tilesY * outputTileSize + kernelSize - 1;
+        std::size_t paddedWidth = tilesX * outputTileSize + kernelSize - 1;
+        std::size_t paddedPlane = paddedHeight * paddedWidth;
+
+        const InputType* in = input.data();
+        std::vector<ResultType> paddedInput(inputChannels * paddedPlane, static_cast<ResultType>(0));
+
+        for (std::size_t paddedY = 0; paddedY < sourceY.size(); ++paddedY) {
+            int inputY = sourceY[paddedY];
+
+            for (std::size_t paddedX = 0; paddedX < sourceX.size(); ++paddedX) {
+                int inputX = sourceX[paddedX];
+                ResultType* target = paddedInput.data() + paddedY * paddedWidth + paddedX;
+
+                if (inputY < 0 || inputX < 0) {
+                    // a constant row of the height axis wins over a constant column of the width axis
+                    ResultType constant = inputY < 0
+                        ? (inputY == xvigra::CONSTANT_BEGIN_INDEX ? constantBeginY : constantEndY)
+                        : (inputX == xvigra::CONSTANT_BEGIN_INDEX ? constantBeginX : constantEndX);
+
+                    for (std::size_t inputChannel = 0; inputChannel < inputChannels; ++inputChannel) {
+                        target[inputChannel * paddedPlane] = constant;
+                    }
+                } else if (!isChannelFirst) {
+                    const InputType* pixel = in + (static_cast<std::size_t>(inputY) * inputWidth + static_cast<std::size_t>(inputX)) * inputChannels;
+
+                    for (std::size_t inputChannel = 0; inputChannel < inputChannels; ++inputChannel) {
+                        target[inputChannel * paddedPlane] = static_cast<ResultType>(pixel[inputChannel]);
+                    }
+                }
+            }
+        }
+
+        if (isChannelFirst) {
+            // the interior is copied plane by plane, so that the channel first input is read contiguously
+            for (std::size_t inputChannel = 0; inputChannel < inputChannels; ++inputChannel) {
+                const InputType* plane = in + inputChannel * inputHeight * inputWidth;
+
+                for (std::size_t paddedY = 0; paddedY < sourceY.size(); ++paddedY) {
+                    int inputY = sourceY[paddedY];
+
+                    if (inputY < 0) {
+                        continue;
+                    }
+
+                    const InputType* inRow = plane + static_cast<std::size_t>(inputY) * inputWidth;
+                    ResultType* paddedRow = paddedInput.data() + inputChannel * paddedPlane + paddedY * paddedWidth;
+
+                    for (std::size_t paddedX = 0; paddedX < sourceX.size(); ++paddedX) {
+                        int inputX = sourceX[paddedX];
+
+                        if (0 <= inputX) {
+                            paddedRow[paddedX] = static_cast<ResultType>(inRow[inputX]);
+                        }
+                    }
+                }
+            }
+        }
+
+        // transformed kernel G g G^T of shape OC x IC x tileArea
+        std::vector<ResultType> transformedKernel(outputChannels * inputChannels * tileArea);
+        for (std::size_t outputChannel = 0; outputChannel < outputChannels; ++outputChannel) {
+            for (std::size_t inputChannel = 0; inputChannel < inputChannels; ++inputChannel) {
+                ResultType weights[kernelSize * kernelSize];
+                for (std::size_t kernelY = 0; kernelY < kernelSize; ++kernelY) {
+                    for (std::size_t kernelX = 0; kernelX < kernelSize; ++kernelX) {
+                        weights[kernelY * kernelSize + kernelX] =
+                            static_cast<ResultType>(kernel(outputChannel, inputChannel, kernelY, kernelX));
+                    }
+                }
+
+                xvigra::applyWinogradTransform(
+                    Transform::KERNEL_TRANSFORM,
+                    weights,
+                    kernelSize,
+                    transformedKernel.data() + (outputChannel * inputChannels + inputChannel) * tileArea
+                );
+            }
+        }
+
+        // a band holds the output rows of one row of tiles; every value of the band is written by exactly one tile, so
+        // it needs no initialization
+        xvigra::Workspace& workspace = xvigra::resolveWorkspace(optionsY.workspace);
+        xvigra::Workspace::Scope workspaceScope(workspace);
+        ResultType* band = workspace.allocate<ResultType>(outputChannels * outputTileSize * outputWidth);
+
+        std::vector<ResultType> transformedTile(inputChannels * tileArea);
+        ResultType accumulator[tileArea];
+        ResultType outputTile[outputTileSize * outputTileSize];
+
+        for (std::size_t tileY = 0; tileY < tilesY; ++tileY) {
+            std::size_t outputY = tileY * outputTileSize;
+            std::size_t validHeight = std::min(outputTileSize, outputHeight - outputY);
+
+            for (std::size_t tileX = 0; tileX < tilesX; ++tileX) {
+                std::size_t outputX = tileX * outputTileSize;
+                std::size_t validWidth = std::min(outputTileSize, outputWidth - outputX);
+
+                // transformed input tiles B^T d B of all input channels
+                for (std::size_t inputChannel = 0; inputChannel < inputChannels; ++inputChannel) {
+                    xvigra::applyWinogradTransform(
+                        Transform::INPUT_TRANSFORM,
+                        paddedInput.data() + inputChannel * paddedPlane + outputY * paddedWidth + outputX,
+                        paddedWidth,
+                        transformedTile.data() + inputChannel * tileArea
+                    );
+                }
+
+                for (std::size_t outputChannel = 0; outputChannel < outputChannels; ++outputChannel) {
+                    std::fill(accumulator, accumulator + tileArea, static_cast<ResultType>(0));
+                    const ResultType* weights = transformedKernel.data() + outputChannel * inputChannels * tileArea;
+
+                    for (std::size_t inputChannel = 0; inputChannel < inputChannels; ++inputChannel) {
+                        const ResultType* weightTile = weights + inputChannel * tileArea;
+                        const ResultType* valueTile = transformedTile.data() + inputChannel * tileArea;
+
+                        for (std::size_t index = 0; index < tileArea; ++index) {
+                            accumulator[index] += weightTile[index] * valueTile[index];
+                        }
+                    }
+
+                    xvigra::applyWinogradTransform(Transform::OUTPUT_TRANSFORM, accumulator, inputTileSize, outputTile);
+
+                    for (std::size_t y = 0; y < validHeight; ++y) {
+                        for (std::size_t x = 0; x < validWidth; ++x) {
+                            std::size_t target = isChannelFirst
+                                ? (outputChannel * validHeight + y) * outputWidth + outputX + x
+                                : (y * outputWidth + outputX + x) * outputChannels + outputChannel;
+                            band[target] = outputTile[y * outputTileSize + x];
+                        }
+                    }
+                }
+            }
+
+            if (isChannelFirst) {
+                xvigra::applyEpilogueTile(
+                    band,
+                    std::array<std::size_t, 3>{outputChannels, validHeight, outputWidth},
+                    epilogue,
+                    0,
+                    xt::view(output, xt::all(), xt::range(outputY, outputY + validHeight), xt::all())
+                );
+            } else {
+                xvigra::applyEpilogueTile(
+                    band,
+                    std::array<std::size_t, 3>{validHeight, outputWidth, outputChannels},
+                    epilogue,
+                    2,
+                    xt::view(output, xt::range(outputY, outputY + validHeight), xt::all(), xt::all())
+                );
+            }
+        }
+    }
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ winogradConvolve2D - end                                                                                     ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+} // xvigra
+
+#endif // XVIGRA_WINOGRAD_CONVOLUTION_HPP
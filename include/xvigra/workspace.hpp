@@ -0,0 +1,377 @@
+#ifndef XVIGRA_WORKSPACE_HPP
+#define XVIGRA_WORKSPACE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace xvigra {
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ forward declaration - begin                                                                                  ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    class Workspace;
+
+    inline Workspace& threadLocalWorkspace();
+
+    inline Workspace& resolveWorkspace(Workspace*);
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ forward declaration - end                                                                                    ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ class Workspace - begin                                                                                      ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    // alignment in bytes of every allocation, which covers a cache line and the widest vector registers
+    constexpr std::size_t WORKSPACE_ALIGNMENT = 64;
+    // size in bytes of a transparent huge page on x86-64 and most aarch64 kernels
+    constexpr std::size_t WORKSPACE_HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+    /*
+     * <p>
+     * Arena for the scratch memory of the convolutions. Allocations are bumped off a list of blocks and are released
+     * in stack order by Workspace::Scope, so a convolution which runs repeatedly reuses the same memory instead of
+     * going through the allocator. If an allocation does not fit, a new block is appended; as soon as nothing is
+     * handed out anymore, the blocks are merged into a single block on the next allocation, so that a steady workload
+     * settles on one block of at least the size of the high water mark.
+     * With huge pages the blocks are aligned and rounded to xvigra::WORKSPACE_HUGE_PAGE_SIZE and advised for
+     * transparent huge pages on Linux; on other platforms the flag only changes the alignment.
+     * The returned memory is uninitialized. A workspace must not be used by concurrently running convolutions;
+     * xvigra::threadLocalWorkspace provides one workspace per thread.
+     * </p>
+     */
+    class Workspace {
+    private:
+        struct Block {
+            std::byte* data;
+            std::size_t capacity;
+        };
+
+        std::vector<Block> blocks;
+        std::size_t blockIndex;
+        std::size_t blockOffset;
+        std::size_t usedBytes;
+        std::size_t highWaterMark;
+        std::size_t systemAllocations;
+        std::size_t mergedCapacity;
+        int openScopes;
+        bool hugePages;
+
+        std::size_t blockAlignment() const;
+        Block allocateBlock(std::size_t);
+        void freeBlock(const Block&) const;
+        void freeBlocksFrom(std::size_t);
+        void mergeBlocks();
+
+    public:
+        class Scope {
+        private:
+            Workspace& workspace;
+            std::size_t blockIndex;
+            std::size_t blockOffset;
+            std::size_t usedBytes;
+
+        public:
+            explicit Scope(Workspace&);
+            ~Scope();
+
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+        }; // Scope
+
+        explicit Workspace(std::size_t capacity = 0, bool hugePages = false);
+        ~Workspace();
+
+        Workspace(const Workspace&) = delete;
+        Workspace& operator=(const Workspace&) = delete;
+
+        void* allocateBytes(std::size_t);
+
+        template <typename T>
+        T* allocate(std::size_t);
+
+        void reserve(std::size_t);
+        void release();
+
+        std::size_t getUsedBytes() const;
+        std::size_t getCapacity() const;
+        std::size_t getHighWaterMark() const;
+        std::size_t getSystemAllocations() const;
+        bool isHugePageBacked() const;
+        void resetStatistics();
+    }; // Workspace
+
+    /*
+     * <p>
+     * Remembers the current position of the workspace and releases everything allocated afterwards on destruction.
+     * </p>
+     *
+     * @param workspace workspace whose allocations are scoped
+     */
+    inline Workspace::Scope::Scope(Workspace& workspace)
+    : workspace(workspace),
+      blockIndex(workspace.blockIndex),
+      blockOffset(workspace.blockOffset),
+      usedBytes(workspace.usedBytes)
+    {
+        ++this->workspace.openScopes;
+    }
+
+    inline Workspace::Scope::~Scope() {
+        this->workspace.blockIndex = this->blockIndex;
+        this->workspace.blockOffset = this->blockOffset;
+        this->workspace.usedBytes = this->usedBytes;
+        --this->workspace.openScopes;
+    }
+
+    /*
+     * <p>
+     * Creates a workspace and allocates the first block up front if a capacity is given.
+     * </p>
+     *
+     * @param capacity number of bytes which are allocated immediately; 0 defers the allocation to the first use
+     * @param hugePages whether the blocks should be backed by transparent huge pages
+     */
+    inline Workspace::Workspace(std::size_t capacity, bool hugePages)
+    : blocks(),
+      blockIndex(0),
+      blockOffset(0),
+      usedBytes(0),
+      highWaterMark(0),
+      systemAllocations(0),
+      mergedCapacity(0),
+      openScopes(0),
+      hugePages(hugePages)
+    {
+        reserve(capacity);
+    }
+
+    inline Workspace::~Workspace() {
+        freeBlocksFrom(0);
+    }
+
+    /*
+     * <p>
+     * Allocates uninitialized memory aligned to xvigra::WORKSPACE_ALIGNMENT, which stays valid until the innermost
+     * open Workspace::Scope is closed. Without an open scope the memory stays valid until Workspace#release.
+     * </p>
+     *
+     * @param bytes number of bytes
+     * @return pointer to the memory
+     */
+    inline void* Workspace::allocateBytes(std::size_t bytes) {
+        std::size_t alignedBytes = std::max<std::size_t>(WORKSPACE_ALIGNMENT, (bytes + WORKSPACE_ALIGNMENT - 1) / WORKSPACE_ALIGNMENT * WORKSPACE_ALIGNMENT);
+
+        // with nothing handed out no pointer can be invalidated, so a grown or too small workspace is merged here
+        if (this->usedBytes == 0 && !this->blocks.empty() && (1 < this->blocks.size() || this->blocks[0].capacity < alignedBytes)) {
+            mergeBlocks();
+        }
+
+        if (this->blocks.empty() || this->blocks[this->blockIndex].capacity < this->blockOffset + alignedBytes) {
+            // the blocks behind the current one are unused, so the next one is reused if it is large enough
+            std::size_t nextIndex = this->blocks.empty() ? 0 : this->blockIndex + 1;
+
+            if (this->blocks.size() <= nextIndex || this->blocks[nextIndex].capacity < alignedBytes) {
+                freeBlocksFrom(nextIndex);
+                std::size_t previousCapacity = this->blocks.empty() ? 0 : this->blocks.back().capacity;
+                this->blocks.push_back(allocateBlock(std::max({alignedBytes, previousCapacity, this->mergedCapacity})));
+                this->mergedCapacity = 0;
+            }
+
+            this->blockIndex = nextIndex;
+            this->blockOffset = 0;
+        }
+
+        std::byte* result = this->blocks[this->blockIndex].data + this->blockOffset;
+        this->blockOffset += alignedBytes;
+        this->usedBytes += alignedBytes;
+        this->highWaterMark = std::max(this->highWaterMark, this->usedBytes);
+
+        return result;
+    }
+
+    /*
+     * <p>
+     * Allocates uninitialized memory for count elements; see Workspace#allocateBytes.
+     * </p>
+     *
+     * @tparam T trivially destructible element type
+     * @param count number of elements
+     * @return pointer to the first element
+     */
+    template <typename T>
+    T* Workspace::allocate(std::size_t count) {
+        static_assert(std::is_trivially_destructible_v<T>, "Workspace::allocate(): Elements are never destroyed!");
+        static_assert(alignof(T) <= WORKSPACE_ALIGNMENT, "Workspace::allocate(): Alignment of the type is too large!");
+
+        return static_cast<T*>(allocateBytes(count * sizeof(T)));
+    }
+
+    /*
+     * <p>
+     * Makes sure that the next allocations up to the given number of bytes are served by a single block.
+     * </p>
+     *
+     * @param capacity number of bytes
+     * @throws std::logic_error if the workspace is in use
+     */
+    inline void Workspace::reserve(std::size_t capacity) {
+        if (this->usedBytes != 0) {
+            throw std::logic_error("Workspace::reserve(): Workspace can't be reserved while it is in use!");
+        }
+
+        if (capacity == 0 || (this->blocks.size() == 1 && capacity <= this->blocks[0].capacity)) {
+            return;
+        }
+
+        std::size_t currentCapacity = getCapacity();
+        freeBlocksFrom(0);
+        this->blocks.push_back(allocateBlock(std::max(capacity, currentCapacity)));
+        this->blockIndex = 0;
+        this->blockOffset = 0;
+    }
+
+    /*
+     * <p>
+     * Returns all blocks to the system.
+     * </p>
+     *
+     * @throws std::logic_error if the workspace is in use
+     */
+    inline void Workspace::release() {
+        if (this->usedBytes != 0 || 0 < this->openScopes) {
+            throw std::logic_error("Workspace::release(): Workspace can't be released while it is in use!");
+        }
+
+        freeBlocksFrom(0);
+        this->blockIndex = 0;
+        this->blockOffset = 0;
+        this->mergedCapacity = 0;
+    }
+
+    // number of bytes which are currently handed out, including the alignment padding
+    inline std::size_t Workspace::getUsedBytes() const {
+        return this->usedBytes;
+    }
+
+    // number of bytes which are currently allocated from the system
+    inline std::size_t Workspace::getCapacity() const {
+        std::size_t result = 0;
+
+        for (const Block& block : this->blocks) {
+            result += block.capacity;
+        }
+
+        return result;
+    }
+
+    // largest number of bytes which was handed out at the same time since construction or the last reset
+    inline std::size_t Workspace::getHighWaterMark() const {
+        return this->highWaterMark;
+    }
+
+    // number of blocks which were allocated from the system since construction or the last reset
+    inline std::size_t Workspace::getSystemAllocations() const {
+        return this->systemAllocations;
+    }
+
+    inline bool Workspace::isHugePageBacked() const {
+        return this->hugePages;
+    }
+
+    inline void Workspace::resetStatistics() {
+        this->highWaterMark = this->usedBytes;
+        this->systemAllocations = 0;
+    }
+
+    inline std::size_t Workspace::blockAlignment() const {
+        return this->hugePages ? WORKSPACE_HUGE_PAGE_SIZE : WORKSPACE_ALIGNMENT;
+    }
+
+    inline Workspace::Block Workspace::allocateBlock(std::size_t capacity) {
+        std::size_t alignment = blockAlignment();
+        capacity = (capacity + alignment - 1) / alignment * alignment;
+
+        auto* data = static_cast<std::byte*>(::operator new(capacity, std::align_val_t(alignment)));
+        ++this->systemAllocations;
+
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+        if (this->hugePages) {
+            // only a hint; without transparent huge page support the block stays backed by regular pages
+            madvise(data, capacity, MADV_HUGEPAGE);
+        }
+#endif
+
+        return Block{data, capacity};
+    }
+
+    inline void Workspace::freeBlock(const Block& block) const {
+        ::operator delete(block.data, std::align_val_t(blockAlignment()));
+    }
+
+    inline void Workspace::freeBlocksFrom(std::size_t index) {
+        for (std::size_t i = index; i < this->blocks.size(); ++i) {
+            freeBlock(this->blocks[i]);
+        }
+
+        this->blocks.resize(std::min(index, this->blocks.size()));
+    }
+
+    // replaces all blocks by a single one of their total size on the next allocation
+    inline void Workspace::mergeBlocks() {
+        this->mergedCapacity = getCapacity();
+        freeBlocksFrom(0);
+        this->blockIndex = 0;
+        this->blockOffset = 0;
+    }
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ class Workspace - end                                                                                        ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ workspace access - begin                                                                                     ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+    /*
+     * <p>
+     * Returns the workspace of the calling thread, which is used by all convolutions without an explicit workspace.
+     * It lives until the thread ends.
+     * </p>
+     *
+     * @return workspace of the calling thread
+     */
+    inline Workspace& threadLocalWorkspace() {
+        thread_local Workspace workspace;
+        return workspace;
+    }
+
+    /*
+     * <p>
+     * Returns the given workspace or the workspace of the calling thread if none is given.
+     * </p>
+     *
+     * @param workspace explicitly passed workspace or nullptr
+     * @return workspace which should be used
+     */
+    inline Workspace& resolveWorkspace(Workspace* workspace) {
+        return workspace != nullptr ? *workspace : threadLocalWorkspace();
+    }
+
+    // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+    // ║ workspace access - end                                                                                       ║
+    // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+} // xvigra
+
+#endif // XVIGRA_WORKSPACE_HPP
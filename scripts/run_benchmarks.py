@@ -90,6 +90,7 @@ def main():
         "xvigra": (
             "benchmark_convolve1D_inputSize_channelFirst",
             "benchmark_convolve1D_inputSize_channelLast",
+            "benchmark_convolve2D_threadCount",
             #   "benchmark_convolve2D_inputSize_channelFirst",
             #   "benchmark_convolve2D_inputSize_channelLast",
             #   "benchmark_separableConvolve1D_inputSize",
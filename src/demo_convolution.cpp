@@ -1,4 +1,5 @@
 #include <array>
+#include <cstdint>
 #include <stdexcept>
 #include <string>
 
@@ -6,9 +7,23 @@
 #include "xtensor/xio.hpp"
 
 #include "xvigra/convolution.hpp"
+#include "xvigra/epilogue.hpp"
 #include "xvigra/image_io.hpp"
 
 
+// clips [0, 1] results and converts them to 8 bit pixels in the same pass
+xt::xtensor<std::uint8_t, 3> toImage(const xt::xtensor<float, 3>& result) {
+    xvigra::Epilogue epilogue;
+    epilogue.setScale(255.0);
+    epilogue.setClip(0.0, 255.0);
+    epilogue.setRounding(xvigra::RoundingMode::NEAREST);
+
+    xt::xtensor<std::uint8_t, 3> image(result.shape());
+    xvigra::applyEpilogue(result, epilogue, 2, image);
+    return image;
+}
+
+
 void runGaussianSmoothingDemo(const std::string& fileExtension) {
     xt::xtensor<float, 3> image = xvigra::loadImageAsXTensor<float>(
         "./resources/src/Piercing-The-Ocean." + fileExtension
@@ -16,7 +31,7 @@ void runGaussianSmoothingDemo(const std::string& fileExtension) {
     auto result = xvigra::gaussianSmoothing<2>(image, std::array<double, 2>{1.5, 1.5});
     xvigra::saveImage(
         "./resources/src/demo_gaussian_smoothing." + fileExtension,
-         xvigra::normalizeAfterConvolution<float>(result)
+        toImage(result)
     );
 }
 
@@ -26,10 +41,9 @@ void runGaussianSharpeningDemo(const std::string& fileExtension) {
         "./resources/src/Piercing-The-Ocean." + fileExtension
     );
     auto result = xvigra::gaussianSharpening<2>(image, 0.4, 2.5);
-    auto res = xvigra::normalizeAfterConvolution<float>(result);
     xvigra::saveImage(
         "./resources/src/demo_gaussian_sharpening." + fileExtension,
-        res
+        toImage(result)
     );
 }
 
@@ -0,0 +1,456 @@
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#define DOCTEST_CONFIG_SUPER_FAST_ASSERTS
+#include "doctest/doctest.h"
+
+#ifdef VOID
+#undef VOID
+#endif
+
+#include "xtensor/xarray.hpp"
+#include "xtensor/xtensor.hpp"
+#include "xtensor/xview.hpp"
+
+#include "xvigra/convolution_plan.hpp"
+#include "xvigra/convolution_util.hpp"
+#include "xvigra/epilogue.hpp"
+#include "xvigra/explicit_convolution.hpp"
+
+#include "test_util.hpp"
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ define - begin                                                                                                   ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+#define TYPE_PAIRS              \
+    std::pair<short, float>,    \
+    std::pair<short, double>,   \
+    std::pair<int, float>,      \
+    std::pair<int, double>
+
+TYPE_TO_STRING(std::pair<short, float>);
+TYPE_TO_STRING(std::pair<short, double>);
+TYPE_TO_STRING(std::pair<int, float>);
+TYPE_TO_STRING(std::pair<int, double>);
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ define - end                                                                                                     ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ constexpr - begin                                                                                                ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+constexpr double ALGORITHM_EPSILON = 1e-4;
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ constexpr - end                                                                                                  ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ utility - begin                                                                                                  ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+template <typename InputType, typename KernelType>
+void checkPlan(
+    const xt::xtensor<InputType, 3>& input,
+    const xt::xtensor<KernelType, 4>& kernel,
+    const xvigra::KernelOptions2D& options
+) {
+    using ResultType = typename std::common_type_t<InputType, KernelType>;
+
+    std::array<std::size_t, 3> shape{input.shape()[0], input.shape()[1], input.shape()[2]};
+    xvigra::ConvolutionPlan2D<InputType, KernelType> plan(shape, kernel, options);
+
+    xt::xtensor<ResultType, 3> expected = xvigra::convolve2D(input, kernel, options);
+    xt::xtensor<ResultType, 3> actual(plan.getOutputShape());
+
+    // executing twice must not depend on the state left behind by the first call
+    plan.execute(input, actual);
+    plan.execute(input, actual);
+
+    REQUIRE_EQ(actual.shape(), expected.shape());
+
+    auto iterActual = actual.begin();
+    for (auto iterExpected = expected.begin(); iterExpected != expected.end(); ++iterActual, ++iterExpected) {
+        CHECK_EQ(*iterActual, doctest::Approx(*iterExpected).epsilon(ALGORITHM_EPSILON));
+    }
+}
+
+
+template <typename InputType, typename KernelType>
+void checkBatch(
+    const xt::xtensor<InputType, 4>& input,
+    const xt::xtensor<KernelType, 4>& kernel,
+    const xvigra::KernelOptions2D& options
+) {
+    using ResultType = typename std::common_type_t<InputType, KernelType>;
+
+    xt::xtensor<ResultType, 4> actual = xvigra::convolve2DBatch(input, kernel, options);
+
+    REQUIRE_EQ(actual.shape()[0], input.shape()[0]);
+
+    for (std::size_t image = 0; image < input.shape()[0]; ++image) {
+        xt::xtensor<InputType, 3> single = xt::view(input, image, xt::all(), xt::all(), xt::all());
+        xt::xtensor<ResultType, 3> expected = xvigra::convolve2D(single, kernel, options);
+        xt::xtensor<ResultType, 3> actualImage = xt::view(actual, image, xt::all(), xt::all(), xt::all());
+
+        REQUIRE_EQ(actualImage.shape(), expected.shape());
+
+        auto iterActual = actualImage.begin();
+        for (auto iterExpected = expected.begin(); iterExpected != expected.end(); ++iterActual, ++iterExpected) {
+            CHECK_EQ(*iterActual, doctest::Approx(*iterExpected).epsilon(ALGORITHM_EPSILON));
+        }
+    }
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ utility - end                                                                                                    ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test ConvolutionPlan2D - begin                                                                                   ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+TEST_CASE_TEMPLATE("ConvolutionPlan2D: Test Against convolve2D", T, TYPE_PAIRS) {
+    using InputType = typename T::first_type;
+    using KernelType = typename T::second_type;
+
+    std::vector<xvigra::BorderTreatment> treatments{
+        xvigra::BorderTreatment::asymmetricReflect(),
+        xvigra::BorderTreatment::avoid(),
+        xvigra::BorderTreatment::constant(2),
+        xvigra::BorderTreatment::repeat(),
+        xvigra::BorderTreatment::symmetricReflect(),
+        xvigra::BorderTreatment::wrap()
+    };
+
+    xt::xtensor<KernelType, 4> kernel = xt::zeros<KernelType>({2, 3, 3, 4});
+    fillWithPattern(kernel, 5, 0.25, -0.5);
+
+    xvigra::KernelOptions2D options;
+    options.setPadding(3, 2);
+    options.setStride(2, 1);
+    options.setDilation(1, 2);
+
+    SUBCASE("Channel First") {
+        xt::xtensor<InputType, 3> input = xt::zeros<InputType>({3, 9, 11});
+        fillWithPattern(input, 11);
+        options.setChannelPosition(xvigra::ChannelPosition::FIRST);
+
+        for (const auto& treatment : treatments) {
+            options.setBorderTreatment(treatment);
+            checkPlan(input, kernel, options);
+        }
+    }
+
+    SUBCASE("Channel Last") {
+        xt::xtensor<InputType, 3> input = xt::zeros<InputType>({9, 11, 3});
+        fillWithPattern(input, 11);
+        options.setChannelPosition(xvigra::ChannelPosition::LAST);
+
+        for (const auto& treatment : treatments) {
+            options.setBorderTreatment(treatment);
+            checkPlan(input, kernel, options);
+        }
+    }
+
+    SUBCASE("Tiled Workspace") {
+        options.setWorkspaceLimit(1);
+        options.setBorderTreatment(xvigra::BorderTreatment::wrap());
+
+        xt::xtensor<InputType, 3> inputFirst = xt::zeros<InputType>({3, 9, 11});
+        fillWithPattern(inputFirst, 11);
+        options.setChannelPosition(xvigra::ChannelPosition::FIRST);
+        checkPlan(inputFirst, kernel, options);
+
+        xt::xtensor<InputType, 3> inputLast = xt::zeros<InputType>({9, 11, 3});
+        fillWithPattern(inputLast, 11);
+        options.setChannelPosition(xvigra::ChannelPosition::LAST);
+        checkPlan(inputLast, kernel, options);
+    }
+}
+
+
+TEST_CASE_TEMPLATE("ConvolutionPlan2D: Test Batch", T, TYPE_PAIRS) {
+    using InputType = typename T::first_type;
+    using KernelType = typename T::second_type;
+
+    xt::xtensor<KernelType, 4> kernel = xt::zeros<KernelType>({2, 3, 3, 4});
+    fillWithPattern(kernel, 5, 0.25, -0.5);
+
+    xvigra::KernelOptions2D options;
+    options.setPadding(3, 2);
+    options.setStride(2, 1);
+    options.setDilation(1, 2);
+    options.setBorderTreatment(xvigra::BorderTreatment::symmetricReflect());
+
+    SUBCASE("Channel First") {
+        xt::xtensor<InputType, 4> input = xt::zeros<InputType>({4, 3, 9, 11});
+        fillWithPattern(input, 13);
+        options.setChannelPosition(xvigra::ChannelPosition::FIRST);
+
+        checkBatch(input, kernel, options);
+
+        // tiles which end in the middle of an image
+        options.setWorkspaceLimit(8000);
+        checkBatch(input, kernel, options);
+    }
+
+    SUBCASE("Channel Last") {
+        xt::xtensor<InputType, 4> input = xt::zeros<InputType>({4, 9, 11, 3});
+        fillWithPattern(input, 13);
+        options.setChannelPosition(xvigra::ChannelPosition::LAST);
+
+        checkBatch(input, kernel, options);
+
+        options.setWorkspaceLimit(8000);
+        checkBatch(input, kernel, options);
+    }
+}
+
+
+TEST_CASE_TEMPLATE("ConvolutionPlan2D: Test Sparse Kernel", T, TYPE_PAIRS) {
+    using InputType = typename T::first_type;
+    using KernelType = typename T::second_type;
+
+    // wide derivative stencils along both axes, 4 non-zero taps out of 2 x 3 x 5 x 5 are sparse for both channel
+    // positions
+    xt::xtensor<KernelType, 4> kernel = xt::zeros<KernelType>({2, 3, 5, 5});
+    kernel(0, 0, 2, 0) = static_cast<KernelType>(-1);
+    kernel(0, 0, 2, 4) = static_cast<KernelType>(1);
+    kernel(1, 2, 0, 2) = static_cast<KernelType>(-1);
+    kernel(1, 2, 4, 2) = static_cast<KernelType>(1);
+    REQUIRE(xvigra::collectNonZeroTaps<KernelType>(kernel).isSparse(xvigra::ChannelPosition::LAST));
+
+    // only Algorithm::AUTO plans the sparse taps, an explicit Algorithm::GEMM keeps the kernel matrix
+    xvigra::KernelOptions2D options;
+    options.setPadding(1, 2);
+    options.setStride(2, 1);
+    options.setBorderTreatment(xvigra::BorderTreatment::constant(2));
+
+    SUBCASE("Explicit GEMM") {
+        xt::xtensor<InputType, 3> input = xt::zeros<InputType>({3, 9, 11});
+        fillWithPattern(input, 11);
+        options.setChannelPosition(xvigra::ChannelPosition::FIRST);
+        checkPlan(input, kernel, options);
+    }
+
+    options.setAlgorithm(xvigra::Algorithm::AUTO);
+
+    SUBCASE("Channel First") {
+        xt::xtensor<InputType, 3> input = xt::zeros<InputType>({3, 9, 11});
+        fillWithPattern(input, 11);
+        options.setChannelPosition(xvigra::ChannelPosition::FIRST);
+        checkPlan(input, kernel, options);
+
+        xt::xtensor<InputType, 4> batch = xt::zeros<InputType>({3, 3, 9, 11});
+        fillWithPattern(batch, 13);
+        options.setThreadCount(2);
+        checkBatch(batch, kernel, options);
+    }
+
+    SUBCASE("Channel Last") {
+        xt::xtensor<InputType, 3> input = xt::zeros<InputType>({9, 11, 3});
+        fillWithPattern(input, 11);
+        options.setChannelPosition(xvigra::ChannelPosition::LAST);
+        checkPlan(input, kernel, options);
+
+        xt::xtensor<InputType, 4> batch = xt::zeros<InputType>({3, 9, 11, 3});
+        fillWithPattern(batch, 13);
+        options.setThreadCount(2);
+        checkBatch(batch, kernel, options);
+    }
+}
+
+
+TEST_CASE_TEMPLATE("ConvolutionPlan2D: Test Epilogue And Groups", T, TYPE_PAIRS) {
+    using InputType = typename T::first_type;
+    using KernelType = typename T::second_type;
+    using ResultType = typename xvigra::ConvolutionPlan2D<InputType, KernelType>::ResultType;
+
+    xvigra::KernelOptions2D options;
+    options.setPadding(1);
+    options.setBorderTreatment(xvigra::BorderTreatment::repeat());
+
+    xvigra::Epilogue epilogue;
+    epilogue.setBias({1.5, -2.0});
+    epilogue.setScale(0.5);
+    epilogue.setClip(-4.0, 9.0);
+
+    xt::xtensor<KernelType, 4> kernel = xt::zeros<KernelType>({2, 3, 3, 3});
+    fillWithPattern(kernel, 5, 0.25, -0.5);
+
+    for (xvigra::ChannelPosition channelPosition : {xvigra::ChannelPosition::FIRST, xvigra::ChannelPosition::LAST}) {
+        CAPTURE(channelPosition);
+        options.setChannelPosition(channelPosition);
+        bool isChannelFirst = channelPosition == xvigra::ChannelPosition::FIRST;
+
+        xt::xtensor<InputType, 4> batch = isChannelFirst
+            ? xt::xtensor<InputType, 4>(xt::zeros<InputType>({3, 3, 9, 11}))
+            : xt::xtensor<InputType, 4>(xt::zeros<InputType>({3, 9, 11, 3}));
+        fillWithPattern(batch, 13);
+
+        // the epilogue is applied to every tile, also when the tiles span several images
+        options.setWorkspaceLimit(1024);
+        xt::xtensor<ResultType, 4> actual = xvigra::convolve2DBatch(batch, kernel, options, epilogue);
+
+        for (std::size_t image = 0; image < batch.shape()[0]; ++image) {
+            xt::xtensor<InputType, 3> single = xt::view(batch, image, xt::all(), xt::all(), xt::all());
+            xt::xtensor<ResultType, 3> expected;
+            xvigra::convolve2D(single, kernel, options.optionsY, options.optionsX, epilogue, expected);
+            xt::xtensor<ResultType, 3> actualImage = xt::view(actual, image, xt::all(), xt::all(), xt::all());
+
+            auto iterActual = actualImage.begin();
+            for (auto iterExpected = expected.begin(); iterExpected != expected.end(); ++iterActual, ++iterExpected) {
+                CHECK_EQ(*iterActual, doctest::Approx(*iterExpected).epsilon(ALGORITHM_EPSILON));
+            }
+        }
+
+        // a kernel without channel axes is the depthwise convolution of one group per input channel
+        xt::xtensor<KernelType, 2> depthwiseKernel = xt::zeros<KernelType>({3, 3});
+        fillWithPattern(depthwiseKernel, 7, 0.5, -1.0);
+        options.setGroups(3);
+        xt::xtensor<ResultType, 4> depthwise = xvigra::convolve2DBatch(batch, depthwiseKernel, options);
+        xt::xtensor<InputType, 3> firstImage = xt::view(batch, 0, xt::all(), xt::all(), xt::all());
+        xt::xtensor<ResultType, 3> expectedDepthwise = xvigra::convolve2D(firstImage, depthwiseKernel, options);
+        xt::xtensor<ResultType, 3> actualDepthwise = xt::view(depthwise, 0, xt::all(), xt::all(), xt::all());
+
+        auto iterActual = actualDepthwise.begin();
+        for (auto iterExpected = expectedDepthwise.begin(); iterExpected != expectedDepthwise.end(); ++iterActual, ++iterExpected) {
+            CHECK_EQ(*iterActual, doctest::Approx(*iterExpected).epsilon(ALGORITHM_EPSILON));
+        }
+        options.setGroups(1);
+    }
+}
+
+
+TEST_CASE_TEMPLATE("ConvolutionPlan2D: Test Invalid Configurations", T, TYPE_PAIRS) {
+    using InputType = typename T::first_type;
+    using KernelType = typename T::second_type;
+    using ResultType = typename std::common_type_t<InputType, KernelType>;
+
+    xt::xtensor<KernelType, 4> kernel = xt::zeros<KernelType>({3, 3, 3, 3});
+    xvigra::KernelOptions2D options;
+    options.setChannelPosition(xvigra::ChannelPosition::LAST);
+
+    SUBCASE("Implicit Option") {
+        options.setChannelPosition(xvigra::ChannelPosition::IMPLICIT);
+
+        CHECK_THROWS_WITH_AS(
+            (xvigra::ConvolutionPlan2D<InputType, KernelType>({7, 5, 3}, kernel, options)),
+            "ConvolutionPlan2D(): Implicit channel option is not supported for explicit channels in input!",
+            std::invalid_argument
+        );
+    }
+
+    SUBCASE("Input Channel Mismatch In Input And Kernel") {
+        CHECK_THROWS_WITH_AS(
+            (xvigra::ConvolutionPlan2D<InputType, KernelType>({7, 5, 2}, kernel, options)),
+            "ConvolutionPlan2D(): Input channels of input and kernel do not align!",
+            std::invalid_argument
+        );
+    }
+
+    SUBCASE("Unsupported Algorithm") {
+        options.setAlgorithm(xvigra::Algorithm::DIRECT);
+
+        CHECK_THROWS_WITH_AS(
+            (xvigra::ConvolutionPlan2D<InputType, KernelType>({7, 5, 3}, kernel, options)),
+            "ConvolutionPlan2D(): Only the GEMM and AUTO algorithms can be planned!",
+            std::invalid_argument
+        );
+    }
+
+    SUBCASE("Groups") {
+        options.setGroups(3);
+
+        CHECK_THROWS_WITH_AS(
+            (xvigra::ConvolutionPlan2D<InputType, KernelType>({7, 5, 3}, kernel, options)),
+            "ConvolutionPlan2D(): Groups are only supported for kernels without channel axes!",
+            std::invalid_argument
+        );
+
+        options.optionsX.setGroups(1);
+
+        CHECK_THROWS_WITH_AS(
+            (xvigra::ConvolutionPlan2D<InputType, KernelType>({7, 5, 3}, kernel, options)),
+            "ConvolutionPlan2D(): Groups can't be different for optionsY and optionsX!",
+            std::invalid_argument
+        );
+    }
+
+    SUBCASE("Bias Size") {
+        xvigra::Epilogue epilogue;
+        epilogue.setBias({1.0, 2.0});
+
+        CHECK_THROWS_WITH_AS(
+            (xvigra::ConvolutionPlan2D<InputType, KernelType>({7, 5, 3}, kernel, options, epilogue)),
+            "ConvolutionPlan2D(): Bias size does not match the output channels!",
+            std::invalid_argument
+        );
+    }
+
+    SUBCASE("Mismatching Batch Shapes") {
+        xvigra::ConvolutionPlan2D<InputType, KernelType> plan({7, 5, 3}, kernel, options);
+
+        xt::xtensor<InputType, 4> input = xt::zeros<InputType>({2, 7, 5, 3});
+        xt::xtensor<InputType, 4> wrongInput = xt::zeros<InputType>({2, 5, 7, 3});
+        xt::xtensor<ResultType, 4> output(plan.getBatchOutputShape(2));
+        xt::xtensor<ResultType, 4> wrongOutput(plan.getBatchOutputShape(3));
+
+        CHECK_THROWS_WITH_AS(
+            plan.executeBatch(wrongInput, output),
+            "ConvolutionPlan2D#executeBatch(): Input shape does not match the planned input shape!",
+            std::invalid_argument
+        );
+
+        CHECK_THROWS_WITH_AS(
+            plan.executeBatch(input, wrongOutput),
+            "ConvolutionPlan2D#executeBatch(): Output shape does not match the planned output shape!",
+            std::invalid_argument
+        );
+    }
+
+    SUBCASE("Batch Without Batch Dimension") {
+        xt::xarray<InputType> input = xt::zeros<InputType>({7, 5, 3});
+
+        CHECK_THROWS_WITH_AS(
+            xvigra::convolve2DBatch(input, kernel, options),
+            "convolve2DBatch(): Need 4 dimensional (N x H x W x C or N x C x H x W) input!",
+            std::invalid_argument
+        );
+    }
+
+    SUBCASE("Mismatching Input And Output Shapes") {
+        xvigra::ConvolutionPlan2D<InputType, KernelType> plan({7, 5, 3}, kernel, options);
+
+        xt::xtensor<InputType, 3> input = xt::zeros<InputType>({7, 5, 3});
+        xt::xtensor<InputType, 3> wrongInput = xt::zeros<InputType>({5, 7, 3});
+        xt::xtensor<ResultType, 3> output(plan.getOutputShape());
+        xt::xtensor<ResultType, 3> wrongOutput = xt::zeros<ResultType>({7, 5, 3});
+
+        CHECK_THROWS_WITH_AS(
+            plan.execute(wrongInput, output),
+            "ConvolutionPlan2D#execute(): Input shape does not match the planned input shape!",
+            std::invalid_argument
+        );
+
+        CHECK_THROWS_WITH_AS(
+            plan.execute(input, wrongOutput),
+            "ConvolutionPlan2D#execute(): Output shape does not match the planned output shape!",
+            std::invalid_argument
+        );
+    }
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test ConvolutionPlan2D - end                                                                                     ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
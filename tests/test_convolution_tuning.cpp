@@ -0,0 +1,460 @@
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#define DOCTEST_CONFIG_SUPER_FAST_ASSERTS
+#include "doctest/doctest.h"
+
+#ifdef VOID
+#undef VOID
+#endif
+
+#include "xtensor/xtensor.hpp"
+
+#include "xvigra/convolution_tuning.hpp"
+#include "xvigra/convolution_util.hpp"
+#include "xvigra/explicit_convolution.hpp"
+#include "xvigra/half_precision.hpp"
+
+#include "test_util.hpp"
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ define - begin                                                                                                   ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+#define TYPE_PAIRS              \
+    std::pair<short, float>,    \
+    std::pair<short, double>,   \
+    std::pair<int, float>,      \
+    std::pair<int, double>
+
+TYPE_TO_STRING(std::pair<short, float>);
+TYPE_TO_STRING(std::pair<short, double>);
+TYPE_TO_STRING(std::pair<int, float>);
+TYPE_TO_STRING(std::pair<int, double>);
+
+#define HALF_TYPES          \
+    xvigra::Float16,        \
+    xvigra::BFloat16
+
+TYPE_TO_STRING(xvigra::Float16);
+TYPE_TO_STRING(xvigra::BFloat16);
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ define - end                                                                                                     ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ constexpr - begin                                                                                                ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+constexpr double ALGORITHM_EPSILON = 1e-4;
+
+// the candidates round every result to 16 bits, so tuned and default results may differ by a few 16-bit epsilons
+constexpr double HALF_ALGORITHM_EPSILON = 3e-2;
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ constexpr - end                                                                                                  ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ utility - begin                                                                                                  ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+std::string createCachePath(const std::string& name) {
+    std::filesystem::path path = std::filesystem::temp_directory_path() / ("xvigra_" + name + ".cache");
+    std::filesystem::remove(path);
+    return path.string();
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ utility - end                                                                                                    ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test tuning key - begin                                                                                          ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+TEST_CASE("Test tuningTypeName") {
+    CHECK_EQ(xvigra::tuningTypeName<float>(), "f4");
+    CHECK_EQ(xvigra::tuningTypeName<double>(), "f8");
+    CHECK_EQ(xvigra::tuningTypeName<short>(), "i2");
+    CHECK_EQ(xvigra::tuningTypeName<unsigned char>(), "u1");
+    CHECK_EQ(xvigra::tuningTypeName<xvigra::Float16>(), "h2");
+    CHECK_EQ(xvigra::tuningTypeName<xvigra::BFloat16>(), "b2");
+}
+
+
+TEST_CASE("Test algorithmName") {
+    for (xvigra::Algorithm algorithm : {
+        xvigra::Algorithm::GEMM,
+        xvigra::Algorithm::DIRECT,
+        xvigra::Algorithm::WINOGRAD_2X2,
+        xvigra::Algorithm::WINOGRAD_4X4,
+        xvigra::Algorithm::FFT,
+        xvigra::Algorithm::AUTO
+    }) {
+        CHECK_EQ(xvigra::parseAlgorithmName(xvigra::algorithmName(algorithm)), algorithm);
+    }
+
+    CHECK_THROWS_WITH_AS(
+        xvigra::parseAlgorithmName("SLOW"),
+        "parseAlgorithmName(): Unknown algorithm name 'SLOW'!",
+        std::invalid_argument
+    );
+}
+
+
+TEST_CASE("Test createTuningKey2D") {
+    xvigra::KernelOptions2D options;
+    options.setPadding(1);
+    options.setBorderTreatment(xvigra::BorderTreatment::constant(0));
+
+    std::string key = xvigra::createTuningKey2D<float, float>(3, 32, 32, 8, 3, 3, 1.0, options);
+
+    CHECK_EQ(key.find(' '), std::string::npos);
+
+    SUBCASE("Ignored Options") {
+        xvigra::KernelOptions2D other = options;
+        other.setAlgorithm(xvigra::Algorithm::FFT);
+        other.setWorkspaceLimit(1);
+        other.setBorderTreatment(xvigra::BorderTreatment::constant(7));
+
+        std::string otherKey = xvigra::createTuningKey2D<float, float>(3, 32, 32, 8, 3, 3, 1.0, other);
+        CHECK_EQ(otherKey, key);
+    }
+
+    SUBCASE("Relevant Options") {
+        std::string typeKey = xvigra::createTuningKey2D<float, double>(3, 32, 32, 8, 3, 3, 1.0, options);
+        std::string widthKey = xvigra::createTuningKey2D<float, float>(3, 32, 33, 8, 3, 3, 1.0, options);
+        std::string kernelKey = xvigra::createTuningKey2D<float, float>(3, 32, 32, 8, 3, 5, 1.0, options);
+
+        std::string densityKey = xvigra::createTuningKey2D<float, float>(3, 32, 32, 8, 3, 3, 0.1, options);
+        std::string roundedDensityKey = xvigra::createTuningKey2D<float, float>(3, 32, 32, 8, 3, 3, 0.9999, options);
+
+        CHECK_NE(typeKey, key);
+        CHECK_NE(widthKey, key);
+        CHECK_NE(kernelKey, key);
+        CHECK_NE(densityKey, key);
+
+        // the density is stored in per mille
+        CHECK_EQ(roundedDensityKey, key);
+
+        // densities on both sides of a sparse threshold never share an entry
+        std::string sparseKey = xvigra::createTuningKey2D<float, float>(3, 32, 32, 8, 3, 3, xvigra::SPARSE_TAP_DENSITY_CHANNEL_LAST, options);
+        std::string denseKey = xvigra::createTuningKey2D<float, float>(3, 32, 32, 8, 3, 3, xvigra::SPARSE_TAP_DENSITY_CHANNEL_LAST + 1e-5, options);
+        CHECK_NE(sparseKey, denseKey);
+
+        xvigra::KernelOptions2D other = options;
+        other.setStride(1, 2);
+        std::string strideKey = xvigra::createTuningKey2D<float, float>(3, 32, 32, 8, 3, 3, 1.0, other);
+        CHECK_NE(strideKey, key);
+
+        other = options;
+        other.setBorderTreatment(xvigra::BorderTreatment::wrap());
+        std::string borderKey = xvigra::createTuningKey2D<float, float>(3, 32, 32, 8, 3, 3, 1.0, other);
+        CHECK_NE(borderKey, key);
+
+        other = options;
+        other.setThreadCount(4);
+        std::string threadKey = xvigra::createTuningKey2D<float, float>(3, 32, 32, 8, 3, 3, 1.0, other);
+        CHECK_NE(threadKey, key);
+
+        other = options;
+        other.setChannelPosition(xvigra::ChannelPosition::FIRST);
+        std::string channelKey = xvigra::createTuningKey2D<float, float>(3, 32, 32, 8, 3, 3, 1.0, other);
+        CHECK_NE(channelKey, key);
+    }
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test tuning key - end                                                                                            ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test ConvolutionTuner - begin                                                                                    ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+TEST_CASE_TEMPLATE("ConvolutionTuner: Test Against convolve2D", T, TYPE_PAIRS) {
+    using InputType = typename T::first_type;
+    using KernelType = typename T::second_type;
+    using ResultType = typename std::common_type_t<InputType, KernelType>;
+
+    xt::xtensor<KernelType, 4> kernel = xt::zeros<KernelType>({4, 3, 3, 3});
+    fillWithPattern(kernel, 5, 0.25, -0.5);
+
+    xvigra::KernelOptions2D options;
+    options.setPadding(1);
+    options.setBorderTreatment(xvigra::BorderTreatment::repeat());
+
+    xvigra::ConvolutionTuner tuner("", 1);
+
+    for (xvigra::ChannelPosition position : {xvigra::ChannelPosition::FIRST, xvigra::ChannelPosition::LAST}) {
+        bool isChannelFirst = position == xvigra::ChannelPosition::FIRST;
+        typename xt::xtensor<InputType, 3>::shape_type shape{17, 19, 3};
+        if (isChannelFirst) {
+            shape = {3, 17, 19};
+        }
+
+        xt::xtensor<InputType, 3> input(shape);
+        fillWithPattern(input, 11);
+        options.setChannelPosition(position);
+
+        xvigra::KernelOptions2D tuned = tuner.tune2D(input, kernel, options);
+
+        CHECK_NE(tuned.optionsY.algorithm, xvigra::Algorithm::AUTO);
+        CHECK_EQ(tuned.optionsY.getPadding(), options.optionsY.getPadding());
+        CHECK_EQ(tuned.optionsX.channelPosition, position);
+
+        xt::xtensor<ResultType, 3> expected = xvigra::convolve2D(input, kernel, options);
+        xt::xtensor<ResultType, 3> actual = xvigra::convolve2D(input, kernel, tuned);
+
+        REQUIRE_EQ(actual.shape(), expected.shape());
+
+        auto iterActual = actual.begin();
+        for (auto iterExpected = expected.begin(); iterExpected != expected.end(); ++iterActual, ++iterExpected) {
+            CHECK_EQ(*iterActual, doctest::Approx(*iterExpected).epsilon(ALGORITHM_EPSILON));
+        }
+
+        // a known configuration is answered from the cache
+        xvigra::KernelOptions2D again = tuner.tune2D(input, kernel, options);
+        CHECK_EQ(again.optionsY.algorithm, tuned.optionsY.algorithm);
+        CHECK_EQ(again.optionsY.workspaceLimit, tuned.optionsY.workspaceLimit);
+    }
+
+    CHECK_EQ(tuner.size(), 2);
+}
+
+
+TEST_CASE_TEMPLATE("ConvolutionTuner: Test Half Precision", T, HALF_TYPES) {
+    xt::xtensor<float, 4> kernel = xt::zeros<float>({4, 3, 3, 3});
+    fillWithPattern(kernel, 5, 0.25, 0.25);
+    xt::xtensor<float, 3> input = xt::zeros<float>({3, 17, 19});
+    fillWithPattern(input, 11, 0.125, 0.5);
+
+    xt::xtensor<T, 4> halfKernel = xt::cast<T>(kernel);
+    xt::xtensor<T, 3> halfInput = xt::cast<T>(input);
+
+    xvigra::KernelOptions2D options;
+    options.setPadding(1);
+    options.setChannelPosition(xvigra::ChannelPosition::FIRST);
+
+    xvigra::ConvolutionTuner tuner("", 1);
+    xvigra::KernelOptions2D tuned = tuner.tune2D(halfInput, halfKernel, options);
+
+    xt::xtensor<T, 3> expected = xvigra::convolve2D(halfInput, halfKernel, options);
+    xt::xtensor<T, 3> actual = xvigra::convolve2D(halfInput, halfKernel, tuned);
+
+    REQUIRE_EQ(actual.shape(), expected.shape());
+
+    auto iterActual = actual.begin();
+    for (auto iterExpected = expected.begin(); iterExpected != expected.end(); ++iterActual, ++iterExpected) {
+        CHECK_EQ(static_cast<float>(*iterActual), doctest::Approx(static_cast<float>(*iterExpected)).epsilon(HALF_ALGORITHM_EPSILON));
+    }
+
+    // the key names the stored types, so the float kernel of the same shape gets its own entry
+    tuner.tune2D(halfInput, kernel, options);
+
+    CHECK_EQ(tuner.size(), 2);
+    CHECK(tuner.contains(xvigra::createTuningKey2D<T, T>(3, 17, 19, 4, 3, 3, 1.0, options)));
+    CHECK(tuner.contains(xvigra::createTuningKey2D<T, float>(3, 17, 19, 4, 3, 3, 1.0, options)));
+}
+
+
+TEST_CASE("ConvolutionTuner: Test Sparse Kernel") {
+    // ring of 4 taps in a 5x5 kernel, which Algorithm::AUTO hands to the sparse backend for channel first inputs
+    xt::xtensor<float, 4> sparseKernel = xt::zeros<float>({4, 3, 5, 5});
+    for (std::size_t outputChannel = 0; outputChannel < 4; ++outputChannel) {
+        for (std::size_t inputChannel = 0; inputChannel < 3; ++inputChannel) {
+            sparseKernel(outputChannel, inputChannel, 0, 2) = 1.0f;
+            sparseKernel(outputChannel, inputChannel, 4, 2) = -1.0f;
+            sparseKernel(outputChannel, inputChannel, 2, 0) = 0.5f;
+            sparseKernel(outputChannel, inputChannel, 2, 4) = -1.5f;
+        }
+    }
+    xt::xtensor<float, 4> denseKernel = xt::ones<float>({4, 3, 5, 5});
+
+    xt::xtensor<float, 3> input = xt::zeros<float>({3, 17, 19});
+    fillWithPattern(input, 11);
+
+    xvigra::KernelOptions2D options;
+    options.setPadding(2);
+    options.setChannelPosition(xvigra::ChannelPosition::FIRST);
+
+    xvigra::ConvolutionTuner tuner("", 1);
+    xvigra::KernelOptions2D tuned = tuner.tune2D(input, sparseKernel, options);
+
+    xt::xtensor<float, 3> expected = xvigra::convolve2D(input, sparseKernel, options);
+    xt::xtensor<float, 3> actual = xvigra::convolve2D(input, sparseKernel, tuned);
+
+    REQUIRE_EQ(actual.shape(), expected.shape());
+
+    auto iterActual = actual.begin();
+    for (auto iterExpected = expected.begin(); iterExpected != expected.end(); ++iterActual, ++iterExpected) {
+        CHECK_EQ(*iterActual, doctest::Approx(*iterExpected).epsilon(ALGORITHM_EPSILON));
+    }
+
+    // the dense kernel of the same shape is tuned under its own key
+    xvigra::KernelOptions2D denseTuned = tuner.tune2D(input, denseKernel, options);
+
+    CHECK_NE(denseTuned.optionsY.algorithm, xvigra::Algorithm::AUTO);
+    CHECK_EQ(tuner.size(), 2);
+    CHECK(tuner.contains(xvigra::createTuningKey2D<float, float>(3, 17, 19, 4, 5, 5, xvigra::collectNonZeroTaps<float>(sparseKernel).density(), options)));
+    CHECK(tuner.contains(xvigra::createTuningKey2D<float, float>(3, 17, 19, 4, 5, 5, 1.0, options)));
+}
+
+
+TEST_CASE("ConvolutionTuner: Test Cache File") {
+    std::string path = createCachePath("test_cache_file");
+
+    xt::xtensor<float, 3> input = xt::zeros<float>({12, 13, 2});
+    xt::xtensor<float, 4> kernel = xt::zeros<float>({2, 2, 3, 3});
+    fillWithPattern(input, 11);
+    fillWithPattern(kernel, 5, 0.25, -0.5);
+
+    xvigra::KernelOptions2D options;
+    options.setPadding(1);
+
+    // every fifth tap of the pattern is 0
+    std::string key = xvigra::createTuningKey2D<float, float>(2, 12, 13, 2, 3, 3, xvigra::collectNonZeroTaps<float>(kernel).density(), options);
+
+    xvigra::ConvolutionTuner writer(path, 1);
+    CHECK_EQ(writer.size(), 0);
+
+    xvigra::KernelOptions2D tuned = writer.tune2D(input, kernel, options);
+    REQUIRE(std::filesystem::exists(path));
+
+    SUBCASE("Load In Later Process") {
+        xvigra::ConvolutionTuner reader(path);
+
+        REQUIRE(reader.contains(key));
+        CHECK_EQ(reader.size(), 1);
+        CHECK_EQ(reader.get(key).algorithm, tuned.optionsY.algorithm);
+        CHECK_EQ(reader.get(key).workspaceLimit, tuned.optionsY.workspaceLimit);
+        CHECK_EQ(reader.get(key).seconds, writer.get(key).seconds);
+    }
+
+    SUBCASE("Merge Entries Of Other Processes") {
+        xvigra::ConvolutionTuner other(path);
+        other.put("other", xvigra::TuningResult{xvigra::Algorithm::FFT, 0, 0.5});
+        other.save();
+
+        writer.put("mine", xvigra::TuningResult{xvigra::Algorithm::DIRECT, 1024, 0.25});
+        writer.save();
+
+        xvigra::ConvolutionTuner reader(path);
+        CHECK_EQ(reader.size(), 3);
+        CHECK_EQ(reader.get("other").algorithm, xvigra::Algorithm::FFT);
+        CHECK_EQ(reader.get("mine").algorithm, xvigra::Algorithm::DIRECT);
+        CHECK_EQ(reader.get("mine").workspaceLimit, 1024);
+        CHECK_EQ(reader.get("mine").seconds, 0.25);
+    }
+
+    SUBCASE("Concurrent Writers") {
+        std::vector<std::thread> writers;
+        for (int index = 0; index < 8; ++index) {
+            writers.emplace_back([&path, index]() {
+                xvigra::ConvolutionTuner concurrent(path);
+                for (int entry = 0; entry < 20; ++entry) {
+                    concurrent.put("writer" + std::to_string(index) + "_" + std::to_string(entry), xvigra::TuningResult{xvigra::Algorithm::GEMM, 0, 0.5});
+                    concurrent.save();
+                }
+            });
+        }
+
+        for (std::thread& thread : writers) {
+            thread.join();
+        }
+
+        // every writer has its own temporary file, so the cache stays well-formed and no temporary file is left behind
+        xvigra::ConvolutionTuner reader(path);
+        CHECK(reader.contains(key));
+        CHECK_GE(reader.size(), 21);
+
+        std::string prefix = std::filesystem::path(path).filename().string() + ".";
+        for (const auto& file : std::filesystem::directory_iterator(std::filesystem::path(path).parent_path())) {
+            CHECK_FALSE(file.path().filename().string().rfind(prefix, 0) == 0);
+        }
+    }
+
+    std::filesystem::remove(path);
+}
+
+
+TEST_CASE("ConvolutionTuner: Test Invalid Configurations") {
+    SUBCASE("No Repetitions") {
+        CHECK_THROWS_WITH_AS(
+            (xvigra::ConvolutionTuner("", 0)),
+            "ConvolutionTuner(): Need at least one repetition!",
+            std::invalid_argument
+        );
+    }
+
+    SUBCASE("Unknown Key") {
+        xvigra::ConvolutionTuner tuner;
+
+        CHECK_THROWS_WITH_AS(
+            tuner.get("missing"),
+            "ConvolutionTuner#get(): No tuning result for key 'missing'!",
+            std::out_of_range
+        );
+    }
+
+    SUBCASE("Foreign File") {
+        std::string path = createCachePath("test_foreign_file");
+        {
+            std::ofstream file(path);
+            file << "some other content\n";
+        }
+
+        xvigra::ConvolutionTuner tuner(path);
+        CHECK_EQ(tuner.size(), 0);
+
+        std::filesystem::remove(path);
+    }
+
+    SUBCASE("Malformed Entry") {
+        std::string path = createCachePath("test_malformed_entry");
+        {
+            std::ofstream file(path);
+            file << xvigra::TUNING_CACHE_HEADER << "\n" << "key GEMM\n";
+        }
+
+        std::string message = "ConvolutionTuner#load(): Malformed entry in line 2 of '" + path + "'!";
+        CHECK_THROWS_WITH_AS(
+            (xvigra::ConvolutionTuner(path)),
+            message.c_str(),
+            std::runtime_error
+        );
+
+        std::filesystem::remove(path);
+    }
+
+    SUBCASE("Implicit Option") {
+        xvigra::ConvolutionTuner tuner;
+        xt::xtensor<float, 3> input = xt::zeros<float>({7, 5, 3});
+        xt::xtensor<float, 4> kernel = xt::zeros<float>({3, 3, 3, 3});
+        xvigra::KernelOptions2D options;
+        options.setChannelPosition(xvigra::ChannelPosition::IMPLICIT);
+
+        CHECK_THROWS_WITH_AS(
+            tuner.tune2D(input, kernel, options),
+            "ConvolutionTuner#tune2D(): Implicit channel option is not supported for explicit channels in input!",
+            std::invalid_argument
+        );
+    }
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test ConvolutionTuner - end                                                                                      ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
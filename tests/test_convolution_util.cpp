@@ -1,6 +1,11 @@
+#include <array>
+#include <complex>
+#include <cstddef>
 #include <limits>
 #include <stdexcept>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #define DOCTEST_CONFIG_SUPER_FAST_ASSERTS
 #include "doctest/doctest.h"
@@ -9,9 +14,11 @@
 #undef VOID
 #endif
 
+#include "xtensor/xmanipulation.hpp"
 #include "xtensor/xtensor.hpp"
 
 #include "xvigra/explicit_convolution.hpp"
+#include "xvigra/kernel_init.hpp"
 
 TEST_CASE("Test calculateOutputSize") {
     constexpr int inputSize = 5;
@@ -43,4 +50,360 @@ TEST_CASE("Test calculateOutputSize") {
             CHECK_EQ(calculateOutputSize(inputSize, kernelSize, options), 3);
         }
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("Test calculateTileSize") {
+    SUBCASE("Unbounded Workspace") {
+        CHECK_EQ(xvigra::calculateTileSize(0, 1024, 17), 17);
+    }
+
+    SUBCASE("Workspace Larger Than Patch") {
+        CHECK_EQ(xvigra::calculateTileSize(1024 * 1024, 1024, 17), 17);
+    }
+
+    SUBCASE("Workspace Smaller Than Patch") {
+        CHECK_EQ(xvigra::calculateTileSize(4096, 1024, 17), 4);
+        CHECK_EQ(xvigra::calculateTileSize(4095, 1024, 17), 3);
+    }
+
+    SUBCASE("Workspace Smaller Than Single Unit") {
+        CHECK_EQ(xvigra::calculateTileSize(1, 1024, 17), 1);
+    }
+}
+
+
+TEST_CASE("Test calculateFFTHeight") {
+    // one row of a band with 3 input channels and 32 columns needs 6 * 17 spectrum values and 32 image values
+    std::size_t rowBytes = 6 * 17 * sizeof(std::complex<double>) + 32 * sizeof(double);
+
+    SUBCASE("Unbounded Workspace") {
+        CHECK_EQ(xvigra::calculateFFTHeight(0, 3, 29, 32, 9), std::size_t(32));
+    }
+
+    SUBCASE("Workspace Larger Than Spectra") {
+        CHECK_EQ(xvigra::calculateFFTHeight(32 * rowBytes, 3, 29, 32, 9), std::size_t(32));
+    }
+
+    SUBCASE("Workspace Smaller Than Spectra") {
+        CHECK_EQ(xvigra::calculateFFTHeight(32 * rowBytes - 1, 3, 29, 32, 9), std::size_t(16));
+    }
+
+    SUBCASE("Workspace Smaller Than Kernel") {
+        CHECK_EQ(xvigra::calculateFFTHeight(1, 3, 29, 32, 9), std::size_t(16));
+        CHECK_EQ(xvigra::calculateFFTHeight(1, 3, 29, 32, 17), std::size_t(32));
+    }
+}
+
+
+TEST_CASE("Test calculateInteriorRange") {
+    constexpr int inputSize = 9;
+    constexpr int kernelSize = 3;
+    xvigra::KernelOptions options;
+
+    SUBCASE("(0, 1, 1)") {
+        options.setPadding(0);
+        CHECK_EQ(xvigra::calculateInteriorRange(inputSize, kernelSize, options), std::make_pair(0, 7));
+    }
+
+    SUBCASE("(2, 1, 1)") {
+        options.setPadding(2);
+        CHECK_EQ(xvigra::calculateInteriorRange(inputSize, kernelSize, options), std::make_pair(2, 9));
+    }
+
+    SUBCASE("(2, 2, 1)") {
+        options.setPadding(2);
+        options.stride = 2;
+        CHECK_EQ(xvigra::calculateInteriorRange(inputSize, kernelSize, options), std::make_pair(1, 5));
+    }
+
+    SUBCASE("(2, 1, 2)") {
+        options.setPadding(2);
+        options.dilation = 2;
+        CHECK_EQ(xvigra::calculateInteriorRange(inputSize, kernelSize, options), std::make_pair(2, 7));
+    }
+
+    SUBCASE("(4, 1, 5)") {
+        options.setPadding(4);
+        options.dilation = 5;
+        CHECK_EQ(xvigra::calculateInteriorRange(inputSize, kernelSize, options), std::make_pair(4, 4));
+    }
+}
+
+
+TEST_CASE("Test calculatePaddedSourceIndices") {
+    constexpr int inputSize = 5;
+    constexpr int kernelSize = 3;
+    xvigra::KernelOptions options;
+    options.setPadding(2);
+
+    SUBCASE("BorderTreatment::asymmetricReflect()") {
+        options.setBorderTreatment(xvigra::BorderTreatment::asymmetricReflect());
+        std::vector<int> expected{2, 1, 0, 1, 2, 3, 4, 3, 2};
+        CHECK_EQ(xvigra::calculatePaddedSourceIndices(inputSize, kernelSize, options), expected);
+    }
+
+    SUBCASE("BorderTreatment::avoid()") {
+        options.setBorderTreatment(xvigra::BorderTreatment::avoid());
+        std::vector<int> expected{0, 1, 2, 3, 4};
+        CHECK_EQ(xvigra::calculatePaddedSourceIndices(inputSize, kernelSize, options), expected);
+    }
+
+    SUBCASE("BorderTreatment::constant(2)") {
+        options.setBorderTreatment(xvigra::BorderTreatment::constant(2));
+        std::vector<int> expected{
+            xvigra::CONSTANT_BEGIN_INDEX, xvigra::CONSTANT_BEGIN_INDEX,
+            0, 1, 2, 3, 4,
+            xvigra::CONSTANT_END_INDEX, xvigra::CONSTANT_END_INDEX
+        };
+        CHECK_EQ(xvigra::calculatePaddedSourceIndices(inputSize, kernelSize, options), expected);
+    }
+
+    SUBCASE("BorderTreatment::repeat()") {
+        options.setBorderTreatment(xvigra::BorderTreatment::repeat());
+        std::vector<int> expected{0, 0, 0, 1, 2, 3, 4, 4, 4};
+        CHECK_EQ(xvigra::calculatePaddedSourceIndices(inputSize, kernelSize, options), expected);
+    }
+
+    SUBCASE("BorderTreatment::symmetricReflect()") {
+        options.setBorderTreatment(xvigra::BorderTreatment::symmetricReflect());
+        std::vector<int> expected{1, 0, 0, 1, 2, 3, 4, 4, 3};
+        CHECK_EQ(xvigra::calculatePaddedSourceIndices(inputSize, kernelSize, options), expected);
+    }
+
+    SUBCASE("BorderTreatment::wrap()") {
+        options.setBorderTreatment(xvigra::BorderTreatment::wrap());
+        std::vector<int> expected{3, 4, 0, 1, 2, 3, 4, 0, 1};
+        CHECK_EQ(xvigra::calculatePaddedSourceIndices(inputSize, kernelSize, options), expected);
+    }
+
+    SUBCASE("Stride=2, Dilation=2") {
+        options.setPadding(1);
+        options.stride = 2;
+        options.dilation = 2;
+        options.setBorderTreatment(xvigra::BorderTreatment::wrap());
+        std::vector<int> expected{5, 0, 1, 2, 3, 4, 5};
+        CHECK_EQ(xvigra::calculatePaddedSourceIndices(inputSize + 1, kernelSize, options), expected);
+    }
+}
+
+
+TEST_CASE("Test isPointwise2D") {
+    xvigra::KernelOptions2D options;
+    CHECK(xvigra::isPointwise2D(1, 1, options.optionsY, options.optionsX));
+    CHECK_FALSE(xvigra::isPointwise2D(1, 3, options.optionsY, options.optionsX));
+
+    // the dilation of a single tap has no effect
+    options.setDilation(2);
+    CHECK(xvigra::isPointwise2D(1, 1, options.optionsY, options.optionsX));
+
+    options.setPadding(0, 1);
+    CHECK_FALSE(xvigra::isPointwise2D(1, 1, options.optionsY, options.optionsX));
+
+    options.setPadding(0);
+    options.setStride(2, 1);
+    CHECK_FALSE(xvigra::isPointwise2D(1, 1, options.optionsY, options.optionsX));
+
+    // the pointwise GEMM skips the gather of the patch, which makes it cheaper than the direct algorithm
+    xvigra::KernelOptions2D pointwiseOptions;
+    CHECK_EQ(xvigra::selectAlgorithm2D(1, 512, 512, 1, 1, 1, pointwiseOptions.optionsY, pointwiseOptions.optionsX, true), xvigra::Algorithm::GEMM);
+
+    pointwiseOptions.setStride(2);
+    CHECK_EQ(xvigra::selectAlgorithm2D(1, 512, 512, 1, 1, 1, pointwiseOptions.optionsY, pointwiseOptions.optionsX, true), xvigra::Algorithm::DIRECT);
+}
+
+
+TEST_CASE("Test estimateAlgorithmCost2D") {
+    xvigra::KernelOptions2D options;
+    options.setPadding(1);
+
+    SUBCASE("Unsupported Winograd Configurations") {
+        CHECK_EQ(
+            xvigra::estimateAlgorithmCost2D(xvigra::Algorithm::WINOGRAD_4X4, 3, 32, 32, 3, 5, 5, options.optionsY, options.optionsX, true),
+            std::numeric_limits<double>::infinity()
+        );
+        CHECK_EQ(
+            xvigra::estimateAlgorithmCost2D(xvigra::Algorithm::WINOGRAD_2X2, 3, 32, 32, 3, 3, 3, options.optionsY, options.optionsX, false),
+            std::numeric_limits<double>::infinity()
+        );
+
+        options.setStride(2, 1);
+        CHECK_EQ(
+            xvigra::estimateAlgorithmCost2D(xvigra::Algorithm::WINOGRAD_2X2, 3, 32, 32, 3, 3, 3, options.optionsY, options.optionsX, true),
+            std::numeric_limits<double>::infinity()
+        );
+    }
+
+    SUBCASE("Cost Grows With Kernel Size") {
+        for (auto algorithm : {xvigra::Algorithm::GEMM, xvigra::Algorithm::DIRECT}) {
+            double smallCost = xvigra::estimateAlgorithmCost2D(algorithm, 3, 32, 32, 3, 3, 3, options.optionsY, options.optionsX, true);
+            double largeCost = xvigra::estimateAlgorithmCost2D(algorithm, 3, 32, 32, 3, 5, 5, options.optionsY, options.optionsX, true);
+            CHECK_LT(smallCost, largeCost);
+        }
+    }
+
+    SUBCASE("FFT Bands Within Workspace Limit") {
+        options.setPadding(7);
+        options.setWorkspaceLimit(0);
+        double unboundedCost = xvigra::estimateAlgorithmCost2D(xvigra::Algorithm::FFT, 3, 64, 64, 3, 15, 15, options.optionsY, options.optionsX, true);
+
+        options.setWorkspaceLimit(1);
+        double boundedCost = xvigra::estimateAlgorithmCost2D(xvigra::Algorithm::FFT, 3, 64, 64, 3, 15, 15, options.optionsY, options.optionsX, true);
+        CHECK_LT(unboundedCost, boundedCost);
+    }
+
+    SUBCASE("Algorithms Of convolve1D") {
+        CHECK_EQ(
+            xvigra::estimateAlgorithmCost1D(xvigra::Algorithm::FFT, 3, 32, 3, 3, options.optionsX),
+            std::numeric_limits<double>::infinity()
+        );
+        CHECK_LT(
+            xvigra::estimateAlgorithmCost1D(xvigra::Algorithm::GEMM, 3, 32, 3, 3, options.optionsX),
+            std::numeric_limits<double>::infinity()
+        );
+    }
+}
+
+
+TEST_CASE("Test selectAlgorithm2D") {
+    xvigra::KernelOptions2D options;
+
+    SUBCASE("Few Channels, Small Kernel") {
+        options.setPadding(1);
+        CHECK_EQ(xvigra::selectAlgorithm2D(1, 512, 512, 1, 3, 3, options.optionsY, options.optionsX, true), xvigra::Algorithm::DIRECT);
+    }
+
+    SUBCASE("Many Channels, 3x3 Kernel") {
+        options.setPadding(1);
+        CHECK_EQ(xvigra::selectAlgorithm2D(64, 56, 56, 64, 3, 3, options.optionsY, options.optionsX, true), xvigra::Algorithm::WINOGRAD_4X4);
+        CHECK_EQ(xvigra::selectAlgorithm2D(64, 56, 56, 64, 3, 3, options.optionsY, options.optionsX, false), xvigra::Algorithm::GEMM);
+    }
+
+    SUBCASE("Many Channels, 1x1 Kernel") {
+        options.setPadding(0);
+        CHECK_EQ(xvigra::selectAlgorithm2D(64, 56, 56, 64, 1, 1, options.optionsY, options.optionsX, true), xvigra::Algorithm::GEMM);
+    }
+
+    SUBCASE("Large Kernel") {
+        options.setPadding(15);
+        CHECK_EQ(xvigra::selectAlgorithm2D(1, 480, 480, 1, 31, 31, options.optionsY, options.optionsX, true), xvigra::Algorithm::FFT);
+    }
+
+    SUBCASE("1-dimensional") {
+        options.setPadding(1);
+        CHECK_EQ(xvigra::selectAlgorithm1D(1, 1000, 1, 3, options.optionsX), xvigra::Algorithm::DIRECT);
+        CHECK_EQ(xvigra::selectAlgorithm1D(32, 1000, 32, 3, options.optionsX), xvigra::Algorithm::GEMM);
+    }
+}
+
+TEST_CASE("Test toChannelBlocked And fromChannelBlocked") {
+    xt::xtensor<int, 3> channelFirst = xt::zeros<int>({11, 3, 4});
+    for (std::size_t index = 0; index < channelFirst.size(); ++index) {
+        channelFirst.flat(index) = static_cast<int>(index) + 1;
+    }
+    xt::xtensor<int, 3> channelLast = xt::transpose(channelFirst, {1, 2, 0});
+
+    SUBCASE("Channel First") {
+        auto blocked = xvigra::toChannelBlocked(channelFirst, xvigra::ChannelPosition::FIRST);
+
+        REQUIRE_EQ(blocked.shape(), std::array<std::size_t, 4>{2, 3, 4, xvigra::CHANNEL_BLOCK_SIZE});
+        CHECK_EQ(blocked(0, 1, 2, 5), channelFirst(5, 1, 2));
+        CHECK_EQ(blocked(1, 2, 3, 2), channelFirst(10, 2, 3));
+        CHECK_EQ(blocked(1, 2, 3, 3), 0);
+        CHECK_EQ(xvigra::fromChannelBlocked(blocked, 11, xvigra::ChannelPosition::FIRST), channelFirst);
+    }
+
+    SUBCASE("Channel Last") {
+        auto blocked = xvigra::toChannelBlocked(channelLast, xvigra::ChannelPosition::LAST);
+
+        CHECK_EQ(blocked, xvigra::toChannelBlocked(channelFirst, xvigra::ChannelPosition::FIRST));
+        CHECK_EQ(xvigra::fromChannelBlocked(blocked, 11, xvigra::ChannelPosition::LAST), channelLast);
+    }
+
+    SUBCASE("Invalid Arguments") {
+        auto blocked = xvigra::toChannelBlocked(channelFirst, xvigra::ChannelPosition::FIRST);
+
+        CHECK_THROWS_WITH_AS(
+            xvigra::toChannelBlocked(channelFirst, xvigra::ChannelPosition::IMPLICIT),
+            "toChannelBlocked(): Only ChannelPosition::FIRST or ChannelPosition::LAST can be converted!",
+            std::invalid_argument
+        );
+        CHECK_THROWS_WITH_AS(
+            xvigra::fromChannelBlocked(blocked, 8, xvigra::ChannelPosition::FIRST),
+            "fromChannelBlocked(): Channels don't fit the channel blocks!",
+            std::invalid_argument
+        );
+        CHECK_THROWS_WITH_AS(
+            xvigra::fromChannelBlocked(channelFirst, 11, xvigra::ChannelPosition::FIRST),
+            "fromChannelBlocked(): Need 4 dimensional (C/8 x H x W x 8) input!",
+            std::invalid_argument
+        );
+    }
+}
+
+TEST_CASE("Test detectKernelSymmetry And resolveKernelSymmetry") {
+    SUBCASE("Detection") {
+        CHECK_EQ(xvigra::detectKernelSymmetry(xt::xtensor<double, 1>{1.0, 2.0, 1.0}), xvigra::KernelSymmetry::SYMMETRIC);
+        CHECK_EQ(xvigra::detectKernelSymmetry(xt::xtensor<double, 1>{1.0, 2.0, 2.0, 1.0}), xvigra::KernelSymmetry::SYMMETRIC);
+        CHECK_EQ(xvigra::detectKernelSymmetry(xt::xtensor<double, 1>{-1.0, 0.0, 1.0}), xvigra::KernelSymmetry::ANTISYMMETRIC);
+        CHECK_EQ(xvigra::detectKernelSymmetry(xt::xtensor<double, 1>{-1.0, 2.0, -2.0, 1.0}), xvigra::KernelSymmetry::ANTISYMMETRIC);
+
+        // an antisymmetric kernel of odd size needs a zero center
+        CHECK_EQ(xvigra::detectKernelSymmetry(xt::xtensor<double, 1>{-1.0, 0.5, 1.0}), xvigra::KernelSymmetry::NONE);
+        CHECK_EQ(xvigra::detectKernelSymmetry(xt::xtensor<double, 1>{1.0, 2.0, 3.0}), xvigra::KernelSymmetry::NONE);
+        CHECK_EQ(xvigra::detectKernelSymmetry(xt::xtensor<double, 1>{4.0}), xvigra::KernelSymmetry::NONE);
+        CHECK_EQ(xvigra::detectKernelSymmetry(xt::xtensor<double, 3>(xt::ones<double>({1, 1, 3}))), xvigra::KernelSymmetry::NONE);
+
+        CHECK_EQ(xvigra::detectKernelSymmetry(xvigra::initGaussian<float>(2.0)), xvigra::KernelSymmetry::SYMMETRIC);
+        CHECK_EQ(xvigra::detectKernelSymmetry(xvigra::initGaussianDerivative<double>(1.5, 1)), xvigra::KernelSymmetry::ANTISYMMETRIC);
+    }
+
+    SUBCASE("Resolution") {
+        xt::xtensor<double, 1> kernel{1.0, 2.0, 3.0};
+        xt::xtensor<double, 1> gaussian = xvigra::initGaussian<double>(1.0);
+
+        xvigra::KernelOptions options;
+        options.setAlgorithm(xvigra::Algorithm::DIRECT);
+
+        CHECK_EQ(xvigra::resolveKernelSymmetry(kernel, options), xvigra::KernelSymmetry::NONE);
+        CHECK_EQ(xvigra::resolveKernelSymmetry(gaussian, options), xvigra::KernelSymmetry::SYMMETRIC);
+
+        options.setAlgorithm(xvigra::Algorithm::AUTO);
+        CHECK_EQ(xvigra::resolveKernelSymmetry(gaussian, options), xvigra::KernelSymmetry::SYMMETRIC);
+
+        // an explicit GEMM never folds, not even a declared symmetry
+        options.setAlgorithm(xvigra::Algorithm::GEMM);
+        CHECK_EQ(xvigra::resolveKernelSymmetry(gaussian, options), xvigra::KernelSymmetry::NONE);
+
+        options.setKernelSymmetry(xvigra::KernelSymmetry::SYMMETRIC);
+        CHECK_EQ(xvigra::resolveKernelSymmetry(gaussian, options), xvigra::KernelSymmetry::NONE);
+
+        options.setAlgorithm(xvigra::Algorithm::DIRECT);
+        CHECK_EQ(xvigra::resolveKernelSymmetry(gaussian, options), xvigra::KernelSymmetry::SYMMETRIC);
+
+        options.setKernelSymmetry(xvigra::KernelSymmetry::ANTISYMMETRIC);
+        CHECK_EQ(xvigra::resolveKernelSymmetry(xvigra::initGaussianDerivative<double>(1.0, 1), options), xvigra::KernelSymmetry::ANTISYMMETRIC);
+
+        options.setKernelSymmetry(xvigra::KernelSymmetry::NONE);
+        CHECK_EQ(xvigra::resolveKernelSymmetry(gaussian, options), xvigra::KernelSymmetry::NONE);
+
+        // a declared symmetry is checked against the taps
+        options.setKernelSymmetry(xvigra::KernelSymmetry::SYMMETRIC);
+        CHECK_THROWS_WITH_AS(
+            xvigra::resolveKernelSymmetry(kernel, options),
+            "resolveKernelSymmetry(): Kernel taps don't have the declared symmetry!",
+            std::invalid_argument
+        );
+
+        options.setKernelSymmetry(xvigra::KernelSymmetry::ANTISYMMETRIC);
+        CHECK_THROWS_WITH_AS(
+            xvigra::resolveKernelSymmetry(xt::xtensor<double, 1>{-1.0, 0.5, 1.0}, options),
+            "resolveKernelSymmetry(): Kernel taps don't have the declared symmetry!",
+            std::invalid_argument
+        );
+
+        // full kernels mix the channels and are never folded
+        xt::xtensor<double, 3> fullKernel = xt::ones<double>({2, 2, 3});
+        options.setKernelSymmetry(xvigra::KernelSymmetry::SYMMETRIC);
+        CHECK_EQ(xvigra::resolveKernelSymmetry(fullKernel, options), xvigra::KernelSymmetry::NONE);
+    }
+}
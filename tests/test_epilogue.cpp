@@ -0,0 +1,391 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#define DOCTEST_CONFIG_SUPER_FAST_ASSERTS
+#include "doctest/doctest.h"
+
+#ifdef VOID
+#undef VOID
+#endif
+
+#include "xtensor/xbuilder.hpp"
+#include "xtensor/xmath.hpp"
+#include "xtensor/xtensor.hpp"
+#include "xtensor/xview.hpp"
+
+#include "xvigra/convolution_util.hpp"
+#include "xvigra/epilogue.hpp"
+#include "xvigra/explicit_convolution.hpp"
+#include "xvigra/math.hpp"
+
+#include "test_util.hpp"
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ define - begin                                                                                                   ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+#define TYPE_PAIRS              \
+    std::pair<short, float>,    \
+    std::pair<short, double>,   \
+    std::pair<int, float>,      \
+    std::pair<int, double>
+
+TYPE_TO_STRING(std::pair<short, float>);
+TYPE_TO_STRING(std::pair<short, double>);
+TYPE_TO_STRING(std::pair<int, float>);
+TYPE_TO_STRING(std::pair<int, double>);
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ define - end                                                                                                     ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ utility - begin                                                                                                  ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+// applies bias, scale, clipping and rounding step by step as separate passes, which the fused epilogue replaces
+template <typename OutputType, typename T>
+xt::xtensor<OutputType, 3> postProcessSeparately(
+    const xt::xtensor<T, 3>& result,
+    const std::vector<double>& bias,
+    double scale,
+    double minimum,
+    double maximum,
+    std::size_t channelAxis
+) {
+    xt::xtensor<double, 3> processed = scale * xt::cast<double>(result);
+
+    for (std::size_t channel = 0; channel < bias.size(); ++channel) {
+        if (channelAxis == 0) {
+            xt::view(processed, channel, xt::all(), xt::all()) += bias[channel];
+        } else {
+            xt::view(processed, xt::all(), xt::all(), channel) += bias[channel];
+        }
+    }
+
+    processed = xt::nearbyint(xt::clip(processed, minimum, maximum));
+    return xt::cast<OutputType>(processed);
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ utility - end                                                                                                    ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test Epilogue - begin                                                                                            ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+TEST_CASE("Epilogue: Test apply") {
+    xvigra::Epilogue epilogue;
+    CHECK(epilogue.isIdentity());
+    CHECK_EQ(epilogue.apply<double>(1.25, 0), 1.25);
+
+    SUBCASE("Bias And Scale") {
+        epilogue.setBias({1.0, -2.0});
+        epilogue.setScale(2.0);
+        CHECK_FALSE(epilogue.isIdentity());
+
+        CHECK_EQ(epilogue.apply<double>(1.25, 0), 3.5);
+        CHECK_EQ(epilogue.apply<double>(1.25, 1), 0.5);
+    }
+
+    SUBCASE("Clip") {
+        epilogue.setClip(-1.0, 1.0);
+
+        CHECK_EQ(epilogue.apply<double>(-3.0, 0), -1.0);
+        CHECK_EQ(epilogue.apply<double>(0.5, 0), 0.5);
+        CHECK_EQ(epilogue.apply<double>(3.0, 0), 1.0);
+    }
+
+    SUBCASE("Rounding") {
+        epilogue.setRounding(xvigra::RoundingMode::NEAREST);
+        CHECK_EQ(epilogue.apply<double>(1.75, 0), 2.0);
+        CHECK_EQ(epilogue.apply<double>(-1.25, 0), -1.0);
+
+        epilogue.setRounding(xvigra::RoundingMode::DECIMALS, 2);
+        CHECK_EQ(epilogue.apply<double>(1.2345, 0), doctest::Approx(1.23));
+    }
+
+    SUBCASE("Integral Output") {
+        epilogue.setScale(255.0);
+
+        CHECK_EQ(epilogue.apply<std::uint8_t>(0.5, 0), 128);
+        CHECK_EQ(epilogue.apply<std::uint8_t>(2.0, 0), 255);
+        CHECK_EQ(epilogue.apply<std::uint8_t>(-1.0, 0), 0);
+        CHECK_EQ(epilogue.apply<std::int8_t>(-1.0, 0), -128);
+    }
+
+    SUBCASE("Invalid Clip") {
+        CHECK_THROWS_WITH_AS(
+            epilogue.setClip(1.0, -1.0),
+            "Epilogue::setClip(): Minimum is greater than maximum!",
+            std::invalid_argument
+        );
+    }
+
+    SUBCASE("Print") {
+        epilogue.setBias({1.0, 2.0});
+        epilogue.setRounding(xvigra::RoundingMode::NEAREST);
+
+        std::stringstream stream;
+        stream << epilogue;
+        CHECK_EQ(stream.str(), "{biasSize=2, scale=1, clip=none, rounding=RoundingMode::NEAREST, decimals=0}");
+    }
+}
+
+
+TEST_CASE_TEMPLATE("Epilogue: Test normalize", T, float, double, int) {
+    xt::xtensor<T, 3> result = xt::zeros<T>({4, 5, 3});
+    fillWithPattern(result, 17, std::is_floating_point_v<T> ? 0.125 : 40.0, std::is_floating_point_v<T> ? -0.5 : -100.0);
+
+    xt::xtensor<T, 3> actual(result.shape());
+    xvigra::applyEpilogue(result, xvigra::Epilogue::normalize<T>(), 2, actual);
+
+    xt::xtensor<T, 3> expected = xvigra::normalizeAfterConvolution<T>(result);
+
+    for (std::size_t index = 0; index < actual.size(); ++index) {
+        CHECK_EQ(actual.flat(index), doctest::Approx(expected.flat(index)));
+    }
+}
+
+
+TEST_CASE("Epilogue: Test applyEpilogue") {
+    xt::xtensor<double, 3> values = xt::zeros<double>({2, 3, 4});
+    fillWithPattern(values, 11, 0.5, -2.0);
+
+    xvigra::Epilogue epilogue;
+    epilogue.setBias({10.0, 20.0, 30.0, 40.0});
+
+    SUBCASE("Identity") {
+        xt::xtensor<double, 3> target(values.shape());
+        xvigra::applyEpilogue(values, xvigra::Epilogue(), 0, target);
+        CHECK_EQ(target, values);
+    }
+
+    SUBCASE("Channel Axis") {
+        xt::xtensor<double, 3> target(values.shape());
+        xvigra::applyEpilogue(values, epilogue, 2, target);
+
+        for (std::size_t y = 0; y < 2; ++y) {
+            for (std::size_t x = 0; x < 3; ++x) {
+                for (std::size_t c = 0; c < 4; ++c) {
+                    CHECK_EQ(target(y, x, c), values(y, x, c) + epilogue.bias[c]);
+                }
+            }
+        }
+    }
+
+    SUBCASE("Channel Offset Into View") {
+        xt::xtensor<double, 3> target = xt::zeros<double>({2, 5, 4});
+        auto targetView = xt::view(target, xt::all(), xt::range(1, 4), xt::all());
+        xvigra::applyEpilogue(values, epilogue, 1, targetView, 1);
+
+        for (std::size_t y = 0; y < 2; ++y) {
+            for (std::size_t x = 0; x < 3; ++x) {
+                for (std::size_t c = 0; c < 4; ++c) {
+                    CHECK_EQ(target(y, x + 1, c), values(y, x, c) + epilogue.bias[x + 1]);
+                }
+            }
+            CHECK_EQ(target(y, 0, 0), 0.0);
+            CHECK_EQ(target(y, 4, 0), 0.0);
+        }
+    }
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test Epilogue - end                                                                                              ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test Fused Convolution - begin                                                                                   ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+TEST_CASE_TEMPLATE("Epilogue: Test Convolve2D", T, TYPE_PAIRS) {
+    using InputType = typename T::first_type;
+    using KernelType = typename T::second_type;
+
+    xt::xtensor<KernelType, 4> kernel = xt::zeros<KernelType>({4, 2, 3, 3});
+    fillWithPattern(kernel, 7, 0.25, -0.5);
+
+    std::vector<double> bias{12.0, -3.5, 100.0, 0.25};
+    xvigra::Epilogue epilogue;
+    epilogue.setBias(bias);
+    epilogue.setScale(1.5);
+    epilogue.setClip(0.0, 255.0);
+    epilogue.setRounding(xvigra::RoundingMode::NEAREST);
+
+    xvigra::KernelOptions2D options;
+    options.setPadding(1);
+    options.setBorderTreatment(xvigra::BorderTreatment::asymmetricReflect());
+
+    xt::xtensor<InputType, 3> input;
+    std::size_t channelAxis = 0;
+
+    SUBCASE("Channel First") {
+        input = xt::zeros<InputType>({2, 9, 10});
+        options.setChannelPosition(xvigra::ChannelPosition::FIRST);
+        channelAxis = 0;
+    }
+
+    SUBCASE("Channel Last") {
+        input = xt::zeros<InputType>({9, 10, 2});
+        options.setChannelPosition(xvigra::ChannelPosition::LAST);
+        channelAxis = 2;
+    }
+
+    fillWithPattern(input, 23, 4.0, -20.0);
+
+    for (xvigra::Algorithm algorithm : {xvigra::Algorithm::GEMM, xvigra::Algorithm::DIRECT, xvigra::Algorithm::FFT, xvigra::Algorithm::WINOGRAD_2X2}) {
+        CAPTURE(algorithm);
+        options.setAlgorithm(algorithm);
+
+        auto result = xvigra::convolve2D(input, kernel, options.optionsY, options.optionsX);
+        auto expected = postProcessSeparately<std::uint8_t>(result, bias, 1.5, 0.0, 255.0, channelAxis);
+
+        xt::xtensor<std::uint8_t, 3> actual;
+        xvigra::convolve2D(input, kernel, options.optionsY, options.optionsX, epilogue, actual);
+        CHECK_EQ(actual, expected);
+
+        CHECK_EQ(xvigra::convolve2D<std::uint8_t>(input, kernel, options.optionsY, options.optionsX, epilogue), expected);
+    }
+
+    SUBCASE("Tiles") {
+        options.setAlgorithm(xvigra::Algorithm::GEMM);
+        options.optionsY.setWorkspaceLimit(1);
+
+        auto result = xvigra::convolve2D(input, kernel, options.optionsY, options.optionsX);
+        auto expected = postProcessSeparately<std::uint8_t>(result, bias, 1.5, 0.0, 255.0, channelAxis);
+
+        CHECK_EQ(xvigra::convolve2D<std::uint8_t>(input, kernel, options.optionsY, options.optionsX, epilogue), expected);
+    }
+
+    SUBCASE("Groups") {
+        options.setAlgorithm(xvigra::Algorithm::GEMM);
+        options.optionsY.setGroups(2);
+        options.optionsX.setGroups(2);
+        xt::xtensor<KernelType, 4> groupedKernel = xt::view(kernel, xt::all(), xt::range(0, 1), xt::all(), xt::all());
+
+        auto result = xvigra::convolve2D(input, groupedKernel, options.optionsY, options.optionsX);
+        auto expected = postProcessSeparately<std::uint8_t>(result, bias, 1.5, 0.0, 255.0, channelAxis);
+
+        CHECK_EQ(xvigra::convolve2D<std::uint8_t>(input, groupedKernel, options.optionsY, options.optionsX, epilogue), expected);
+    }
+
+    SUBCASE("Wrong Bias Size") {
+        epilogue.setBias({1.0, 2.0});
+
+        CHECK_THROWS_WITH_AS(
+            xvigra::convolve2D<std::uint8_t>(input, kernel, options.optionsY, options.optionsX, epilogue),
+            "convolve2D(): Bias size does not match the output channels!",
+            std::invalid_argument
+        );
+    }
+}
+
+
+TEST_CASE("Epilogue: Test Default Epilogue With Integral Output") {
+    // integral results from -372 to 372, which the default epilogue has to saturate for std::uint8_t
+    xt::xtensor<float, 4> kernel = xt::zeros<float>({3, 2, 3, 3});
+    fillWithPattern(kernel, 7, 1.0, -3.0);
+
+    xt::xtensor<float, 3> input = xt::zeros<float>({9, 10, 2});
+    fillWithPattern(input, 23, 4.0, -44.0);
+
+    xvigra::KernelOptions2D options;
+    options.setPadding(1);
+    options.setChannelPosition(xvigra::ChannelPosition::LAST);
+
+    for (xvigra::Algorithm algorithm : {xvigra::Algorithm::GEMM, xvigra::Algorithm::DIRECT, xvigra::Algorithm::FFT, xvigra::Algorithm::WINOGRAD_2X2}) {
+        CAPTURE(algorithm);
+        options.setAlgorithm(algorithm);
+
+        xt::xtensor<float, 3> result = xvigra::convolve2D(input, kernel, options.optionsY, options.optionsX);
+        REQUIRE_LT(xt::amin(result)(), -1.0f);
+        REQUIRE_GT(xt::amax(result)(), 256.0f);
+
+        xt::xtensor<std::uint8_t, 3> actual = xvigra::convolve2D<std::uint8_t>(input, kernel, options.optionsY, options.optionsX, xvigra::Epilogue());
+        REQUIRE_EQ(actual.shape(), result.shape());
+
+        for (std::size_t index = 0; index < actual.size(); ++index) {
+            double expected = std::clamp(std::nearbyint(static_cast<double>(result.flat(index))), 0.0, 255.0);
+            CHECK_EQ(static_cast<double>(actual.flat(index)), doctest::Approx(expected));
+        }
+    }
+}
+
+
+TEST_CASE_TEMPLATE("Epilogue: Test Convolve1D And ConvolveND", T, TYPE_PAIRS) {
+    using InputType = typename T::first_type;
+    using KernelType = typename T::second_type;
+
+    xt::xtensor<KernelType, 3> kernel1D = xt::zeros<KernelType>({3, 2, 5});
+    fillWithPattern(kernel1D, 7, 0.25, -0.5);
+    xt::xtensor<KernelType, 5> kernel3D = xt::zeros<KernelType>({3, 2, 3, 3, 3});
+    fillWithPattern(kernel3D, 7, 0.125, -0.25);
+
+    std::vector<double> bias{-1.0, 0.5, 2.0};
+    xvigra::Epilogue epilogue;
+    epilogue.setBias(bias);
+    epilogue.setClip(-4.0, 4.0);
+    epilogue.setRounding(xvigra::RoundingMode::DECIMALS, 1);
+
+    xvigra::KernelOptions options;
+    options.setPadding(2);
+    options.setChannelPosition(xvigra::ChannelPosition::FIRST);
+
+    auto postProcess = [&](const auto& result, auto& actual) {
+        for (std::size_t index = 0; index < actual.size(); ++index) {
+            std::size_t channel = index / (actual.size() / bias.size());
+            double expected = xvigra::roundValue(std::clamp(static_cast<double>(result.flat(index)) + bias[channel], -4.0, 4.0), 1);
+            CHECK_EQ(static_cast<double>(actual.flat(index)), doctest::Approx(expected));
+        }
+    };
+
+    SUBCASE("Convolve1D") {
+        xt::xtensor<InputType, 2> input = xt::zeros<InputType>({2, 13});
+        fillWithPattern(input, 11, 1.0, -5.0);
+
+        for (xvigra::Algorithm algorithm : {xvigra::Algorithm::GEMM, xvigra::Algorithm::DIRECT}) {
+            options.setAlgorithm(algorithm);
+            auto result = xvigra::convolve1D(input, kernel1D, options);
+            auto actual = xvigra::convolve1D<double>(input, kernel1D, options, epilogue);
+
+            REQUIRE_EQ(actual.shape(), result.shape());
+            postProcess(result, actual);
+        }
+    }
+
+    SUBCASE("ConvolveND") {
+        xt::xtensor<InputType, 4> input = xt::zeros<InputType>({2, 5, 6, 7});
+        fillWithPattern(input, 11, 1.0, -5.0);
+        std::array<xvigra::KernelOptions, 3> kernelOptions{options, options, options};
+
+        auto result = xvigra::convolveND<3>(input, kernel3D, kernelOptions);
+        auto actual = xvigra::convolveND<3, float>(input, kernel3D, kernelOptions, epilogue);
+
+        REQUIRE_EQ(actual.shape(), result.shape());
+        postProcess(result, actual);
+
+        epilogue.setBias({1.0});
+        CHECK_THROWS_WITH_AS(
+            xvigra::convolveND<3, float>(input, kernel3D, kernelOptions, epilogue),
+            "convolveND(): Bias size does not match the output channels!",
+            std::invalid_argument
+        );
+    }
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test Fused Convolution - end                                                                                     ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
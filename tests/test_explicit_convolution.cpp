@@ -1,3 +1,6 @@
+#include <array>
+#include <cstdint>
+#include <cstdlib>
 #include <limits>
 #include <stdexcept>
 #include <type_traits>
@@ -11,11 +14,17 @@
 #undef VOID
 #endif
 
+#include "xtensor/xadapt.hpp"
 #include "xtensor/xtensor.hpp"
+#include "xtensor/xview.hpp"
 
 #include "xvigra/image_io.hpp"
 #include "xvigra/explicit_convolution.hpp"
 #include "xvigra/convolution_util.hpp"
+#include "xvigra/quantized_convolution.hpp"
+#include "xvigra/separable_convolution.hpp"
+
+#include "test_util.hpp"
 
 // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
 // ║ define - begin                                                                                                   ║
@@ -38,6 +47,13 @@ TYPE_TO_STRING(std::pair<int, double>);
 TYPE_TO_STRING(std::pair<double, float>);
 TYPE_TO_STRING(std::pair<double, double>);
 
+#define QUANTIZED_TYPE_PAIRS                    \
+    std::pair<std::uint8_t, std::int8_t>,       \
+    std::pair<std::int8_t, std::int8_t>
+
+TYPE_TO_STRING(std::pair<std::uint8_t, std::int8_t>);
+TYPE_TO_STRING(std::pair<std::int8_t, std::int8_t>);
+
 #define EXPECTED_UNPADDED_RESULT                     \
     8.7f, 12.7f, 16.7f, 20.7f, 24.7f, 28.7f, 32.7f
 
@@ -67,6 +83,7 @@ TYPE_TO_STRING(std::pair<double, double>);
 // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
 
 constexpr double FLOAT_EPSILON = std::numeric_limits<float>::epsilon();
+constexpr double ALGORITHM_EPSILON = 1e-4;
 
 constexpr auto TEST_IMAGE_PGM = "./resources/tests/Piercing-The-Ocean.pgm";
 constexpr auto TEST_IMAGE_PPM = "./resources/tests/Piercing-The-Ocean.ppm";
@@ -202,6 +219,75 @@ void checkConvolution2DWithImage(
     CHECK_EQ(actualImage, expectedImage);
 }
 
+
+template <typename I, typename K>
+void checkAlgorithm1D(
+    const xt::xexpression<I>& inputExpression,
+    const xt::xexpression<K>& kernelExpression,
+    xvigra::KernelOptions options,
+    xvigra::Algorithm algorithm,
+    double epsilon = ALGORITHM_EPSILON
+) {
+    auto input = inputExpression.derived_cast();
+    auto kernel = kernelExpression.derived_cast();
+
+    options.setAlgorithm(xvigra::Algorithm::GEMM);
+    auto expected = xvigra::convolve1D(input, kernel, options);
+
+    options.setAlgorithm(algorithm);
+    auto actual = xvigra::convolve1D(input, kernel, options);
+
+    checkExpressions(actual, expected, epsilon);
+}
+
+
+template <typename I, typename K>
+void checkAlgorithm2D(
+    const xt::xexpression<I>& inputExpression,
+    const xt::xexpression<K>& kernelExpression,
+    xvigra::KernelOptions2D options,
+    xvigra::Algorithm algorithm,
+    double epsilon = ALGORITHM_EPSILON
+) {
+    auto input = inputExpression.derived_cast();
+    auto kernel = kernelExpression.derived_cast();
+
+    options.setAlgorithm(xvigra::Algorithm::GEMM);
+    auto expected = xvigra::convolve2D(input, kernel, options);
+
+    options.setAlgorithm(algorithm);
+    auto actual = xvigra::convolve2D(input, kernel, options);
+
+    checkExpressions(actual, expected, epsilon);
+}
+
+
+template <typename K, std::size_t N>
+xt::xtensor<K, N> expandGroupedKernel(const xt::xtensor<K, N>& groupedKernel, std::size_t groups) {
+    typename xt::xtensor<K, N>::shape_type shape = groupedKernel.shape();
+    std::size_t outputChannels = shape[0];
+    std::size_t groupInputChannels = shape[1];
+    std::size_t groupOutputChannels = outputChannels / groups;
+    std::size_t taps = groupedKernel.size() / (outputChannels * groupInputChannels);
+
+    shape[1] = groupInputChannels * groups;
+    xt::xtensor<K, N> result = xt::zeros<K>(shape);
+
+    for (std::size_t outIndex = 0; outIndex < outputChannels; ++outIndex) {
+        std::size_t group = outIndex / groupOutputChannels;
+
+        for (std::size_t inIndex = 0; inIndex < groupInputChannels; ++inIndex) {
+            std::size_t denseInIndex = group * groupInputChannels + inIndex;
+
+            for (std::size_t tap = 0; tap < taps; ++tap) {
+                result.flat((outIndex * shape[1] + denseInIndex) * taps + tap) = groupedKernel.flat((outIndex * groupInputChannels + inIndex) * taps + tap);
+            }
+        }
+    }
+
+    return result;
+}
+
 // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
 // ║ utility - end                                                                                                    ║
 // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
@@ -509,6 +595,36 @@ TEST_CASE_TEMPLATE("Convolve1D: Test Invalid Configurations", T, TYPE_PAIRS) {
             std::invalid_argument
         );
     }
+
+    SUBCASE("Winograd Algorithm") {
+        xt::xtensor<InputType, 2> input{{1, 2, 3, 4, 5}};
+        xt::xtensor<KernelType, 3> kernel{{{1.0f, 1.3f, 1.7f}}};
+
+        xvigra::KernelOptions options;
+        options.channelPosition = xvigra::ChannelPosition::FIRST;
+        options.setAlgorithm(xvigra::Algorithm::WINOGRAD_2X2);
+
+        CHECK_THROWS_WITH_AS(
+            xvigra::convolve1D(input, kernel, options),
+            "convolve1D(): Winograd algorithms are only available for convolve2D!",
+            std::invalid_argument
+        );
+    }
+
+    SUBCASE("FFT Algorithm") {
+        xt::xtensor<InputType, 2> input{{1, 2, 3, 4, 5}};
+        xt::xtensor<KernelType, 3> kernel{{{1.0f, 1.3f, 1.7f}}};
+
+        xvigra::KernelOptions options;
+        options.channelPosition = xvigra::ChannelPosition::FIRST;
+        options.setAlgorithm(xvigra::Algorithm::FFT);
+
+        CHECK_THROWS_WITH_AS(
+            xvigra::convolve1D(input, kernel, options),
+            "convolve1D(): FFT algorithm is only available for convolve2D!",
+            std::invalid_argument
+        );
+    }
 }
 
 // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
@@ -2111,6 +2227,45 @@ TEST_CASE_TEMPLATE("Convolve2D: Test Invalid Configurations", T, TYPE_PAIRS) {
         );
     }
 
+    SUBCASE("Different Algorithms For Y And X") {
+        xt::xarray<InputType> input(std::vector<std::size_t>{7, 5, 3});
+        xt::xarray<KernelType> kernel(std::vector<std::size_t>{3, 3, 3, 3});
+
+        xvigra::KernelOptions2D options;
+        options.setChannelPosition(xvigra::ChannelPosition::LAST);
+        options.optionsY.setAlgorithm(xvigra::Algorithm::DIRECT);
+
+        CHECK_THROWS_WITH_AS(
+            xvigra::convolve2D(input, kernel, options),
+            "convolve2D(): Algorithm can't be different for optionsY and optionsX!",
+            std::invalid_argument
+        );
+    }
+
+    SUBCASE("Winograd With Unsupported Configuration") {
+        xt::xarray<InputType> input(std::vector<std::size_t>{7, 5, 3});
+        xt::xarray<KernelType> kernel(std::vector<std::size_t>{3, 3, 3, 3});
+        xt::xarray<KernelType> wideKernel(std::vector<std::size_t>{3, 3, 3, 5});
+
+        xvigra::KernelOptions2D options;
+        options.setChannelPosition(xvigra::ChannelPosition::LAST);
+        options.setAlgorithm(xvigra::Algorithm::WINOGRAD_4X4);
+
+        CHECK_THROWS_WITH_AS(
+            xvigra::convolve2D(input, wideKernel, options),
+            "convolve2D(): Winograd algorithms require a 3x3 kernel!",
+            std::invalid_argument
+        );
+
+        options.setDilation(1, 2);
+
+        CHECK_THROWS_WITH_AS(
+            xvigra::convolve2D(input, kernel, options),
+            "convolve2D(): Winograd algorithms require stride 1 and dilation 1!",
+            std::invalid_argument
+        );
+    }
+
     SUBCASE("Input Channel Mismatch In Input And Kernel") {
         xt::xarray<InputType> input(std::vector<std::size_t>{7, 5, 3});
         xt::xarray<KernelType> kernel(std::vector<std::size_t>{1, 1, 3, 3});
@@ -2153,3 +2308,2323 @@ TEST_CASE_TEMPLATE("Convolve2D: Test Invalid Configurations", T, TYPE_PAIRS) {
 // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
 // ║ Test convolve2D - end                                                                                            ║
 // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test algorithms - begin                                                                                          ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+TEST_CASE_TEMPLATE("Convolve1D: Test Direct Algorithm", T, TYPE_PAIRS) {
+    using InputType = typename T::first_type;
+    using KernelType = typename T::second_type;
+
+    std::vector<xvigra::BorderTreatment> treatments{
+        xvigra::BorderTreatment::asymmetricReflect(),
+        xvigra::BorderTreatment::avoid(),
+        xvigra::BorderTreatment::constant(2),
+        xvigra::BorderTreatment::repeat(),
+        xvigra::BorderTreatment::symmetricReflect(),
+        xvigra::BorderTreatment::wrap()
+    };
+
+    xt::xtensor<KernelType, 3> kernel = xt::zeros<KernelType>({2, 3, 4});
+    fillWithPattern(kernel, 5, 0.25, -0.5);
+
+    xvigra::KernelOptions options;
+    options.setPadding(3);
+    options.stride = 2;
+    options.dilation = 2;
+
+    SUBCASE("Channel First") {
+        xt::xtensor<InputType, 2> input = xt::zeros<InputType>({3, 11});
+        fillWithPattern(input, 11);
+        options.channelPosition = xvigra::ChannelPosition::FIRST;
+
+        for (const auto& treatment : treatments) {
+            options.setBorderTreatment(treatment);
+            checkAlgorithm1D(input, kernel, options, xvigra::Algorithm::DIRECT);
+        }
+    }
+
+    SUBCASE("Channel Last") {
+        xt::xtensor<InputType, 2> input = xt::zeros<InputType>({11, 3});
+        fillWithPattern(input, 11);
+        options.channelPosition = xvigra::ChannelPosition::LAST;
+
+        for (const auto& treatment : treatments) {
+            options.setBorderTreatment(treatment);
+            checkAlgorithm1D(input, kernel, options, xvigra::Algorithm::DIRECT);
+        }
+    }
+}
+
+
+TEST_CASE_TEMPLATE("Convolve2D: Test Direct Algorithm", T, TYPE_PAIRS) {
+    using InputType = typename T::first_type;
+    using KernelType = typename T::second_type;
+
+    std::vector<xvigra::BorderTreatment> treatments{
+        xvigra::BorderTreatment::asymmetricReflect(),
+        xvigra::BorderTreatment::avoid(),
+        xvigra::BorderTreatment::constant(2),
+        xvigra::BorderTreatment::repeat(),
+        xvigra::BorderTreatment::symmetricReflect(),
+        xvigra::BorderTreatment::wrap()
+    };
+
+    xt::xtensor<KernelType, 4> kernel = xt::zeros<KernelType>({2, 3, 3, 4});
+    fillWithPattern(kernel, 5, 0.25, -0.5);
+
+    xvigra::KernelOptions2D options;
+
+    SUBCASE("Channel First") {
+        xt::xtensor<InputType, 3> input = xt::zeros<InputType>({3, 9, 11});
+        fillWithPattern(input, 11);
+        options.setChannelPosition(xvigra::ChannelPosition::FIRST);
+
+        SUBCASE("Padding=1x1, Stride=1x1, Dilation=1x1") {
+            options.setPadding(1, 1);
+
+            for (const auto& treatment : treatments) {
+                options.setBorderTreatment(treatment);
+                checkAlgorithm2D(input, kernel, options, xvigra::Algorithm::DIRECT);
+            }
+        }
+
+        SUBCASE("Padding=3x2, Stride=2x1, Dilation=1x2") {
+            options.setPadding(3, 2);
+            options.setStride(2, 1);
+            options.setDilation(1, 2);
+
+            for (const auto& treatment : treatments) {
+                options.setBorderTreatment(treatment);
+                checkAlgorithm2D(input, kernel, options, xvigra::Algorithm::DIRECT);
+            }
+        }
+    }
+
+    SUBCASE("Channel Last") {
+        xt::xtensor<InputType, 3> input = xt::zeros<InputType>({9, 11, 3});
+        fillWithPattern(input, 11);
+        options.setChannelPosition(xvigra::ChannelPosition::LAST);
+
+        SUBCASE("Padding=1x1, Stride=1x1, Dilation=1x1") {
+            options.setPadding(1, 1);
+
+            for (const auto& treatment : treatments) {
+                options.setBorderTreatment(treatment);
+                checkAlgorithm2D(input, kernel, options, xvigra::Algorithm::DIRECT);
+            }
+        }
+
+        SUBCASE("Padding=3x2, Stride=2x1, Dilation=1x2") {
+            options.setPadding(3, 2);
+            options.setStride(2, 1);
+            options.setDilation(1, 2);
+
+            for (const auto& treatment : treatments) {
+                options.setBorderTreatment(treatment);
+                checkAlgorithm2D(input, kernel, options, xvigra::Algorithm::DIRECT);
+            }
+        }
+    }
+}
+
+
+TEST_CASE_TEMPLATE("Convolve2D: Test Winograd Algorithm", T, TYPE_PAIRS) {
+    using InputType = typename T::first_type;
+    using KernelType = typename T::second_type;
+
+    std::vector<xvigra::BorderTreatment> treatments{
+        xvigra::BorderTreatment::asymmetricReflect(),
+        xvigra::BorderTreatment::avoid(),
+        xvigra::BorderTreatment::constant(2),
+        xvigra::BorderTreatment::repeat(),
+        xvigra::BorderTreatment::symmetricReflect(),
+        xvigra::BorderTreatment::wrap()
+    };
+
+    std::vector<xvigra::Algorithm> algorithms{
+        xvigra::Algorithm::WINOGRAD_2X2,
+        xvigra::Algorithm::WINOGRAD_4X4
+    };
+
+    xt::xtensor<KernelType, 4> kernel = xt::zeros<KernelType>({2, 3, 3, 3});
+    fillWithPattern(kernel, 5, 0.25, -0.5);
+
+    xvigra::KernelOptions2D options;
+
+    SUBCASE("Channel First") {
+        xt::xtensor<InputType, 3> input = xt::zeros<InputType>({3, 9, 11});
+        fillWithPattern(input, 11);
+        options.setChannelPosition(xvigra::ChannelPosition::FIRST);
+
+        for (int padding : {0, 1, 3}) {
+            options.setPadding(padding, 2);
+
+            for (const auto& treatment : treatments) {
+                options.setBorderTreatment(treatment);
+
+                for (const auto& algorithm : algorithms) {
+                    checkAlgorithm2D(input, kernel, options, algorithm);
+                }
+            }
+        }
+    }
+
+    SUBCASE("Channel Last") {
+        xt::xtensor<InputType, 3> input = xt::zeros<InputType>({9, 11, 3});
+        fillWithPattern(input, 11);
+        options.setChannelPosition(xvigra::ChannelPosition::LAST);
+
+        for (int padding : {0, 1, 3}) {
+            options.setPadding(padding, 2);
+
+            for (const auto& treatment : treatments) {
+                options.setBorderTreatment(treatment);
+
+                for (const auto& algorithm : algorithms) {
+                    checkAlgorithm2D(input, kernel, options, algorithm);
+                }
+            }
+        }
+    }
+}
+
+
+TEST_CASE_TEMPLATE("Convolve2D: Test FFT Algorithm", T, TYPE_PAIRS) {
+    using InputType = typename T::first_type;
+    using KernelType = typename T::second_type;
+
+    std::vector<xvigra::BorderTreatment> treatments{
+        xvigra::BorderTreatment::asymmetricReflect(),
+        xvigra::BorderTreatment::avoid(),
+        xvigra::BorderTreatment::constant(2),
+        xvigra::BorderTreatment::repeat(),
+        xvigra::BorderTreatment::symmetricReflect(),
+        xvigra::BorderTreatment::wrap()
+    };
+
+    xt::xtensor<KernelType, 4> kernel = xt::zeros<KernelType>({2, 3, 9, 6});
+    fillWithPattern(kernel, 5, 0.25, -0.5);
+
+    xvigra::KernelOptions2D options;
+
+    SUBCASE("Channel First") {
+        xt::xtensor<InputType, 3> input = xt::zeros<InputType>({3, 21, 19});
+        fillWithPattern(input, 11);
+        options.setChannelPosition(xvigra::ChannelPosition::FIRST);
+
+        SUBCASE("Padding=4x3, Stride=1x1, Dilation=1x1") {
+            options.setPadding(4, 3);
+
+            for (const auto& treatment : treatments) {
+                options.setBorderTreatment(treatment);
+                checkAlgorithm2D(input, kernel, options, xvigra::Algorithm::FFT);
+            }
+        }
+
+        SUBCASE("Padding=5x2, Stride=2x3, Dilation=1x2") {
+            options.setPadding(5, 2);
+            options.setStride(2, 3);
+            options.setDilation(1, 2);
+
+            for (const auto& treatment : treatments) {
+                options.setBorderTreatment(treatment);
+                checkAlgorithm2D(input, kernel, options, xvigra::Algorithm::FFT);
+            }
+        }
+    }
+
+    SUBCASE("Channel Last") {
+        xt::xtensor<InputType, 3> input = xt::zeros<InputType>({21, 19, 3});
+        fillWithPattern(input, 11);
+        options.setChannelPosition(xvigra::ChannelPosition::LAST);
+
+        SUBCASE("Padding=4x3, Stride=1x1, Dilation=1x1") {
+            options.setPadding(4, 3);
+
+            for (const auto& treatment : treatments) {
+                options.setBorderTreatment(treatment);
+                checkAlgorithm2D(input, kernel, options, xvigra::Algorithm::FFT);
+            }
+        }
+
+        SUBCASE("Padding=5x2, Stride=2x3, Dilation=1x2") {
+            options.setPadding(5, 2);
+            options.setStride(2, 3);
+            options.setDilation(1, 2);
+
+            for (const auto& treatment : treatments) {
+                options.setBorderTreatment(treatment);
+                checkAlgorithm2D(input, kernel, options, xvigra::Algorithm::FFT);
+            }
+        }
+    }
+
+    SUBCASE("Bands And Threads") {
+        xt::xtensor<InputType, 3> input = xt::zeros<InputType>({3, 21, 19});
+        fillWithPattern(input, 11);
+        options.setChannelPosition(xvigra::ChannelPosition::FIRST);
+        options.setPadding(4, 3);
+        options.setBorderTreatment(xvigra::BorderTreatment::repeat());
+
+        // bands of 8 rows with the kernel transformed per band, bands of 8 rows with cached kernel spectra and a
+        // single band
+        for (std::size_t limit : {std::size_t(1), std::size_t(40000), std::size_t(0)}) {
+            options.setWorkspaceLimit(limit);
+
+            for (int threadCount : {1, 3}) {
+                options.setThreadCount(threadCount);
+                checkAlgorithm2D(input, kernel, options, xvigra::Algorithm::FFT);
+            }
+        }
+    }
+}
+
+
+TEST_CASE_TEMPLATE("Convolve1D: Test Auto Algorithm", T, TYPE_PAIRS) {
+    using InputType = typename T::first_type;
+    using KernelType = typename T::second_type;
+
+    xvigra::KernelOptions options;
+    options.setPadding(1);
+    options.setBorderTreatment(xvigra::BorderTreatment::repeat());
+
+    SUBCASE("Channel First") {
+        xt::xtensor<InputType, 2> input = xt::zeros<InputType>({3, 11});
+        xt::xtensor<KernelType, 3> kernel = xt::zeros<KernelType>({2, 3, 3});
+        fillWithPattern(input, 11);
+        fillWithPattern(kernel, 5, 0.25, -0.5);
+        options.channelPosition = xvigra::ChannelPosition::FIRST;
+
+        checkAlgorithm1D(input, kernel, options, xvigra::Algorithm::AUTO);
+    }
+
+    SUBCASE("Channel Last") {
+        xt::xtensor<InputType, 2> input = xt::zeros<InputType>({11, 3});
+        xt::xtensor<KernelType, 3> kernel = xt::zeros<KernelType>({2, 3, 3});
+        fillWithPattern(input, 11);
+        fillWithPattern(kernel, 5, 0.25, -0.5);
+        options.channelPosition = xvigra::ChannelPosition::LAST;
+
+        checkAlgorithm1D(input, kernel, options, xvigra::Algorithm::AUTO);
+    }
+}
+
+
+TEST_CASE_TEMPLATE("Convolve2D: Test Auto Algorithm", T, TYPE_PAIRS) {
+    using InputType = typename T::first_type;
+    using KernelType = typename T::second_type;
+
+    xvigra::KernelOptions2D options;
+    options.setChannelPosition(xvigra::ChannelPosition::FIRST);
+    options.setBorderTreatment(xvigra::BorderTreatment::symmetricReflect());
+
+    SUBCASE("Few Channels, Small Kernel") {
+        xt::xtensor<InputType, 3> input = xt::zeros<InputType>({3, 9, 11});
+        xt::xtensor<KernelType, 4> kernel = xt::zeros<KernelType>({3, 3, 3, 3});
+        fillWithPattern(input, 11);
+        fillWithPattern(kernel, 5, 0.25, -0.5);
+        options.setPadding(1);
+
+        checkAlgorithm2D(input, kernel, options, xvigra::Algorithm::AUTO);
+
+        options.setAlgorithm(xvigra::Algorithm::AUTO);
+        CHECK_EQ(xvigra::resolveAlgorithm2D(input, kernel, options), xvigra::Algorithm::DIRECT);
+    }
+
+    SUBCASE("Large Kernel") {
+        xt::xtensor<InputType, 3> input = xt::zeros<InputType>({1, 48, 48});
+        xt::xtensor<KernelType, 4> kernel = xt::zeros<KernelType>({1, 1, 15, 15});
+        fillWithPattern(input, 11);
+        fillWithPattern(kernel, 5, 0.25, -0.5);
+        options.setPadding(7);
+
+        checkAlgorithm2D(input, kernel, options, xvigra::Algorithm::AUTO);
+
+        options.setAlgorithm(xvigra::Algorithm::AUTO);
+        CHECK_EQ(xvigra::resolveAlgorithm2D(input, kernel, options), xvigra::Algorithm::FFT);
+    }
+
+    SUBCASE("Explicit Algorithm") {
+        xt::xtensor<InputType, 3> input = xt::zeros<InputType>({3, 9, 11});
+        xt::xtensor<KernelType, 4> kernel = xt::zeros<KernelType>({3, 3, 3, 3});
+        options.setAlgorithm(xvigra::Algorithm::GEMM);
+
+        CHECK_EQ(xvigra::resolveAlgorithm2D(input, kernel, options), xvigra::Algorithm::GEMM);
+    }
+
+    SUBCASE("Sparse Kernel") {
+        xt::xtensor<InputType, 3> input = xt::zeros<InputType>({3, 9, 11});
+        xt::xtensor<KernelType, 4> kernel = xt::zeros<KernelType>({3, 3, 5, 5});
+        xt::view(kernel, xt::all(), xt::all(), 2, 0) = static_cast<KernelType>(0.5);
+        xt::view(kernel, xt::all(), xt::all(), 0, 2) = static_cast<KernelType>(-1.5);
+        options.setAlgorithm(xvigra::Algorithm::AUTO);
+        bool isSparse = false;
+
+        xvigra::resolveAlgorithm2D(input, kernel, options, &isSparse);
+        CHECK(isSparse);
+
+        // the density test is done for every group on its own, so one dense group leaves the other groups sparse
+        options.setGroups(3);
+        xt::view(kernel, 1, xt::all(), xt::all(), xt::all()) = static_cast<KernelType>(1);
+        xt::xtensor<KernelType, 4> groupedKernel = xt::view(kernel, xt::all(), xt::range(0, 1), xt::all(), xt::all());
+        xvigra::resolveAlgorithm2D(input, groupedKernel, options, &isSparse);
+        CHECK(isSparse);
+
+        xt::xtensor<KernelType, 4> denseKernel = xt::ones<KernelType>({3, 1, 5, 5});
+        xvigra::resolveAlgorithm2D(input, denseKernel, options, &isSparse);
+        CHECK_FALSE(isSparse);
+
+        // an explicit algorithm never takes the sparse backend
+        options.setAlgorithm(xvigra::Algorithm::GEMM);
+        xvigra::resolveAlgorithm2D(input, kernel, options, &isSparse);
+        CHECK_FALSE(isSparse);
+    }
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test algorithms - end                                                                                            ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test workspace limit - begin                                                                                     ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+TEST_CASE_TEMPLATE("Convolve1D: Test Workspace Limit", T, TYPE_PAIRS) {
+    using InputType = typename T::first_type;
+    using KernelType = typename T::second_type;
+
+    xt::xtensor<KernelType, 3> kernel = xt::zeros<KernelType>({2, 3, 5});
+    fillWithPattern(kernel, 5, 0.25, -0.5);
+
+    xvigra::KernelOptions options;
+    options.setPadding(2);
+    options.setBorderTreatment(xvigra::BorderTreatment::asymmetricReflect());
+
+    SUBCASE("Channel First") {
+        xt::xtensor<InputType, 2> input = xt::zeros<InputType>({3, 23});
+        fillWithPattern(input, 11);
+        options.channelPosition = xvigra::ChannelPosition::FIRST;
+
+        options.setWorkspaceLimit(0);
+        auto expected = xvigra::convolve1D(input, kernel, options);
+
+        // the direct algorithm accumulates its result in tiles within the same limit
+        for (xvigra::Algorithm algorithm : {xvigra::Algorithm::GEMM, xvigra::Algorithm::DIRECT}) {
+            options.setAlgorithm(algorithm);
+
+            for (std::size_t limit : {std::size_t(1), std::size_t(200), std::size_t(1000)}) {
+                options.setWorkspaceLimit(limit);
+                checkConvolution1D(input, kernel, options, expected);
+            }
+        }
+    }
+
+    SUBCASE("Channel Last") {
+        xt::xtensor<InputType, 2> input = xt::zeros<InputType>({23, 3});
+        fillWithPattern(input, 11);
+        options.channelPosition = xvigra::ChannelPosition::LAST;
+
+        options.setWorkspaceLimit(0);
+        auto expected = xvigra::convolve1D(input, kernel, options);
+
+        // the direct algorithm accumulates its result in tiles within the same limit
+        for (xvigra::Algorithm algorithm : {xvigra::Algorithm::GEMM, xvigra::Algorithm::DIRECT}) {
+            options.setAlgorithm(algorithm);
+
+            for (std::size_t limit : {std::size_t(1), std::size_t(200), std::size_t(1000)}) {
+                options.setWorkspaceLimit(limit);
+                checkConvolution1D(input, kernel, options, expected);
+            }
+        }
+    }
+}
+
+
+TEST_CASE_TEMPLATE("Convolve2D: Test Workspace Limit", T, TYPE_PAIRS) {
+    using InputType = typename T::first_type;
+    using KernelType = typename T::second_type;
+
+    xt::xtensor<KernelType, 4> kernel = xt::zeros<KernelType>({2, 3, 3, 4});
+    fillWithPattern(kernel, 5, 0.25, -0.5);
+
+    xvigra::KernelOptions2D options;
+    options.setPadding(2, 1);
+    options.setStride(2, 1);
+    options.setBorderTreatment(xvigra::BorderTreatment::wrap());
+
+    SUBCASE("Channel First") {
+        xt::xtensor<InputType, 3> input = xt::zeros<InputType>({3, 13, 11});
+        fillWithPattern(input, 11);
+        options.setChannelPosition(xvigra::ChannelPosition::FIRST);
+
+        options.setWorkspaceLimit(0);
+        auto expected = xvigra::convolve2D(input, kernel, options);
+
+        // the direct algorithm accumulates its result in tiles within the same limit
+        for (xvigra::Algorithm algorithm : {xvigra::Algorithm::GEMM, xvigra::Algorithm::DIRECT}) {
+            options.setAlgorithm(algorithm);
+
+            for (std::size_t limit : {std::size_t(1), std::size_t(5000), std::size_t(20000)}) {
+                options.setWorkspaceLimit(limit);
+                checkConvolution2D(input, kernel, options, expected);
+            }
+        }
+    }
+
+    SUBCASE("Channel Last") {
+        xt::xtensor<InputType, 3> input = xt::zeros<InputType>({13, 11, 3});
+        fillWithPattern(input, 11);
+        options.setChannelPosition(xvigra::ChannelPosition::LAST);
+
+        options.setWorkspaceLimit(0);
+        auto expected = xvigra::convolve2D(input, kernel, options);
+
+        // the direct algorithm accumulates its result in tiles within the same limit
+        for (xvigra::Algorithm algorithm : {xvigra::Algorithm::GEMM, xvigra::Algorithm::DIRECT}) {
+            options.setAlgorithm(algorithm);
+
+            for (std::size_t limit : {std::size_t(1), std::size_t(5000), std::size_t(20000)}) {
+                options.setWorkspaceLimit(limit);
+                checkConvolution2D(input, kernel, options, expected);
+            }
+        }
+    }
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test workspace limit - end                                                                                       ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test thread count - begin                                                                                        ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+TEST_CASE_TEMPLATE("Convolve1D: Test Thread Count", T, TYPE_PAIRS) {
+    using InputType = typename T::first_type;
+    using KernelType = typename T::second_type;
+
+    xt::xtensor<KernelType, 3> kernel = xt::zeros<KernelType>({2, 3, 5});
+    fillWithPattern(kernel, 5, 0.25, -0.5);
+
+    xvigra::KernelOptions options;
+    options.setPadding(2);
+    options.setDilation(2);
+    options.setBorderTreatment(xvigra::BorderTreatment::symmetricReflect());
+
+    SUBCASE("Channel First") {
+        xt::xtensor<InputType, 2> input = xt::zeros<InputType>({3, 23});
+        fillWithPattern(input, 11);
+        options.channelPosition = xvigra::ChannelPosition::FIRST;
+
+        auto expected = xvigra::convolve1D(input, kernel, options);
+
+        // the direct algorithm distributes its tiles over the same threads
+        for (xvigra::Algorithm algorithm : {xvigra::Algorithm::GEMM, xvigra::Algorithm::DIRECT}) {
+            options.setAlgorithm(algorithm);
+
+            for (int threadCount : {0, 2, 3, 64}) {
+                options.setThreadCount(threadCount);
+                options.setWorkspaceLimit(0);
+                checkConvolution1D(input, kernel, options, expected);
+
+                options.setWorkspaceLimit(200);
+                checkConvolution1D(input, kernel, options, expected);
+            }
+        }
+    }
+
+    SUBCASE("Channel Last") {
+        xt::xtensor<InputType, 2> input = xt::zeros<InputType>({23, 3});
+        fillWithPattern(input, 11);
+        options.channelPosition = xvigra::ChannelPosition::LAST;
+
+        auto expected = xvigra::convolve1D(input, kernel, options);
+
+        // the direct algorithm distributes its tiles over the same threads
+        for (xvigra::Algorithm algorithm : {xvigra::Algorithm::GEMM, xvigra::Algorithm::DIRECT}) {
+            options.setAlgorithm(algorithm);
+
+            for (int threadCount : {0, 2, 3, 64}) {
+                options.setThreadCount(threadCount);
+                options.setWorkspaceLimit(0);
+                checkConvolution1D(input, kernel, options, expected);
+
+                options.setWorkspaceLimit(200);
+                checkConvolution1D(input, kernel, options, expected);
+            }
+        }
+    }
+
+    SUBCASE("Negative Thread Count") {
+        xt::xtensor<InputType, 2> input = xt::zeros<InputType>({23, 3});
+        options.setThreadCount(-1);
+
+        CHECK_THROWS_WITH_AS(
+            xvigra::convolve1D(input, kernel, options),
+            "resolveThreadCount(): Thread count can't be negative!",
+            std::invalid_argument
+        );
+    }
+}
+
+
+TEST_CASE_TEMPLATE("Convolve2D: Test Thread Count", T, TYPE_PAIRS) {
+    using InputType = typename T::first_type;
+    using KernelType = typename T::second_type;
+
+    xt::xtensor<KernelType, 4> kernel = xt::zeros<KernelType>({2, 3, 3, 4});
+    fillWithPattern(kernel, 5, 0.25, -0.5);
+
+    xvigra::KernelOptions2D options;
+    options.setPadding(2, 1);
+    options.setStride(2, 1);
+    options.setBorderTreatment(xvigra::BorderTreatment::repeat());
+
+    SUBCASE("Channel First") {
+        xt::xtensor<InputType, 3> input = xt::zeros<InputType>({3, 13, 11});
+        fillWithPattern(input, 11);
+        options.setChannelPosition(xvigra::ChannelPosition::FIRST);
+
+        auto expected = xvigra::convolve2D(input, kernel, options);
+
+        // the direct algorithm distributes its tiles over the same threads
+        for (xvigra::Algorithm algorithm : {xvigra::Algorithm::GEMM, xvigra::Algorithm::DIRECT}) {
+            options.setAlgorithm(algorithm);
+
+            for (int threadCount : {0, 2, 3, 64}) {
+                options.setThreadCount(threadCount);
+                options.setWorkspaceLimit(0);
+                checkConvolution2D(input, kernel, options, expected);
+
+                options.setWorkspaceLimit(5000);
+                checkConvolution2D(input, kernel, options, expected);
+            }
+        }
+    }
+
+    SUBCASE("Channel Last") {
+        xt::xtensor<InputType, 3> input = xt::zeros<InputType>({13, 11, 3});
+        fillWithPattern(input, 11);
+        options.setChannelPosition(xvigra::ChannelPosition::LAST);
+
+        auto expected = xvigra::convolve2D(input, kernel, options);
+
+        // the direct algorithm distributes its tiles over the same threads
+        for (xvigra::Algorithm algorithm : {xvigra::Algorithm::GEMM, xvigra::Algorithm::DIRECT}) {
+            options.setAlgorithm(algorithm);
+
+            for (int threadCount : {0, 2, 3, 64}) {
+                options.setThreadCount(threadCount);
+                options.setWorkspaceLimit(0);
+                checkConvolution2D(input, kernel, options, expected);
+
+                options.setWorkspaceLimit(5000);
+                checkConvolution2D(input, kernel, options, expected);
+            }
+        }
+    }
+
+    SUBCASE("Negative Thread Count") {
+        xt::xtensor<InputType, 3> input = xt::zeros<InputType>({13, 11, 3});
+        options.setThreadCount(-1);
+
+        CHECK_THROWS_WITH_AS(
+            xvigra::convolve2D(input, kernel, options),
+            "resolveThreadCount(): Thread count can't be negative!",
+            std::invalid_argument
+        );
+    }
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test thread count - end                                                                                          ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test groups - begin                                                                                              ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+TEST_CASE_TEMPLATE("Convolve1D: Test Groups", T, TYPE_PAIRS) {
+    using InputType = typename T::first_type;
+    using KernelType = typename T::second_type;
+
+    xvigra::KernelOptions options;
+    options.setPadding(2);
+    options.setBorderTreatment(xvigra::BorderTreatment::wrap());
+
+    xt::xtensor<InputType, 2> input;
+
+    SUBCASE("Channel First") {
+        input = xt::zeros<InputType>({4, 17});
+        options.channelPosition = xvigra::ChannelPosition::FIRST;
+    }
+
+    SUBCASE("Channel Last") {
+        input = xt::zeros<InputType>({17, 4});
+        options.channelPosition = xvigra::ChannelPosition::LAST;
+    }
+
+    fillWithPattern(input, 11);
+
+    // grouped kernel
+    xt::xtensor<KernelType, 3> groupedKernel = xt::zeros<KernelType>({6, 2, 3});
+    fillWithPattern(groupedKernel, 5, 0.25, -0.5);
+
+    for (xvigra::Algorithm algorithm : {xvigra::Algorithm::GEMM, xvigra::Algorithm::DIRECT}) {
+        options.setAlgorithm(algorithm);
+        options.setGroups(1);
+        auto expected = xvigra::convolve1D(input, expandGroupedKernel(groupedKernel, 2), options);
+
+        options.setGroups(2);
+        checkConvolution1D(input, groupedKernel, options, expected);
+    }
+
+    // depthwise kernel
+    xt::xtensor<KernelType, 3> depthwiseKernel = xt::zeros<KernelType>({8, 1, 4});
+    fillWithPattern(depthwiseKernel, 5, 0.25, -0.5);
+
+    options.setAlgorithm(xvigra::Algorithm::GEMM);
+    options.setGroups(1);
+    auto expectedDepthwise = xvigra::convolve1D(input, expandGroupedKernel(depthwiseKernel, 4), options);
+
+    options.setGroups(4);
+    checkConvolution1D(input, depthwiseKernel, options, expectedDepthwise);
+
+    // kernel without channels
+    xt::xtensor<KernelType, 1> kernel{0.25, -1.0, 0.5};
+
+    options.setGroups(1);
+    auto expectedPromoted = xvigra::convolve1D(input, xvigra::promoteKernelToFull1D(kernel, 4), options);
+    checkConvolution1D(input, kernel, options, expectedPromoted);
+}
+
+
+TEST_CASE_TEMPLATE("Convolve2D: Test Groups", T, TYPE_PAIRS) {
+    using InputType = typename T::first_type;
+    using KernelType = typename T::second_type;
+
+    xvigra::KernelOptions2D options;
+    options.setPadding(1, 2);
+    options.setStride(2, 1);
+    options.setBorderTreatment(xvigra::BorderTreatment::repeat());
+
+    xt::xtensor<InputType, 3> input;
+
+    SUBCASE("Channel First") {
+        input = xt::zeros<InputType>({6, 11, 9});
+        options.setChannelPosition(xvigra::ChannelPosition::FIRST);
+    }
+
+    SUBCASE("Channel Last") {
+        input = xt::zeros<InputType>({11, 9, 6});
+        options.setChannelPosition(xvigra::ChannelPosition::LAST);
+    }
+
+    fillWithPattern(input, 11);
+
+    // grouped kernel
+    xt::xtensor<KernelType, 4> groupedKernel = xt::zeros<KernelType>({6, 2, 3, 3});
+    fillWithPattern(groupedKernel, 5, 0.25, -0.5);
+
+    for (xvigra::Algorithm algorithm : {xvigra::Algorithm::GEMM, xvigra::Algorithm::DIRECT, xvigra::Algorithm::AUTO}) {
+        options.setAlgorithm(algorithm);
+        options.setGroups(1);
+        auto expected = xvigra::convolve2D(input, expandGroupedKernel(groupedKernel, 3), options);
+
+        options.setGroups(3);
+        checkConvolution2D(input, groupedKernel, options, expected);
+    }
+
+    // depthwise kernel
+    xt::xtensor<KernelType, 4> depthwiseKernel = xt::zeros<KernelType>({6, 1, 3, 4});
+    fillWithPattern(depthwiseKernel, 5, 0.25, -0.5);
+
+    options.setAlgorithm(xvigra::Algorithm::GEMM);
+    options.setGroups(1);
+    auto expectedDepthwise = xvigra::convolve2D(input, expandGroupedKernel(depthwiseKernel, 6), options);
+
+    options.setGroups(6);
+    checkConvolution2D(input, depthwiseKernel, options, expectedDepthwise);
+
+    // kernel without channels
+    xt::xtensor<KernelType, 2> kernel = EDGE_KERNEL;
+
+    options.setGroups(1);
+    auto expectedPromoted = xvigra::convolve2D(input, xvigra::promoteKernelToFull2D(kernel, 6), options);
+    checkConvolution2D(input, kernel, options, expectedPromoted);
+
+    // groups on several threads, each with its slice of the bias
+    xvigra::Epilogue epilogue;
+    epilogue.setBias({1.0, -2.0, 3.0, -4.0, 5.0, -6.0});
+
+    options.setAlgorithm(xvigra::Algorithm::GEMM);
+    xt::xtensor<double, 3> expectedBiased;
+    xvigra::convolve2D(input, expandGroupedKernel(groupedKernel, 3), options.optionsY, options.optionsX, epilogue, expectedBiased);
+
+    options.setGroups(3);
+    for (int threadCount : {1, 2, 4}) {
+        CAPTURE(threadCount);
+        options.setThreadCount(threadCount);
+
+        xt::xtensor<double, 3> actual;
+        xvigra::convolve2D(input, groupedKernel, options.optionsY, options.optionsX, epilogue, actual);
+        checkExpressions(actual, expectedBiased, FLOAT_EPSILON);
+
+        // an output which is no container receives the result of all groups at once
+        std::array<std::size_t, 3> shape = expectedBiased.shape();
+        xt::xtensor<double, 4> outputs = xt::zeros<double>({std::size_t(2), shape[0], shape[1], shape[2]});
+        auto outputView = xt::view(outputs, 1, xt::all(), xt::all(), xt::all());
+        xvigra::convolve2D(input, groupedKernel, options.optionsY, options.optionsX, epilogue, outputView);
+        checkExpressions(outputView, expectedBiased, FLOAT_EPSILON);
+    }
+}
+
+
+TEST_CASE_TEMPLATE("Convolve2D: Test Invalid Groups", T, TYPE_PAIRS) {
+    using InputType = typename T::first_type;
+    using KernelType = typename T::second_type;
+
+    xt::xtensor<InputType, 3> input = xt::zeros<InputType>({7, 5, 6});
+    xt::xtensor<KernelType, 4> kernel = xt::zeros<KernelType>({6, 2, 3, 3});
+    xvigra::KernelOptions2D options;
+
+    SUBCASE("No Group") {
+        options.setGroups(0);
+
+        CHECK_THROWS_WITH_AS(
+            xvigra::convolve2D(input, kernel, options),
+            "convolve2D(): Need at least 1 group!",
+            std::invalid_argument
+        );
+    }
+
+    SUBCASE("Different Groups") {
+        options.optionsY.setGroups(3);
+
+        CHECK_THROWS_WITH_AS(
+            xvigra::convolve2D(input, kernel, options),
+            "convolve2D(): Groups can't be different for optionsY and optionsX!",
+            std::invalid_argument
+        );
+    }
+
+    SUBCASE("Indivisible Input Channels") {
+        options.setGroups(4);
+
+        CHECK_THROWS_WITH_AS(
+            xvigra::convolve2D(input, kernel, options),
+            "convolve2D(): Input channels are not divisible by the number of groups!",
+            std::invalid_argument
+        );
+    }
+
+    SUBCASE("Indivisible Output Channels") {
+        xt::xtensor<KernelType, 4> wrongKernel = xt::zeros<KernelType>({4, 2, 3, 3});
+        options.setGroups(3);
+
+        CHECK_THROWS_WITH_AS(
+            xvigra::convolve2D(input, wrongKernel, options),
+            "convolve2D(): Output channels are not divisible by the number of groups!",
+            std::invalid_argument
+        );
+    }
+
+    SUBCASE("Mismatching Group Channels") {
+        options.setGroups(2);
+
+        CHECK_THROWS_WITH_AS(
+            xvigra::convolve2D(input, kernel, options),
+            "convolve2D(): Input channels of input and kernel do not align!",
+            std::invalid_argument
+        );
+    }
+
+    SUBCASE("Kernel Without Channel Axes") {
+        // such a kernel is always depthwise, so only 1 group or one group per input channel are meaningful
+        xt::xtensor<KernelType, 2> kernel2D = xt::ones<KernelType>({3, 3});
+        xt::xtensor<KernelType, 1> kernel1D = xt::ones<KernelType>({3});
+        xt::xtensor<InputType, 2> input1D = xt::zeros<InputType>({5, 6});
+        xvigra::KernelOptions options1D;
+
+        options.setGroups(6);
+        CHECK_EQ(xvigra::convolve2D(input, kernel2D, options).shape()[2], 6);
+
+        options.setGroups(2);
+        CHECK_THROWS_WITH_AS(
+            xvigra::convolve2D(input, kernel2D, options),
+            "convolve2D(): Kernel without channel axes needs 1 group or one group per input channel!",
+            std::invalid_argument
+        );
+
+        options1D.setGroups(3);
+        CHECK_THROWS_WITH_AS(
+            xvigra::convolve1D(input1D, kernel1D, options1D),
+            "convolve1D(): Kernel without channel axis needs 1 group or one group per input channel!",
+            std::invalid_argument
+        );
+    }
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test groups - end                                                                                                ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test output - begin                                                                                              ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+TEST_CASE_TEMPLATE("Convolve1D: Test Output", T, TYPE_PAIRS) {
+    using InputType = typename T::first_type;
+    using KernelType = typename T::second_type;
+    using ResultType = typename std::common_type_t<InputType, KernelType>;
+
+    xt::xtensor<KernelType, 3> kernel = xt::zeros<KernelType>({2, 3, 5});
+    fillWithPattern(kernel, 5, 0.25, -0.5);
+
+    xvigra::KernelOptions options;
+    options.setPadding(2);
+    options.setBorderTreatment(xvigra::BorderTreatment::repeat());
+    options.channelPosition = xvigra::ChannelPosition::FIRST;
+
+    xt::xtensor<InputType, 2> input = xt::zeros<InputType>({3, 23});
+    fillWithPattern(input, 11);
+
+    SUBCASE("Tensor Output") {
+        for (xvigra::Algorithm algorithm : {xvigra::Algorithm::GEMM, xvigra::Algorithm::DIRECT}) {
+            options.setAlgorithm(algorithm);
+            auto expected = xvigra::convolve1D(input, kernel, options);
+
+            xt::xtensor<ResultType, 2> output(expected.shape());
+            const ResultType* data = output.data();
+
+            xvigra::convolve1D(input, kernel, options, output);
+            checkExpressions(output, expected);
+            CHECK_EQ(output.data(), data);
+
+            xt::xtensor<ResultType, 2> emptyOutput;
+            xvigra::convolve1D(input, kernel, options, emptyOutput);
+            checkExpressions(emptyOutput, expected);
+        }
+    }
+
+    SUBCASE("Adapted Input And Output") {
+        std::vector<InputType> inputBuffer(input.begin(), input.end());
+        auto adaptedInput = xt::adapt(inputBuffer, std::vector<std::size_t>{3, 23});
+
+        for (xvigra::Algorithm algorithm : {xvigra::Algorithm::GEMM, xvigra::Algorithm::DIRECT}) {
+            options.setAlgorithm(algorithm);
+            auto expected = xvigra::convolve1D(input, kernel, options);
+
+            std::vector<ResultType> outputBuffer(expected.size());
+            auto adaptedOutput = xt::adapt(outputBuffer, std::vector<std::size_t>{expected.shape()[0], expected.shape()[1]});
+
+            xvigra::convolve1D(adaptedInput, kernel, options, adaptedOutput);
+            checkExpressions(adaptedOutput, expected);
+        }
+    }
+
+    SUBCASE("Strided Input") {
+        xt::xtensor<InputType, 2> wideInput = xt::zeros<InputType>({3, 46});
+        xt::view(wideInput, xt::all(), xt::range(0, 46, 2)) = input;
+
+        for (xvigra::Algorithm algorithm : {xvigra::Algorithm::GEMM, xvigra::Algorithm::DIRECT}) {
+            options.setAlgorithm(algorithm);
+            auto expected = xvigra::convolve1D(input, kernel, options);
+
+            checkConvolution1D(xt::view(wideInput, xt::all(), xt::range(0, 46, 2)), kernel, options, expected);
+        }
+    }
+
+    SUBCASE("Temporary Output View") {
+        for (xvigra::Algorithm algorithm : {xvigra::Algorithm::GEMM, xvigra::Algorithm::DIRECT}) {
+            options.setAlgorithm(algorithm);
+            auto expected = xvigra::convolve1D(input, kernel, options);
+
+            xt::xtensor<ResultType, 2> wideOutput = xt::zeros<ResultType>({std::size_t(4), expected.shape()[1]});
+            xvigra::convolve1D(input, kernel, options, xt::view(wideOutput, xt::range(1, 3), xt::all()));
+            checkExpressions(xt::view(wideOutput, xt::range(1, 3), xt::all()), expected);
+
+            xvigra::convolve1D(input, kernel, options, xvigra::Epilogue(), xt::view(wideOutput, xt::range(2, 4), xt::all()));
+            checkExpressions(xt::view(wideOutput, xt::range(2, 4), xt::all()), expected);
+        }
+    }
+
+    SUBCASE("Wrong Output Shape") {
+        std::vector<ResultType> outputBuffer(2 * 22);
+        auto adaptedOutput = xt::adapt(outputBuffer, std::vector<std::size_t>{2, 22});
+
+        CHECK_THROWS_WITH_AS(
+            xvigra::convolve1D(input, kernel, options, adaptedOutput),
+            "convolve1D(): Output shape does not match the result shape!",
+            std::invalid_argument
+        );
+    }
+
+    SUBCASE("Implicit Channels") {
+        xt::xtensor<InputType, 1> implicitInput = xt::view(input, 0, xt::all());
+        xt::xtensor<KernelType, 1> implicitKernel{0.25, -1.0, 0.5};
+        options.channelPosition = xvigra::ChannelPosition::IMPLICIT;
+
+        auto expected = xvigra::convolve1DImplicit(implicitInput, implicitKernel, options);
+        xt::xtensor<ResultType, 1> output(expected.shape());
+
+        xvigra::convolve1DImplicit(implicitInput, implicitKernel, options, output);
+        checkExpressions(output, expected);
+    }
+}
+
+
+TEST_CASE_TEMPLATE("Convolve2D: Test Output", T, TYPE_PAIRS) {
+    using InputType = typename T::first_type;
+    using KernelType = typename T::second_type;
+    using ResultType = typename std::common_type_t<InputType, KernelType>;
+
+    xt::xtensor<KernelType, 4> kernel = xt::zeros<KernelType>({2, 3, 3, 3});
+    fillWithPattern(kernel, 5, 0.25, -0.5);
+
+    xvigra::KernelOptions2D options;
+    options.setPadding(1);
+    options.setBorderTreatment(xvigra::BorderTreatment::symmetricReflect());
+    options.setChannelPosition(xvigra::ChannelPosition::LAST);
+
+    xt::xtensor<InputType, 3> input = xt::zeros<InputType>({13, 11, 3});
+    fillWithPattern(input, 11);
+
+    std::vector<xvigra::Algorithm> algorithms{xvigra::Algorithm::GEMM, xvigra::Algorithm::DIRECT, xvigra::Algorithm::FFT};
+
+    SUBCASE("Tensor Output") {
+        for (xvigra::Algorithm algorithm : algorithms) {
+            options.setAlgorithm(algorithm);
+            auto expected = xvigra::convolve2D(input, kernel, options);
+
+            xt::xtensor<ResultType, 3> output(expected.shape());
+            const ResultType* data = output.data();
+
+            xvigra::convolve2D(input, kernel, options, output);
+            checkExpressions(output, expected, ALGORITHM_EPSILON);
+            CHECK_EQ(output.data(), data);
+        }
+    }
+
+    SUBCASE("Adapted Input And Output") {
+        std::vector<InputType> inputBuffer(input.begin(), input.end());
+        auto adaptedInput = xt::adapt(inputBuffer, std::vector<std::size_t>{13, 11, 3});
+
+        for (xvigra::Algorithm algorithm : algorithms) {
+            options.setAlgorithm(algorithm);
+            auto expected = xvigra::convolve2D(input, kernel, options);
+
+            std::vector<ResultType> outputBuffer(expected.size());
+            auto adaptedOutput = xt::adapt(outputBuffer, std::vector<std::size_t>{expected.shape()[0], expected.shape()[1], expected.shape()[2]});
+
+            xvigra::convolve2D(adaptedInput, kernel, options, adaptedOutput);
+            checkExpressions(adaptedOutput, expected, ALGORITHM_EPSILON);
+        }
+    }
+
+    SUBCASE("Strided Input And Output View") {
+        xt::xtensor<InputType, 3> wideInput = xt::zeros<InputType>({13, 22, 3});
+        xt::view(wideInput, xt::all(), xt::range(0, 22, 2), xt::all()) = input;
+
+        for (xvigra::Algorithm algorithm : algorithms) {
+            options.setAlgorithm(algorithm);
+            auto expected = xvigra::convolve2D(input, kernel, options);
+
+            xt::xtensor<ResultType, 3> wideOutput = xt::zeros<ResultType>({expected.shape()[0], expected.shape()[1], std::size_t(4)});
+            auto outputView = xt::view(wideOutput, xt::all(), xt::all(), xt::range(1, 3));
+
+            xvigra::convolve2D(xt::view(wideInput, xt::all(), xt::range(0, 22, 2), xt::all()), kernel, options, outputView);
+            checkExpressions(outputView, expected, ALGORITHM_EPSILON);
+        }
+    }
+
+    SUBCASE("Temporary Output View") {
+        for (xvigra::Algorithm algorithm : algorithms) {
+            options.setAlgorithm(algorithm);
+            auto expected = xvigra::convolve2D(input, kernel, options);
+
+            xt::xtensor<ResultType, 3> wideOutput = xt::zeros<ResultType>({expected.shape()[0], expected.shape()[1], std::size_t(4)});
+            xvigra::convolve2D(input, kernel, options, xt::view(wideOutput, xt::all(), xt::all(), xt::range(1, 3)));
+            checkExpressions(xt::view(wideOutput, xt::all(), xt::all(), xt::range(1, 3)), expected, ALGORITHM_EPSILON);
+
+            xvigra::convolve2D(input, kernel, options.optionsY, options.optionsX, xvigra::Epilogue(), xt::view(wideOutput, xt::all(), xt::all(), xt::range(2, 4)));
+            checkExpressions(xt::view(wideOutput, xt::all(), xt::all(), xt::range(2, 4)), expected, ALGORITHM_EPSILON);
+        }
+    }
+
+    SUBCASE("Wrong Output Shape") {
+        std::vector<ResultType> outputBuffer(13 * 11 * 3);
+        auto adaptedOutput = xt::adapt(outputBuffer, std::vector<std::size_t>{13, 11, 3});
+
+        CHECK_THROWS_WITH_AS(
+            xvigra::convolve2D(input, kernel, options, adaptedOutput),
+            "convolve2D(): Output shape does not match the result shape!",
+            std::invalid_argument
+        );
+    }
+
+    SUBCASE("Implicit Channels") {
+        xt::xtensor<InputType, 2> implicitInput = xt::view(input, xt::all(), xt::all(), 0);
+        xt::xtensor<KernelType, 2> implicitKernel = EDGE_KERNEL;
+        options.setChannelPosition(xvigra::ChannelPosition::IMPLICIT);
+
+        auto expected = xvigra::convolve2DImplicit(implicitInput, implicitKernel, options);
+        xt::xtensor<ResultType, 2> output(expected.shape());
+
+        xvigra::convolve2DImplicit(implicitInput, implicitKernel, options, output);
+        checkExpressions(output, expected);
+    }
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test output - end                                                                                                ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test convolveND - begin                                                                                          ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+TEST_CASE_TEMPLATE("ConvolveND: Test Against Convolve1D", T, TYPE_PAIRS) {
+    using InputType = typename T::first_type;
+    using KernelType = typename T::second_type;
+
+    xt::xtensor<KernelType, 3> kernel = xt::zeros<KernelType>({3, 2, 4});
+    fillWithPattern(kernel, 5, 0.25, -0.5);
+
+    std::array<xvigra::KernelOptions, 1> kernelOptions;
+    kernelOptions[0].setPadding(3);
+    kernelOptions[0].setStride(2);
+    kernelOptions[0].setDilation(2);
+    kernelOptions[0].setBorderTreatment(xvigra::BorderTreatment::symmetricReflect(), xvigra::BorderTreatment::constant(3));
+
+    xt::xtensor<InputType, 2> input;
+
+    SUBCASE("Channel First") {
+        input = xt::zeros<InputType>({2, 17});
+        kernelOptions[0].channelPosition = xvigra::ChannelPosition::FIRST;
+    }
+
+    SUBCASE("Channel Last") {
+        input = xt::zeros<InputType>({17, 2});
+        kernelOptions[0].channelPosition = xvigra::ChannelPosition::LAST;
+    }
+
+    fillWithPattern(input, 11);
+
+    xvigra::KernelOptions directOptions = kernelOptions[0];
+    directOptions.setAlgorithm(xvigra::Algorithm::DIRECT);
+    auto expected = xvigra::convolve1D(input, kernel, directOptions);
+
+    auto actual = xvigra::convolveND<1>(input, kernel, kernelOptions);
+
+    checkExpressions(actual, expected);
+}
+
+
+TEST_CASE_TEMPLATE("ConvolveND: Test Against Convolve2D", T, TYPE_PAIRS) {
+    using InputType = typename T::first_type;
+    using KernelType = typename T::second_type;
+
+    xt::xtensor<KernelType, 4> kernel = xt::zeros<KernelType>({3, 2, 3, 4});
+    fillWithPattern(kernel, 5, 0.25, -0.5);
+
+    std::array<xvigra::KernelOptions, 2> kernelOptions;
+    kernelOptions[0].setPadding(1);
+    kernelOptions[0].setStride(2);
+    kernelOptions[0].setBorderTreatment(xvigra::BorderTreatment::wrap());
+    kernelOptions[1].setPadding(2);
+    kernelOptions[1].setDilation(2);
+    kernelOptions[1].setBorderTreatment(xvigra::BorderTreatment::repeat(), xvigra::BorderTreatment::constant(-1));
+
+    xt::xtensor<InputType, 3> input;
+
+    SUBCASE("Channel First") {
+        input = xt::zeros<InputType>({2, 9, 11});
+        for (auto& options : kernelOptions) {
+            options.channelPosition = xvigra::ChannelPosition::FIRST;
+        }
+    }
+
+    SUBCASE("Channel Last") {
+        input = xt::zeros<InputType>({9, 11, 2});
+        for (auto& options : kernelOptions) {
+            options.channelPosition = xvigra::ChannelPosition::LAST;
+        }
+    }
+
+    fillWithPattern(input, 11);
+
+    std::array<xvigra::KernelOptions, 2> directOptions = kernelOptions;
+    for (auto& options : directOptions) {
+        options.setAlgorithm(xvigra::Algorithm::DIRECT);
+    }
+    auto expected = xvigra::convolve2D(input, kernel, directOptions[0], directOptions[1]);
+
+    SUBCASE("GEMM") {
+        checkExpressions(xvigra::convolveND<2>(input, kernel, kernelOptions), expected);
+    }
+
+    SUBCASE("GEMM With Workspace Limit And Threads") {
+        for (auto& options : kernelOptions) {
+            options.setThreadCount(3);
+        }
+        kernelOptions[0].setWorkspaceLimit(1);
+
+        checkExpressions(xvigra::convolveND<2>(input, kernel, kernelOptions), expected);
+    }
+
+    SUBCASE("Forwarded Algorithm") {
+        checkExpressions(xvigra::convolveND<2>(input, kernel, directOptions), expected);
+    }
+}
+
+
+TEST_CASE_TEMPLATE("ConvolveND: Test 4 Dimensions Against Separable Convolution", T, TYPE_PAIRS) {
+    using InputType = typename T::first_type;
+    using KernelType = typename T::second_type;
+
+    // a 1-dimensional kernel is promoted to the outer product along all axes, which separates exactly
+    xt::xtensor<KernelType, 1> kernel{-0.5, 1.0, 0.75};
+
+    std::array<xvigra::KernelOptions, 4> kernelOptions;
+    kernelOptions[0].setPadding(1);
+    kernelOptions[0].setBorderTreatment(xvigra::BorderTreatment::repeat());
+    kernelOptions[1].setPadding(2);
+    kernelOptions[1].setStride(2);
+    kernelOptions[1].setBorderTreatment(xvigra::BorderTreatment::asymmetricReflect());
+    kernelOptions[2].setPadding(2);
+    kernelOptions[2].setDilation(2);
+    kernelOptions[2].setBorderTreatment(xvigra::BorderTreatment::wrap());
+    kernelOptions[3].setPadding(1);
+    kernelOptions[3].setBorderTreatment(xvigra::BorderTreatment::constant(2), xvigra::BorderTreatment::symmetricReflect());
+
+    xt::xtensor<InputType, 5> input;
+
+    SUBCASE("Channel First") {
+        input = xt::zeros<InputType>({2, 4, 5, 6, 7});
+        for (auto& options : kernelOptions) {
+            options.channelPosition = xvigra::ChannelPosition::FIRST;
+        }
+    }
+
+    SUBCASE("Channel Last") {
+        input = xt::zeros<InputType>({4, 5, 6, 7, 2});
+        for (auto& options : kernelOptions) {
+            options.channelPosition = xvigra::ChannelPosition::LAST;
+        }
+    }
+
+    fillWithPattern(input, 11);
+
+    auto expected = xvigra::separableConvolveND<4>(input, std::array<xt::xtensor<KernelType, 1>, 4>{kernel, kernel, kernel, kernel}, kernelOptions);
+    auto actual = xvigra::convolveND<4>(input, kernel, kernelOptions);
+
+    checkExpressions(actual, expected, ALGORITHM_EPSILON);
+}
+
+
+TEST_CASE_TEMPLATE("ConvolveND: Test Invalid Configurations", T, TYPE_PAIRS) {
+    using InputType = typename T::first_type;
+    using KernelType = typename T::second_type;
+
+    xt::xtensor<InputType, 5> input = xt::zeros<InputType>({3, 4, 5, 6, 3});
+    xt::xtensor<KernelType, 6> kernel = xt::zeros<KernelType>({2, 3, 3, 3, 3, 3});
+
+    std::array<xvigra::KernelOptions, 4> kernelOptions;
+    for (auto& options : kernelOptions) {
+        options.channelPosition = xvigra::ChannelPosition::LAST;
+    }
+
+    SUBCASE("Input wrong dimension") {
+        xt::xtensor<InputType, 4> wrongInput = xt::zeros<InputType>({4, 5, 6, 3});
+
+        CHECK_THROWS_WITH_AS(
+            xvigra::convolveND<4>(wrongInput, kernel, kernelOptions),
+            "convolveND(): Number of dimensions of input does not match the given non-channel dimension template parameter!",
+            std::invalid_argument
+        );
+    }
+
+    SUBCASE("Unsupported Algorithm") {
+        for (auto& options : kernelOptions) {
+            options.setAlgorithm(xvigra::Algorithm::WINOGRAD_2X2);
+        }
+
+        CHECK_THROWS_WITH_AS(
+            xvigra::convolveND<4>(input, kernel, kernelOptions),
+            "convolveND(): Only the GEMM algorithm is supported for more than 2 dimensions!",
+            std::invalid_argument
+        );
+    }
+
+    SUBCASE("Kernel bigger than padded input") {
+        kernelOptions[3].setDilation(2);
+
+        CHECK_THROWS_WITH_AS(
+            xvigra::convolveND<4>(input, kernel, kernelOptions),
+            "convolveND(): Kernel is greater than padded input along axis 3!",
+            std::invalid_argument
+        );
+    }
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test convolveND - end                                                                                            ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test convolve3D - begin                                                                                          ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+TEST_CASE_TEMPLATE("Convolve3D: Test Against Convolve2D", T, TYPE_PAIRS) {
+    using InputType = typename T::first_type;
+    using KernelType = typename T::second_type;
+
+    // a kernel of depth 1 without depth padding convolves every depth slice on its own
+    xt::xtensor<KernelType, 5> kernel = xt::zeros<KernelType>({3, 2, 1, 3, 4});
+    fillWithPattern(kernel, 5, 0.25, -0.5);
+    xt::xtensor<KernelType, 4> sliceKernel = xt::view(kernel, xt::all(), xt::all(), 0, xt::all(), xt::all());
+
+    xvigra::KernelOptions optionsZ;
+    xvigra::KernelOptions2D options;
+    options.setPadding(1, 2);
+    options.setStride(2, 1);
+    options.setDilation(1, 2);
+    options.optionsY.setBorderTreatment(xvigra::BorderTreatment::symmetricReflect());
+    options.optionsX.setBorderTreatment(xvigra::BorderTreatment::constant(2), xvigra::BorderTreatment::wrap());
+
+    SUBCASE("Channel First") {
+        xt::xtensor<InputType, 4> input = xt::zeros<InputType>({2, 4, 9, 11});
+        fillWithPattern(input, 11);
+        optionsZ.channelPosition = xvigra::ChannelPosition::FIRST;
+        options.setChannelPosition(xvigra::ChannelPosition::FIRST);
+
+        auto actual = xvigra::convolve3D(input, kernel, optionsZ, options.optionsY, options.optionsX);
+        REQUIRE_EQ(actual.shape()[1], 4);
+
+        for (std::size_t z = 0; z < 4; ++z) {
+            xt::xtensor<InputType, 3> slice = xt::view(input, xt::all(), z, xt::all(), xt::all());
+            auto expected = xvigra::convolve2D(slice, sliceKernel, options);
+            checkExpressions(xt::view(actual, xt::all(), z, xt::all(), xt::all()), expected);
+        }
+    }
+
+    SUBCASE("Channel Last") {
+        xt::xtensor<InputType, 4> input = xt::zeros<InputType>({4, 9, 11, 2});
+        fillWithPattern(input, 11);
+        optionsZ.channelPosition = xvigra::ChannelPosition::LAST;
+        options.setChannelPosition(xvigra::ChannelPosition::LAST);
+
+        auto actual = xvigra::convolve3D(input, kernel, optionsZ, options.optionsY, options.optionsX);
+        REQUIRE_EQ(actual.shape()[0], 4);
+
+        for (std::size_t z = 0; z < 4; ++z) {
+            xt::xtensor<InputType, 3> slice = xt::view(input, z, xt::all(), xt::all(), xt::all());
+            auto expected = xvigra::convolve2D(slice, sliceKernel, options);
+            checkExpressions(xt::view(actual, z, xt::all(), xt::all(), xt::all()), expected);
+        }
+    }
+}
+
+
+TEST_CASE_TEMPLATE("Convolve3D: Test Against Separable Convolution", T, TYPE_PAIRS) {
+    using InputType = typename T::first_type;
+    using KernelType = typename T::second_type;
+
+    // a 1-dimensional kernel is promoted to the outer product along all axes, which separates exactly
+    xt::xtensor<KernelType, 1> kernel{0.25, 1.0, -0.5};
+
+    std::array<xvigra::KernelOptions, 3> kernelOptions;
+    kernelOptions[0].setPadding(2);
+    kernelOptions[0].setStride(2);
+    kernelOptions[0].setBorderTreatment(xvigra::BorderTreatment::asymmetricReflect());
+    kernelOptions[1].setPadding(2);
+    kernelOptions[1].setDilation(2);
+    kernelOptions[1].setBorderTreatment(xvigra::BorderTreatment::repeat());
+    kernelOptions[2].setPadding(1);
+    kernelOptions[2].setBorderTreatment(xvigra::BorderTreatment::wrap(), xvigra::BorderTreatment::symmetricReflect());
+
+    xt::xtensor<InputType, 4> input;
+
+    SUBCASE("Channel First") {
+        input = xt::zeros<InputType>({2, 7, 8, 9});
+        for (auto& options : kernelOptions) {
+            options.channelPosition = xvigra::ChannelPosition::FIRST;
+        }
+    }
+
+    SUBCASE("Channel Last") {
+        input = xt::zeros<InputType>({7, 8, 9, 2});
+        for (auto& options : kernelOptions) {
+            options.channelPosition = xvigra::ChannelPosition::LAST;
+        }
+    }
+
+    fillWithPattern(input, 11);
+
+    auto expected = xvigra::separableConvolveND<3>(input, std::array<xt::xtensor<KernelType, 1>, 3>{kernel, kernel, kernel}, kernelOptions);
+    auto actual = xvigra::convolve3D(input, kernel, kernelOptions[0], kernelOptions[1], kernelOptions[2]);
+
+    checkExpressions(actual, expected, ALGORITHM_EPSILON);
+}
+
+
+TEST_CASE_TEMPLATE("Convolve3D: Test Workspace Limit And Thread Count", T, TYPE_PAIRS) {
+    using InputType = typename T::first_type;
+    using KernelType = typename T::second_type;
+
+    xt::xtensor<KernelType, 5> kernel = xt::zeros<KernelType>({2, 3, 3, 3, 2});
+    fillWithPattern(kernel, 5, 0.25, -0.5);
+
+    xvigra::KernelOptions optionsZ;
+    xvigra::KernelOptions optionsY;
+    xvigra::KernelOptions optionsX;
+    optionsZ.setPadding(1);
+    optionsZ.setBorderTreatment(xvigra::BorderTreatment::constant(1));
+    optionsY.setPadding(1);
+    optionsY.setStride(2);
+    optionsY.setBorderTreatment(xvigra::BorderTreatment::wrap());
+    optionsX.setPadding(1);
+    optionsX.setBorderTreatment(xvigra::BorderTreatment::asymmetricReflect());
+
+    xt::xtensor<InputType, 4> input;
+
+    SUBCASE("Channel First") {
+        input = xt::zeros<InputType>({3, 5, 7, 6});
+        optionsZ.channelPosition = optionsY.channelPosition = optionsX.channelPosition = xvigra::ChannelPosition::FIRST;
+    }
+
+    SUBCASE("Channel Last") {
+        input = xt::zeros<InputType>({5, 7, 6, 3});
+        optionsZ.channelPosition = optionsY.channelPosition = optionsX.channelPosition = xvigra::ChannelPosition::LAST;
+    }
+
+    fillWithPattern(input, 11);
+
+    optionsZ.setWorkspaceLimit(0);
+    auto expected = xvigra::convolve3D(input, kernel, optionsZ, optionsY, optionsX);
+
+    for (std::size_t limit : {std::size_t(1), std::size_t(3000), std::size_t(20000)}) {
+        for (int threadCount : {1, 3}) {
+            optionsZ.setWorkspaceLimit(limit);
+            optionsZ.setThreadCount(threadCount);
+            checkExpressions(xvigra::convolve3D(input, kernel, optionsZ, optionsY, optionsX), expected);
+        }
+    }
+}
+
+
+TEST_CASE_TEMPLATE("Convolve3D: Test Groups", T, TYPE_PAIRS) {
+    using InputType = typename T::first_type;
+    using KernelType = typename T::second_type;
+
+    xvigra::KernelOptions optionsZ;
+    xvigra::KernelOptions optionsY;
+    xvigra::KernelOptions optionsX;
+    optionsZ.setPadding(1);
+    optionsY.setPadding(1);
+    optionsX.setPadding(2);
+    optionsX.setBorderTreatment(xvigra::BorderTreatment::repeat());
+
+    xt::xtensor<InputType, 4> input;
+
+    SUBCASE("Channel First") {
+        input = xt::zeros<InputType>({4, 5, 6, 7});
+        optionsZ.channelPosition = optionsY.channelPosition = optionsX.channelPosition = xvigra::ChannelPosition::FIRST;
+    }
+
+    SUBCASE("Channel Last") {
+        input = xt::zeros<InputType>({5, 6, 7, 4});
+        optionsZ.channelPosition = optionsY.channelPosition = optionsX.channelPosition = xvigra::ChannelPosition::LAST;
+    }
+
+    fillWithPattern(input, 11);
+
+    // grouped kernel
+    xt::xtensor<KernelType, 5> groupedKernel = xt::zeros<KernelType>({6, 2, 3, 3, 3});
+    fillWithPattern(groupedKernel, 5, 0.25, -0.5);
+
+    auto expected = xvigra::convolve3D(input, expandGroupedKernel(groupedKernel, 2), optionsZ, optionsY, optionsX);
+
+    optionsZ.setGroups(2);
+    optionsY.setGroups(2);
+    optionsX.setGroups(2);
+    checkExpressions(xvigra::convolve3D(input, groupedKernel, optionsZ, optionsY, optionsX), expected);
+
+    // the groups run on their own threads, and a strided view of the input gives the same result
+    optionsZ.setThreadCount(2);
+    checkExpressions(xvigra::convolve3D(input, groupedKernel, optionsZ, optionsY, optionsX), expected);
+
+    xt::xtensor<InputType, 4> paddedInput = xt::zeros<InputType>({input.shape()[0], input.shape()[1], input.shape()[2], 2 * input.shape()[3]});
+    xt::view(paddedInput, xt::all(), xt::all(), xt::all(), xt::range(0, input.shape()[3])) = input;
+    auto inputView = xt::view(paddedInput, xt::all(), xt::all(), xt::all(), xt::range(0, input.shape()[3]));
+    checkExpressions(xvigra::convolve3D(inputView, groupedKernel, optionsZ, optionsY, optionsX), expected);
+    optionsZ.setThreadCount(1);
+
+    // kernel without channels
+    xt::xtensor<KernelType, 3> kernel = xt::zeros<KernelType>({3, 3, 3});
+    fillWithPattern(kernel, 5, 0.25, -0.5);
+
+    optionsZ.setGroups(1);
+    optionsY.setGroups(1);
+    optionsX.setGroups(1);
+    auto expectedPromoted = xvigra::convolve3D(input, xvigra::promoteKernelToFull3D(kernel, 4), optionsZ, optionsY, optionsX);
+    checkExpressions(xvigra::convolve3D(input, kernel, optionsZ, optionsY, optionsX), expectedPromoted);
+}
+
+
+TEST_CASE_TEMPLATE("Convolve3D: Test Output", T, TYPE_PAIRS) {
+    using InputType = typename T::first_type;
+    using KernelType = typename T::second_type;
+    using ResultType = typename std::common_type_t<InputType, KernelType>;
+
+    xt::xtensor<KernelType, 5> kernel = xt::zeros<KernelType>({2, 3, 3, 3, 3});
+    fillWithPattern(kernel, 5, 0.25, -0.5);
+
+    xvigra::KernelOptions options;
+    options.setPadding(1);
+    options.setBorderTreatment(xvigra::BorderTreatment::symmetricReflect());
+    options.channelPosition = xvigra::ChannelPosition::LAST;
+
+    xt::xtensor<InputType, 4> input = xt::zeros<InputType>({5, 6, 7, 3});
+    fillWithPattern(input, 11);
+
+    auto expected = xvigra::convolve3D(input, kernel, options, options, options);
+
+    SUBCASE("Tensor Output") {
+        xt::xtensor<ResultType, 4> output(expected.shape());
+        const ResultType* data = output.data();
+
+        xvigra::convolve3D(input, kernel, options, options, options, output);
+        checkExpressions(output, expected);
+        CHECK_EQ(output.data(), data);
+    }
+
+    SUBCASE("Strided Input And Output View") {
+        xt::xtensor<InputType, 4> wideInput = xt::zeros<InputType>({5, 6, 14, 3});
+        xt::view(wideInput, xt::all(), xt::all(), xt::range(0, 14, 2), xt::all()) = input;
+
+        xt::xtensor<ResultType, 4> wideOutput = xt::zeros<ResultType>({5, 6, 7, 4});
+        auto outputView = xt::view(wideOutput, xt::all(), xt::all(), xt::all(), xt::range(1, 3));
+
+        xvigra::convolve3D(xt::view(wideInput, xt::all(), xt::all(), xt::range(0, 14, 2), xt::all()), kernel, options, options, options, outputView);
+        checkExpressions(outputView, expected);
+    }
+
+    SUBCASE("Wrong Output Shape") {
+        std::vector<ResultType> outputBuffer(5 * 6 * 7 * 3);
+        auto adaptedOutput = xt::adapt(outputBuffer, std::vector<std::size_t>{5, 6, 7, 3});
+
+        CHECK_THROWS_WITH_AS(
+            xvigra::convolve3D(input, kernel, options, options, options, adaptedOutput),
+            "convolveND(): Output shape does not match the result shape!",
+            std::invalid_argument
+        );
+    }
+}
+
+
+TEST_CASE_TEMPLATE("Convolve3D: Test Invalid Configurations", T, TYPE_PAIRS) {
+    using InputType = typename T::first_type;
+    using KernelType = typename T::second_type;
+
+    xt::xtensor<InputType, 4> input = xt::zeros<InputType>({4, 5, 6, 3});
+    xt::xtensor<KernelType, 5> kernel = xt::zeros<KernelType>({2, 3, 3, 3, 3});
+
+    xvigra::KernelOptions options;
+    options.channelPosition = xvigra::ChannelPosition::LAST;
+
+    SUBCASE("Input wrong dimension") {
+        xt::xtensor<InputType, 3> wrongInput = xt::zeros<InputType>({5, 6, 3});
+
+        CHECK_THROWS_WITH_AS(
+            xvigra::convolve3D(wrongInput, kernel, options, options, options),
+            "convolveND(): Number of dimensions of input does not match the given non-channel dimension template parameter!",
+            std::invalid_argument
+        );
+    }
+
+    SUBCASE("Implicit Channels") {
+        options.channelPosition = xvigra::ChannelPosition::IMPLICIT;
+
+        CHECK_THROWS_WITH_AS(
+            xvigra::convolve3D(input, kernel, options, options, options),
+            "convolveND(): Implicit channel option is not supported for explicit channels in input!",
+            std::invalid_argument
+        );
+    }
+
+    SUBCASE("Different Options") {
+        xvigra::KernelOptions otherOptions = options;
+        otherOptions.channelPosition = xvigra::ChannelPosition::FIRST;
+
+        CHECK_THROWS_WITH_AS(
+            xvigra::convolve3D(input, kernel, options, otherOptions, options),
+            "convolveND(): Channel can't be on different positions for the options of different axes!",
+            std::invalid_argument
+        );
+
+        otherOptions = options;
+        otherOptions.setAlgorithm(xvigra::Algorithm::DIRECT);
+
+        CHECK_THROWS_WITH_AS(
+            xvigra::convolve3D(input, kernel, options, options, otherOptions),
+            "convolveND(): Algorithm can't be different for the options of different axes!",
+            std::invalid_argument
+        );
+
+        otherOptions = options;
+        otherOptions.setGroups(3);
+
+        CHECK_THROWS_WITH_AS(
+            xvigra::convolve3D(input, kernel, otherOptions, options, options),
+            "convolveND(): Groups can't be different for the options of different axes!",
+            std::invalid_argument
+        );
+    }
+
+    SUBCASE("Unsupported Algorithm") {
+        options.setAlgorithm(xvigra::Algorithm::FFT);
+
+        CHECK_THROWS_WITH_AS(
+            xvigra::convolve3D(input, kernel, options, options, options),
+            "convolveND(): Only the GEMM algorithm is supported for more than 2 dimensions!",
+            std::invalid_argument
+        );
+    }
+
+    SUBCASE("Channels do not align") {
+        xt::xtensor<KernelType, 5> wrongKernel = xt::zeros<KernelType>({2, 2, 3, 3, 3});
+
+        CHECK_THROWS_WITH_AS(
+            xvigra::convolve3D(input, wrongKernel, options, options, options),
+            "convolveND(): Input channels of input and kernel do not align!",
+            std::invalid_argument
+        );
+    }
+
+    SUBCASE("Kernel bigger than padded input") {
+        xt::xtensor<KernelType, 5> deepKernel = xt::zeros<KernelType>({2, 3, 5, 3, 3});
+
+        CHECK_THROWS_WITH_AS(
+            xvigra::convolve3D(input, deepKernel, options, options, options),
+            "convolveND(): Kernel is greater than padded input along axis 0!",
+            std::invalid_argument
+        );
+
+        xvigra::KernelOptions dilatedOptions = options;
+        dilatedOptions.setDilation(3);
+
+        CHECK_THROWS_WITH_AS(
+            xvigra::convolve3D(input, kernel, options, dilatedOptions, options),
+            "convolveND(): Kernel is greater than padded input along axis 1!",
+            std::invalid_argument
+        );
+    }
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test convolve3D - end                                                                                            ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test convolve2DBlocked - begin                                                                                   ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+TEST_CASE_TEMPLATE("Convolve2DBlocked: Test Against Convolve2D", T, TYPE_PAIRS) {
+    using InputType = typename T::first_type;
+    using KernelType = typename T::second_type;
+
+    // 11 input channels fill 2 blocks partially, 10 output channels as well
+    xt::xtensor<KernelType, 4> kernel = xt::zeros<KernelType>({10, 11, 3, 4});
+    fillWithPattern(kernel, 5, 0.25, -0.5);
+    xt::xtensor<InputType, 3> input = xt::zeros<InputType>({11, 9, 13});
+    fillWithPattern(input, 11);
+
+    xvigra::KernelOptions optionsY;
+    xvigra::KernelOptions optionsX;
+    optionsY.setPadding(1);
+    optionsY.setStride(2);
+    optionsY.setBorderTreatment(xvigra::BorderTreatment::wrap());
+    optionsX.setPadding(2);
+    optionsX.setDilation(2);
+    optionsX.setBorderTreatment(xvigra::BorderTreatment::repeat(), xvigra::BorderTreatment::constant(-1));
+
+    xvigra::KernelOptions directOptionsY = optionsY;
+    xvigra::KernelOptions directOptionsX = optionsX;
+    directOptionsY.setChannelPosition(xvigra::ChannelPosition::FIRST);
+    directOptionsX.setChannelPosition(xvigra::ChannelPosition::FIRST);
+    directOptionsY.setAlgorithm(xvigra::Algorithm::DIRECT);
+    directOptionsX.setAlgorithm(xvigra::Algorithm::DIRECT);
+    auto expected = xvigra::convolve2D(input, kernel, directOptionsY, directOptionsX);
+
+    optionsY.setChannelPosition(xvigra::ChannelPosition::BLOCKED);
+    optionsX.setChannelPosition(xvigra::ChannelPosition::BLOCKED);
+    auto blockedInput = xvigra::toChannelBlocked(input, xvigra::ChannelPosition::FIRST);
+
+    SUBCASE("Single Thread") {
+        auto result = xvigra::convolve2DBlocked(blockedInput, kernel, optionsY, optionsX);
+
+        REQUIRE_EQ(result.shape(), std::array<std::size_t, 4>{2, expected.shape()[1], expected.shape()[2], xvigra::CHANNEL_BLOCK_SIZE});
+        checkExpressions(xvigra::fromChannelBlocked(result, 10, xvigra::ChannelPosition::FIRST), expected);
+
+        // the lanes behind the last output channel stay 0
+        CHECK(xt::all(xt::equal(xt::view(result, 1, xt::all(), xt::all(), xt::range(2, 8)), 0)));
+    }
+
+    SUBCASE("Threads") {
+        optionsY.setThreadCount(3);
+        auto result = xvigra::convolve2DBlocked(blockedInput, kernel, optionsY, optionsX);
+
+        checkExpressions(xvigra::fromChannelBlocked(result, 10, xvigra::ChannelPosition::FIRST), expected);
+    }
+
+    SUBCASE("Depthwise Kernel") {
+        xt::xtensor<KernelType, 2> depthwiseKernel = xt::view(kernel, 0, 0, xt::all(), xt::all());
+        auto depthwiseExpected = xvigra::convolve2D(input, depthwiseKernel, directOptionsY, directOptionsX);
+        auto result = xvigra::convolve2DBlocked(blockedInput, depthwiseKernel, optionsY, optionsX);
+
+        checkExpressions(xvigra::fromChannelBlocked(result, 11, xvigra::ChannelPosition::FIRST), depthwiseExpected);
+    }
+
+    SUBCASE("Epilogue") {
+        xvigra::Epilogue epilogue;
+        epilogue.setBias({1.0, -2.0, 3.0, -4.0, 5.0, -6.0, 7.0, -8.0, 9.0, -10.0});
+        epilogue.setScale(0.5);
+        epilogue.setClip(-20.0, 20.0);
+
+        xt::xtensor<double, 3> expectedPostProcessed;
+        xvigra::convolve2D(input, kernel, directOptionsY, directOptionsX, epilogue, expectedPostProcessed);
+
+        optionsY.setThreadCount(2);
+        auto result = xvigra::convolve2DBlocked<double>(blockedInput, kernel, optionsY, optionsX, epilogue);
+
+        checkExpressions(xvigra::fromChannelBlocked(result, 10, xvigra::ChannelPosition::FIRST), expectedPostProcessed);
+
+        // the bias only belongs to real channels, the lanes behind the last output channel stay 0
+        CHECK(xt::all(xt::equal(xt::view(result, 1, xt::all(), xt::all(), xt::range(2, 8)), 0.0)));
+    }
+
+    SUBCASE("Output") {
+        // a reused output is overwritten completely, including the lanes behind the last output channel
+        xt::xtensor<double, 4> output = xt::ones<double>({std::size_t(2), expected.shape()[1], expected.shape()[2], xvigra::CHANNEL_BLOCK_SIZE});
+        xvigra::convolve2DBlocked(blockedInput, kernel, optionsY, optionsX, output);
+
+        checkExpressions(xvigra::fromChannelBlocked(output, 10, xvigra::ChannelPosition::FIRST), expected);
+        CHECK(xt::all(xt::equal(xt::view(output, 1, xt::all(), xt::all(), xt::range(2, 8)), 0.0)));
+
+        // an output which is no container is written in place
+        xt::xtensor<double, 5> outputs = xt::zeros<double>({std::size_t(2), std::size_t(2), expected.shape()[1], expected.shape()[2], xvigra::CHANNEL_BLOCK_SIZE});
+        auto outputView = xt::view(outputs, 1, xt::all(), xt::all(), xt::all(), xt::all());
+        xvigra::convolve2DBlocked(blockedInput, kernel, optionsY, optionsX, outputView);
+
+        checkExpressions(outputView, output);
+        CHECK(xt::all(xt::equal(xt::view(outputs, 0, xt::all(), xt::all(), xt::all(), xt::all()), 0.0)));
+    }
+}
+
+
+TEST_CASE_TEMPLATE("Convolve2DBlocked: Test Invalid Configurations", T, TYPE_PAIRS) {
+    using InputType = typename T::first_type;
+    using KernelType = typename T::second_type;
+
+    xt::xtensor<KernelType, 4> kernel = xt::zeros<KernelType>({4, 3, 3, 3});
+    xt::xtensor<InputType, 4> input = xt::zeros<InputType>({1, 5, 5, 8});
+
+    xvigra::KernelOptions2D options;
+    options.setChannelPosition(xvigra::ChannelPosition::BLOCKED);
+
+    SUBCASE("Channel Position") {
+        xvigra::KernelOptions2D firstOptions;
+        firstOptions.setChannelPosition(xvigra::ChannelPosition::FIRST);
+
+        CHECK_THROWS_WITH_AS(
+            xvigra::convolve2DBlocked(input, kernel, firstOptions),
+            "convolve2DBlocked(): Need ChannelPosition::BLOCKED in optionsY and optionsX!",
+            std::invalid_argument
+        );
+
+        xt::xtensor<InputType, 3> unblockedInput = xt::zeros<InputType>({3, 5, 5});
+        CHECK_THROWS_WITH_AS(
+            xvigra::convolve2D(unblockedInput, kernel, options),
+            "convolve2D(): Blocked channel option is only supported by convolve2DBlocked!",
+            std::invalid_argument
+        );
+    }
+
+    SUBCASE("Groups") {
+        options.setGroups(2);
+
+        CHECK_THROWS_WITH_AS(
+            xvigra::convolve2DBlocked(input, kernel, options),
+            "convolve2DBlocked(): Groups are not supported!",
+            std::invalid_argument
+        );
+    }
+
+    SUBCASE("Input Shape") {
+        xt::xtensor<InputType, 4> wrongInput = xt::zeros<InputType>({1, 5, 5, 4});
+
+        CHECK_THROWS_WITH_AS(
+            xvigra::convolve2DBlocked(wrongInput, kernel, options),
+            "convolve2DBlocked(): Need 4 dimensional (C/8 x H x W x 8) input!",
+            std::invalid_argument
+        );
+    }
+
+    SUBCASE("Input Channels") {
+        xt::xtensor<KernelType, 4> wideKernel = xt::zeros<KernelType>({4, 9, 3, 3});
+
+        CHECK_THROWS_WITH_AS(
+            xvigra::convolve2DBlocked(input, wideKernel, options),
+            "convolve2DBlocked(): Input channels of input and kernel do not align!",
+            std::invalid_argument
+        );
+    }
+
+    SUBCASE("Kernel Size") {
+        xt::xtensor<KernelType, 4> largeKernel = xt::zeros<KernelType>({4, 3, 7, 3});
+
+        CHECK_THROWS_WITH_AS(
+            xvigra::convolve2DBlocked(input, largeKernel, options),
+            "convolve2DBlocked(): Kernel height is greater than padded input height!",
+            std::invalid_argument
+        );
+    }
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test convolve2DBlocked - end                                                                                     ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test sparse kernel - begin                                                                                       ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+TEST_CASE("Convolve2D: Test collectNonZeroTaps") {
+    xt::xtensor<float, 4> kernel = xt::zeros<float>({2, 2, 3, 3});
+    kernel(0, 1, 0, 2) = 1.5f;
+    kernel(0, 0, 2, 1) = -1.0f;
+    kernel(1, 1, 1, 1) = 4.0f;
+
+    auto sparseKernel = xvigra::collectNonZeroTaps<double>(kernel);
+
+    CHECK_EQ(sparseKernel.outputChannels, 2);
+    CHECK_EQ(sparseKernel.inputChannels, 2);
+    CHECK_EQ(sparseKernel.kernelHeight, 3);
+    CHECK_EQ(sparseKernel.kernelWidth, 3);
+    CHECK_EQ(sparseKernel.offsets, std::vector<std::size_t>{0, 2, 3});
+    REQUIRE_EQ(sparseKernel.taps.size(), 3);
+
+    // ordered by input channel, kernel row and kernel column
+    CHECK_EQ(sparseKernel.taps[0].inputChannel, 0);
+    CHECK_EQ(sparseKernel.taps[0].kernelY, 2);
+    CHECK_EQ(sparseKernel.taps[0].kernelX, 1);
+    CHECK_EQ(sparseKernel.taps[0].weight, -1.0);
+    CHECK_EQ(sparseKernel.taps[1].inputChannel, 1);
+    CHECK_EQ(sparseKernel.taps[1].weight, 1.5);
+    CHECK_EQ(sparseKernel.taps[2].kernelY, 1);
+    CHECK_EQ(sparseKernel.taps[2].weight, 4.0);
+
+    CHECK_EQ(sparseKernel.density(), doctest::Approx(3.0 / 36.0));
+    CHECK(sparseKernel.isSparse(xvigra::ChannelPosition::FIRST));
+
+    // the scalar gather of channel last inputs needs far fewer non-zero taps
+    CHECK_FALSE(sparseKernel.isSparse(xvigra::ChannelPosition::LAST));
+
+    // weights which become 0 in the result type are skipped as well
+    kernel(1, 0, 0, 0) = 0.25f;
+    CHECK_EQ(xvigra::collectNonZeroTaps<int>(kernel).taps.size(), 3);
+    CHECK_EQ(xvigra::collectNonZeroTaps<double>(kernel).taps.size(), 4);
+
+    xt::xtensor<float, 4> denseKernel = xt::ones<float>({2, 2, 3, 3});
+    CHECK_FALSE(xvigra::collectNonZeroTaps<float>(denseKernel).isSparse(xvigra::ChannelPosition::FIRST));
+}
+
+
+TEST_CASE_TEMPLATE("Convolve2D: Test Sparse Kernel", T, TYPE_PAIRS) {
+    using InputType = typename T::first_type;
+    using KernelType = typename T::second_type;
+
+    // ring of 4 taps in a 5x5 kernel, so that only 16% of the taps are non-zero
+    xt::xtensor<KernelType, 4> kernel = xt::zeros<KernelType>({4, 3, 5, 5});
+    for (std::size_t outputChannel = 0; outputChannel < 4; ++outputChannel) {
+        for (std::size_t inputChannel = 0; inputChannel < 3; ++inputChannel) {
+            KernelType weight = static_cast<KernelType>(static_cast<int>(outputChannel + inputChannel) - 2);
+            kernel(outputChannel, inputChannel, 0, 2) = weight;
+            kernel(outputChannel, inputChannel, 4, 2) = -weight;
+            kernel(outputChannel, inputChannel, 2, 0) = static_cast<KernelType>(0.5);
+            kernel(outputChannel, inputChannel, 2, 4) = static_cast<KernelType>(-1.5);
+        }
+    }
+    REQUIRE(xvigra::collectNonZeroTaps<KernelType>(kernel).isSparse(xvigra::ChannelPosition::FIRST));
+
+    for (xvigra::ChannelPosition channelPosition : {xvigra::ChannelPosition::FIRST, xvigra::ChannelPosition::LAST}) {
+        CAPTURE(channelPosition);
+        bool isChannelFirst = channelPosition == xvigra::ChannelPosition::FIRST;
+
+        xt::xtensor<InputType, 3> input = isChannelFirst
+            ? xt::xtensor<InputType, 3>(xt::zeros<InputType>({3, 11, 14}))
+            : xt::xtensor<InputType, 3>(xt::zeros<InputType>({11, 14, 3}));
+        fillWithPattern(input, 13, 1.0, -6.0);
+
+        xvigra::KernelOptions optionsY;
+        xvigra::KernelOptions optionsX;
+        optionsY.setChannelPosition(channelPosition);
+        optionsX.setChannelPosition(channelPosition);
+
+        SUBCASE("Padding") {
+            optionsY.setPadding(2);
+            optionsX.setPadding(2);
+        }
+
+        SUBCASE("Stride And Dilation") {
+            optionsY.setPadding(3);
+            optionsY.setStride(2);
+            optionsX.setPadding(4);
+            optionsX.setDilation(2);
+        }
+
+        SUBCASE("Border Treatments") {
+            optionsY.setPadding(2);
+            optionsY.setBorderTreatment(xvigra::BorderTreatment::constant(3));
+            optionsX.setPadding(2);
+            optionsX.setBorderTreatment(xvigra::BorderTreatment::wrap(), xvigra::BorderTreatment::constant(-2));
+        }
+
+        SUBCASE("Threads") {
+            optionsY.setPadding(2);
+            optionsY.setThreadCount(3);
+            optionsX.setPadding(1);
+        }
+
+        xvigra::KernelOptions directOptionsY = optionsY;
+        xvigra::KernelOptions directOptionsX = optionsX;
+        directOptionsY.setAlgorithm(xvigra::Algorithm::DIRECT);
+        directOptionsX.setAlgorithm(xvigra::Algorithm::DIRECT);
+        auto expected = xvigra::convolve2D(input, kernel, directOptionsY, directOptionsX);
+
+        // an explicit Algorithm::GEMM builds the patch, Algorithm::AUTO may only gather the non-zero taps instead
+        checkExpressions(xvigra::convolve2D(input, kernel, optionsY, optionsX), expected, ALGORITHM_EPSILON);
+
+        xvigra::KernelOptions autoOptionsY = optionsY;
+        xvigra::KernelOptions autoOptionsX = optionsX;
+        autoOptionsY.setAlgorithm(xvigra::Algorithm::AUTO);
+        autoOptionsX.setAlgorithm(xvigra::Algorithm::AUTO);
+        checkExpressions(xvigra::convolve2D(input, kernel, autoOptionsY, autoOptionsX), expected, ALGORITHM_EPSILON);
+
+        // the sparse backend also handles dense kernels
+        xt::xtensor<KernelType, 4> denseKernel = xt::zeros<KernelType>({4, 3, 5, 5});
+        fillWithPattern(denseKernel, 7, 0.5, -1.5);
+        auto denseExpected = xvigra::convolve2D(input, denseKernel, directOptionsY, directOptionsX);
+
+        using ResultType = std::common_type_t<InputType, KernelType>;
+        auto sparseKernel = xvigra::collectNonZeroTaps<ResultType>(denseKernel);
+        xt::xtensor<ResultType, 3> sparseResult(denseExpected.shape());
+        xvigra::sparseConvolve2D<ResultType, InputType>(input, sparseKernel, optionsY, optionsX, xvigra::Epilogue(), sparseResult);
+        checkExpressions(sparseResult, denseExpected, ALGORITHM_EPSILON);
+
+        // a tiny workspace limit accumulates every output row in a tile of its own
+        xvigra::KernelOptions tiledOptionsY = optionsY;
+        tiledOptionsY.setWorkspaceLimit(1);
+        sparseResult.fill(0);
+        xvigra::sparseConvolve2D<ResultType, InputType>(input, sparseKernel, tiledOptionsY, optionsX, xvigra::Epilogue(), sparseResult);
+        checkExpressions(sparseResult, denseExpected, ALGORITHM_EPSILON);
+    }
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test sparse kernel - end                                                                                         ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test kernel symmetry - begin                                                                                     ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+TEST_CASE_TEMPLATE("Convolve1D: Test Kernel Symmetry", T, TYPE_PAIRS) {
+    using InputType = typename T::first_type;
+    using KernelType = typename T::second_type;
+
+    std::vector<xt::xtensor<KernelType, 1>> kernels{
+        {0.25, 0.5, 1.0, 0.5, 0.25},
+        {0.5, -1.0, -1.0, 0.5},
+        {-0.5, -1.0, 0.0, 1.0, 0.5},
+        {-1.0, 0.5, -0.5, 1.0}
+    };
+
+    for (xvigra::ChannelPosition channelPosition : {xvigra::ChannelPosition::FIRST, xvigra::ChannelPosition::LAST}) {
+        CAPTURE(channelPosition);
+        bool isChannelFirst = channelPosition == xvigra::ChannelPosition::FIRST;
+
+        xt::xtensor<InputType, 2> input = isChannelFirst
+            ? xt::xtensor<InputType, 2>(xt::zeros<InputType>({3, 23}))
+            : xt::xtensor<InputType, 2>(xt::zeros<InputType>({23, 3}));
+        fillWithPattern(input, 13, 1.0, -6.0);
+
+        xvigra::KernelOptions options;
+        options.setChannelPosition(channelPosition);
+
+        SUBCASE("Padding") {
+            options.setPadding(4);
+        }
+
+        SUBCASE("Reflect Border Treatments") {
+            options.setPadding(3);
+            options.setBorderTreatment(xvigra::BorderTreatment::asymmetricReflect(), xvigra::BorderTreatment::symmetricReflect());
+        }
+
+        SUBCASE("Other Border Treatments") {
+            options.setPadding(3);
+            options.setBorderTreatment(xvigra::BorderTreatment::constant(2), xvigra::BorderTreatment::wrap());
+        }
+
+        SUBCASE("Stride And Dilation") {
+            options.setPadding(5);
+            options.setStride(2);
+            options.setDilation(2);
+            options.setBorderTreatment(xvigra::BorderTreatment::symmetricReflect(), xvigra::BorderTreatment::repeat());
+        }
+
+        SUBCASE("Thread Count") {
+            options.setPadding(3);
+            options.setThreadCount(3);
+        }
+
+        for (const auto& kernel : kernels) {
+            CAPTURE(kernel);
+            REQUIRE_NE(xvigra::detectKernelSymmetry(kernel), xvigra::KernelSymmetry::NONE);
+
+            // the promoted diagonal kernel is never folded
+            xt::xtensor<KernelType, 3> fullKernel = xvigra::promoteKernelToFull1D(kernel, 3);
+            auto expected = xvigra::convolve1D(input, fullKernel, options);
+
+            for (xvigra::Algorithm algorithm : {xvigra::Algorithm::GEMM, xvigra::Algorithm::DIRECT, xvigra::Algorithm::AUTO}) {
+                CAPTURE(algorithm);
+                xvigra::KernelOptions symmetricOptions = options;
+                symmetricOptions.setAlgorithm(algorithm);
+
+                checkExpressions(xvigra::convolve1D(input, kernel, symmetricOptions), expected, ALGORITHM_EPSILON);
+
+                symmetricOptions.setKernelSymmetry(xvigra::KernelSymmetry::NONE);
+                checkExpressions(xvigra::convolve1D(input, kernel, symmetricOptions), expected, ALGORITHM_EPSILON);
+            }
+        }
+
+        // a declared symmetry is checked against the taps, so a wrong declaration is rejected instead of folded
+        xt::xtensor<KernelType, 1> declaredKernel{-0.5, -1.0, 7.0, 1.0, 0.5};
+        xvigra::KernelOptions declaredOptions = options;
+        declaredOptions.setAlgorithm(xvigra::Algorithm::DIRECT);
+        declaredOptions.setKernelSymmetry(xvigra::KernelSymmetry::ANTISYMMETRIC);
+
+        checkExpressions(
+            xvigra::convolve1D(input, kernels[2], declaredOptions),
+            xvigra::convolve1D(input, xvigra::promoteKernelToFull1D(kernels[2], 3), options),
+            ALGORITHM_EPSILON
+        );
+        CHECK_THROWS_WITH_AS(
+            xvigra::convolve1D(input, declaredKernel, declaredOptions),
+            "resolveKernelSymmetry(): Kernel taps don't have the declared symmetry!",
+            std::invalid_argument
+        );
+
+        // an explicit GEMM runs as requested, so a declared symmetry is neither folded nor checked
+        xvigra::KernelOptions gemmOptions = declaredOptions;
+        gemmOptions.setAlgorithm(xvigra::Algorithm::GEMM);
+
+        checkExpressions(
+            xvigra::convolve1D(input, declaredKernel, gemmOptions),
+            xvigra::convolve1D(input, xvigra::promoteKernelToFull1D(declaredKernel, 3), options),
+            ALGORITHM_EPSILON
+        );
+    }
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test kernel symmetry - end                                                                                       ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test pointwise kernel - begin                                                                                    ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+TEST_CASE_TEMPLATE("Convolve2D: Test Pointwise Kernel", T, TYPE_PAIRS) {
+    using InputType = typename T::first_type;
+    using KernelType = typename T::second_type;
+    using ResultType = std::common_type_t<InputType, KernelType>;
+
+    // channel mixing with 5 output channels and a sparse colour matrix, the pointwise product precedes the sparse backend
+    xt::xtensor<KernelType, 4> mixingKernel = xt::zeros<KernelType>({5, 3, 1, 1});
+    fillWithPattern(mixingKernel, 7, 0.25, -0.5);
+    xt::xtensor<KernelType, 4> colourKernel = xt::zeros<KernelType>({3, 3, 1, 1});
+    colourKernel(0, 0, 0, 0) = static_cast<KernelType>(1.0);
+    colourKernel(2, 0, 0, 0) = static_cast<KernelType>(-0.25);
+
+    for (xvigra::ChannelPosition channelPosition : {xvigra::ChannelPosition::FIRST, xvigra::ChannelPosition::LAST}) {
+        CAPTURE(channelPosition);
+        bool isChannelFirst = channelPosition == xvigra::ChannelPosition::FIRST;
+
+        xt::xtensor<InputType, 3> input = isChannelFirst
+            ? xt::xtensor<InputType, 3>(xt::zeros<InputType>({3, 13, 17}))
+            : xt::xtensor<InputType, 3>(xt::zeros<InputType>({13, 17, 3}));
+        fillWithPattern(input, 23, 1.0, -11.0);
+
+        xvigra::KernelOptions2D options;
+        options.setChannelPosition(channelPosition);
+
+        SUBCASE("Single Thread") {
+            options.setThreadCount(1);
+        }
+
+        SUBCASE("Threads") {
+            options.setThreadCount(3);
+        }
+
+        SUBCASE("Dilation") {
+            options.setDilation(2);
+        }
+
+        REQUIRE(xvigra::isPointwise2D(1, 1, options.optionsY, options.optionsX));
+
+        xvigra::KernelOptions2D directOptions = options;
+        directOptions.setAlgorithm(xvigra::Algorithm::DIRECT);
+
+        for (const auto& kernel : {mixingKernel, colourKernel}) {
+            auto expected = xvigra::convolve2D(input, kernel, directOptions);
+
+            checkExpressions(xvigra::convolve2D(input, kernel, options), expected, ALGORITHM_EPSILON);
+
+            // views are evaluated once and then multiplied in place as well
+            auto inputView = xt::view(input, xt::all(), xt::all(), xt::all());
+            checkExpressions(xvigra::convolve2D(inputView, kernel, options), expected, ALGORITHM_EPSILON);
+        }
+
+        // the epilogue is applied to the product
+        xvigra::Epilogue epilogue;
+        epilogue.setBias({1.0, -2.0, 0.5, 0.0, 3.0});
+        epilogue.setClip(-4.0, 4.0);
+
+        xt::xtensor<ResultType, 3> expected;
+        xt::xtensor<ResultType, 3> actual;
+        xvigra::convolve2D(input, mixingKernel, directOptions.optionsY, directOptions.optionsX, epilogue, expected);
+        xvigra::convolve2D(input, mixingKernel, options.optionsY, options.optionsX, epilogue, actual);
+        checkExpressions(actual, expected, ALGORITHM_EPSILON);
+    }
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test pointwise kernel - end                                                                                      ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test quantized - begin                                                                                           ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+template <typename InputType, typename KernelType>
+void checkQuantizedConvolution2D(
+    const xt::xtensor<InputType, 3>& input,
+    const xt::xtensor<KernelType, 4>& kernel,
+    const xvigra::QuantizationParameters& inputParameters,
+    const xvigra::QuantizationParameters& kernelParameters,
+    const xvigra::KernelOptions2D& options
+) {
+    // the float reference convolves the real values which the quantized tensors represent
+    xt::xtensor<double, 3> realInput = xvigra::dequantize<double>(input, inputParameters);
+    xt::xtensor<double, 4> realKernel = xvigra::dequantize<double>(kernel, kernelParameters);
+    xt::xtensor<double, 3> reference = xvigra::convolve2D(realInput, realKernel, options);
+
+    auto realResult = xvigra::quantizedConvolve2D<double>(input, kernel, inputParameters, kernelParameters, options);
+    checkExpressions(realResult, reference, 1e-6);
+
+    double realScale = static_cast<double>(inputParameters.scale) * static_cast<double>(kernelParameters.scale);
+    auto accumulator = xvigra::quantizedConvolve2D<std::int32_t>(input, kernel, inputParameters, kernelParameters, options);
+    checkExpressions(xt::xtensor<double, 3>(xt::cast<double>(accumulator) * realScale), reference, 1e-6);
+
+    // requantization may only differ by one step where the reference lies on a rounding boundary
+    xvigra::QuantizationParameters outputParameters(0.1f, 100);
+    auto requantized = xvigra::quantizedConvolve2D<std::uint8_t>(input, kernel, inputParameters, kernelParameters, options, outputParameters);
+    auto expected = xvigra::quantize<std::uint8_t>(reference, outputParameters);
+
+    REQUIRE(requantized.shape() == expected.shape());
+    for (std::size_t index = 0; index < expected.size(); ++index) {
+        CHECK_LE(std::abs(static_cast<int>(requantized.flat(index)) - static_cast<int>(expected.flat(index))), 1);
+    }
+}
+
+
+TEST_CASE("Test quantize") {
+    xvigra::QuantizationParameters parameters(0.5f, 10);
+    xt::xtensor<float, 1> values{-100.0f, -1.2f, 0.0f, 0.74f, 1.0f, 200.0f};
+
+    auto quantized = xvigra::quantize<std::uint8_t>(values, parameters);
+    xt::xtensor<std::uint8_t, 1> expectedQuantized{0, 8, 10, 11, 12, 255};
+    CHECK(quantized == expectedQuantized);
+
+    auto dequantized = xvigra::dequantize(quantized, parameters);
+    xt::xtensor<float, 1> expectedDequantized{-5.0f, -1.0f, 0.0f, 0.5f, 1.0f, 122.5f};
+    checkExpressions(dequantized, expectedDequantized);
+}
+
+
+TEST_CASE_TEMPLATE("QuantizedConvolve2D: Test Accuracy", T, QUANTIZED_TYPE_PAIRS) {
+    using InputType = typename T::first_type;
+    using KernelType = typename T::second_type;
+
+    constexpr bool isSignedInput = std::is_signed_v<InputType>;
+    xvigra::QuantizationParameters inputParameters(0.02f, isSignedInput ? -5 : 120);
+    xvigra::QuantizationParameters kernelParameters(0.01f, 3);
+
+    xt::xtensor<InputType, 3> inputFirst = xt::empty<InputType>({3, 13, 11});
+    xt::xtensor<InputType, 3> inputLast = xt::empty<InputType>({13, 11, 3});
+    xt::xtensor<KernelType, 4> kernel = xt::empty<KernelType>({4, 3, 3, 3});
+    fillWithPattern(inputFirst, 241, 1.0, isSignedInput ? -120.0 : 0.0);
+    fillWithPattern(inputLast, 241, 1.0, isSignedInput ? -120.0 : 0.0);
+    fillWithPattern(kernel, 23, 1.0, -8.0);
+
+    xvigra::KernelOptions2D options;
+    options.setPadding(1);
+
+    SUBCASE("Channel First") {
+        options.setChannelPosition(xvigra::ChannelPosition::FIRST);
+        checkQuantizedConvolution2D(inputFirst, kernel, inputParameters, kernelParameters, options);
+    }
+
+    SUBCASE("Channel Last") {
+        options.setChannelPosition(xvigra::ChannelPosition::LAST);
+        checkQuantizedConvolution2D(inputLast, kernel, inputParameters, kernelParameters, options);
+    }
+
+    SUBCASE("Stride And Dilation") {
+        options.setPadding(2);
+        options.setStride(2, 1);
+        options.setDilation(1, 2);
+
+        for (xvigra::ChannelPosition position : {xvigra::ChannelPosition::FIRST, xvigra::ChannelPosition::LAST}) {
+            options.setChannelPosition(position);
+            const auto& input = position == xvigra::ChannelPosition::FIRST ? inputFirst : inputLast;
+            checkQuantizedConvolution2D(input, kernel, inputParameters, kernelParameters, options);
+        }
+    }
+
+    SUBCASE("Border Treatments") {
+        // 0.2 is a multiple of the input scale, so the quantized constant border is exact
+        for (const xvigra::BorderTreatment& treatment : {
+            xvigra::BorderTreatment::constant(0.2),
+            xvigra::BorderTreatment::asymmetricReflect(),
+            xvigra::BorderTreatment::symmetricReflect(),
+            xvigra::BorderTreatment::repeat(),
+            xvigra::BorderTreatment::wrap(),
+            xvigra::BorderTreatment::avoid()
+        }) {
+            options.setBorderTreatment(treatment);
+
+            for (xvigra::ChannelPosition position : {xvigra::ChannelPosition::FIRST, xvigra::ChannelPosition::LAST}) {
+                options.setChannelPosition(position);
+                const auto& input = position == xvigra::ChannelPosition::FIRST ? inputFirst : inputLast;
+                checkQuantizedConvolution2D(input, kernel, inputParameters, kernelParameters, options);
+            }
+        }
+    }
+
+    SUBCASE("Tiles And Threads") {
+        options.setWorkspaceLimit(3 * 3 * 3 * 11 * sizeof(std::int16_t) * 4);
+        options.setThreadCount(3);
+
+        for (xvigra::ChannelPosition position : {xvigra::ChannelPosition::FIRST, xvigra::ChannelPosition::LAST}) {
+            options.setChannelPosition(position);
+            const auto& input = position == xvigra::ChannelPosition::FIRST ? inputFirst : inputLast;
+            checkQuantizedConvolution2D(input, kernel, inputParameters, kernelParameters, options);
+        }
+    }
+
+    SUBCASE("Depthwise Kernel") {
+        // the kernel zero point must not leak into the zeros of the promoted diagonal kernel
+        xt::xtensor<KernelType, 2> depthwiseKernel = xt::view(kernel, 0, 0, xt::all(), xt::all());
+        xt::xtensor<KernelType, 4> fullKernel = xvigra::quantize<KernelType>(
+            xvigra::promoteKernelToFull2D(xvigra::dequantize<double>(depthwiseKernel, kernelParameters), 3),
+            kernelParameters
+        );
+        options.setChannelPosition(xvigra::ChannelPosition::LAST);
+
+        auto expected = xvigra::quantizedConvolve2D<std::int32_t>(inputLast, fullKernel, inputParameters, kernelParameters, options);
+        auto actual = xvigra::quantizedConvolve2D<std::int32_t>(inputLast, depthwiseKernel, inputParameters, kernelParameters, options);
+        CHECK(actual == expected);
+    }
+}
+
+
+TEST_CASE("QuantizedConvolve2D: Test Invalid Arguments") {
+    xt::xtensor<std::uint8_t, 3> input = xt::zeros<std::uint8_t>({6, 6, 2});
+    xt::xtensor<std::int8_t, 4> kernel = xt::zeros<std::int8_t>({2, 2, 3, 3});
+    xvigra::QuantizationParameters parameters(0.1f, 0);
+    xvigra::KernelOptions2D options;
+
+    SUBCASE("Groups") {
+        options.setGroups(2);
+        CHECK_THROWS_WITH_AS(
+            xvigra::quantizedConvolve2D(input, kernel, parameters, parameters, options),
+            "quantizedConvolve2D(): Groups are not supported!",
+            std::invalid_argument
+        );
+    }
+
+    SUBCASE("1D Kernel") {
+        xt::xtensor<std::int8_t, 1> kernel1D = xt::zeros<std::int8_t>({3});
+        CHECK_THROWS_WITH_AS(
+            xvigra::quantizedConvolve2D(input, kernel1D, parameters, parameters, options),
+            "quantizedConvolve2D(): Need 2, 3 or 4 dimensional kernel!",
+            std::invalid_argument
+        );
+    }
+
+    SUBCASE("Quantization Parameters") {
+        CHECK_THROWS_WITH_AS(
+            xvigra::quantizedConvolve2D(input, kernel, xvigra::QuantizationParameters(0.1f, 256), parameters, options),
+            "quantizedConvolve2D(): Zero point of the input is out of range!",
+            std::invalid_argument
+        );
+        CHECK_THROWS_WITH_AS(
+            xvigra::quantizedConvolve2D(input, kernel, parameters, xvigra::QuantizationParameters(0.1f, -129), options),
+            "quantizedConvolve2D(): Zero point of the kernel is out of range!",
+            std::invalid_argument
+        );
+        CHECK_THROWS_WITH_AS(
+            xvigra::quantizedConvolve2D(input, kernel, xvigra::QuantizationParameters(0.0f, 0), parameters, options),
+            "quantizedConvolve2D(): Scale of the input must be positive!",
+            std::invalid_argument
+        );
+        CHECK_THROWS_WITH_AS(
+            xvigra::quantizedConvolve2D<std::uint8_t>(input, kernel, parameters, parameters, options, xvigra::QuantizationParameters(0.1f, -1)),
+            "quantizedConvolve2D(): Zero point of the output is out of range!",
+            std::invalid_argument
+        );
+    }
+
+    SUBCASE("Reduction Depth") {
+        // 3701 * 3 * 3 products of up to 255 * 255 exceed std::int32_t
+        xt::xtensor<std::uint8_t, 3> deepInput = xt::zeros<std::uint8_t>({3, 3, 3701});
+        xt::xtensor<std::int8_t, 4> deepKernel = xt::zeros<std::int8_t>({1, 3701, 3, 3});
+        CHECK_THROWS_WITH_AS(
+            xvigra::quantizedConvolve2D(deepInput, deepKernel, parameters, parameters, options),
+            "quantizedConvolve2D(): Reduction depth would overflow the 32 bit accumulator!",
+            std::invalid_argument
+        );
+    }
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test quantized - end                                                                                             ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
@@ -0,0 +1,193 @@
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#define DOCTEST_CONFIG_SUPER_FAST_ASSERTS
+#include "doctest/doctest.h"
+
+#ifdef VOID
+#undef VOID
+#endif
+
+#include "xvigra/fft.hpp"
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ constexpr - begin                                                                                                ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+constexpr double FFT_EPSILON = 1e-10;
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ constexpr - end                                                                                                  ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ utility - begin                                                                                                  ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+std::vector<double> createPattern(std::size_t size) {
+    std::vector<double> result(size);
+
+    for (std::size_t index = 0; index < size; ++index) {
+        result[index] = static_cast<double>((index * 7) % 11) - 5.0;
+    }
+
+    return result;
+}
+
+
+std::complex<double> naiveDFT2D(
+    const std::vector<double>& image,
+    std::size_t height,
+    std::size_t width,
+    std::size_t frequencyY,
+    std::size_t frequencyX
+) {
+    const double pi = std::acos(-1.0);
+    std::complex<double> result(0.0, 0.0);
+
+    for (std::size_t y = 0; y < height; ++y) {
+        for (std::size_t x = 0; x < width; ++x) {
+            double angle = -2.0 * pi * (
+                static_cast<double>(frequencyY * y) / static_cast<double>(height)
+                + static_cast<double>(frequencyX * x) / static_cast<double>(width)
+            );
+            result += image[y * width + x] * std::polar(1.0, angle);
+        }
+    }
+
+    return result;
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ utility - end                                                                                                    ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test FFT1D - begin                                                                                               ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+TEST_CASE("Test nextPowerOfTwo") {
+    CHECK_EQ(xvigra::nextPowerOfTwo(0), 1);
+    CHECK_EQ(xvigra::nextPowerOfTwo(1), 1);
+    CHECK_EQ(xvigra::nextPowerOfTwo(2), 2);
+    CHECK_EQ(xvigra::nextPowerOfTwo(3), 4);
+    CHECK_EQ(xvigra::nextPowerOfTwo(17), 32);
+    CHECK_EQ(xvigra::nextPowerOfTwo(64), 64);
+}
+
+
+TEST_CASE("FFT1D: Test Transform") {
+    SUBCASE("Impulse") {
+        xvigra::FFT1D transform(8);
+        std::vector<std::complex<double>> data(8, std::complex<double>(0.0, 0.0));
+        data[0] = 1.0;
+
+        transform.transform(data.data(), false);
+
+        for (const auto& value : data) {
+            CHECK_EQ(value.real(), doctest::Approx(1.0).epsilon(FFT_EPSILON));
+            CHECK_EQ(value.imag(), doctest::Approx(0.0).epsilon(FFT_EPSILON));
+        }
+    }
+
+    SUBCASE("Round Trip") {
+        xvigra::FFT1D transform(16);
+        std::vector<double> pattern = createPattern(16);
+        std::vector<std::complex<double>> data(pattern.begin(), pattern.end());
+
+        transform.transform(data.data(), false);
+        transform.transform(data.data(), true);
+
+        for (std::size_t index = 0; index < data.size(); ++index) {
+            CHECK_EQ(data[index].real() / 16.0, doctest::Approx(pattern[index]).epsilon(FFT_EPSILON));
+            CHECK_EQ(data[index].imag() / 16.0, doctest::Approx(0.0).epsilon(FFT_EPSILON));
+        }
+    }
+
+    SUBCASE("Invalid Size") {
+        CHECK_THROWS_WITH_AS(
+            xvigra::FFT1D(12),
+            "FFT1D(): Size has to be a power of two!",
+            std::invalid_argument
+        );
+    }
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test FFT1D - end                                                                                                 ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test RealFFT2D - begin                                                                                           ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+TEST_CASE("RealFFT2D: Test Against Naive DFT") {
+    for (const auto& shape : std::vector<std::pair<std::size_t, std::size_t>>{{1, 2}, {1, 8}, {4, 8}, {8, 4}, {16, 16}}) {
+        std::size_t height = shape.first;
+        std::size_t width = shape.second;
+
+        xvigra::RealFFT2D transform(height, width);
+        REQUIRE_EQ(transform.getSpectrumWidth(), width / 2 + 1);
+
+        std::vector<double> image = createPattern(height * width);
+        std::vector<std::complex<double>> spectrum(height * transform.getSpectrumWidth());
+        transform.forward(image.data(), spectrum.data());
+
+        for (std::size_t frequencyY = 0; frequencyY < height; ++frequencyY) {
+            for (std::size_t frequencyX = 0; frequencyX < transform.getSpectrumWidth(); ++frequencyX) {
+                std::complex<double> expected = naiveDFT2D(image, height, width, frequencyY, frequencyX);
+                std::complex<double> actual = spectrum[frequencyY * transform.getSpectrumWidth() + frequencyX];
+
+                CHECK_EQ(actual.real(), doctest::Approx(expected.real()).epsilon(FFT_EPSILON));
+                CHECK_EQ(actual.imag(), doctest::Approx(expected.imag()).epsilon(FFT_EPSILON));
+            }
+        }
+    }
+}
+
+
+TEST_CASE("RealFFT2D: Test Round Trip") {
+    for (const auto& shape : std::vector<std::pair<std::size_t, std::size_t>>{{1, 2}, {2, 4}, {8, 16}, {32, 8}}) {
+        std::size_t height = shape.first;
+        std::size_t width = shape.second;
+
+        xvigra::RealFFT2D transform(height, width);
+
+        std::vector<double> image = createPattern(height * width);
+        std::vector<std::complex<double>> spectrum(height * transform.getSpectrumWidth());
+        std::vector<double> restored(height * width);
+
+        transform.forward(image.data(), spectrum.data());
+        transform.inverse(spectrum.data(), restored.data());
+
+        for (std::size_t index = 0; index < image.size(); ++index) {
+            CHECK_EQ(restored[index], doctest::Approx(image[index]).epsilon(FFT_EPSILON));
+        }
+    }
+}
+
+
+TEST_CASE("RealFFT2D: Test Invalid Configurations") {
+    CHECK_THROWS_WITH_AS(
+        xvigra::RealFFT2D(4, 1),
+        "RealFFT2D(): Width has to be at least 2!",
+        std::invalid_argument
+    );
+
+    CHECK_THROWS_WITH_AS(
+        xvigra::RealFFT2D(6, 8),
+        "FFT1D(): Size has to be a power of two!",
+        std::invalid_argument
+    );
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test RealFFT2D - end                                                                                             ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
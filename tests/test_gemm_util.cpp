@@ -0,0 +1,310 @@
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#define DOCTEST_CONFIG_SUPER_FAST_ASSERTS
+#include "doctest/doctest.h"
+
+#ifdef VOID
+#undef VOID
+#endif
+
+#include "xtensor/xadapt.hpp"
+#include "xtensor/xbuilder.hpp"
+#include "xtensor/xmanipulation.hpp"
+#include "xtensor/xtensor.hpp"
+#include "xtensor/xview.hpp"
+
+#include "xtensor-blas/xlinalg.hpp"
+
+#include "xvigra/convolution_util.hpp"
+#include "xvigra/explicit_convolution.hpp"
+#include "xvigra/gemm_util.hpp"
+
+#include "test_util.hpp"
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ define - begin                                                                                                   ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+#define TYPE_PAIRS              \
+    std::pair<short, float>,    \
+    std::pair<short, double>,   \
+    std::pair<int, float>,      \
+    std::pair<int, double>
+
+TYPE_TO_STRING(std::pair<short, float>);
+TYPE_TO_STRING(std::pair<short, double>);
+TYPE_TO_STRING(std::pair<int, float>);
+TYPE_TO_STRING(std::pair<int, double>);
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ define - end                                                                                                     ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ utility - begin                                                                                                  ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+template <typename A, typename B>
+void checkApproxEqual(const A& actual, const B& expected) {
+    REQUIRE_EQ(actual.shape(), expected.shape());
+
+    for (std::size_t index = 0; index < actual.size(); ++index) {
+        CHECK_EQ(static_cast<double>(actual.flat(index)), doctest::Approx(static_cast<double>(expected.flat(index))).epsilon(1e-4));
+    }
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ utility - end                                                                                                    ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test Small Gemm - begin                                                                                          ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+TEST_CASE("GemmUtil: Test isSmallGemm") {
+    CHECK(xvigra::isSmallGemm(1, 4096, 16));
+    CHECK(xvigra::isSmallGemm(4096, 1, 16));
+    CHECK(xvigra::isSmallGemm(xvigra::SMALL_GEMM_LIMIT, xvigra::SMALL_GEMM_WORK_LIMIT / xvigra::SMALL_GEMM_LIMIT, 1));
+    CHECK_FALSE(xvigra::isSmallGemm(xvigra::SMALL_GEMM_LIMIT + 1, xvigra::SMALL_GEMM_LIMIT + 1, 1));
+
+    // a skinny product with a lot of work goes to BLAS
+    CHECK_FALSE(xvigra::isSmallGemm(1, 100000, 21));
+    CHECK_FALSE(xvigra::isSmallGemm(xvigra::SMALL_GEMM_LIMIT, xvigra::SMALL_GEMM_WORK_LIMIT / xvigra::SMALL_GEMM_LIMIT, 2));
+}
+
+
+TEST_CASE_TEMPLATE("GemmUtil: Test smallGemm", T, float, double) {
+    // every combination of full register blocks and row / column tails
+    for (std::size_t rows : {1, 2, 3, 4, 5, 7, 8, 13}) {
+        for (std::size_t columns : {1, 3, 8, 9, 15, 40}) {
+            for (std::size_t depth : {1, 5, 27}) {
+                CAPTURE(rows);
+                CAPTURE(columns);
+                CAPTURE(depth);
+
+                xt::xtensor<T, 2> left = xt::zeros<T>({rows, depth});
+                xt::xtensor<T, 2> right = xt::zeros<T>({depth, columns});
+                fillWithPattern(left, 11, 0.5, -2.0);
+                fillWithPattern(right, 13, 0.25, -1.5);
+
+                xt::xtensor<T, 2> expected = xt::linalg::dot(left, right);
+
+                xt::xtensor<T, 2> actual = xt::zeros<T>({rows, columns});
+                xvigra::smallGemm(
+                    static_cast<int>(rows), static_cast<int>(columns), static_cast<int>(depth),
+                    left.data(), static_cast<std::ptrdiff_t>(depth), 1,
+                    right.data(), static_cast<std::ptrdiff_t>(columns), 1,
+                    actual.data(), static_cast<std::ptrdiff_t>(columns)
+                );
+                checkApproxEqual(actual, expected);
+
+                // the transposed right matrix is addressed by swapping its strides
+                xt::xtensor<T, 2> rightTransposed = xt::transpose(right);
+                xvigra::smallGemm(
+                    static_cast<int>(rows), static_cast<int>(columns), static_cast<int>(depth),
+                    left.data(), static_cast<std::ptrdiff_t>(depth), 1,
+                    rightTransposed.data(), 1, static_cast<std::ptrdiff_t>(depth),
+                    actual.data(), static_cast<std::ptrdiff_t>(columns)
+                );
+                checkApproxEqual(actual, expected);
+            }
+        }
+    }
+}
+
+
+TEST_CASE_TEMPLATE("GemmUtil: Test matrixProduct", T, float, double) {
+    xt::xtensor<T, 2> left = xt::zeros<T>({3, 50});
+    xt::xtensor<T, 2> right = xt::zeros<T>({50, 70});
+    fillWithPattern(left, 11, 0.5, -2.0);
+    fillWithPattern(right, 13, 0.25, -1.5);
+
+    xt::xtensor<T, 2> expected = xt::linalg::dot(left, right);
+
+    SUBCASE("Few Rows") {
+        for (int threadCount : {1, 3, 0}) {
+            CAPTURE(threadCount);
+            checkApproxEqual(xvigra::matrixProduct(left, right, threadCount), expected);
+        }
+    }
+
+    SUBCASE("Few Columns") {
+        xt::xtensor<T, 2> expectedTransposed = xt::transpose(expected);
+
+        for (int threadCount : {1, 3, 0}) {
+            CAPTURE(threadCount);
+            checkApproxEqual(xvigra::matrixProduct(xt::transpose(right), xt::transpose(left), threadCount), expectedTransposed);
+        }
+    }
+
+    SUBCASE("Single Row") {
+        xt::xtensor<T, 2> rowLeft = xt::view(left, xt::range(0, 1), xt::all());
+        xt::xtensor<T, 2> rowExpected = xt::view(expected, xt::range(0, 1), xt::all());
+        xt::xtensor<T, 2> columnExpected = xt::transpose(rowExpected);
+
+        for (int threadCount : {1, 3, 0}) {
+            CAPTURE(threadCount);
+            checkApproxEqual(xvigra::matrixProduct(rowLeft, right, threadCount), rowExpected);
+            checkApproxEqual(xvigra::matrixProduct(xt::transpose(right), xt::transpose(rowLeft), threadCount), columnExpected);
+        }
+    }
+
+    SUBCASE("Reshaped View") {
+        auto reshapedLeft = xt::reshape_view(left, {3, 50});
+        checkApproxEqual(xvigra::matrixProduct(reshapedLeft, right), expected);
+    }
+
+    SUBCASE("Mixed Types") {
+        xt::xtensor<double, 2> rightDouble = right;
+        auto actual = xvigra::matrixProduct(left, rightDouble);
+
+        CHECK(std::is_same_v<typename decltype(actual)::value_type, double>);
+        checkApproxEqual(actual, expected);
+    }
+
+    SUBCASE("Large Product") {
+        xt::xtensor<T, 2> largeLeft = xt::zeros<T>({20, 50});
+        fillWithPattern(largeLeft, 11, 0.5, -2.0);
+
+        checkApproxEqual(xvigra::matrixProduct(largeLeft, right), xt::xtensor<T, 2>(xt::linalg::dot(largeLeft, right)));
+    }
+
+    SUBCASE("Into Product") {
+        for (std::size_t rows : {1, 3, 20}) {
+            CAPTURE(rows);
+            xt::xtensor<T, 2> rowsLeft = xt::zeros<T>({rows, std::size_t(50)});
+            fillWithPattern(rowsLeft, 11, 0.5, -2.0);
+            xt::xtensor<T, 2> rowsExpected = xt::linalg::dot(rowsLeft, right);
+
+            std::vector<T> buffer(rows * 70, static_cast<T>(-1));
+            auto product = xt::adapt(buffer.data(), buffer.size(), xt::no_ownership(), std::array<std::size_t, 2>{rows, 70});
+
+            for (int threadCount : {1, 3}) {
+                CAPTURE(threadCount);
+                xvigra::matrixProduct(rowsLeft, right, product, threadCount);
+                checkApproxEqual(product, rowsExpected);
+            }
+        }
+
+        xt::xtensor<T, 4> outputs = xt::zeros<T>({2, 1, 3, 70});
+        auto productView = xt::view(outputs, 1, 0, xt::all(), xt::all());
+        xvigra::matrixProduct(left, right, productView);
+        checkApproxEqual(xt::xtensor<T, 2>(productView), expected);
+        xt::xtensor<T, 3> untouched = xt::view(outputs, 0, xt::all(), xt::all(), xt::all());
+        CHECK(untouched == xt::zeros<T>({1, 3, 70}));
+    }
+
+    SUBCASE("Invalid Shapes") {
+        CHECK_THROWS_WITH_AS(
+            xvigra::matrixProduct(left, left),
+            "matrixProduct(): Inner dimensions of the matrices do not match!",
+            std::invalid_argument
+        );
+
+        xt::xtensor<T, 2> product = xt::zeros<T>({3, 69});
+        CHECK_THROWS_WITH_AS(
+            xvigra::matrixProduct(left, right, product),
+            "matrixProduct(): Product does not have the shape of the result!",
+            std::invalid_argument
+        );
+    }
+}
+
+
+TEST_CASE("GemmUtil: Test Integer matrixProduct") {
+    // BLAS has no integer products, so products of every size are computed by xvigra::smallGemm in place
+    xt::xtensor<int, 2> left = xt::zeros<int>({20, 50});
+    xt::xtensor<int, 2> right = xt::zeros<int>({50, 70});
+    fillWithPattern(left, 11, 1.0, -5.0);
+    fillWithPattern(right, 13, 1.0, -6.0);
+
+    xt::xtensor<int, 2> expected = xt::zeros<int>({20, 70});
+    for (std::size_t row = 0; row < 20; ++row) {
+        for (std::size_t column = 0; column < 70; ++column) {
+            for (std::size_t index = 0; index < 50; ++index) {
+                expected(row, column) += left(row, index) * right(index, column);
+            }
+        }
+    }
+
+    std::vector<int> buffer(20 * 70, -1);
+    auto product = xt::adapt(buffer.data(), buffer.size(), xt::no_ownership(), std::array<std::size_t, 2>{20, 70});
+
+    for (int threadCount : {1, 3}) {
+        CAPTURE(threadCount);
+        xvigra::matrixProduct(left, right, product, threadCount);
+        CHECK(product == expected);
+    }
+}
+
+
+TEST_CASE("GemmUtil: Test Threaded Integer matrixProduct") {
+    // 64 x 64 x 128 multiply-adds are enough for 4 threads of xvigra::SMALL_GEMM_THREAD_WORK
+    xt::xtensor<int, 2> left = xt::zeros<int>({64, 64});
+    xt::xtensor<int, 2> right = xt::zeros<int>({64, 128});
+    fillWithPattern(left, 11, 1.0, -5.0);
+    fillWithPattern(right, 13, 1.0, -6.0);
+
+    xt::xtensor<int, 2> expected = xt::zeros<int>({64, 128});
+    for (std::size_t row = 0; row < 64; ++row) {
+        for (std::size_t column = 0; column < 128; ++column) {
+            for (std::size_t index = 0; index < 64; ++index) {
+                expected(row, column) += left(row, index) * right(index, column);
+            }
+        }
+    }
+
+    for (int threadCount : {1, 3, 8, 0}) {
+        CAPTURE(threadCount);
+        CHECK(xvigra::matrixProduct(left, right, threadCount) == expected);
+        CHECK(xvigra::matrixProduct(xt::transpose(right), xt::transpose(left), threadCount) == xt::transpose(expected));
+    }
+}
+
+
+TEST_CASE_TEMPLATE("GemmUtil: Test Convolution With Few Output Channels", T, TYPE_PAIRS) {
+    using InputType = typename T::first_type;
+    using KernelType = typename T::second_type;
+
+    for (std::size_t outputChannels : {1, 2, 3}) {
+        CAPTURE(outputChannels);
+
+        xt::xtensor<KernelType, 3> kernel1D = xt::zeros<KernelType>({outputChannels, 2, 5});
+        fillWithPattern(kernel1D, 7, 0.25, -0.5);
+        xt::xtensor<KernelType, 4> kernel2D = xt::zeros<KernelType>({outputChannels, 2, 3, 3});
+        fillWithPattern(kernel2D, 7, 0.25, -0.5);
+
+        for (xvigra::ChannelPosition channelPosition : {xvigra::ChannelPosition::FIRST, xvigra::ChannelPosition::LAST}) {
+            CAPTURE(channelPosition);
+            bool isChannelFirst = channelPosition == xvigra::ChannelPosition::FIRST;
+
+            xvigra::KernelOptions options;
+            options.setPadding(2);
+            options.setChannelPosition(channelPosition);
+
+            xvigra::KernelOptions referenceOptions = options;
+            referenceOptions.setAlgorithm(xvigra::Algorithm::DIRECT);
+
+            xt::xtensor<InputType, 2> input1D = isChannelFirst ? xt::xtensor<InputType, 2>(xt::zeros<InputType>({2, 37})) : xt::xtensor<InputType, 2>(xt::zeros<InputType>({37, 2}));
+            fillWithPattern(input1D, 11, 1.0, -5.0);
+
+            checkApproxEqual(xvigra::convolve1D(input1D, kernel1D, options), xvigra::convolve1D(input1D, kernel1D, referenceOptions));
+
+            xt::xtensor<InputType, 3> input2D = isChannelFirst ? xt::xtensor<InputType, 3>(xt::zeros<InputType>({2, 9, 10})) : xt::xtensor<InputType, 3>(xt::zeros<InputType>({9, 10, 2}));
+            fillWithPattern(input2D, 23, 4.0, -20.0);
+
+            checkApproxEqual(xvigra::convolve2D(input2D, kernel2D, options, options), xvigra::convolve2D(input2D, kernel2D, referenceOptions, referenceOptions));
+        }
+    }
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test Small Gemm - end                                                                                            ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
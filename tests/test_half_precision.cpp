@@ -0,0 +1,313 @@
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#define DOCTEST_CONFIG_SUPER_FAST_ASSERTS
+#include "doctest/doctest.h"
+
+#ifdef VOID
+#undef VOID
+#endif
+
+#include "xtensor/xbuilder.hpp"
+#include "xtensor/xtensor.hpp"
+
+#include "xvigra/convolution.hpp"
+#include "xvigra/convolution_plan.hpp"
+#include "xvigra/convolution_util.hpp"
+#include "xvigra/explicit_convolution.hpp"
+#include "xvigra/half_precision.hpp"
+#include "xvigra/separable_convolution.hpp"
+
+#include "test_util.hpp"
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ define - begin                                                                                                   ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+#define HALF_TYPES          \
+    xvigra::Float16,        \
+    xvigra::BFloat16
+
+TYPE_TO_STRING(xvigra::Float16);
+TYPE_TO_STRING(xvigra::BFloat16);
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ define - end                                                                                                     ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ constexpr - begin                                                                                                ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+// distance between 1 and the next representable value, every rounding to nearest is off by at most half of it
+template <typename T>
+constexpr double HALF_EPSILON = std::is_same_v<T, xvigra::Float16> ? 1.0 / 1024.0 : 1.0 / 128.0;
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ constexpr - end                                                                                                  ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ utility - begin                                                                                                  ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+template <typename T, typename O>
+void checkExpressions(
+    const xt::xexpression<T>& actualExpression,
+    const xt::xexpression<O>& expectedExpression,
+    double epsilon
+) {
+    auto actual = actualExpression.derived_cast();
+    auto expected = expectedExpression.derived_cast();
+
+    REQUIRE_EQ(actual.dimension(), expected.dimension());
+    for (std::size_t axis = 0; axis < expected.dimension(); ++axis) {
+        REQUIRE_EQ(actual.shape()[axis], expected.shape()[axis]);
+    }
+
+    auto iterActual = actual.begin();
+    auto iterExpected = expected.begin();
+    auto endExpected = expected.end();
+
+    for (; iterExpected != endExpected; ++iterActual, ++iterExpected) {
+        CHECK_EQ(static_cast<double>(*iterActual), doctest::Approx(static_cast<double>(*iterExpected)).epsilon(epsilon));
+    }
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ utility - end                                                                                                    ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test conversion - begin                                                                                          ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+TEST_CASE("Float16: Test Conversion") {
+    SUBCASE("Exact values") {
+        CHECK_EQ(xvigra::Float16(1.0f).getBits(), 0x3c00u);
+        CHECK_EQ(xvigra::Float16(-2.0f).getBits(), 0xc000u);
+        CHECK_EQ(xvigra::Float16(0.0f).getBits(), 0x0000u);
+        CHECK_EQ(xvigra::Float16(-0.0f).getBits(), 0x8000u);
+        CHECK_EQ(xvigra::Float16(65504.0f).getBits(), 0x7bffu);
+        CHECK_EQ(xvigra::Float16(std::ldexp(1.0f, -14)).getBits(), 0x0400u);
+        CHECK_EQ(xvigra::Float16(std::ldexp(1.0f, -24)).getBits(), 0x0001u);
+    }
+
+    SUBCASE("Round to nearest even") {
+        // 1 + 2^-11 lies between 1 and 1 + 2^-10 and rounds to the even 1, 1 + 3 * 2^-11 rounds up to 1 + 2^-9
+        CHECK_EQ(xvigra::Float16(1.0f + std::ldexp(1.0f, -11)).getBits(), 0x3c00u);
+        CHECK_EQ(xvigra::Float16(1.0f + 3.0f * std::ldexp(1.0f, -11)).getBits(), 0x3c02u);
+        CHECK_EQ(xvigra::Float16(std::ldexp(1.0f, -25)).getBits(), 0x0000u);
+        CHECK_EQ(xvigra::Float16(std::ldexp(3.0f, -25)).getBits(), 0x0002u);
+    }
+
+    SUBCASE("Overflow, infinity and NaN") {
+        CHECK_EQ(xvigra::Float16(65519.0f).getBits(), 0x7bffu);
+        CHECK_EQ(xvigra::Float16(65520.0f).getBits(), 0x7c00u);
+        CHECK_EQ(xvigra::Float16(-1e10f).getBits(), 0xfc00u);
+        CHECK(std::isinf(static_cast<float>(xvigra::Float16(std::numeric_limits<float>::infinity()))));
+        CHECK(std::isnan(static_cast<float>(xvigra::Float16(std::numeric_limits<float>::quiet_NaN()))));
+    }
+
+    SUBCASE("Round trip of every value") {
+        for (std::uint32_t bits = 0; bits <= 0xffffu; ++bits) {
+            xvigra::Float16 value = xvigra::Float16::fromBits(static_cast<std::uint16_t>(bits));
+            float widened = value;
+            if (!std::isnan(widened)) {
+                REQUIRE_EQ(xvigra::Float16(widened).getBits(), bits);
+            }
+        }
+    }
+}
+
+
+TEST_CASE("BFloat16: Test Conversion") {
+    SUBCASE("Exact values") {
+        CHECK_EQ(xvigra::BFloat16(1.0f).getBits(), 0x3f80u);
+        CHECK_EQ(xvigra::BFloat16(-2.0f).getBits(), 0xc000u);
+        CHECK_EQ(static_cast<float>(xvigra::BFloat16(1e30f)), doctest::Approx(1e30).epsilon(HALF_EPSILON<xvigra::BFloat16>));
+    }
+
+    SUBCASE("Round to nearest even") {
+        CHECK_EQ(xvigra::BFloat16(1.0f + std::ldexp(1.0f, -8)).getBits(), 0x3f80u);
+        CHECK_EQ(xvigra::BFloat16(1.0f + 3.0f * std::ldexp(1.0f, -8)).getBits(), 0x3f82u);
+    }
+
+    SUBCASE("Infinity and NaN") {
+        CHECK_EQ(xvigra::BFloat16(std::numeric_limits<float>::max()).getBits(), 0x7f80u);
+        CHECK(std::isnan(static_cast<float>(xvigra::BFloat16(std::numeric_limits<float>::quiet_NaN()))));
+    }
+
+    SUBCASE("Round trip of every value") {
+        for (std::uint32_t bits = 0; bits <= 0xffffu; ++bits) {
+            xvigra::BFloat16 value = xvigra::BFloat16::fromBits(static_cast<std::uint16_t>(bits));
+            float widened = value;
+            if (!std::isnan(widened)) {
+                REQUIRE_EQ(xvigra::BFloat16(widened).getBits(), bits);
+            }
+        }
+    }
+}
+
+
+TEST_CASE("Half Precision: Test Common Type") {
+    CHECK(std::is_same_v<std::common_type_t<xvigra::Float16, xvigra::Float16>, xvigra::Float16>);
+    CHECK(std::is_same_v<std::common_type_t<xvigra::Float16, short>, xvigra::Float16>);
+    CHECK(std::is_same_v<std::common_type_t<int, xvigra::BFloat16>, xvigra::BFloat16>);
+    CHECK(std::is_same_v<std::common_type_t<xvigra::Float16, float>, float>);
+    CHECK(std::is_same_v<std::common_type_t<double, xvigra::BFloat16>, double>);
+    CHECK(std::is_same_v<std::common_type_t<xvigra::Float16, xvigra::BFloat16>, float>);
+    CHECK(std::is_same_v<xvigra::AccumulationType<xvigra::Float16>, float>);
+    CHECK(std::is_same_v<xvigra::AccumulationType<double>, double>);
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test conversion - end                                                                                            ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test convolution - begin                                                                                         ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+// The data is positive, so no cancellation occurs and the relative error of a result is bounded by the roundings of
+// the input, the kernel and the output, each off by at most half an epsilon. Every further 16-bit intermediate adds
+// another half epsilon.
+
+TEST_CASE_TEMPLATE("Convolve2D: Test Half Precision", T, HALF_TYPES) {
+    xt::xtensor<float, 3> inputFirst = xt::empty<float>({3, 13, 11});
+    xt::xtensor<float, 3> inputLast = xt::empty<float>({13, 11, 3});
+    xt::xtensor<float, 4> kernel = xt::empty<float>({4, 3, 3, 3});
+    fillWithPattern(inputFirst, 31, 0.37, 1.0);
+    fillWithPattern(inputLast, 31, 0.37, 1.0);
+    fillWithPattern(kernel, 17, 0.031, 0.05);
+
+    xt::xtensor<T, 4> halfKernel = xt::cast<T>(kernel);
+    double epsilon = 1.5 * HALF_EPSILON<T>;
+
+    xvigra::KernelOptions2D options;
+    options.setPadding(1);
+    options.setBorderTreatment(xvigra::BorderTreatment::constant(0.5));
+
+    for (xvigra::Algorithm algorithm : {xvigra::Algorithm::GEMM, xvigra::Algorithm::DIRECT, xvigra::Algorithm::WINOGRAD_2X2, xvigra::Algorithm::FFT}) {
+        options.setAlgorithm(algorithm);
+
+        for (xvigra::ChannelPosition position : {xvigra::ChannelPosition::FIRST, xvigra::ChannelPosition::LAST}) {
+            CAPTURE(algorithm);
+            CAPTURE(position);
+            options.setChannelPosition(position);
+            const auto& input = position == xvigra::ChannelPosition::FIRST ? inputFirst : inputLast;
+            xt::xtensor<T, 3> halfInput = xt::cast<T>(input);
+
+            auto expected = xvigra::convolve2D(input, kernel, options);
+            auto actual = xvigra::convolve2D(halfInput, halfKernel, options);
+            CHECK(std::is_same_v<typename decltype(actual)::value_type, T>);
+            checkExpressions(actual, expected, epsilon);
+
+            // a float kernel keeps the accumulation in float and produces a float result
+            auto mixed = xvigra::convolve2D(halfInput, kernel, options);
+            CHECK(std::is_same_v<typename decltype(mixed)::value_type, float>);
+            checkExpressions(mixed, expected, epsilon);
+        }
+    }
+
+    SUBCASE("Output") {
+        options.setAlgorithm(xvigra::Algorithm::GEMM);
+        options.setChannelPosition(xvigra::ChannelPosition::LAST);
+        xt::xtensor<T, 3> halfInput = xt::cast<T>(inputLast);
+
+        xt::xtensor<T, 3> output;
+        xvigra::convolve2D(halfInput, halfKernel, options, output);
+        checkExpressions(output, xvigra::convolve2D(inputLast, kernel, options), epsilon);
+    }
+
+    SUBCASE("Auto Algorithm") {
+        // the accumulation in float makes the floating point algorithms eligible, as they are for float inputs
+        xt::xtensor<float, 3> largeInput = xt::empty<float>({1, 48, 48});
+        xt::xtensor<float, 4> largeKernel = xt::empty<float>({1, 1, 15, 15});
+        fillWithPattern(largeInput, 31, 0.37, 1.0);
+        fillWithPattern(largeKernel, 17, 0.031, 0.05);
+        xt::xtensor<T, 3> halfInput = xt::cast<T>(largeInput);
+        xt::xtensor<T, 4> halfLargeKernel = xt::cast<T>(largeKernel);
+
+        options.setAlgorithm(xvigra::Algorithm::AUTO);
+        options.setChannelPosition(xvigra::ChannelPosition::FIRST);
+        options.setPadding(7);
+
+        CHECK_EQ(xvigra::resolveAlgorithm2D(halfInput, halfLargeKernel, options), xvigra::resolveAlgorithm2D(largeInput, largeKernel, options));
+        CHECK_EQ(xvigra::resolveAlgorithm2D(halfInput, halfLargeKernel, options), xvigra::Algorithm::FFT);
+    }
+}
+
+
+TEST_CASE_TEMPLATE("ConvolutionPlan2D: Test Half Precision", T, HALF_TYPES) {
+    xt::xtensor<float, 3> input = xt::empty<float>({13, 11, 3});
+    xt::xtensor<float, 4> kernel = xt::empty<float>({4, 3, 3, 3});
+    fillWithPattern(input, 31, 0.37, 1.0);
+    fillWithPattern(kernel, 17, 0.031, 0.05);
+    xt::xtensor<T, 3> halfInput = xt::cast<T>(input);
+    xt::xtensor<T, 4> halfKernel = xt::cast<T>(kernel);
+
+    xvigra::KernelOptions2D options;
+    options.setPadding(1);
+
+    // as in xvigra::convolve2D the products are accumulated in float, so only input and kernel are rounded
+    using ResultType = typename xvigra::ConvolutionPlan2D<T, T>::ResultType;
+    CHECK(std::is_same_v<ResultType, float>);
+
+    xvigra::ConvolutionPlan2D<T, T> plan({13, 11, 3}, halfKernel, options);
+    xt::xtensor<ResultType, 3> actual(plan.getOutputShape());
+    plan.execute(halfInput, actual);
+    checkExpressions(actual, xvigra::convolve2D(input, kernel, options), HALF_EPSILON<T>);
+}
+
+
+TEST_CASE_TEMPLATE("SeparableConvolve2D: Test Half Precision", T, HALF_TYPES) {
+    xt::xtensor<float, 3> input = xt::empty<float>({17, 15, 2});
+    fillWithPattern(input, 29, 0.41, 2.0);
+    xt::xtensor<float, 1> kernelY{0.2f, 0.5f, 0.3f};
+    xt::xtensor<float, 1> kernelX{0.1f, 0.15f, 0.5f, 0.15f, 0.1f};
+
+    xvigra::KernelOptions optionsY;
+    optionsY.setPadding(1);
+    optionsY.setBorderTreatment(xvigra::BorderTreatment::asymmetricReflect());
+    xvigra::KernelOptions optionsX;
+    optionsX.setPadding(2);
+    optionsX.setBorderTreatment(xvigra::BorderTreatment::constant(1.5));
+
+    xt::xtensor<T, 3> halfInput = xt::cast<T>(input);
+    xt::xtensor<T, 1> halfKernelY = xt::cast<T>(kernelY);
+    xt::xtensor<T, 1> halfKernelX = xt::cast<T>(kernelX);
+
+    auto expected = xvigra::separableConvolve2D(input, std::array{kernelY, kernelX}, std::array{optionsY, optionsX});
+    auto actual = xvigra::separableConvolve2D(halfInput, std::array{halfKernelY, halfKernelX}, std::array{optionsY, optionsX});
+
+    // the intermediate result between both passes is stored in 16 bits as well
+    CHECK(std::is_same_v<typename decltype(actual)::value_type, T>);
+    checkExpressions(actual, expected, 2.5 * HALF_EPSILON<T>);
+}
+
+
+TEST_CASE_TEMPLATE("GaussianSmoothing: Test Half Precision", T, HALF_TYPES) {
+    xt::xtensor<float, 3> input = xt::empty<float>({19, 16, 3});
+    fillWithPattern(input, 37, 0.53, 1.0);
+    xt::xtensor<T, 3> halfInput = xt::cast<T>(input);
+
+    auto expected = xvigra::gaussianSmoothing<2>(input, std::array{1.2, 0.8});
+    auto actual = xvigra::gaussianSmoothing<2>(halfInput, std::array{1.2, 0.8});
+
+    CHECK(std::is_same_v<typename decltype(actual)::value_type, T>);
+    checkExpressions(actual, expected, 2.5 * HALF_EPSILON<T>);
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test convolution - end                                                                                           ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
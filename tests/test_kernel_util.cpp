@@ -1,3 +1,4 @@
+#include <array>
 #include <limits>
 #include <stdexcept>
 #include <type_traits>
@@ -14,6 +15,7 @@
 #include "xtensor/xrandom.hpp"
 #include "xtensor/xtensor.hpp"
 #include "xtensor/xio.hpp"
+#include "xtensor/xview.hpp"
 
 #include "xvigra/kernel_util.hpp"
 #include "xvigra/math.hpp"
@@ -549,3 +551,139 @@ TEST_CASE_TEMPLATE("Test promoteKernelToFull2D", KernelType, TYPES) {
 // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
 // ║ Test promoteKernelToFull2D - end                                                                                 ║
 // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test promoteKernelToFull3D - begin                                                                               ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+TEST_CASE_TEMPLATE("Test promoteKernelToFull3D", KernelType, TYPES) {
+    xt::xtensor<KernelType, 1> kernel1D{1, 2, 3};
+    xt::xtensor<KernelType, 3> kernel3D = xt::arange<KernelType>(0, 12).reshape({2, 3, 2});
+    xt::xtensor<KernelType, 4> kernel4D = xt::arange<KernelType>(0, 24).reshape({2, 2, 3, 2});
+
+    SUBCASE("Raw Kernel 1D") {
+        auto actual = xvigra::promoteKernelToFull3D(kernel1D, 2);
+        REQUIRE_EQ(actual.shape(), std::array<std::size_t, 5>{2, 2, 3, 3, 3});
+
+        for (std::size_t d = 0; d < 3; ++d) {
+            for (std::size_t h = 0; h < 3; ++h) {
+                for (std::size_t w = 0; w < 3; ++w) {
+                    KernelType expected = static_cast<KernelType>(kernel1D(d) * kernel1D(h) * kernel1D(w));
+                    CHECK_EQ(actual(0, 0, d, h, w), expected);
+                    CHECK_EQ(actual(1, 1, d, h, w), expected);
+                    CHECK_EQ(actual(0, 1, d, h, w), static_cast<KernelType>(0));
+                    CHECK_EQ(actual(1, 0, d, h, w), static_cast<KernelType>(0));
+                }
+            }
+        }
+    }
+
+    SUBCASE("Raw Kernel 3D") {
+        auto actual = xvigra::promoteKernelToFull3D(kernel3D, 3);
+        REQUIRE_EQ(actual.shape(), std::array<std::size_t, 5>{3, 3, 2, 3, 2});
+
+        xt::xtensor<KernelType, 3> zero = xt::zeros<KernelType>(kernel3D.shape());
+
+        for (std::size_t outIndex = 0; outIndex < 3; ++outIndex) {
+            for (std::size_t inIndex = 0; inIndex < 3; ++inIndex) {
+                xt::xtensor<KernelType, 3> slice = xt::view(actual, outIndex, inIndex, xt::all(), xt::all(), xt::all());
+                CHECK_EQ(slice, outIndex == inIndex ? kernel3D : zero);
+            }
+        }
+    }
+
+    SUBCASE("Raw Kernel 4D") {
+        auto actual = xvigra::promoteKernelToFull3D(kernel4D, 3);
+        REQUIRE_EQ(actual.shape(), std::array<std::size_t, 5>{3, 2, 2, 3, 2});
+
+        for (std::size_t outIndex = 0; outIndex < 3; ++outIndex) {
+            xt::xtensor<KernelType, 4> slice = xt::view(actual, outIndex, xt::all(), xt::all(), xt::all(), xt::all());
+            CHECK_EQ(slice, kernel4D);
+        }
+    }
+
+    SUBCASE("Raw Kernel 5D") {
+        xt::xtensor<KernelType, 5> kernel5D = xt::expand_dims(kernel4D, 0);
+        CHECK_EQ(xvigra::promoteKernelToFull3D(kernel5D), kernel5D);
+    }
+
+    SUBCASE("Invalid Kernel") {
+        xt::xtensor<KernelType, 2> kernel2D = xt::zeros<KernelType>({3, 3});
+
+        CHECK_THROWS_WITH_AS(
+            xvigra::promoteKernelToFull3D(kernel2D, 1),
+            "promoteKernelToFullND(): Can't promote 2 dimensional kernel!",
+            std::invalid_argument
+        );
+
+        CHECK_THROWS_WITH_AS(
+            xvigra::promoteKernelToFull3D(kernel3D),
+            "promoteKernelToFullND(): Need atleast 1 output channel!",
+            std::invalid_argument
+        );
+    }
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test promoteKernelToFull3D - end                                                                                 ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test promoteKernelToFullND - begin                                                                               ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+TEST_CASE_TEMPLATE("Test promoteKernelToFullND", KernelType, TYPES) {
+    xt::xtensor<KernelType, 1> kernel1D{1, 2, 3};
+    xt::xtensor<KernelType, 2> kernel2D = xt::arange<KernelType>(0, 6).reshape({2, 3});
+    xt::xtensor<KernelType, 3> kernel3D = xt::arange<KernelType>(0, 12).reshape({2, 3, 2});
+
+    SUBCASE("Against promoteKernelToFull1D") {
+        CHECK_EQ(xvigra::promoteKernelToFullND<1>(kernel1D, 2), xvigra::promoteKernelToFull1D(kernel1D, 2));
+        CHECK_EQ(xvigra::promoteKernelToFullND<1>(kernel2D, 4), xvigra::promoteKernelToFull1D(kernel2D, 4));
+        CHECK_EQ(xvigra::promoteKernelToFullND<1>(kernel3D), kernel3D);
+    }
+
+    SUBCASE("Against promoteKernelToFull2D") {
+        CHECK_EQ(xvigra::promoteKernelToFullND<2>(kernel1D, 2), xvigra::promoteKernelToFull2D(kernel1D, 2));
+        CHECK_EQ(xvigra::promoteKernelToFullND<2>(kernel2D, 3), xvigra::promoteKernelToFull2D(kernel2D, 3));
+        CHECK_EQ(xvigra::promoteKernelToFullND<2>(kernel3D, 3), xvigra::promoteKernelToFull2D(kernel3D, 3));
+    }
+
+    SUBCASE("Raw Kernel 1D For 4 Dimensions") {
+        auto actual = xvigra::promoteKernelToFullND<4>(kernel1D, 1);
+        REQUIRE_EQ(actual.shape(), std::array<std::size_t, 6>{1, 1, 3, 3, 3, 3});
+
+        for (std::size_t t = 0; t < 3; ++t) {
+            for (std::size_t d = 0; d < 3; ++d) {
+                for (std::size_t h = 0; h < 3; ++h) {
+                    for (std::size_t w = 0; w < 3; ++w) {
+                        KernelType expected = static_cast<KernelType>(kernel1D(t) * kernel1D(d) * kernel1D(h) * kernel1D(w));
+                        CHECK_EQ(actual(0, 0, t, d, h, w), expected);
+                    }
+                }
+            }
+        }
+    }
+
+    SUBCASE("Invalid Kernel") {
+        xt::xtensor<KernelType, 4> kernel4D = xt::zeros<KernelType>({1, 1, 3, 3});
+
+        CHECK_THROWS_WITH_AS(
+            xvigra::promoteKernelToFullND<1>(kernel4D, 1),
+            "promoteKernelToFullND(): Can't promote 4 dimensional kernel!",
+            std::invalid_argument
+        );
+
+        CHECK_THROWS_WITH_AS(
+            xvigra::promoteKernelToFullND<4>(kernel1D),
+            "promoteKernelToFullND(): Need atleast 1 output channel!",
+            std::invalid_argument
+        );
+    }
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test promoteKernelToFullND - end                                                                                 ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
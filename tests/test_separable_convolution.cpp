@@ -864,6 +864,57 @@ TEST_CASE_TEMPLATE("SeparableConvolve2D: Test Invalid Configurations", T, TYPE_P
     }
 }
 
+TEST_CASE_TEMPLATE("SeparableConvolve2D: Test Kernel Symmetry", T, TYPE_PAIRS) {
+    using InputType = typename T::first_type;
+    using KernelType = typename T::second_type;
+
+    xt::xtensor<KernelType, 1> smoothing{0.25f, 0.50f, 1.00f, 0.50f, 0.25f};
+    xt::xtensor<KernelType, 1> derivative{-0.50f, -1.00f, 0.00f, 1.00f, 0.50f};
+
+    xvigra::KernelOptions2D options2D;
+    options2D.setPadding(2);
+    options2D.setBorderTreatment(xvigra::BorderTreatment::asymmetricReflect());
+
+    xt::xtensor<InputType, 3> input;
+
+    SUBCASE("Channel First") {
+        input = xt::zeros<InputType>({3, 9, 11});
+        options2D.setChannelPosition(xvigra::ChannelPosition::FIRST);
+    }
+
+    SUBCASE("Channel Last") {
+        input = xt::zeros<InputType>({9, 11, 3});
+        options2D.setChannelPosition(xvigra::ChannelPosition::LAST);
+    }
+
+    for (std::size_t index = 0; index < input.size(); ++index) {
+        input.flat(index) = static_cast<InputType>(static_cast<int>((index * 7) % 13) - 6);
+    }
+
+    // the promoted diagonal kernels are the reference, since they are never folded
+    xvigra::KernelOptions2D unfoldedOptions2D = options2D;
+    unfoldedOptions2D.setKernelSymmetry(xvigra::KernelSymmetry::NONE);
+    auto expected = xvigra::separableConvolve2D(input, std::array{smoothing, derivative}, unfoldedOptions2D);
+
+    checkExpressions(xvigra::separableConvolve2D(input, std::array{smoothing, derivative}, options2D), expected, 1e-5);
+
+    // only the DIRECT and AUTO algorithms fold, with detected or declared symmetries
+    xvigra::KernelOptions2D detectedOptions2D = options2D;
+    detectedOptions2D.setAlgorithm(xvigra::Algorithm::AUTO);
+    checkExpressions(xvigra::separableConvolve2D(input, std::array{smoothing, derivative}, detectedOptions2D), expected, 1e-5);
+
+    options2D.setAlgorithm(xvigra::Algorithm::DIRECT);
+    options2D.setKernelSymmetry(xvigra::KernelSymmetry::SYMMETRIC, xvigra::KernelSymmetry::ANTISYMMETRIC);
+    checkExpressions(xvigra::separableConvolve2D(input, std::array{smoothing, derivative}, options2D), expected, 1e-5);
+
+    options2D.setKernelSymmetry(xvigra::KernelSymmetry::ANTISYMMETRIC, xvigra::KernelSymmetry::ANTISYMMETRIC);
+    CHECK_THROWS_WITH_AS(
+        xvigra::separableConvolve2D(input, std::array{smoothing, derivative}, options2D),
+        "resolveKernelSymmetry(): Kernel taps don't have the declared symmetry!",
+        std::invalid_argument
+    );
+}
+
 // ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
 // ║ Test separableConvolve2D - end                                                                                   ║
 // ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
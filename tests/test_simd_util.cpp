@@ -0,0 +1,353 @@
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#define DOCTEST_CONFIG_SUPER_FAST_ASSERTS
+#include "doctest/doctest.h"
+
+#ifdef VOID
+#undef VOID
+#endif
+
+#include "xtensor/xbuilder.hpp"
+#include "xtensor/xtensor.hpp"
+#include "xtensor/xview.hpp"
+
+#include "xvigra/convolution_util.hpp"
+#include "xvigra/explicit_convolution.hpp"
+#include "xvigra/simd_util.hpp"
+
+#include "test_util.hpp"
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ define - begin                                                                                                   ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+#define TYPE_PAIRS              \
+    std::pair<short, float>,    \
+    std::pair<short, double>,   \
+    std::pair<int, float>,      \
+    std::pair<float, float>,    \
+    std::pair<double, double>
+
+TYPE_TO_STRING(std::pair<short, float>);
+TYPE_TO_STRING(std::pair<short, double>);
+TYPE_TO_STRING(std::pair<int, float>);
+TYPE_TO_STRING(std::pair<float, float>);
+TYPE_TO_STRING(std::pair<double, double>);
+
+#define INSTRUCTION_SETS {                  \
+    xvigra::InstructionSet::SCALAR,         \
+    xvigra::InstructionSet::SSE4,           \
+    xvigra::InstructionSet::AVX2,           \
+    xvigra::InstructionSet::AVX512          \
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ define - end                                                                                                     ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ utility - begin                                                                                                  ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+// restores the detected instruction set at the end of a test, so that the order of the tests does not matter
+class InstructionSetGuard {
+public:
+    ~InstructionSetGuard() {
+        xvigra::setInstructionSet(xvigra::detectInstructionSet());
+    }
+};
+
+
+template <typename T, typename O>
+void checkExpressions(const xt::xexpression<T>& actualExpression, const xt::xexpression<O>& expectedExpression) {
+    using ValueType = typename O::value_type;
+
+    auto actual = actualExpression.derived_cast();
+    auto expected = expectedExpression.derived_cast();
+
+    REQUIRE(actual.shape() == expected.shape());
+    for (std::size_t index = 0; index < expected.size(); ++index) {
+        CHECK_EQ(actual.flat(index), doctest::Approx(expected.flat(index)).epsilon(std::numeric_limits<ValueType>::epsilon() * 16));
+    }
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ utility - end                                                                                                    ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test dispatch - begin                                                                                            ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+TEST_CASE("Test Instruction Set Dispatch") {
+    InstructionSetGuard guard;
+    xvigra::InstructionSet detected = xvigra::detectInstructionSet();
+
+    CHECK_EQ(xvigra::activeInstructionSet(), detected);
+
+    CHECK_EQ(xvigra::setInstructionSet(xvigra::InstructionSet::SCALAR), xvigra::InstructionSet::SCALAR);
+    CHECK_EQ(xvigra::activeInstructionSet(), xvigra::InstructionSet::SCALAR);
+
+    // a wider instruction set than the host supports is clamped
+    CHECK_EQ(xvigra::setInstructionSet(xvigra::InstructionSet::AVX512), detected);
+    CHECK_EQ(xvigra::activeInstructionSet(), detected);
+}
+
+
+TEST_CASE("Test multiplyAdd") {
+    InstructionSetGuard guard;
+
+    // sizes around every vector width, so that the vector loops and the scalar tails are both covered
+    for (xvigra::InstructionSet instructionSet : INSTRUCTION_SETS) {
+        xvigra::setInstructionSet(instructionSet);
+
+        for (std::size_t size : {0, 1, 3, 4, 7, 8, 15, 16, 17, 33}) {
+            CAPTURE(instructionSet);
+            CAPTURE(size);
+
+            std::vector<float> targetFloat(size);
+            std::vector<float> sourceFloat(size);
+            std::vector<double> targetDouble(size);
+            std::vector<double> sourceDouble(size);
+            std::vector<int> targetInt(size);
+            std::vector<int> sourceInt(size);
+
+            for (std::size_t index = 0; index < size; ++index) {
+                targetFloat[index] = 0.5f * static_cast<float>(index);
+                sourceFloat[index] = static_cast<float>(index) + 1.0f;
+                targetDouble[index] = 0.25 * static_cast<double>(index);
+                sourceDouble[index] = static_cast<double>(index) - 3.0;
+                targetInt[index] = static_cast<int>(index);
+                sourceInt[index] = 2 * static_cast<int>(index);
+            }
+
+            xvigra::multiplyAdd(targetFloat.data(), sourceFloat.data(), 2.0f, size);
+            xvigra::multiplyAdd(targetDouble.data(), sourceDouble.data(), 3.0, size);
+            xvigra::multiplyAdd(targetInt.data(), sourceInt.data(), -1, size);
+
+            // all values are small integers or halves, so every instruction set computes them exactly
+            for (std::size_t index = 0; index < size; ++index) {
+                CHECK_EQ(targetFloat[index], 0.5f * static_cast<float>(index) + 2.0f * (static_cast<float>(index) + 1.0f));
+                CHECK_EQ(targetDouble[index], 0.25 * static_cast<double>(index) + 3.0 * (static_cast<double>(index) - 3.0));
+                CHECK_EQ(targetInt[index], -static_cast<int>(index));
+            }
+        }
+    }
+}
+
+
+TEST_CASE("Test multiplyAddChannelBlock") {
+    InstructionSetGuard guard;
+
+    // pixel counts around the 4 pixels of the register blocked loop, with contiguous, strided and repeated pixels
+    for (xvigra::InstructionSet instructionSet : INSTRUCTION_SETS) {
+        xvigra::setInstructionSet(instructionSet);
+
+        for (std::size_t pixels : {0, 1, 3, 4, 5, 9}) {
+            for (std::ptrdiff_t sourceStride : {0, 8, 16}) {
+                CAPTURE(instructionSet);
+                CAPTURE(pixels);
+                CAPTURE(sourceStride);
+
+                std::size_t sourceSize = pixels == 0 ? 0 : static_cast<std::size_t>(sourceStride) * (pixels - 1) + 8;
+                std::vector<float> targetFloat(pixels * 8);
+                std::vector<float> sourceFloat(sourceSize);
+                std::vector<float> weightsFloat(64);
+                std::vector<double> targetDouble(pixels * 8);
+                std::vector<double> sourceDouble(sourceSize);
+                std::vector<double> weightsDouble(64);
+                std::vector<int> targetInt(pixels * 8);
+                std::vector<int> sourceInt(sourceSize);
+                std::vector<int> weightsInt(64);
+
+                for (std::size_t index = 0; index < targetFloat.size(); ++index) {
+                    targetFloat[index] = static_cast<float>(index % 5);
+                    targetDouble[index] = 0.5 * static_cast<double>(index % 7);
+                    targetInt[index] = static_cast<int>(index % 3);
+                }
+
+                for (std::size_t index = 0; index < sourceSize; ++index) {
+                    sourceFloat[index] = static_cast<float>(index % 9) - 4.0f;
+                    sourceDouble[index] = static_cast<double>(index % 11) - 5.0;
+                    sourceInt[index] = static_cast<int>(index % 4) - 2;
+                }
+
+                for (std::size_t index = 0; index < 64; ++index) {
+                    weightsFloat[index] = static_cast<float>(index % 6) - 2.0f;
+                    weightsDouble[index] = 0.25 * static_cast<double>(index % 13);
+                    weightsInt[index] = static_cast<int>(index % 5) - 1;
+                }
+
+                std::vector<float> expectedFloat(targetFloat);
+                std::vector<double> expectedDouble(targetDouble);
+                std::vector<int> expectedInt(targetInt);
+                for (std::size_t pixel = 0; pixel < pixels; ++pixel) {
+                    for (std::size_t lane = 0; lane < 8; ++lane) {
+                        std::size_t source = pixel * static_cast<std::size_t>(sourceStride) + lane;
+                        for (std::size_t column = 0; column < 8; ++column) {
+                            expectedFloat[pixel * 8 + column] += sourceFloat[source] * weightsFloat[lane * 8 + column];
+                            expectedDouble[pixel * 8 + column] += sourceDouble[source] * weightsDouble[lane * 8 + column];
+                            expectedInt[pixel * 8 + column] += sourceInt[source] * weightsInt[lane * 8 + column];
+                        }
+                    }
+                }
+
+                xvigra::multiplyAddChannelBlock(targetFloat.data(), sourceFloat.data(), sourceStride, weightsFloat.data(), pixels);
+                xvigra::multiplyAddChannelBlock(targetDouble.data(), sourceDouble.data(), sourceStride, weightsDouble.data(), pixels);
+                xvigra::multiplyAddChannelBlock(targetInt.data(), sourceInt.data(), sourceStride, weightsInt.data(), pixels);
+
+                // all values are small integers or quarters, so every instruction set computes them exactly
+                for (std::size_t index = 0; index < targetFloat.size(); ++index) {
+                    CHECK_EQ(targetFloat[index], expectedFloat[index]);
+                    CHECK_EQ(targetDouble[index], expectedDouble[index]);
+                    CHECK_EQ(targetInt[index], expectedInt[index]);
+                }
+            }
+        }
+    }
+}
+
+
+TEST_CASE("Test convertRow") {
+    InstructionSetGuard guard;
+
+    for (xvigra::InstructionSet instructionSet : INSTRUCTION_SETS) {
+        xvigra::setInstructionSet(instructionSet);
+
+        for (std::size_t size : {0, 1, 3, 4, 7, 8, 15, 16, 17, 33}) {
+            CAPTURE(instructionSet);
+            CAPTURE(size);
+
+            std::vector<std::int16_t> sourceShort(size);
+            std::vector<std::int32_t> sourceInt(2 * size);
+            for (std::size_t index = 0; index < size; ++index) {
+                sourceShort[index] = static_cast<std::int16_t>(37 * static_cast<int>(index) - 500);
+                sourceInt[2 * index] = 1000 * static_cast<int>(index) - 7;
+                sourceInt[2 * index + 1] = -1;
+            }
+
+            std::vector<float> targetShort(size);
+            std::vector<float> targetContiguous(size);
+            std::vector<float> targetStrided(size);
+            std::vector<double> targetDouble(size);
+            xvigra::convertRow(sourceShort.data(), 1, targetShort.data(), size);
+            xvigra::convertRow(sourceInt.data(), 1, targetContiguous.data(), size);
+            xvigra::convertRow(sourceInt.data(), 2, targetStrided.data(), size);
+            xvigra::convertRow(sourceShort.data(), 1, targetDouble.data(), size);
+
+            for (std::size_t index = 0; index < size; ++index) {
+                CHECK_EQ(targetShort[index], static_cast<float>(sourceShort[index]));
+                CHECK_EQ(targetContiguous[index], static_cast<float>(sourceInt[index]));
+                CHECK_EQ(targetStrided[index], static_cast<float>(sourceInt[2 * index]));
+                CHECK_EQ(targetDouble[index], static_cast<double>(sourceShort[index]));
+            }
+        }
+    }
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test dispatch - end                                                                                              ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test convolution - begin                                                                                         ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+TEST_CASE_TEMPLATE("Convolve1D: Test Instruction Sets", T, TYPE_PAIRS) {
+    using InputType = typename T::first_type;
+    using KernelType = typename T::second_type;
+    InstructionSetGuard guard;
+
+    xt::xtensor<InputType, 2> inputFirst = xt::empty<InputType>({5, 41});
+    xt::xtensor<InputType, 2> inputLast = xt::empty<InputType>({41, 5});
+    xt::xtensor<KernelType, 3> kernel = xt::empty<KernelType>({19, 5, 5});
+    fillWithPattern(inputFirst, 31, 1.0, -9.0);
+    fillWithPattern(inputLast, 31, 1.0, -9.0);
+    fillWithPattern(kernel, 13, 0.25, -1.5);
+
+    xvigra::KernelOptions options;
+    options.setPadding(2);
+    options.setBorderTreatment(xvigra::BorderTreatment::constant(3));
+
+    for (xvigra::Algorithm algorithm : {xvigra::Algorithm::GEMM, xvigra::Algorithm::DIRECT}) {
+        for (int stride : {1, 2}) {
+            options.setAlgorithm(algorithm);
+            options.setStride(stride);
+
+            for (xvigra::ChannelPosition position : {xvigra::ChannelPosition::FIRST, xvigra::ChannelPosition::LAST}) {
+                CAPTURE(algorithm);
+                CAPTURE(stride);
+                CAPTURE(position);
+                options.setChannelPosition(position);
+                const auto& input = position == xvigra::ChannelPosition::FIRST ? inputFirst : inputLast;
+
+                xvigra::setInstructionSet(xvigra::InstructionSet::SCALAR);
+                auto expected = xvigra::convolve1D(input, kernel, options);
+
+                for (xvigra::InstructionSet instructionSet : INSTRUCTION_SETS) {
+                    CAPTURE(instructionSet);
+                    xvigra::setInstructionSet(instructionSet);
+                    checkExpressions(xvigra::convolve1D(input, kernel, options), expected);
+                }
+            }
+        }
+    }
+}
+
+
+TEST_CASE_TEMPLATE("Convolve2D: Test Instruction Sets", T, TYPE_PAIRS) {
+    using InputType = typename T::first_type;
+    using KernelType = typename T::second_type;
+    InstructionSetGuard guard;
+
+    xt::xtensor<InputType, 3> inputFirst = xt::empty<InputType>({3, 14, 37});
+    xt::xtensor<InputType, 3> inputLast = xt::empty<InputType>({14, 37, 3});
+    xt::xtensor<KernelType, 4> kernel = xt::empty<KernelType>({17, 3, 3, 5});
+    fillWithPattern(inputFirst, 31, 1.0, -9.0);
+    fillWithPattern(inputLast, 31, 1.0, -9.0);
+    fillWithPattern(kernel, 13, 0.25, -1.5);
+
+    xvigra::KernelOptions2D options;
+    options.setPadding(1, 2);
+    options.setBorderTreatment(xvigra::BorderTreatment::asymmetricReflect());
+
+    for (xvigra::Algorithm algorithm : {xvigra::Algorithm::GEMM, xvigra::Algorithm::DIRECT}) {
+        for (int stride : {1, 2}) {
+            options.setAlgorithm(algorithm);
+            options.setStride(1, stride);
+
+            for (xvigra::ChannelPosition position : {xvigra::ChannelPosition::FIRST, xvigra::ChannelPosition::LAST}) {
+                CAPTURE(algorithm);
+                CAPTURE(stride);
+                CAPTURE(position);
+                options.setChannelPosition(position);
+                const auto& input = position == xvigra::ChannelPosition::FIRST ? inputFirst : inputLast;
+
+                xvigra::setInstructionSet(xvigra::InstructionSet::SCALAR);
+                auto expected = xvigra::convolve2D(input, kernel, options);
+
+                for (xvigra::InstructionSet instructionSet : INSTRUCTION_SETS) {
+                    CAPTURE(instructionSet);
+                    xvigra::setInstructionSet(instructionSet);
+                    checkExpressions(xvigra::convolve2D(input, kernel, options), expected);
+
+                    // a strided view is gathered through its strides instead of being copied
+                    auto view = xt::view(input, xt::all(), xt::all(), xt::all());
+                    checkExpressions(xvigra::convolve2D(view, kernel, options), expected);
+                }
+            }
+        }
+    }
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test convolution - end                                                                                           ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
@@ -0,0 +1,263 @@
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#define DOCTEST_CONFIG_SUPER_FAST_ASSERTS
+#include "doctest/doctest.h"
+
+#ifdef VOID
+#undef VOID
+#endif
+
+#include "xtensor/xbuilder.hpp"
+#include "xtensor/xmath.hpp"
+#include "xtensor/xtensor.hpp"
+
+#include "xvigra/convolution_util.hpp"
+#include "xvigra/explicit_convolution.hpp"
+#include "xvigra/gemm_util.hpp"
+#include "xvigra/thread_util.hpp"
+
+#include "test_util.hpp"
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ utility - begin                                                                                                  ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+// fake BLAS thread functions, which record every requested thread count
+int fakeBlasThreadCount = 8;
+std::vector<int> requestedBlasThreadCounts;
+
+int getFakeBlasThreadCount() {
+    return fakeBlasThreadCount;
+}
+
+void setFakeBlasThreadCount(int threadCount) {
+    fakeBlasThreadCount = threadCount;
+    requestedBlasThreadCounts.push_back(threadCount);
+}
+
+
+// connects the fake BLAS and restores the threading configuration of the library at the end of a test
+struct ThreadingFixture {
+    xvigra::ThreadingMode previousMode;
+
+    ThreadingFixture() : previousMode(xvigra::activeThreadingMode()) {
+        fakeBlasThreadCount = 8;
+        requestedBlasThreadCounts.clear();
+        xvigra::setBlasThreadFunctions(&getFakeBlasThreadCount, &setFakeBlasThreadCount);
+    }
+
+    ~ThreadingFixture() {
+        xvigra::setThreadingMode(this->previousMode);
+#if defined(XVIGRA_USE_OPENBLAS)
+        xvigra::setBlasThreadFunctions(&openblas_get_num_threads, &openblas_set_num_threads);
+#else
+        xvigra::setBlasThreadFunctions(nullptr, nullptr);
+#endif
+    }
+};
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ utility - end                                                                                                    ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test Threading - begin                                                                                           ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+TEST_CASE_FIXTURE(ThreadingFixture, "ThreadUtil: Test ThreadingMode") {
+    CHECK_EQ(xvigra::setThreadingMode(xvigra::ThreadingMode::BUDGET), this->previousMode);
+    CHECK_EQ(xvigra::activeThreadingMode(), xvigra::ThreadingMode::BUDGET);
+
+    SUBCASE("Parallel Region") {
+        CHECK_FALSE(xvigra::isInParallelRegion());
+
+        {
+            xvigra::ParallelRegion outer;
+            {
+                xvigra::ParallelRegion inner;
+                CHECK(xvigra::isInParallelRegion());
+            }
+            CHECK(xvigra::isInParallelRegion());
+        }
+
+        CHECK_FALSE(xvigra::isInParallelRegion());
+    }
+
+    SUBCASE("Resolve BLAS Thread Count") {
+        xvigra::setThreadingMode(xvigra::ThreadingMode::UNMANAGED);
+        CHECK_EQ(xvigra::resolveBlasThreadCount(4), 0);
+
+        xvigra::setThreadingMode(xvigra::ThreadingMode::BUDGET);
+        CHECK_EQ(xvigra::resolveBlasThreadCount(4), 4);
+        CHECK_EQ(xvigra::resolveBlasThreadCount(0), xvigra::resolveThreadCount(0));
+
+        xvigra::setThreadingMode(xvigra::ThreadingMode::SINGLE_IN_PARALLEL);
+        CHECK_EQ(xvigra::resolveBlasThreadCount(4), 4);
+        {
+            xvigra::ParallelRegion region;
+            CHECK_EQ(xvigra::resolveBlasThreadCount(4), 1);
+
+            xvigra::setThreadingMode(xvigra::ThreadingMode::BUDGET);
+            CHECK_EQ(xvigra::resolveBlasThreadCount(4), 4);
+        }
+
+        CHECK_THROWS_WITH_AS(
+            xvigra::resolveBlasThreadCount(-1),
+            "resolveThreadCount(): Thread count can't be negative!",
+            std::invalid_argument
+        );
+    }
+}
+
+
+TEST_CASE_FIXTURE(ThreadingFixture, "ThreadUtil: Test BlasThreadScope") {
+    SUBCASE("Unmanaged") {
+        xvigra::setThreadingMode(xvigra::ThreadingMode::UNMANAGED);
+        {
+            xvigra::BlasThreadScope scope(4);
+        }
+        CHECK(requestedBlasThreadCounts.empty());
+    }
+
+    SUBCASE("Budget") {
+        xvigra::setThreadingMode(xvigra::ThreadingMode::BUDGET);
+        {
+            xvigra::BlasThreadScope outer(4);
+            CHECK_EQ(fakeBlasThreadCount, 4);
+            {
+                xvigra::BlasThreadScope inner(2);
+                CHECK_EQ(fakeBlasThreadCount, 2);
+            }
+            // the previous count is only restored by the last scope
+            CHECK_EQ(fakeBlasThreadCount, 2);
+        }
+        CHECK_EQ(fakeBlasThreadCount, 8);
+        CHECK_EQ(requestedBlasThreadCounts, std::vector<int>{4, 2, 8});
+    }
+
+    SUBCASE("Single In Parallel") {
+        xvigra::setThreadingMode(xvigra::ThreadingMode::SINGLE_IN_PARALLEL);
+        {
+            xvigra::ParallelRegion region;
+            xvigra::BlasThreadScope scope(4);
+            CHECK_EQ(fakeBlasThreadCount, 1);
+        }
+        CHECK_EQ(fakeBlasThreadCount, 8);
+    }
+
+    SUBCASE("No BLAS Functions") {
+        xvigra::setThreadingMode(xvigra::ThreadingMode::BUDGET);
+        xvigra::setBlasThreadFunctions(nullptr, nullptr);
+        {
+            xvigra::BlasThreadScope scope(4);
+        }
+        CHECK(requestedBlasThreadCounts.empty());
+    }
+}
+
+
+TEST_CASE_FIXTURE(ThreadingFixture, "ThreadUtil: Test parallelFor") {
+    std::atomic<int> regionChunks(0);
+    std::atomic<int> innerChunks(0);
+
+    auto nestedLoop = [&](int, int) {
+        xvigra::parallelFor(0, 64, 4, [&](int, int) {
+            ++innerChunks;
+        });
+    };
+
+    SUBCASE("Chunks Are Parallel Regions") {
+        xvigra::parallelFor(0, 4, 4, [&](int, int) {
+            if (xvigra::isInParallelRegion()) {
+                ++regionChunks;
+            }
+        });
+        CHECK_EQ(regionChunks.load(), 4);
+
+        regionChunks = 0;
+        xvigra::parallelFor(0, 4, 1, [&](int, int) {
+            if (xvigra::isInParallelRegion()) {
+                ++regionChunks;
+            }
+        });
+        CHECK_EQ(regionChunks.load(), 0);
+    }
+
+    SUBCASE("Nested Budget") {
+        xvigra::setThreadingMode(xvigra::ThreadingMode::BUDGET);
+        xvigra::parallelFor(0, 2, 2, nestedLoop);
+
+        // 2 outer chunks with 4 inner chunks each
+        CHECK_EQ(innerChunks.load(), 8);
+    }
+
+    SUBCASE("Nested Single In Parallel") {
+        xvigra::setThreadingMode(xvigra::ThreadingMode::SINGLE_IN_PARALLEL);
+        xvigra::parallelFor(0, 2, 2, nestedLoop);
+
+        // the inner loops run as a single chunk on the threads of the outer loop
+        CHECK_EQ(innerChunks.load(), 2);
+    }
+}
+
+
+TEST_CASE_FIXTURE(ThreadingFixture, "ThreadUtil: Test Concurrent Convolutions") {
+    xt::xtensor<double, 4> kernel = xt::zeros<double>({24, 3, 3, 3});
+    fillWithPattern(kernel, 7, 0.25, -0.5);
+    xt::xtensor<double, 3> input = xt::zeros<double>({3, 20, 21});
+    fillWithPattern(input, 23, 4.0, -20.0);
+
+    xvigra::KernelOptions2D options;
+    options.setPadding(1);
+    options.setChannelPosition(xvigra::ChannelPosition::FIRST);
+    options.setThreadCount(4);
+
+    xvigra::setThreadingMode(xvigra::ThreadingMode::UNMANAGED);
+    auto expected = xvigra::convolve2D(input, kernel, options);
+
+    for (xvigra::ThreadingMode mode : {xvigra::ThreadingMode::BUDGET, xvigra::ThreadingMode::SINGLE_IN_PARALLEL}) {
+        CAPTURE(mode);
+        xvigra::setThreadingMode(mode);
+        requestedBlasThreadCounts.clear();
+
+        // a single caller gives the whole budget to BLAS, the product with 24 output channels is not a small GEMM
+        CHECK(xt::allclose(xvigra::convolve2D(input, kernel, options), expected));
+        REQUIRE_FALSE(requestedBlasThreadCounts.empty());
+        CHECK_EQ(requestedBlasThreadCounts.front(), 4);
+
+        // concurrent callers inside parallel regions
+        std::vector<xt::xtensor<double, 3>> results(4);
+        std::vector<std::thread> callers;
+        requestedBlasThreadCounts.clear();
+
+        for (std::size_t caller = 0; caller < results.size(); ++caller) {
+            callers.emplace_back([&, caller]() {
+                xvigra::ParallelRegion region;
+                results[caller] = xvigra::convolve2D(input, kernel, options);
+            });
+        }
+
+        for (std::thread& thread : callers) {
+            thread.join();
+        }
+
+        for (const auto& result : results) {
+            CHECK(xt::allclose(result, expected));
+        }
+
+        if (mode == xvigra::ThreadingMode::SINGLE_IN_PARALLEL) {
+            REQUIRE_FALSE(requestedBlasThreadCounts.empty());
+            CHECK_EQ(requestedBlasThreadCounts.front(), 1);
+        }
+    }
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test Threading - end                                                                                             ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
@@ -0,0 +1,25 @@
+#ifndef XVIGRA_TEST_UTIL_HPP
+#define XVIGRA_TEST_UTIL_HPP
+
+#include <cstddef>
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ utility - begin                                                                                                  ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+// fills the tensor with the deterministic pattern ((index * 7) % modulus) * scale + offset, which is shared by the
+// tests of all convolution backends
+template <typename T>
+void fillWithPattern(T& tensor, int modulus, double scale = 1.0, double offset = 0.0) {
+    using ValueType = typename T::value_type;
+
+    for (std::size_t index = 0; index < tensor.size(); ++index) {
+        tensor.flat(index) = static_cast<ValueType>(static_cast<int>((index * 7) % modulus) * scale + offset);
+    }
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ utility - end                                                                                                    ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+#endif // XVIGRA_TEST_UTIL_HPP
@@ -0,0 +1,334 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#define DOCTEST_CONFIG_SUPER_FAST_ASSERTS
+#include "doctest/doctest.h"
+
+#ifdef VOID
+#undef VOID
+#endif
+
+#include "xtensor/xbuilder.hpp"
+#include "xtensor/xtensor.hpp"
+
+#include "xvigra/convolution_util.hpp"
+#include "xvigra/explicit_convolution.hpp"
+#include "xvigra/separable_convolution.hpp"
+#include "xvigra/workspace.hpp"
+
+#include "test_util.hpp"
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ define - begin                                                                                                   ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+#define TYPE_PAIRS              \
+    std::pair<short, float>,    \
+    std::pair<short, double>,   \
+    std::pair<int, float>,      \
+    std::pair<int, double>
+
+TYPE_TO_STRING(std::pair<short, float>);
+TYPE_TO_STRING(std::pair<short, double>);
+TYPE_TO_STRING(std::pair<int, float>);
+TYPE_TO_STRING(std::pair<int, double>);
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ define - end                                                                                                     ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ utility - begin                                                                                                  ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+std::size_t alignedBytes(std::size_t bytes) {
+    return (bytes + xvigra::WORKSPACE_ALIGNMENT - 1) / xvigra::WORKSPACE_ALIGNMENT * xvigra::WORKSPACE_ALIGNMENT;
+}
+
+
+bool isAligned(const void* pointer, std::size_t alignment) {
+    return reinterpret_cast<std::uintptr_t>(pointer) % alignment == 0;
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ utility - end                                                                                                    ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test Workspace - begin                                                                                           ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+TEST_CASE("Workspace: Test allocate") {
+    xvigra::Workspace workspace(1024);
+
+    CHECK_EQ(workspace.getCapacity(), 1024);
+    CHECK_EQ(workspace.getSystemAllocations(), 1);
+    CHECK_EQ(workspace.getUsedBytes(), 0);
+
+    SUBCASE("Alignment") {
+        xvigra::Workspace::Scope scope(workspace);
+        char* first = workspace.allocate<char>(1);
+        double* second = workspace.allocate<double>(3);
+
+        CHECK(isAligned(first, xvigra::WORKSPACE_ALIGNMENT));
+        CHECK(isAligned(second, xvigra::WORKSPACE_ALIGNMENT));
+        CHECK_EQ(reinterpret_cast<char*>(second) - first, xvigra::WORKSPACE_ALIGNMENT);
+        CHECK_EQ(workspace.getUsedBytes(), 2 * xvigra::WORKSPACE_ALIGNMENT);
+    }
+
+    SUBCASE("Scope") {
+        float* outer = nullptr;
+        float* firstInner = nullptr;
+        float* secondInner = nullptr;
+
+        {
+            xvigra::Workspace::Scope outerScope(workspace);
+            outer = workspace.allocate<float>(16);
+
+            {
+                xvigra::Workspace::Scope innerScope(workspace);
+                firstInner = workspace.allocate<float>(16);
+            }
+
+            CHECK_EQ(workspace.getUsedBytes(), 64);
+
+            {
+                xvigra::Workspace::Scope innerScope(workspace);
+                secondInner = workspace.allocate<float>(16);
+            }
+        }
+
+        CHECK_NE(outer, firstInner);
+        CHECK_EQ(firstInner, secondInner);
+        CHECK_EQ(workspace.getUsedBytes(), 0);
+        CHECK_EQ(workspace.getHighWaterMark(), 128);
+        CHECK_EQ(workspace.getSystemAllocations(), 1);
+    }
+}
+
+
+TEST_CASE("Workspace: Test growth") {
+    xvigra::Workspace workspace(256);
+
+    {
+        xvigra::Workspace::Scope scope(workspace);
+        std::byte* first = workspace.allocate<std::byte>(256);
+        std::byte* second = workspace.allocate<std::byte>(1024);
+
+        // the first allocation stays valid while the second one is served by a new block
+        CHECK_NE(first, second);
+        CHECK_EQ(workspace.getSystemAllocations(), 2);
+        CHECK_EQ(workspace.getCapacity(), 256 + 1024);
+    }
+
+    CHECK_EQ(workspace.getHighWaterMark(), 256 + 1024);
+
+    SUBCASE("Merge") {
+        for (int i = 0; i < 3; ++i) {
+            xvigra::Workspace::Scope scope(workspace);
+            workspace.allocate<std::byte>(256);
+            workspace.allocate<std::byte>(1024);
+        }
+
+        CHECK_EQ(workspace.getSystemAllocations(), 3);
+        CHECK_EQ(workspace.getCapacity(), 256 + 1024);
+        CHECK_EQ(workspace.getHighWaterMark(), 256 + 1024);
+    }
+
+    SUBCASE("Reset Statistics") {
+        workspace.resetStatistics();
+
+        CHECK_EQ(workspace.getHighWaterMark(), 0);
+        CHECK_EQ(workspace.getSystemAllocations(), 0);
+
+        {
+            xvigra::Workspace::Scope scope(workspace);
+            workspace.allocate<std::byte>(100);
+        }
+
+        CHECK_EQ(workspace.getHighWaterMark(), 128);
+    }
+
+    SUBCASE("Release") {
+        workspace.release();
+
+        CHECK_EQ(workspace.getCapacity(), 0);
+
+        {
+            xvigra::Workspace::Scope scope(workspace);
+            workspace.allocate<std::byte>(100);
+        }
+
+        CHECK_EQ(workspace.getCapacity(), 128);
+    }
+}
+
+
+TEST_CASE("Workspace: Test in use") {
+    xvigra::Workspace workspace;
+    xvigra::Workspace::Scope scope(workspace);
+    workspace.allocate<int>(4);
+
+    CHECK_THROWS_WITH_AS(
+        workspace.reserve(4096),
+        "Workspace::reserve(): Workspace can't be reserved while it is in use!",
+        std::logic_error
+    );
+    CHECK_THROWS_WITH_AS(
+        workspace.release(),
+        "Workspace::release(): Workspace can't be released while it is in use!",
+        std::logic_error
+    );
+}
+
+
+TEST_CASE("Workspace: Test huge pages") {
+    xvigra::Workspace workspace(1000, true);
+
+    CHECK(workspace.isHugePageBacked());
+    CHECK_EQ(workspace.getCapacity(), xvigra::WORKSPACE_HUGE_PAGE_SIZE);
+
+    xvigra::Workspace::Scope scope(workspace);
+    float* data = workspace.allocate<float>(1000);
+
+    CHECK(isAligned(data, xvigra::WORKSPACE_HUGE_PAGE_SIZE));
+
+    for (int i = 0; i < 1000; ++i) {
+        data[i] = static_cast<float>(i);
+    }
+
+    CHECK_EQ(data[999], 999.0f);
+}
+
+
+TEST_CASE("Workspace: Test threadLocalWorkspace") {
+    xvigra::Workspace* mainWorkspace = &xvigra::threadLocalWorkspace();
+    xvigra::Workspace* otherWorkspace = nullptr;
+    xvigra::Workspace explicitWorkspace;
+
+    std::thread thread([&otherWorkspace]() {
+        otherWorkspace = &xvigra::threadLocalWorkspace();
+    });
+    thread.join();
+
+    CHECK_EQ(&xvigra::threadLocalWorkspace(), mainWorkspace);
+    CHECK_NE(otherWorkspace, mainWorkspace);
+    CHECK_EQ(&xvigra::resolveWorkspace(nullptr), mainWorkspace);
+    CHECK_EQ(&xvigra::resolveWorkspace(&explicitWorkspace), &explicitWorkspace);
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test Workspace - end                                                                                             ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test convolution workspace - begin                                                                               ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝
+
+TEST_CASE_TEMPLATE("Workspace: Test convolve1D", T, TYPE_PAIRS) {
+    using InputType = typename T::first_type;
+    using KernelType = typename T::second_type;
+
+    xt::xtensor<InputType, 2> input = xt::empty<InputType>({40, 3});
+    xt::xtensor<KernelType, 3> kernel = xt::empty<KernelType>({4, 3, 5});
+    fillWithPattern(input, 11);
+    fillWithPattern(kernel, 5, 0.25, -0.5);
+
+    xvigra::KernelOptions options(2);
+    options.setBorderTreatment(xvigra::BorderTreatment::asymmetricReflect());
+    auto expected = xvigra::convolve1D(input, kernel, options);
+
+    xvigra::Workspace workspace;
+    options.setWorkspace(&workspace);
+
+    for (int run = 0; run < 3; ++run) {
+        auto result = xvigra::convolve1D(input, kernel, options);
+        CHECK(result == expected);
+    }
+
+    CHECK_EQ(workspace.getUsedBytes(), 0);
+    // the patch, the product and the kernel matrix share one allocation
+    CHECK_EQ(workspace.getHighWaterMark(), alignedBytes((40 * 3 * 5 + 40 * 4 + 4 * 3 * 5) * sizeof(KernelType)));
+    CHECK_EQ(workspace.getSystemAllocations(), 1);
+}
+
+
+TEST_CASE_TEMPLATE("Workspace: Test convolve2D", T, TYPE_PAIRS) {
+    using InputType = typename T::first_type;
+    using KernelType = typename T::second_type;
+
+    xt::xtensor<InputType, 3> input = xt::empty<InputType>({2, 12, 10});
+    xt::xtensor<KernelType, 4> kernel = xt::empty<KernelType>({3, 2, 3, 3});
+    fillWithPattern(input, 13);
+    fillWithPattern(kernel, 7, 0.5, -1.0);
+
+    xvigra::KernelOptions2D options;
+    options.setPadding(1);
+    options.setChannelPosition(xvigra::ChannelPosition::FIRST);
+    options.setBorderTreatment(xvigra::BorderTreatment::repeat());
+    auto expected = xvigra::convolve2D(input, kernel, options);
+
+    xvigra::Workspace workspace;
+    options.setWorkspace(&workspace);
+
+    SUBCASE("Single Tile") {
+        for (int run = 0; run < 3; ++run) {
+            auto result = xvigra::convolve2D(input, kernel, options);
+            CHECK(result == expected);
+        }
+
+        CHECK_EQ(workspace.getUsedBytes(), 0);
+        CHECK_EQ(workspace.getHighWaterMark(), alignedBytes((2 * 3 * 3 * 12 * 10 + 3 * 12 * 10 + 3 * 2 * 3 * 3) * sizeof(KernelType)));
+        CHECK_EQ(workspace.getSystemAllocations(), 1);
+    }
+
+    SUBCASE("Tiled") {
+        options.setWorkspaceLimit(2 * 3 * 3 * 10 * sizeof(KernelType) * 5);
+
+        for (int run = 0; run < 3; ++run) {
+            auto result = xvigra::convolve2D(input, kernel, options);
+            CHECK(result == expected);
+        }
+
+        CHECK_EQ(workspace.getHighWaterMark(), alignedBytes((2 * 3 * 3 * 5 * 10 + 3 * 5 * 10 + 3 * 2 * 3 * 3) * sizeof(KernelType)));
+        CHECK_EQ(workspace.getSystemAllocations(), 1);
+    }
+}
+
+
+TEST_CASE_TEMPLATE("Workspace: Test separableConvolve2D", T, TYPE_PAIRS) {
+    using InputType = typename T::first_type;
+    using KernelType = typename T::second_type;
+
+    xt::xtensor<InputType, 3> input = xt::empty<InputType>({9, 11, 2});
+    xt::xtensor<KernelType, 1> kernel{0.25, 0.5, 0.25};
+    fillWithPattern(input, 17);
+
+    std::array<xvigra::KernelOptions, 2> options{xvigra::KernelOptions(1), xvigra::KernelOptions(1)};
+    auto expected = xvigra::separableConvolve2D(input, std::array{kernel, kernel}, options);
+
+    xvigra::Workspace workspace;
+    options[0].setWorkspace(&workspace);
+    options[1].setWorkspace(&workspace);
+
+    auto result = xvigra::separableConvolve2D(input, std::array{kernel, kernel}, options);
+
+    // the rows along x need a larger patch than the rows along y, so the workspace grows once
+    CHECK(result == expected);
+    CHECK_EQ(workspace.getUsedBytes(), 0);
+    CHECK_EQ(workspace.getHighWaterMark(), alignedBytes(11 * 2 * 3 * sizeof(KernelType)));
+    CHECK_EQ(workspace.getSystemAllocations(), 2);
+    CHECK_EQ(workspace.getCapacity(), alignedBytes(11 * 2 * 3 * sizeof(KernelType)));
+}
+
+// ╔══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╗
+// ║ Test convolution workspace - end                                                                                 ║
+// ╚══════════════════════════════════════════════════════════════════════════════════════════════════════════════════╝